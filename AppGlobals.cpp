@@ -29,6 +29,12 @@ bool setting_enable_books = false;
 int setting_books_led_start = 300;
 int setting_cds_led_start = 0;
 
+int setting_disp_mode = 0; // Direct mode (tear-free), the compiled-in default
+int setting_disp_buf_num = 2;
+int setting_disp_buf_lines = 20;
+bool setting_disp_buf_psram = false;
+int setting_disp_bounce_lines = 10;
+
 int led_count = 800;
 String led_type_str = "WS2812B";
 bool led_master_on = true;
@@ -55,8 +61,6 @@ bool filter_favorites_only = false;
 unsigned long previewModeUntil = 0;
 
 std::vector<int> search_matches;
-int search_display_offset = 0;
-const int SEARCH_PAGE_SIZE = 20;
 
 CD currentEditCD;
 Book currentEditBook;
@@ -153,6 +157,13 @@ void loadSettings() {
   setting_theme_cd = preferences.getUInt("theme_cd", 0x00ff88);
   setting_theme_book = preferences.getUInt("theme_book", 0xffaa00);
 
+  // Load Display Buffering
+  setting_disp_mode = preferences.getInt("disp_mode", 0);
+  setting_disp_buf_num = preferences.getInt("disp_nbuf", 2);
+  setting_disp_buf_lines = preferences.getInt("disp_lines", 20);
+  setting_disp_buf_psram = preferences.getBool("disp_psram", false);
+  setting_disp_bounce_lines = preferences.getInt("disp_bounce", 10);
+
   // Load Cache Size
   setting_cache_size =
       preferences.getInt("cache_size", 5); // Default 5 items per side
@@ -205,6 +216,13 @@ void saveSettings() {
   preferences.putUInt("theme_cd", setting_theme_cd);
   preferences.putUInt("theme_book", setting_theme_book);
 
+  // Save Display Buffering
+  preferences.putInt("disp_mode", setting_disp_mode);
+  preferences.putInt("disp_nbuf", setting_disp_buf_num);
+  preferences.putInt("disp_lines", setting_disp_buf_lines);
+  preferences.putBool("disp_psram", setting_disp_buf_psram);
+  preferences.putInt("disp_bounce", setting_disp_bounce_lines);
+
   // Save Cache Size
   preferences.putInt("cache_size", setting_cache_size);
 
@@ -13,6 +13,12 @@
 #define LED_PIN 6
 #define COLOR_ORDER GRB
 
+// On-device benchmarks (/api/debug/bench/*): off in release builds. Define
+// as 1 here or with -DDEBUG_BENCHES=1 to compile them in.
+#ifndef DEBUG_BENCHES
+#define DEBUG_BENCHES 0
+#endif
+
 extern const char *DEFAULT_SSID;
 extern const char *DEFAULT_PASSWORD;
 extern const char *DISCOGS_TOKEN;
@@ -24,6 +30,7 @@ extern CRGB *leds;
 
 extern SemaphoreHandle_t libraryMutex;
 extern SemaphoreHandle_t i2cMutex;
+extern SemaphoreHandle_t jpegMutex; // The one TJpgDec instance; take it last
 
 extern MediaMode currentMode;
 extern int currentCDIndex;
@@ -48,6 +55,13 @@ extern bool setting_enable_books;
 extern int setting_books_led_start;
 extern int setting_cds_led_start;
 
+// Display buffering (applied at boot, see lvgl_port_config_t)
+extern int setting_disp_mode;
+extern int setting_disp_buf_num;
+extern int setting_disp_buf_lines;
+extern bool setting_disp_buf_psram;
+extern int setting_disp_bounce_lines;
+
 // --- LED State ---
 extern int led_count;
 extern String led_type_str;
@@ -75,8 +89,6 @@ extern unsigned long previewModeUntil;
 
 // --- Search State ---
 extern std::vector<int> search_matches;
-extern int search_display_offset;
-extern const int SEARCH_PAGE_SIZE;
 
 // --- Media State ---
 extern CD currentEditCD;
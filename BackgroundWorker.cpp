@@ -1,326 +1,1082 @@
 #include <Arduino.h>
 #include <ESP_IOExpander_Library.h>
 #include <SD.h>
+#include <algorithm>
+#include <atomic>
+#include <esp_heap_caps.h>
 #include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 #include <freertos/semphr.h>
 #include <queue>
+#include <unordered_set>
 
 #include "AppGlobals.h"
 #include "BackgroundWorker.h"
+#include "CoverStore.h"
+#include "EventBus.h"
 #include "ErrorHandler.h"
+#include "HttpPool.h"
+#include "LockProfiler.h"
 #include "MediaManager.h"
 #include "NetworkManager.h"
 #include "Storage.h"
+#include "TraceRecorder.h"
 #include "Utils.h"
+#include "Waveshare_ST7262_LVGL.h"
 #include "mode_abstraction.h"
 #include "waveshare_sd_card.h"
 
 // Static members
-std::queue<BackgroundJob> BackgroundWorker::_jobQueue;
+std::deque<BackgroundWorker::QueuedJob>
+    BackgroundWorker::_queues[JOB_CLASS_COUNT][JOB_PRIO_COUNT];
+std::vector<JobHandle> BackgroundWorker::_running;
+std::deque<JobHandle> BackgroundWorker::_finished;
+std::deque<JobHandle> BackgroundWorker::_results;
 SemaphoreHandle_t BackgroundWorker::_queueMutex = NULL;
-bool BackgroundWorker::_busy = false;
+BackgroundWorker::Worker BackgroundWorker::_workers[BG_MAX_WORKERS];
+int BackgroundWorker::_workerCount = 0;
+JobClassStats BackgroundWorker::_classStats[JOB_CLASS_COUNT] = {};
+uint32_t BackgroundWorker::_startedAt = 0;
+uint32_t BackgroundWorker::_nextId = 1;
 String BackgroundWorker::_statusMsg = "Idle";
 float BackgroundWorker::_progress = 0.0f;
-int BackgroundWorker::_totalJobs = 0;
+
+// Network waits sit next to the WiFi stack on core 0; decoding and SD work
+// gets core 1 (shared with LVGL) at the same low priority as before.
+// 32KB stacks for heavy network/JSON operations.
+static const WorkerConfig defaultPool[] = {
+    {"BG_IO0", 32768, 0, JOB_CLASS_IO},
+    {"BG_IO1", 24576, 0, JOB_CLASS_IO},
+    {"BG_CPU", 32768, 1, JOB_CLASS_CPU},
+};
 
 void BackgroundWorker::begin() {
+  begin(defaultPool, sizeof(defaultPool) / sizeof(defaultPool[0]));
+}
+
+void BackgroundWorker::begin(const WorkerConfig *workers, int count) {
   if (_queueMutex == NULL) {
     _queueMutex = xSemaphoreCreateMutex();
   }
-  // Background task on Core 1 (Same as UI/Main Loop) to avoid Core 0
-  // System/WiFi contention Increase stack to 32KB for heavy network/JSON
-  // operations
-  xTaskCreatePinnedToCore(workerTask, "BG_Worker", 32768, NULL, 1, NULL, 1);
+  if (_workerCount > 0)
+    return; // Already running
+  if (count > BG_MAX_WORKERS)
+    count = BG_MAX_WORKERS;
+
+  _startedAt = millis();
+  for (int i = 0; i < count; i++) {
+    Worker &w = _workers[_workerCount];
+    w.cfg = workers[i];
+    if (xTaskCreatePinnedToCore(workerTask, w.cfg.name, w.cfg.stackSize,
+                                (void *)(intptr_t)_workerCount, 1, &w.task,
+                                w.cfg.core) == pdPASS) {
+      _workerCount++;
+    } else {
+      ErrorHandler::logError(ERR_CAT_MEMORY,
+                             String("Worker start failed: ") + w.cfg.name,
+                             "BackgroundWorker::begin");
+    }
+  }
+  Serial.printf("BG_Worker: %d workers started\n", _workerCount);
 }
 
-void BackgroundWorker::addJob(BackgroundJob job) {
-  if (xSemaphoreTake(_queueMutex, pdMS_TO_TICKS(100))) {
-    _jobQueue.push(job);
-    xSemaphoreGive(_queueMutex);
+JobClass BackgroundWorker::defaultClass(JobType type) {
+  // The bulk sync's own work is ingesting (decode/resize) and SD writes; its
+  // network stages run in separate tasks.
+  return type == JOB_BULK_SYNC ? JOB_CLASS_CPU : JOB_CLASS_IO;
+}
+
+JobPriority BackgroundWorker::defaultPriority(JobType type) {
+  switch (type) {
+  case JOB_METADATA_LOOKUP:
+  case JOB_LOOKUP_ADD:
+  case JOB_LOOKUP_BATCH:
+    return JOB_PRIO_INTERACTIVE;
+  case JOB_LYRICS_FETCH_ALL:
+    return JOB_PRIO_CRAWL;
+  default:
+    return JOB_PRIO_COVER;
   }
 }
 
-bool BackgroundWorker::isBusy() { return _busy; }
-int BackgroundWorker::getQueueSize() { return (int)_jobQueue.size(); }
-String BackgroundWorker::getStatusMessage() { return _statusMsg; }
+// Trace span names (static: the trace ring keeps the pointer)
+static const char *jobTraceName(JobType type) {
+  switch (type) {
+  case JOB_METADATA_LOOKUP:
+    return "job.metadata_lookup";
+  case JOB_COVER_DOWNLOAD:
+    return "job.cover_download";
+  case JOB_BULK_SYNC:
+    return "job.bulk_sync";
+  case JOB_LYRICS_FETCH_ALL:
+    return "job.lyrics_fetch_all";
+  case JOB_LOOKUP_ADD:
+    return "job.lookup_add";
+  case JOB_LOOKUP_BATCH:
+    return "job.lookup_batch";
+  default:
+    return "job";
+  }
+}
+
+uint32_t BackgroundWorker::addJob(const BackgroundJob &job) {
+  return addJob(job, defaultPriority(job.type));
+}
+
+uint32_t BackgroundWorker::addJob(const BackgroundJob &job,
+                                  JobPriority priority) {
+  if (_queueMutex == NULL)
+    return 0;
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+
+  // Coalesce with an identical job that hasn't started yet
+  JobClass cls = defaultClass(job.type);
+  for (int p = 0; p < JOB_PRIO_COUNT; p++) {
+    std::deque<QueuedJob> &queue = _queues[cls][p];
+    for (auto it = queue.begin(); it != queue.end(); ++it) {
+      BackgroundJob &q = it->job;
+      if (q.type != job.type || q.id != job.id || q.extraData != job.extraData)
+        continue;
+
+      if (job.onComplete) {
+        auto first = q.onComplete;
+        auto second = job.onComplete;
+        q.onComplete = [first, second](bool success, String message) {
+          if (first)
+            first(success, message);
+          second(success, message);
+        };
+      }
+      uint32_t id = it->ctl->id;
+      if (priority < p) {
+        QueuedJob moved = *it;
+        queue.erase(it);
+        moved.ctl->priority = priority;
+        _queues[cls][priority].push_back(moved);
+      }
+      xSemaphoreGive(_queueMutex);
+      Serial.printf("BG_Worker: job %lu coalesced\n", (unsigned long)id);
+      return id;
+    }
+  }
+
+  QueuedJob q;
+  q.job = job;
+  q.ctl = std::make_shared<JobControl>();
+  q.ctl->id = _nextId++;
+  q.ctl->type = job.type;
+  q.ctl->priority = priority;
+  q.ctl->jobClass = cls;
+  q.ctl->queuedAt = millis();
+  q.ctl->status = "Queued";
+  uint32_t id = q.ctl->id;
+  _queues[cls][priority].push_back(q);
+
+  // Wake an idle worker, preferring one whose home is this class
+  int wake = -1;
+  for (int i = 0; i < _workerCount; i++) {
+    if (_workers[i].busy)
+      continue;
+    if (wake < 0 || _workers[i].cfg.home == cls)
+      wake = i;
+    if (_workers[i].cfg.home == cls)
+      break;
+  }
+  xSemaphoreGive(_queueMutex);
+  EventBus::notify(EVENT_JOBS);
+
+  if (wake >= 0)
+    xTaskNotifyGive(_workers[wake].task);
+  return id;
+}
+
+bool BackgroundWorker::cancel(uint32_t jobId) {
+  if (_queueMutex == NULL)
+    return false;
+
+  QueuedJob dropped;
+  bool found = false;
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  for (auto &c : _running) {
+    if (c->id == jobId) {
+      c->cancelled = true;
+      xSemaphoreGive(_queueMutex);
+      return true;
+    }
+  }
+  for (int c = 0; c < JOB_CLASS_COUNT && !found; c++) {
+    for (int p = 0; p < JOB_PRIO_COUNT && !found; p++) {
+      std::deque<QueuedJob> &queue = _queues[c][p];
+      for (auto it = queue.begin(); it != queue.end(); ++it) {
+        if (it->ctl->id == jobId) {
+          dropped = *it;
+          queue.erase(it);
+          found = true;
+          break;
+        }
+      }
+    }
+  }
+  if (found) {
+    dropped.ctl->cancelled = true;
+    dropped.ctl->state = JOB_CANCELLED;
+    dropped.ctl->result = "Cancelled";
+    retire(dropped.ctl);
+  }
+  xSemaphoreGive(_queueMutex);
+  if (found)
+    EventBus::notify(EVENT_JOBS);
+
+  if (found && dropped.job.onComplete)
+    dropped.job.onComplete(false, "Cancelled");
+  return found;
+}
+
+JobInfo BackgroundWorker::snapshot(const JobControl &c) {
+  JobInfo info;
+  info.id = c.id;
+  info.type = c.type;
+  info.priority = c.priority;
+  info.jobClass = c.jobClass;
+  info.worker = c.worker;
+  info.state = (JobState)c.state.load();
+  info.progress = c.progress;
+  info.status = c.status;
+  info.result = c.result;
+  return info;
+}
+
+bool BackgroundWorker::getJob(uint32_t jobId, JobInfo &out) {
+  if (_queueMutex == NULL)
+    return false;
+  bool found = false;
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  for (auto &c : _running) {
+    if (!found && c->id == jobId) {
+      out = snapshot(*c);
+      found = true;
+    }
+  }
+  for (int c = 0; c < JOB_CLASS_COUNT && !found; c++) {
+    for (int p = 0; p < JOB_PRIO_COUNT && !found; p++) {
+      for (auto &q : _queues[c][p]) {
+        if (!found && q.ctl->id == jobId) {
+          out = snapshot(*q.ctl);
+          found = true;
+        }
+      }
+    }
+  }
+  for (auto &c : _finished) {
+    if (!found && c->id == jobId) {
+      out = snapshot(*c);
+      found = true;
+    }
+  }
+  xSemaphoreGive(_queueMutex);
+  return found;
+}
+
+bool BackgroundWorker::collectJob(uint32_t jobId, JobInfo &out) {
+  if (_queueMutex == NULL)
+    return false;
+  bool found = getJob(jobId, out);
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  pruneResults(millis());
+  for (auto it = _results.begin(); it != _results.end(); ++it) {
+    if ((*it)->id != jobId)
+      continue;
+    // It may have finished since getJob(); hand out what is kept then
+    if (!found || out.state == JOB_QUEUED || out.state == JOB_RUNNING) {
+      out = snapshot(**it);
+      found = true;
+    }
+    _results.erase(it);
+    break;
+  }
+  xSemaphoreGive(_queueMutex);
+  return found;
+}
+
+bool BackgroundWorker::expired(uint32_t jobId) {
+  JobInfo info;
+  return jobId > 0 && jobId < _nextId && !getJob(jobId, info);
+}
+
+void BackgroundWorker::retire(const JobHandle &ctl) {
+  ctl->finishedAt = millis();
+  _finished.push_back(ctl);
+  if (_finished.size() > JOB_HISTORY)
+    _finished.pop_front();
+
+  if (ctl->type != JOB_LOOKUP_ADD)
+    return;
+  pruneResults(ctl->finishedAt);
+  if (_results.size() >= JOB_RESULT_MAX)
+    _results.pop_front();
+  _results.push_back(ctl);
+}
+
+// Oldest first: they are appended as they finish
+void BackgroundWorker::pruneResults(uint32_t now) {
+  while (!_results.empty() &&
+         now - _results.front()->finishedAt > JOB_RESULT_TTL_MS)
+    _results.pop_front();
+}
+
+std::vector<JobInfo> BackgroundWorker::getJobs() {
+  std::vector<JobInfo> jobs;
+  if (_queueMutex == NULL)
+    return jobs;
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  for (auto &c : _running)
+    jobs.push_back(snapshot(*c));
+  for (int p = 0; p < JOB_PRIO_COUNT; p++) {
+    for (int c = 0; c < JOB_CLASS_COUNT; c++) {
+      for (auto &q : _queues[c][p])
+        jobs.push_back(snapshot(*q.ctl));
+    }
+  }
+  for (auto it = _finished.rbegin(); it != _finished.rend(); ++it)
+    jobs.push_back(snapshot(**it));
+  xSemaphoreGive(_queueMutex);
+  return jobs;
+}
+
+bool BackgroundWorker::isBusy() {
+  for (int i = 0; i < _workerCount; i++) {
+    if (_workers[i].busy)
+      return true;
+  }
+  return false;
+}
+
+int BackgroundWorker::getQueueSize() {
+  if (_queueMutex == NULL)
+    return 0;
+  int n = 0;
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  for (int c = 0; c < JOB_CLASS_COUNT; c++) {
+    for (int p = 0; p < JOB_PRIO_COUNT; p++)
+      n += (int)_queues[c][p].size();
+  }
+  xSemaphoreGive(_queueMutex);
+  return n;
+}
+
+String BackgroundWorker::getStatusMessage() {
+  if (_queueMutex == NULL)
+    return _statusMsg;
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  String msg = _statusMsg;
+  xSemaphoreGive(_queueMutex);
+  return msg;
+}
+
 float BackgroundWorker::getProgress() { return _progress; }
 
+void BackgroundWorker::report(const JobHandle &ctl, float progress,
+                              const String &status) {
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  ctl->progress = progress;
+  ctl->status = status;
+  _progress = progress;
+  _statusMsg = status;
+  xSemaphoreGive(_queueMutex);
+  EventBus::notify(EVENT_JOBS);
+}
+
+void BackgroundWorker::report(const JobHandle &ctl, float progress) {
+  ctl->progress = progress;
+  _progress = progress;
+  EventBus::notify(EVENT_JOBS);
+}
+
+bool BackgroundWorker::stopRequested(const JobHandle &ctl) {
+  return is_sync_stopping || ctl->cancelled;
+}
+
+int BackgroundWorker::getWorkerCount() { return _workerCount; }
+
+WorkerStats BackgroundWorker::getWorkerStats(int worker) {
+  WorkerStats st = {};
+  if (worker < 0 || worker >= _workerCount)
+    return st;
+  Worker &w = _workers[worker];
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  st.name = w.cfg.name;
+  st.core = w.cfg.core;
+  st.home = w.cfg.home;
+  st.busy = w.busy;
+  st.jobs = w.jobs;
+  st.stolen = w.stolen;
+  st.busyMs = w.busyMs;
+  xSemaphoreGive(_queueMutex);
+  // Stack units are bytes on ESP32
+  st.stackFree = w.task ? uxTaskGetStackHighWaterMark(w.task) : 0;
+  return st;
+}
+
+JobClassStats BackgroundWorker::getClassStats(JobClass jobClass) {
+  JobClassStats st = {};
+  if (jobClass < 0 || jobClass >= JOB_CLASS_COUNT || !_queueMutex)
+    return st;
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  st = _classStats[jobClass];
+  xSemaphoreGive(_queueMutex);
+  return st;
+}
+
+uint32_t BackgroundWorker::getUptimeMs() { return millis() - _startedAt; }
+
+int BackgroundWorker::currentWorker() {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  for (int i = 0; i < _workerCount; i++) {
+    if (_workers[i].task == self)
+      return i;
+  }
+  return -1;
+}
+
+// Highest-priority queued job with priority < belowPriority, from the
+// worker's home class first, then stolen from the other class.
+bool BackgroundWorker::popNext(int worker, int belowPriority,
+                               QueuedJob &out) {
+  JobClass home = _workers[worker].cfg.home;
+  bool found = false;
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  for (int pass = 0; pass < JOB_CLASS_COUNT && !found; pass++) {
+    int c = (home + pass) % JOB_CLASS_COUNT;
+    for (int p = 0; p < belowPriority && p < JOB_PRIO_COUNT; p++) {
+      std::deque<QueuedJob> &queue = _queues[c][p];
+      auto it = queue.begin();
+      // One bulk sync at a time: it owns is_sync_stopping and the index
+      if (it != queue.end() && it->job.type == JOB_BULK_SYNC) {
+        for (auto &r : _running) {
+          if (r->type == JOB_BULK_SYNC)
+            it = queue.end();
+        }
+      }
+      if (it != queue.end()) {
+        out = *it;
+        queue.erase(it);
+        if (pass > 0)
+          _workers[worker].stolen++;
+        found = true;
+        break;
+      }
+    }
+  }
+  xSemaphoreGive(_queueMutex);
+  return found;
+}
+
+// Called by long jobs between items: a scan lookup shouldn't wait behind a
+// 2,000-item crawl. Runs on the calling worker only.
+void BackgroundWorker::yieldToHigherPriority(const JobHandle &current) {
+  int worker = currentWorker();
+  if (worker < 0)
+    return;
+  QueuedJob next;
+  while (popNext(worker, current->priority, next)) {
+    Serial.printf("BG_Worker: job %lu preempts job %lu\n",
+                  (unsigned long)next.ctl->id, (unsigned long)current->id);
+    execute(worker, next);
+  }
+}
+
 void BackgroundWorker::workerTask(void *pvParameters) {
+  int worker = (int)(intptr_t)pvParameters;
   while (true) {
-    BackgroundJob currentJob;
-    bool hasJob = false;
-
-    if (xSemaphoreTake(_queueMutex, pdMS_TO_TICKS(50))) {
-      if (!_jobQueue.empty()) {
-        currentJob = _jobQueue.front();
-        _jobQueue.pop();
-        hasJob = true;
-        _totalJobs = getItemCount(); // Current total
-        _busy = true;
+    QueuedJob next;
+    if (popNext(worker, JOB_PRIO_COUNT, next)) {
+      execute(worker, next);
+      continue;
+    }
+
+    if (worker == 0)
+      HttpPool::evictIdle(); // Close keep-alive sockets nobody is using
+    // Sleep until addJob() notifies us; wake now and then to age the pool
+    // and pick up work another worker's notification didn't cover
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(HTTP_POOL_IDLE_MS));
+  }
+}
+
+void BackgroundWorker::execute(int worker, QueuedJob &q) {
+  BackgroundJob &currentJob = q.job;
+  JobHandle ctl = q.ctl;
+  Worker &w = _workers[worker];
+
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  _running.push_back(ctl);
+  ctl->state = JOB_RUNNING;
+  ctl->worker = worker;
+  ctl->startedAt = millis();
+  bool nested = w.busy; // Preempting a job on this worker
+  w.busy = true;
+  JobClassStats &cs = _classStats[ctl->jobClass];
+  uint32_t waited = ctl->startedAt - ctl->queuedAt;
+  cs.totalWaitMs += waited;
+  if (waited > cs.maxWaitMs)
+    cs.maxWaitMs = waited;
+  xSemaphoreGive(_queueMutex);
+  EventBus::notify(EVENT_JOBS);
+
+  bool success = false;
+  String resultMsg = "";
+  TraceScope trace(jobTraceName(currentJob.type));
+
+  switch (currentJob.type) {
+  case JOB_METADATA_LOOKUP: {
+    report(ctl, 0.0f, "Looking up " + currentJob.id);
+    ItemView staged;
+    success =
+        MediaManager::fetchMetadataForBarcode(currentJob.id.c_str(), staged);
+    if (success) {
+      resultMsg = "Fetched: " + staged.title;
+    }
+  } break;
+
+  case JOB_LOOKUP_ADD: {
+    // resultMsg is the JSON the web scanner polls for
+    report(ctl, 0.0f, "Looking up " + currentJob.id);
+    StaticJsonDocument<384> doc;
+    doc["code"] = currentJob.id;
+    if (currentJob.index != (int)currentMode) {
+      doc["status"] = "error";
+      doc["error"] = "Mode changed";
+    } else {
+      ItemView out;
+      LookupAddResult res =
+          lookupAndAddItem(currentJob.id, out, currentJob.extraData == "force");
+      if (res == LOOKUP_DUPLICATE) {
+        // Scanned twice while the first lookup was still queued or running
+        doc["status"] = "duplicate";
+        doc["title"] = out.title;
+        doc["artist"] = out.artistOrAuthor;
+      } else if (res == LOOKUP_ADDED) {
+        lvgl_port_lock(-1);
+        update_item_display();
+        lvgl_port_unlock();
+
+        doc["status"] = "added";
+        doc["title"] = out.title;
+        doc["artist"] = out.artistOrAuthor;
+        doc["year"] = out.year;
+        doc["genre"] = out.genre;
+        success = true;
       } else {
-        _busy = false;
+        doc["status"] = "notfound";
       }
-      xSemaphoreGive(_queueMutex);
     }
+    serializeJson(doc, resultMsg);
+  } break;
 
-    if (hasJob) {
-      bool success = false;
-      String resultMsg = "";
-
-      switch (currentJob.type) {
-      case JOB_METADATA_LOOKUP: {
-        _statusMsg = "Looking up " + currentJob.id;
-        ItemView staged;
-        success = MediaManager::fetchMetadataForBarcode(currentJob.id.c_str(),
-                                                        staged);
-        if (success) {
-          resultMsg = "Fetched: " + staged.title;
-        }
-      } break;
+  case JOB_LOOKUP_BATCH: {
+    // Stashes the results for the JOB_LOOKUP_ADD jobs queued behind it
+    std::vector<String> codes;
+    int start = 0;
+    while (start < (int)currentJob.id.length()) {
+      int comma = currentJob.id.indexOf(',', start);
+      if (comma < 0)
+        comma = currentJob.id.length();
+      codes.push_back(currentJob.id.substring(start, comma));
+      start = comma + 1;
+    }
+    report(ctl, 0.0f, "Searching " + String(codes.size()) + " barcodes");
+    std::map<String, MBRelease> releases;
+    int found = MediaManager::fetchReleasesByBarcodes(codes, releases);
+    MediaManager::stashReleases(codes, releases);
+    resultMsg = "Matched " + String(found) + "/" + String(codes.size());
+    success = true;
+  } break;
+
+  case JOB_BULK_SYNC: {
+    success = runBulkSync(ctl);
+    report(ctl, 1.0f, success ? "Sync Complete" : "Sync Stopped");
+  } break;
 
-      case JOB_BULK_SYNC: {
-        is_sync_stopping = false;
-        int total = getItemCount();
-        int downloadedCount = 0;
+  case JOB_COVER_DOWNLOAD: {
+    report(ctl, 0.0f, "Downloading cover...");
+    String savePath = currentJob.extraData;
+    String url = currentJob.id;
 
-        for (int i = 0; i < total; i++) {
-          if (is_sync_stopping) {
-            Serial.println("BG_Worker: Sync stopping requested");
+    if (savePath.length() > 0 && url.length() > 0) {
+      if (AppNetworkManager::downloadCoverImage(url, savePath)) {
+        resultMsg = "Downloaded to " + savePath;
+        success = true;
+      } else {
+        ErrorHandler::logError(ERR_CAT_NETWORK,
+                               String("Cover download failed: ") + savePath,
+                               "BackgroundWorker::JOB_COVER_DOWNLOAD");
+        resultMsg = "Download Failed";
+        success = false;
+      }
+    } else {
+      resultMsg = "Invalid Params";
+      success = false;
+    }
+  } break;
+
+  case JOB_LYRICS_FETCH_ALL: {
+    String targetMbid = currentJob.id;
+    if (targetMbid.length() > 0) {
+      report(ctl, 0.0f, "Fetching lyrics for CD...");
+      TrackList *tl = Storage.loadTracklist(targetMbid.c_str());
+      if (tl) {
+        int trackCount = (int)tl->tracks.size();
+        int fetched = 0;
+        for (int i = 0; i < trackCount; i++) {
+          yieldToHigherPriority(ctl);
+          if (stopRequested(ctl))
             break;
-          }
+          report(ctl, (float)i / trackCount,
+                 "Lyrics: " + String(tl->tracks[i].title.c_str()));
 
-          _progress = (float)i / total;
-
-          // 1. Initial Data Fetch (Short Lock)
-          ItemView item;
-          if (libraryMutex) {
-            if (xSemaphoreTakeRecursive(libraryMutex, pdMS_TO_TICKS(5000)) ==
-                pdPASS) {
-              ensureItemDetailsLoaded(i);
-              item = getItemAtSD(i);
-
-              // Ensure ID exists while locked
-              if (item.isValid && item.uniqueID.length() == 0) {
-                String newID =
-                    (item.codecOrIsbn.length() > 0)
-                        ? item.codecOrIsbn
-                        : (String(millis()) + "_" + String(random(9999)));
-                setItemID(i, newID);
-                item.uniqueID = newID;
-              }
-              xSemaphoreGiveRecursive(libraryMutex);
-            } else {
-              continue;
-            }
+          // This will check cache first, then hit APIs if missing
+          LyricsResult res = fetchLyricsIfNeeded(targetMbid.c_str(), i, false);
+          if (res == LYRICS_FETCHED_NOW || res == LYRICS_ALREADY_CACHED) {
+            fetched++;
           }
-
-          if (!item.isValid)
-            continue;
-          _statusMsg = "Sync: " + item.title;
-
-          // 2. Hardware Check (I2C Lock only, NO Library Lock)
-          bool missing = true;
-          String savePath = "";
-          String foundFileName = "";
-          if (sdExpander && i2cMutex) {
-            if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(1000)) ==
-                pdPASS) {
-              sdExpander->digitalWrite(SD_CS, LOW);
-
-              if (item.coverFile.length() > 4 &&
-                  SD.exists("/covers/" + item.coverFile)) {
-                missing = false;
-              } else {
-                String prefix = getUidPrefix();
-                String safeID = sanitizeFilename(item.uniqueID);
-                savePath = "/covers/" + prefix + safeID + ".jpg";
-                if (SD.exists(savePath)) {
-                  missing = false;
-                  foundFileName = prefix + safeID + ".jpg";
-                }
-              }
-              sdExpander->digitalWrite(SD_CS, HIGH);
-              xSemaphoreGiveRecursive(i2cMutex);
-
-              // Move setter OUTSIDE i2c lock to prevent libraryMutex hierarchy
-              // violation
-              if (foundFileName.length() > 0) {
-                setItemCoverFile(i, foundFileName);
-
-                // PERSIST: If we found a missing path on disk, save it to the
-                // detail file!
-                if (libraryMutex &&
-                    xSemaphoreTakeRecursive(libraryMutex,
-                                            pdMS_TO_TICKS(1000)) == pdPASS) {
-                  switch (currentMode) {
-                  case MODE_CD:
-                    if (i < (int)cdLibrary.size())
-                      Storage.saveCD(cdLibrary[i], nullptr, true);
-                    break;
-                  case MODE_BOOK:
-                    if (i < (int)bookLibrary.size())
-                      Storage.saveBook(bookLibrary[i], nullptr, true);
-                    break;
-                  default:
-                    break;
-                  }
-                  xSemaphoreGiveRecursive(libraryMutex);
-                }
-              }
-            }
+        }
+        resultMsg = "Fetched " + String(fetched) + "/" + String(trackCount);
+        success = !stopRequested(ctl);
+        delete tl;
+      } else {
+        resultMsg = "Tracklist missing";
+        success = false;
+      }
+    } else {
+      // If no specific CD, fetch for ALL items in library that have MBID
+      report(ctl, 0.0f, "Lyrics: Full Scan");
+      int cdCount = (int)cdLibrary.size();
+      for (int i = 0; i < cdCount; i++) {
+        yieldToHigherPriority(ctl);
+        if (stopRequested(ctl))
+          break;
+        // Copy what the fetch needs; the lock is never held across network
+        // calls, and the library may change between tracks
+        String uid, mbid, title;
+        int tracks = 0;
+        if (libraryMutex)
+          LOCK_TAKE(libraryMutex, portMAX_DELAY);
+        bool inRange = i < (int)cdLibrary.size();
+        if (inRange) {
+          const CD &cd = cdLibrary[i];
+          uid = cd.uniqueID.c_str();
+          mbid = cd.releaseMbid.c_str();
+          title = cd.title.c_str();
+          tracks = std::min((int)cd.trackCount, 5);
+        }
+        if (libraryMutex)
+          LOCK_GIVE(libraryMutex);
+        if (!inRange)
+          break;
+        if (mbid.length() > 0) {
+          report(ctl, (float)i / cdCount, "Lyrics: " + title);
+          // Just fetch first 5 tracks in full scan to avoid API ban
+          for (int t = 0; t < tracks && !stopRequested(ctl); t++) {
+            // Stop if the CD was deleted or re-matched meanwhile
+            if (libraryMutex)
+              LOCK_TAKE(libraryMutex, portMAX_DELAY);
+            int pos = findItemByUniqueID(cdLibrary, uid.c_str());
+            bool current =
+                pos >= 0 && mbid == cdLibrary[pos].releaseMbid.c_str();
+            if (libraryMutex)
+              LOCK_GIVE(libraryMutex);
+            if (!current)
+              break;
+            fetchLyricsIfNeeded(mbid.c_str(), t, false);
           }
+        } else {
+          report(ctl, (float)i / cdCount);
+        }
+      }
+      resultMsg = "Scan complete";
+      success = !stopRequested(ctl);
+    }
+  } break;
 
-          Serial.printf(
-              "[SYNC] Item %d: '%s' | CoverFile: '%s' | Missing: %s\n", i,
-              item.title.c_str(), item.coverFile.c_str(),
-              missing ? "YES" : "NO");
-
-          // 3. Network & Persistence (NO Library Lock held during HTTP)
-          if (missing) {
-            String downloadUrl = item.coverUrl;
-            Serial.printf("[SYNC] CoverUrl in DB: '%s' (length: %d)\n",
-                          downloadUrl.c_str(), downloadUrl.length());
-
-            // Always re-fetch if we're missing the file, even if we have a URL
-            // This ensures we get fresh Google Books URLs instead of stale Open
-            // Library ones
-            Serial.printf(
-                "[SYNC] Cover file missing, re-fetching URL for item %d...\n",
-                i);
-            downloadUrl = fetchCoverUrlForIndex(i); // Internal locking
-            if (downloadUrl.length() > 0) {
-              setItemCoverUrl(i, downloadUrl);
-            } else {
-              Serial.printf("[SYNC] Failed to fetch cover URL\n");
-            }
-
-            if (downloadUrl.length() > 0) {
-              if (AppNetworkManager::downloadCoverImage(downloadUrl,
-                                                        savePath)) {
-                downloadedCount++;
-                String prefix = getUidPrefix();
-                String fileName =
-                    prefix + sanitizeFilename(item.uniqueID) + ".jpg";
-                setItemCoverFile(i, fileName);
-
-                // Save to storage (Requires short lock for vector access)
-                if (libraryMutex &&
-                    xSemaphoreTakeRecursive(libraryMutex,
-                                            pdMS_TO_TICKS(5000)) == pdPASS) {
-                  switch (currentMode) {
-                  case MODE_CD:
-                    if (i < (int)cdLibrary.size())
-                      Storage.saveCD(cdLibrary[i], nullptr, true); // Batch save
-                    break;
-                  case MODE_BOOK:
-                    if (i < (int)bookLibrary.size())
-                      Storage.saveBook(bookLibrary[i], nullptr,
-                                       true); // Batch save
-                    break;
-                  default:
-                    break;
-                  }
-                  xSemaphoreGiveRecursive(libraryMutex);
-                }
-              }
-            }
-          }
+  default:
+    break;
+  }
+
+  xSemaphoreTake(_queueMutex, portMAX_DELAY);
+  ctl->progress = 1.0f;
+  ctl->result = resultMsg;
+  ctl->state = ctl->cancelled ? JOB_CANCELLED
+                              : (success ? JOB_DONE : JOB_FAILED);
+  ctl->worker = -1;
+  uint32_t ran = millis() - ctl->startedAt;
+  cs.jobs++;
+  cs.totalRunMs += ran;
+  w.jobs++;
+  if (!nested) {
+    w.busyMs += ran; // The outer job's time already covers nested ones
+    w.busy = false;
+  }
+  _running.erase(std::find(_running.begin(), _running.end(), ctl));
+  retire(ctl);
+  xSemaphoreGive(_queueMutex);
+  EventBus::notify(EVENT_JOBS);
+
+  if (currentJob.onComplete) {
+    currentJob.onComplete(success, resultMsg);
+  }
+}
+
+// ==========================================
+// BULK COVER SYNC PIPELINE
+// ==========================================
+//
+// scan (task)     walks the library, drops items whose cover file exists
+// resolve (task)  finds the cover URL (store lookup or metadata API)
+// download (task) fetches the image into PSRAM
+// store (caller)  ingests into CoverStore and saves the item
+//
+// Every item that leaves the scan reaches the store stage (failed ones with
+// no file name) so progress is counted in one place. A nullptr marks the end
+// of the stream; each stage forwards it after its last item and exits. Once
+// is_sync_stopping is set (or the job is cancelled), stages pass items through
+// without working on them.
+
+struct SyncItem {
+  String uniqueID; // Positions shift while the sync runs; resolved per use
+  String title;
+  String coverUrl;
+  String fileName; // Cover file once known
+  uint8_t *data = nullptr;
+  size_t len = 0;
+};
+
+struct PsramStringHash {
+  size_t operator()(const PsramString &s) const {
+    uint32_t h = 2166136261u; // FNV-1a
+    for (char c : s) {
+      h ^= (uint8_t)c;
+      h *= 16777619u;
+    }
+    return h;
+  }
+};
 
-          delay(10); // Yield to other operations
+typedef std::unordered_set<PsramString, PsramStringHash,
+                           std::equal_to<PsramString>,
+                           PsramAllocator<PsramString>>
+    CoverNameSet;
+
+struct SyncPipeline {
+  JobControl *job;
+  QueueHandle_t toResolve;
+  QueueHandle_t toDownload;
+  QueueHandle_t toStore;
+  CoverNameSet onDisk; // Read by the scan stage only
+  int total;
+  std::atomic<int> scanned;
+  std::atomic<int> forwarded;
+};
+
+// One directory listing instead of an SD.exists() per item
+static void listCoverFiles(CoverNameSet &out) {
+  if (!i2cMutex || LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(5000)) != pdPASS)
+    return;
+  if (sdExpander)
+    sdExpander->digitalWrite(SD_CS, LOW);
+
+  File dir = SD.open("/covers");
+  if (dir && dir.isDirectory()) {
+    File file = dir.openNextFile();
+    while (file) {
+      if (!file.isDirectory()) {
+        String name = String(file.name());
+        int slash = name.lastIndexOf('/');
+        if (slash >= 0)
+          name = name.substring(slash + 1);
+        out.insert(name.c_str());
+      }
+      file = dir.openNextFile();
+    }
+  }
+  if (dir)
+    dir.close();
+
+  if (sdExpander)
+    sdExpander->digitalWrite(SD_CS, HIGH);
+  LOCK_GIVE(i2cMutex);
+}
+
+// Persists item i's detail file (batch save; index rewritten at the end)
+static void saveItemDetail(int i) {
+  if (!libraryMutex || LOCK_TAKE(libraryMutex, pdMS_TO_TICKS(5000)) != pdPASS)
+    return;
+  switch (currentMode) {
+  case MODE_CD:
+    if (i < (int)cdLibrary.size())
+      Storage.saveCD(cdLibrary[i], nullptr, true);
+    break;
+  case MODE_BOOK:
+    if (i < (int)bookLibrary.size())
+      Storage.saveBook(bookLibrary[i], nullptr, true);
+    break;
+  default:
+    break;
+  }
+  LOCK_GIVE(libraryMutex);
+}
+
+// Current position of the item, or -1 if it was deleted (or the mode changed)
+// since the scan. Call with libraryMutex held and use the result before
+// giving it back.
+static int resolveSyncItem(const SyncItem *work) {
+  int i = findItemIndex(work->uniqueID);
+  if (i < 0 || getItemAtRAM(i).uniqueID != work->uniqueID)
+    return -1;
+  return i;
+}
+
+static bool syncStopping(const SyncPipeline *p) {
+  return is_sync_stopping || p->job->cancelled;
+}
+
+static void syncScanTask(void *param) {
+  SyncPipeline *p = (SyncPipeline *)param;
+
+  for (int i = 0; i < p->total && !syncStopping(p); i++) {
+    // 1. Initial Data Fetch (Short Lock)
+    ItemView item;
+    if (libraryMutex &&
+        LOCK_TAKE(libraryMutex, pdMS_TO_TICKS(5000)) == pdPASS) {
+      ensureItemDetailsLoaded(i);
+      item = getItemAtSD(i);
+
+      // Ensure ID exists while locked
+      if (item.isValid && item.uniqueID.length() == 0) {
+        String newID = (item.codecOrIsbn.length() > 0)
+                           ? item.codecOrIsbn
+                           : (String(millis()) + "_" + String(random(9999)));
+        setItemID(i, newID);
+        item.uniqueID = newID;
+      }
+      LOCK_GIVE(libraryMutex);
+    }
+
+    p->scanned++;
+    if (!item.isValid)
+      continue;
+
+    // 2. Existence check against the directory listing
+    if (item.coverFile.length() > 4 &&
+        p->onDisk.count(item.coverFile.c_str()) > 0)
+      continue;
+
+    String legacyName =
+        getUidPrefix() + sanitizeFilename(item.uniqueID) + ".jpg";
+    if (p->onDisk.count(legacyName.c_str()) > 0) {
+      // PERSIST: the file was on disk but the item didn't point at it
+      setItemCoverFile(i, legacyName);
+      saveItemDetail(i);
+      continue;
+    }
+
+    Serial.printf("[SYNC] Item %d: '%s' | CoverFile: '%s' | Missing\n", i,
+                  item.title.c_str(), item.coverFile.c_str());
+
+    SyncItem *work = new SyncItem();
+    work->uniqueID = item.uniqueID;
+    work->title = item.title;
+    work->coverUrl = item.coverUrl;
+    p->forwarded++;
+    xQueueSend(p->toResolve, &work, portMAX_DELAY);
+  }
+
+  SyncItem *end = nullptr;
+  xQueueSend(p->toResolve, &end, portMAX_DELAY);
+  vTaskDelete(NULL);
+}
+
+static void syncResolveTask(void *param) {
+  SyncPipeline *p = (SyncPipeline *)param;
+  SyncItem *work;
+
+  while (xQueueReceive(p->toResolve, &work, portMAX_DELAY) == pdTRUE &&
+         work) {
+    if (!syncStopping(p)) {
+      // If this URL was already ingested (e.g. shared box-set art), the
+      // stored hash is reused without resolving or downloading again.
+      work->fileName = CoverStore::findByUrl(work->coverUrl);
+      if (work->fileName.length() > 0) {
+        Serial.printf("[SYNC] Reusing stored cover %s\n",
+                      work->fileName.c_str());
+      } else {
+        // Re-fetch the URL when the file is missing, even if we have one.
+        // This ensures we get fresh Google Books URLs instead of stale Open
+        // Library ones
+        int index = -1;
+        if (libraryMutex &&
+            LOCK_TAKE(libraryMutex, pdMS_TO_TICKS(5000)) == pdPASS) {
+          index = resolveSyncItem(work);
+          LOCK_GIVE(libraryMutex);
         }
+        if (index >= 0)
+          work->coverUrl = fetchCoverUrlForIndex(index); // Internal locking
+        else
+          work->coverUrl = "";
 
-        // Final index rewrite after batch sync completes
-        Storage.rewriteIndex(currentMode);
-
-        success = !is_sync_stopping;
-        _progress = 1.0f;
-        _statusMsg = success ? "Sync Complete" : "Sync Stopped";
-      } break;
-
-      case JOB_COVER_DOWNLOAD: {
-        _statusMsg = "Downloading cover...";
-        String savePath = currentJob.extraData;
-        String url = currentJob.id;
-
-        if (savePath.length() > 0 && url.length() > 0) {
-          if (AppNetworkManager::downloadCoverImage(url, savePath)) {
-            resultMsg = "Downloaded to " + savePath;
-            success = true;
-          } else {
-            ErrorHandler::logError(ERR_CAT_NETWORK,
-                                   String("Cover download failed: ") + savePath,
-                                   "BackgroundWorker::JOB_COVER_DOWNLOAD");
-            resultMsg = "Download Failed";
-            success = false;
-          }
-        } else {
-          resultMsg = "Invalid Params";
-          success = false;
+        if (work->coverUrl.length() > 0 && libraryMutex &&
+            LOCK_TAKE(libraryMutex, pdMS_TO_TICKS(5000)) == pdPASS) {
+          index = resolveSyncItem(work);
+          if (index >= 0)
+            setItemCoverUrl(index, work->coverUrl);
+          LOCK_GIVE(libraryMutex);
         }
-      } break;
-
-      case JOB_LYRICS_FETCH_ALL: {
-        String targetMbid = currentJob.id;
-        if (targetMbid.length() > 0) {
-          _statusMsg = "Fetching lyrics for CD...";
-          TrackList *tl = Storage.loadTracklist(targetMbid.c_str());
-          if (tl) {
-            int trackCount = (int)tl->tracks.size();
-            int fetched = 0;
-            for (int i = 0; i < trackCount; i++) {
-              if (is_sync_stopping)
-                break;
-              _progress = (float)i / trackCount;
-              _statusMsg = "Lyrics: " + String(tl->tracks[i].title.c_str());
-
-              // This will check cache first, then hit APIs if missing
-              LyricsResult res =
-                  fetchLyricsIfNeeded(targetMbid.c_str(), i, false);
-              if (res == LYRICS_FETCHED_NOW || res == LYRICS_ALREADY_CACHED) {
-                fetched++;
-              }
-              delay(50); // Small gap between API requests
-            }
-            resultMsg = "Fetched " + String(fetched) + "/" + String(trackCount);
-            success = true;
-            delete tl;
-          } else {
-            resultMsg = "Tracklist missing";
-            success = false;
-          }
+        if (work->coverUrl.length() > 0 && index >= 0) {
+          work->fileName = CoverStore::findByUrl(work->coverUrl);
         } else {
-          // If no specific CD, fetch for ALL items in library that have MBID
-          _statusMsg = "Lyrics: Full Scan";
-          int cdCount = (int)cdLibrary.size();
-          for (int i = 0; i < cdCount; i++) {
-            if (is_sync_stopping)
-              break;
-            _progress = (float)i / cdCount;
-            CD &cd = cdLibrary[i];
-            if (cd.releaseMbid.length() > 0) {
-              _statusMsg = "Lyrics: " + String(cd.title.c_str());
-              // Just fetch first 5 tracks in full scan to avoid API ban
-              for (int t = 0; t < std::min((int)cd.trackCount, 5); t++) {
-                fetchLyricsIfNeeded(cd.releaseMbid.c_str(), t, false);
-                delay(100);
-              }
-            }
-          }
-          resultMsg = "Scan complete";
-          success = true;
+          work->coverUrl = "";
+          Serial.printf("[SYNC] Failed to fetch cover URL for '%s'\n",
+                        work->title.c_str());
         }
-      } break;
+      }
+    }
+    xQueueSend(p->toDownload, &work, portMAX_DELAY);
+  }
 
-      default:
-        break;
+  SyncItem *end = nullptr;
+  xQueueSend(p->toDownload, &end, portMAX_DELAY);
+  vTaskDelete(NULL);
+}
+
+static void syncDownloadTask(void *param) {
+  SyncPipeline *p = (SyncPipeline *)param;
+  SyncItem *work;
+
+  while (xQueueReceive(p->toDownload, &work, portMAX_DELAY) == pdTRUE &&
+         work) {
+    if (!syncStopping(p) && work->fileName.length() == 0 &&
+        work->coverUrl.length() > 0) {
+      work->data = AppNetworkManager::downloadToBuffer(work->coverUrl,
+                                                       work->len);
+      if (!work->data)
+        Serial.printf("[SYNC] Download failed: %s\n", work->coverUrl.c_str());
+    }
+    xQueueSend(p->toStore, &work, portMAX_DELAY);
+  }
+
+  SyncItem *end = nullptr;
+  xQueueSend(p->toStore, &end, portMAX_DELAY);
+  vTaskDelete(NULL);
+}
+
+// Runs the store stage in the calling (worker) task. Returns false if the
+// sync was stopped.
+bool BackgroundWorker::runBulkSync(const JobHandle &ctl) {
+  is_sync_stopping = false;
+
+  SyncPipeline p;
+  p.job = ctl.get();
+  p.total = getItemCount();
+  p.scanned = 0;
+  p.forwarded = 0;
+  p.toResolve = xQueueCreate(SYNC_RESOLVE_QUEUE, sizeof(SyncItem *));
+  p.toDownload = xQueueCreate(SYNC_DOWNLOAD_QUEUE, sizeof(SyncItem *));
+  p.toStore = xQueueCreate(SYNC_WRITE_QUEUE, sizeof(SyncItem *));
+  if (!p.toResolve || !p.toDownload || !p.toStore) {
+    ErrorHandler::logError(ERR_CAT_MEMORY, "Sync queues allocation failed",
+                           "BackgroundWorker::runBulkSync");
+    if (p.toResolve)
+      vQueueDelete(p.toResolve);
+    if (p.toDownload)
+      vQueueDelete(p.toDownload);
+    if (p.toStore)
+      vQueueDelete(p.toStore);
+    return false;
+  }
+
+  report(ctl, 0.0f, "Sync: scanning covers");
+  listCoverFiles(p.onDisk);
+  Serial.printf("[SYNC] %d items, %d files in /covers\n", p.total,
+                (int)p.onDisk.size());
+
+  // Start from the end of the pipe; if a stage can't start, close the stream
+  // it would have fed so everything downstream still drains and exits.
+  struct {
+    TaskFunction_t fn;
+    const char *name;
+    QueueHandle_t feeds;
+  } stages[] = {{syncDownloadTask, "sync_dl", p.toStore},
+                {syncResolveTask, "sync_url", p.toDownload},
+                {syncScanTask, "sync_scan", p.toResolve}};
+  for (auto &st : stages) {
+    if (xTaskCreatePinnedToCore(st.fn, st.name, SYNC_STAGE_STACK, &p, 1, NULL,
+                                SYNC_STAGE_CORE) != pdPASS) {
+      ErrorHandler::logError(ERR_CAT_MEMORY,
+                             String("Sync stage start failed: ") + st.name,
+                             "BackgroundWorker::runBulkSync");
+      SyncItem *end = nullptr;
+      xQueueSend(st.feeds, &end, portMAX_DELAY);
+      break;
+    }
+  }
+
+  // Store stage
+  int stored = 0;
+  int downloaded = 0;
+  SyncItem *work;
+  while (xQueueReceive(p.toStore, &work, portMAX_DELAY) == pdTRUE && work) {
+    String held; // Reference from ingest(), dropped once the item has its own
+    if (work->data) {
+      if (!syncStopping(&p)) {
+        work->fileName =
+            CoverStore::ingest(work->data, work->len, work->coverUrl);
+        held = work->fileName;
+        if (work->fileName.length() > 0)
+          downloaded++;
       }
+      heap_caps_free(work->data);
+    }
+
+    // Items the scan skipped are done; forwarded ones are done once stored
+    stored++;
+    int done = p.scanned - p.forwarded + stored;
+    float progress = p.total > 0 ? (float)done / p.total : 1.0f;
 
-      if (currentJob.onComplete) {
-        currentJob.onComplete(success, resultMsg);
+    bool applied = false;
+    if (!syncStopping(&p) && work->fileName.length() > 0 && libraryMutex &&
+        LOCK_TAKE(libraryMutex, pdMS_TO_TICKS(5000)) == pdPASS) {
+      int index = resolveSyncItem(work);
+      if (index >= 0) {
+        setItemCoverFile(index, work->fileName);
+        saveItemDetail(index); // Recursive lock
+        applied = true;
+      } else {
+        Serial.printf("[SYNC] '%s' is gone, cover not applied\n",
+                      work->title.c_str());
       }
+      LOCK_GIVE(libraryMutex);
+    }
+    if (held.length() > 0)
+      CoverStore::release(held);
+
+    if (applied) {
+      report(ctl, progress, "Sync: " + work->title);
     } else {
-      delay(100); // Wait longer when idle to reduce bus load
+      report(ctl, progress);
     }
-    delay(10);
+    delete work;
+
+    // Interactive lookups run here while the other stages keep going
+    yieldToHigherPriority(ctl);
   }
+
+  vQueueDelete(p.toResolve);
+  vQueueDelete(p.toDownload);
+  vQueueDelete(p.toStore);
+
+  Serial.printf("[SYNC] %d/%d items needed covers, %d downloaded%s\n",
+                (int)p.forwarded, p.total, downloaded,
+                syncStopping(&p) ? " (stopped)" : "");
+
+  // Final index rewrite after batch sync completes
+  Storage.rewriteIndex(currentMode);
+  return !syncStopping(&p);
 }
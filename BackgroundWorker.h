@@ -2,16 +2,80 @@
 #define BACKGROUND_WORKER_H
 
 #include <Arduino.h>
+#include <atomic>
+#include <deque>
 #include <functional>
-#include <queue>
+#include <memory>
+#include <vector>
 
+// JOB_BULK_SYNC pipeline: scan -> resolve URL -> download -> store, one task
+// per stage, connected by bounded queues so network and SD work overlap.
+#define SYNC_RESOLVE_QUEUE 16 // Items waiting for a cover URL
+#define SYNC_DOWNLOAD_QUEUE 8 // Items waiting for the image
+#define SYNC_WRITE_QUEUE 3    // Downloaded images held in PSRAM
+#define SYNC_STAGE_STACK 16384
+#define SYNC_STAGE_CORE 0 // Network-bound, keep off the LVGL core
+
+#define JOB_HISTORY 8 // Finished jobs kept for getJob()
+// Web scanner results (JOB_LOOKUP_ADD) are also kept apart from JOB_HISTORY
+// until collected or for JOB_RESULT_TTL_MS, so a batch of lookups can't push
+// one out before the page polls it.
+#define JOB_RESULT_TTL_MS (10UL * 60 * 1000)
+#define JOB_RESULT_MAX 64
+#define BG_MAX_WORKERS 4
 
 enum JobType {
   JOB_NONE,
   JOB_METADATA_LOOKUP,
   JOB_COVER_DOWNLOAD,
   JOB_BULK_SYNC,
-  JOB_LYRICS_FETCH_ALL
+  JOB_LYRICS_FETCH_ALL,
+  JOB_LOOKUP_ADD,  // Web scanner: id = code, index = mode, extraData "force"
+  JOB_LOOKUP_BATCH // Combined CD search: id = barcodes, comma separated
+};
+
+// Lower runs first. Long jobs check between items and run any queued job of
+// a higher class before continuing (see yieldToHigherPriority).
+enum JobPriority {
+  JOB_PRIO_INTERACTIVE = 0, // User is waiting (scan lookups)
+  JOB_PRIO_COVER,           // Cover downloads, bulk cover sync
+  JOB_PRIO_CRAWL,           // Lyrics crawls
+  JOB_PRIO_COUNT
+};
+
+enum JobState { JOB_QUEUED, JOB_RUNNING, JOB_DONE, JOB_FAILED, JOB_CANCELLED };
+
+// What a job mostly waits on. Each worker serves its home class first and
+// steals from the other when that queue is empty.
+enum JobClass {
+  JOB_CLASS_IO = 0, // Network round trips (lookups, downloads, lyrics)
+  JOB_CLASS_CPU,    // Decoding/resizing/SD writes (bulk cover ingest)
+  JOB_CLASS_COUNT
+};
+
+struct WorkerConfig {
+  const char *name;
+  uint32_t stackSize;
+  BaseType_t core;
+  JobClass home;
+};
+
+struct WorkerStats {
+  const char *name;
+  int core;
+  JobClass home;
+  bool busy;
+  uint32_t jobs;
+  uint32_t stolen;    // Jobs taken from the other class
+  uint32_t busyMs;    // Time spent running jobs
+  uint32_t stackFree; // High-water mark, bytes
+};
+
+struct JobClassStats {
+  uint32_t jobs;
+  uint32_t totalWaitMs; // Queued -> started
+  uint32_t maxWaitMs;
+  uint32_t totalRunMs;
 };
 
 struct BackgroundJob {
@@ -22,25 +86,119 @@ struct BackgroundJob {
   std::function<void(bool success, String message)> onComplete;
 };
 
+// Cancellation token and progress handle of one job. Shared by the queue, the
+// running job and whoever asked for it; status/result are guarded by the
+// worker's mutex.
+struct JobControl {
+  uint32_t id;
+  JobType type;
+  JobPriority priority;
+  JobClass jobClass;
+  uint32_t queuedAt = 0; // millis()
+  uint32_t startedAt = 0;
+  uint32_t finishedAt = 0;
+  int worker = -1; // Index in the pool while running
+  std::atomic<bool> cancelled{false};
+  std::atomic<int> state{JOB_QUEUED};
+  std::atomic<float> progress{0.0f};
+  String status;
+  String result;
+};
+typedef std::shared_ptr<JobControl> JobHandle;
+
+// Snapshot for the UI / web API
+struct JobInfo {
+  uint32_t id;
+  JobType type;
+  JobPriority priority;
+  JobClass jobClass;
+  int worker;
+  JobState state;
+  float progress;
+  String status;
+  String result;
+};
+
 class BackgroundWorker {
 public:
+  // Starts the default pool (two I/O workers on core 0 next to WiFi, one CPU
+  // worker on core 1), or `count` workers as configured.
   static void begin();
-  static void addJob(BackgroundJob job);
+  static void begin(const WorkerConfig *workers, int count);
+
+  // Queues a job and wakes the worker. An identical job (type, id,
+  // extraData) still waiting is coalesced: its id is returned, both callbacks
+  // run, and it moves up if `priority` is higher. Returns the job id.
+  static uint32_t addJob(const BackgroundJob &job);
+  static uint32_t addJob(const BackgroundJob &job, JobPriority priority);
+  static JobPriority defaultPriority(JobType type);
+  static JobClass defaultClass(JobType type);
+
+  // Queued jobs are dropped (onComplete(false, "Cancelled")); a running one
+  // stops at its next item. False if the id is unknown or already finished.
+  static bool cancel(uint32_t jobId);
+  static bool getJob(uint32_t jobId, JobInfo &out);
+  // getJob() for whoever waits on the result: also finds kept JOB_LOOKUP_ADD
+  // results, and releases one once it has been returned finished.
+  static bool collectJob(uint32_t jobId, JobInfo &out);
+  // True if jobId was handed out but the job is no longer kept
+  static bool expired(uint32_t jobId);
+  static std::vector<JobInfo> getJobs(); // Running, queued, then recent
+
   static bool isBusy();
   static int getQueueSize();
 
-  // UI Helpers
+  // Pool stats. Utilization = busyMs over the time since begin().
+  static int getWorkerCount();
+  static WorkerStats getWorkerStats(int worker);
+  static JobClassStats getClassStats(JobClass jobClass);
+  static uint32_t getUptimeMs();
+
+  // UI Helpers (most recently updated running job)
   static String getStatusMessage();
   static float getProgress(); // 0.0 to 1.0
 
 private:
+  struct QueuedJob {
+    BackgroundJob job;
+    JobHandle ctl;
+  };
+
+  struct Worker {
+    WorkerConfig cfg;
+    TaskHandle_t task = NULL;
+    bool busy = false;
+    uint32_t jobs = 0;
+    uint32_t stolen = 0;
+    uint32_t busyMs = 0;
+  };
+
   static void workerTask(void *pvParameters);
-  static std::queue<BackgroundJob> _jobQueue;
+  static int currentWorker();
+  static bool popNext(int worker, int belowPriority, QueuedJob &out);
+  static void execute(int worker, QueuedJob &q);
+  static void yieldToHigherPriority(const JobHandle &current);
+  static bool stopRequested(const JobHandle &ctl);
+  static void report(const JobHandle &ctl, float progress,
+                     const String &status);
+  static void report(const JobHandle &ctl, float progress);
+  static JobInfo snapshot(const JobControl &c);
+  static void retire(const JobHandle &ctl); // With _queueMutex held
+  static void pruneResults(uint32_t now);   // With _queueMutex held
+  static bool runBulkSync(const JobHandle &ctl);
+
+  static std::deque<QueuedJob> _queues[JOB_CLASS_COUNT][JOB_PRIO_COUNT];
+  static std::vector<JobHandle> _running;
+  static std::deque<JobHandle> _finished;
+  static std::deque<JobHandle> _results; // Kept JOB_LOOKUP_ADD results
   static SemaphoreHandle_t _queueMutex;
-  static bool _busy;
+  static Worker _workers[BG_MAX_WORKERS];
+  static int _workerCount;
+  static JobClassStats _classStats[JOB_CLASS_COUNT];
+  static uint32_t _startedAt;
+  static uint32_t _nextId;
   static String _statusMsg;
   static float _progress;
-  static int _totalJobs;
 };
 
 #endif
@@ -0,0 +1,213 @@
+#include "ChunkWriter.h"
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+ChunkWriter::ChunkWriter(Sink sink) : _sink(sink) {}
+
+ChunkWriter::~ChunkWriter() { flush(); }
+
+ChunkWriter::Sink ChunkWriter::into(ChunkSpool &spool) {
+  return [&spool](const char *data, size_t len) {
+    spool.insert(spool.end(), data, data + len);
+  };
+}
+
+ChunkWriter::Sink ChunkWriter::discard() {
+  return [](const char *, size_t) {};
+}
+
+void ChunkWriter::flush() {
+  if (_len == 0)
+    return;
+  if (_sink)
+    _sink(_buf, _len);
+  _total += _len;
+  _len = 0;
+}
+
+ChunkWriter &ChunkWriter::raw(char c) {
+  put(c);
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::raw(const char *s) {
+  while (*s)
+    put(*s++);
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::raw(const char *data, size_t len) {
+  if (len >= sizeof(_buf)) {
+    // Too big to be worth copying: pass it through in one piece
+    flush();
+    if (_sink)
+      _sink(data, len);
+    _total += len;
+    return *this;
+  }
+  if (_len + len > sizeof(_buf))
+    flush();
+  memcpy(_buf + _len, data, len);
+  _len += len;
+  return *this;
+}
+
+void ChunkWriter::separate() {
+  if (_needComma)
+    put(',');
+}
+
+ChunkWriter &ChunkWriter::beginObject() {
+  separate();
+  put('{');
+  _needComma = false;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::endObject() {
+  put('}');
+  _needComma = true;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::beginArray() {
+  separate();
+  put('[');
+  _needComma = false;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::endArray() {
+  put(']');
+  _needComma = true;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::key(const char *name) {
+  separate();
+  quoted(name);
+  put(':');
+  _needComma = false;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::string(const char *s) {
+  separate();
+  quoted(s ? s : "");
+  _needComma = true;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::number(long v) {
+  char digits[12];
+  ltoa(v, digits, 10);
+  separate();
+  raw(digits);
+  _needComma = true;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::number(unsigned long v) {
+  char digits[12];
+  ultoa(v, digits, 10);
+  separate();
+  raw(digits);
+  _needComma = true;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::hex(unsigned long v) {
+  char digits[10];
+  ultoa(v, digits, 16);
+  separate();
+  put('"');
+  raw(digits);
+  put('"');
+  _needComma = true;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::boolean(bool v) {
+  separate();
+  raw(v ? "true" : "false");
+  _needComma = true;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::null() {
+  separate();
+  raw("null");
+  _needComma = true;
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::endLine() {
+  put('\n');
+  _needComma = false;
+  return *this;
+}
+
+// Strict JSON: quotes, backslashes and control characters only. UTF-8 goes
+// through unchanged.
+void ChunkWriter::quoted(const char *s) {
+  put('"');
+  for (const char *p = s; *p; p++) {
+    unsigned char c = (unsigned char)*p;
+    if (c == '"' || c == '\\') {
+      put('\\');
+      put((char)c);
+    } else if (c == '\n') {
+      raw("\\n");
+    } else if (c == '\r') {
+      raw("\\r");
+    } else if (c == '\t') {
+      raw("\\t");
+    } else if (c < 0x20) {
+      raw("\\u00");
+      put(HEX_DIGITS[c >> 4]);
+      put(HEX_DIGITS[c & 0xf]);
+    } else {
+      put((char)c);
+    }
+  }
+  put('"');
+}
+
+ChunkWriter &ChunkWriter::html(const char *s) {
+  for (const char *p = s; *p; p++) {
+    switch (*p) {
+    case '&':
+      raw("&amp;");
+      break;
+    case '<':
+      raw("&lt;");
+      break;
+    case '>':
+      raw("&gt;");
+      break;
+    case '"':
+      raw("&quot;");
+      break;
+    case '\'':
+      raw("&#39;");
+      break;
+    default:
+      put(*p);
+    }
+  }
+  return *this;
+}
+
+ChunkWriter &ChunkWriter::url(const char *s) {
+  for (const char *p = s; *p; p++) {
+    unsigned char c = (unsigned char)*p;
+    if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+      put((char)c);
+    } else {
+      put('%');
+      put(toupper(HEX_DIGITS[c >> 4]));
+      put(toupper(HEX_DIGITS[c & 0xf]));
+    }
+  }
+  return *this;
+}
@@ -0,0 +1,89 @@
+#ifndef CHUNK_WRITER_H
+#define CHUNK_WRITER_H
+
+#include "PsramAllocator.h"
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+// Buffered writer for responses and files built piece by piece.
+//
+// Output collects in a fixed buffer inside the writer (on the caller's stack)
+// and goes to the sink whenever that fills, so output of any size costs no
+// heap. Strings are escaped straight into the buffer rather than through
+// String temporaries ("a" + b, escapers returning a String, serializeJson()
+// into a String). The destructor flushes whatever is left.
+//
+// JSON helpers place the commas: a value, key or begin*() that follows a
+// finished value in the same object/array is preceded by one. raw() writes
+// bytes as they are and doesn't touch that state.
+//
+//   ChunkWriter out(sendChunk);
+//   out.beginObject().key("title").string(cd.title.c_str());
+//   out.key("year").number(cd.year).endObject();
+
+#define CHUNK_WRITER_SIZE 1436 // One TCP segment per flush
+
+// Sink target for output that has to be complete before it's sent (built
+// under a lock, or needed for a Content-Length). Lives in PSRAM.
+typedef std::vector<char, PsramAllocator<char>> ChunkSpool;
+
+class ChunkWriter {
+public:
+  typedef std::function<void(const char *data, size_t len)> Sink;
+
+  explicit ChunkWriter(Sink sink);
+  ~ChunkWriter();
+  ChunkWriter(const ChunkWriter &) = delete;
+  ChunkWriter &operator=(const ChunkWriter &) = delete;
+
+  // Appends to `spool`, which grows as needed
+  static Sink into(ChunkSpool &spool);
+  // Discards the output; bytesWritten() still counts it
+  static Sink discard();
+
+  ChunkWriter &raw(char c);
+  ChunkWriter &raw(const char *s);
+  ChunkWriter &raw(const char *data, size_t len);
+
+  ChunkWriter &beginObject();
+  ChunkWriter &endObject();
+  ChunkWriter &beginArray();
+  ChunkWriter &endArray();
+  ChunkWriter &key(const char *name);
+  ChunkWriter &string(const char *s); // Quoted and escaped
+  ChunkWriter &number(long v);
+  ChunkWriter &number(unsigned long v);
+  ChunkWriter &number(int v) { return number((long)v); }
+  ChunkWriter &number(unsigned int v) { return number((unsigned long)v); }
+  ChunkWriter &hex(unsigned long v); // As a quoted string, e.g. "1a2b"
+  ChunkWriter &boolean(bool v);
+  ChunkWriter &null();
+  // Ends a line of newline-delimited JSON; the next value starts a new one
+  ChunkWriter &endLine();
+
+  // Text escaped for HTML element content / attribute values, and for a
+  // URL query component
+  ChunkWriter &html(const char *s);
+  ChunkWriter &url(const char *s);
+
+  void flush();
+  size_t bytesWritten() const { return _total + _len; }
+
+private:
+  void put(char c) {
+    if (_len == sizeof(_buf))
+      flush();
+    _buf[_len++] = c;
+  }
+  void separate(); // Comma before a value/key that isn't the first
+  void quoted(const char *s);
+
+  Sink _sink;
+  size_t _len = 0;
+  size_t _total = 0; // Flushed so far
+  bool _needComma = false;
+  char _buf[CHUNK_WRITER_SIZE];
+};
+
+#endif // CHUNK_WRITER_H
@@ -0,0 +1,319 @@
+#include "ConcurrentWebServer.h"
+
+// One worker's WebServer. It never listens; serve() hands it a connection
+// the acceptor already took and drives the stock parser until it's done.
+class HttpWorkerServer : public WebServer {
+public:
+  HttpWorkerServer() : WebServer(HTTP_PORT) {}
+
+  void serve(WiFiClient &client) {
+    _currentClient = client;
+    _currentStatus = HC_WAIT_READ;
+    _statusChange = millis();
+    while (_currentStatus != HC_NONE) {
+      if (_currentStatus == HC_WAIT_CLOSE)
+        _currentClient.stop(); // Responses carry "Connection: close"
+      else if (!_currentClient.available())
+        vTaskDelay(pdMS_TO_TICKS(2)); // handleClient() would only yield
+      handleClient();
+    }
+  }
+};
+
+ConcurrentWebServer::ConcurrentWebServer(int port) : _port(port) {}
+
+void ConcurrentWebServer::addRoute(const String &uri, HTTPMethod method,
+                                   bool concurrent,
+                                   WebServer::THandlerFunction fn,
+                                   WebServer::THandlerFunction ufn) {
+  if (_queue) {
+    Serial.printf("HTTP: route %s added after begin(), ignored\n",
+                  uri.c_str());
+    return;
+  }
+  Route r;
+  r.uri = uri;
+  r.method = method;
+  r.concurrent = concurrent;
+  r.fn = fn;
+  r.ufn = ufn;
+  _routes.push_back(r);
+}
+
+void ConcurrentWebServer::on(const String &uri, HTTPMethod method,
+                             WebServer::THandlerFunction fn) {
+  addRoute(uri, method, false, fn, nullptr);
+}
+
+void ConcurrentWebServer::on(const String &uri, HTTPMethod method,
+                             WebServer::THandlerFunction fn,
+                             WebServer::THandlerFunction ufn) {
+  addRoute(uri, method, false, fn, ufn);
+}
+
+void ConcurrentWebServer::onConcurrent(const String &uri, HTTPMethod method,
+                                       WebServer::THandlerFunction fn) {
+  addRoute(uri, method, true, fn, nullptr);
+}
+
+void ConcurrentWebServer::collectHeaders(const char *headerKeys[],
+                                         const size_t headerKeysCount) {
+  _headerKeys = headerKeys; // Caller keeps the array (static)
+  _headerKeyCount = headerKeysCount;
+}
+
+void ConcurrentWebServer::registerRoutes(WebServer &ws) {
+  for (int i = 0; i < (int)_routes.size(); i++) {
+    if (_routes[i].ufn) {
+      ws.on(_routes[i].uri, _routes[i].method,
+            [this, i]() { runHandler(i, false); },
+            [this, i]() { runHandler(i, true); });
+    } else {
+      ws.on(_routes[i].uri, _routes[i].method,
+            [this, i]() { runHandler(i, false); });
+    }
+  }
+}
+
+void ConcurrentWebServer::begin() {
+  if (_queue)
+    return;
+  _queue = xQueueCreate(HTTP_ACCEPT_QUEUE, sizeof(WiFiClient *));
+  _exclusive = xSemaphoreCreateRecursiveMutex();
+
+  for (int i = 0; i < HTTP_WORKERS; i++) {
+    Worker &w = _workers[i];
+    w.owner = this;
+    w.server = new HttpWorkerServer();
+    if (_headerKeys)
+      w.server->collectHeaders(_headerKeys, _headerKeyCount);
+    registerRoutes(*w.server);
+
+    char name[12];
+    snprintf(name, sizeof(name), "http%d", i);
+    xTaskCreatePinnedToCore(workerTask, name, HTTP_WORKER_STACK, &w, 1,
+                            &w.task, HTTP_WORKER_CORE);
+  }
+  xTaskCreatePinnedToCore(acceptTask, "httpAccept", HTTP_ACCEPT_STACK, this, 1,
+                          NULL, HTTP_ACCEPT_CORE);
+  Serial.printf("HTTP: %d routes, %d workers on port %d\n",
+                (int)_routes.size(), HTTP_WORKERS, _port);
+}
+
+void ConcurrentWebServer::acceptTask(void *pvParameters) {
+  ConcurrentWebServer *self = (ConcurrentWebServer *)pvParameters;
+  WiFiServer listener(self->_port);
+  listener.begin();
+  listener.setNoDelay(true);
+
+  for (;;) {
+    WiFiClient client = listener.available();
+    if (!client) {
+      vTaskDelay(pdMS_TO_TICKS(5));
+      continue;
+    }
+
+    WiFiClient *conn = new WiFiClient(client); // Worker deletes it
+    if (xQueueSend(self->_queue, &conn, 0) != pdTRUE) {
+      // Every worker busy and the backlog full: answer rather than stall
+      conn->print("HTTP/1.1 503 Service Unavailable\r\n"
+                  "Retry-After: 1\r\n"
+                  "Content-Length: 0\r\n"
+                  "Connection: close\r\n\r\n");
+      conn->stop();
+      delete conn;
+      portENTER_CRITICAL(&self->_lock);
+      self->_rejected++;
+      portEXIT_CRITICAL(&self->_lock);
+      continue;
+    }
+    portENTER_CRITICAL(&self->_lock);
+    self->_accepted++;
+    portEXIT_CRITICAL(&self->_lock);
+  }
+}
+
+void ConcurrentWebServer::workerTask(void *pvParameters) {
+  Worker *w = (Worker *)pvParameters;
+  ConcurrentWebServer *self = w->owner;
+
+  for (;;) {
+    WiFiClient *conn = nullptr;
+    if (xQueueReceive(self->_queue, &conn, portMAX_DELAY) != pdTRUE)
+      continue;
+
+    uint32_t start = millis();
+    w->server->serve(*conn);
+    delete conn;
+
+    portENTER_CRITICAL(&self->_lock);
+    w->served++;
+    w->busyMs += millis() - start;
+    portEXIT_CRITICAL(&self->_lock);
+  }
+}
+
+// Wraps every route: serializes the non-concurrent ones and records
+// in-flight counts and latency (lock wait included, as the client sees it).
+void ConcurrentWebServer::runHandler(int route, bool upload) {
+  Route &r = _routes[route];
+
+  if (upload) {
+    // Called once per chunk while the request is parsed, before r.fn
+    if (!r.concurrent)
+      xSemaphoreTakeRecursive(_exclusive, portMAX_DELAY);
+    r.ufn();
+    if (!r.concurrent)
+      xSemaphoreGiveRecursive(_exclusive);
+    return;
+  }
+
+  int64_t start = esp_timer_get_time();
+  if (!r.concurrent) {
+    xSemaphoreTakeRecursive(_exclusive, portMAX_DELAY);
+    Metrics::recordLockWait(METRIC_LOCK_HTTP,
+                            (uint32_t)(esp_timer_get_time() - start), true);
+  }
+
+  portENTER_CRITICAL(&_lock);
+  _lockWaitMs += (uint32_t)((esp_timer_get_time() - start) / 1000);
+  if (++r.active > r.maxActive)
+    r.maxActive = r.active;
+  if (++_active > _maxActive)
+    _maxActive = _active;
+  portEXIT_CRITICAL(&_lock);
+
+  {
+    TRACE_SCOPE(r.uri.c_str()); // Routes are fixed once begin() has run
+    r.fn();
+  }
+
+  uint32_t us = (uint32_t)(esp_timer_get_time() - start);
+  uint32_t ms = us / 1000;
+  portENTER_CRITICAL(&_lock);
+  r.active--;
+  _active--;
+  r.requests++;
+  r.totalMs += ms;
+  if (ms > r.maxMs)
+    r.maxMs = ms;
+  r.latency[r.latencyNext] = ms > 0xFFFF ? 0xFFFF : ms;
+  r.latencyNext = (r.latencyNext + 1) % SCHED_LATENCY_SAMPLES;
+  if (r.latencyCount < SCHED_LATENCY_SAMPLES)
+    r.latencyCount++;
+  r.histogram.add(us);
+  portEXIT_CRITICAL(&_lock);
+
+  if (!r.concurrent)
+    xSemaphoreGiveRecursive(_exclusive);
+}
+
+WebServer &ConcurrentWebServer::current() {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  for (int i = 0; i < HTTP_WORKERS; i++) {
+    if (_workers[i].task == self)
+      return *_workers[i].server;
+  }
+  return *_workers[0].server; // Only handlers should get here
+}
+
+String ConcurrentWebServer::arg(const String &name) {
+  return current().arg(name);
+}
+
+bool ConcurrentWebServer::hasArg(const String &name) {
+  return current().hasArg(name);
+}
+
+String ConcurrentWebServer::header(const String &name) {
+  return current().header(name);
+}
+
+HTTPMethod ConcurrentWebServer::method() { return current().method(); }
+
+HTTPUpload &ConcurrentWebServer::upload() { return current().upload(); }
+
+WiFiClient &ConcurrentWebServer::client() { return current().client(); }
+
+void ConcurrentWebServer::sendHeader(const String &name, const String &value,
+                                     bool first) {
+  current().sendHeader(name, value, first);
+}
+
+void ConcurrentWebServer::setContentLength(const size_t contentLength) {
+  current().setContentLength(contentLength);
+}
+
+void ConcurrentWebServer::send(int code, const char *contentType,
+                               const String &content) {
+  current().send(code, contentType, content);
+}
+
+void ConcurrentWebServer::send(int code, const String &contentType,
+                               const String &content) {
+  current().send(code, contentType, content);
+}
+
+void ConcurrentWebServer::send_P(int code, PGM_P contentType, PGM_P content,
+                                 size_t contentLength) {
+  current().send_P(code, contentType, content, contentLength);
+}
+
+void ConcurrentWebServer::sendContent(const String &content) {
+  current().sendContent(content);
+}
+
+void ConcurrentWebServer::sendContent(const char *content,
+                                      size_t contentLength) {
+  current().sendContent(content, contentLength);
+}
+
+int ConcurrentWebServer::getRouteCount() { return (int)_routes.size(); }
+
+HttpRouteStats ConcurrentWebServer::getRouteStats(int route) {
+  HttpRouteStats s = {};
+  if (route < 0 || route >= (int)_routes.size())
+    return s;
+
+  const Route &r = _routes[route];
+  uint16_t samples[SCHED_LATENCY_SAMPLES];
+  portENTER_CRITICAL(&_lock);
+  s.uri = r.uri.c_str();
+  s.method = r.method;
+  s.concurrent = r.concurrent;
+  s.requests = r.requests;
+  s.active = r.active;
+  s.maxActive = r.maxActive;
+  s.totalMs = r.totalMs;
+  s.maxMs = r.maxMs;
+  int n = r.latencyCount;
+  memcpy(samples, r.latency, sizeof(samples));
+  s.histogram = r.histogram;
+  portEXIT_CRITICAL(&_lock);
+
+  latency_percentiles(samples, n, s.p50Ms, s.p95Ms);
+  return s;
+}
+
+HttpServerStats ConcurrentWebServer::getStats() {
+  HttpServerStats s = {};
+  portENTER_CRITICAL(&_lock);
+  s.accepted = _accepted;
+  s.rejected = _rejected;
+  s.active = _active;
+  s.maxActive = _maxActive;
+  s.lockWaitMs = _lockWaitMs;
+  for (int i = 0; i < HTTP_WORKERS; i++) {
+    s.served[i] = _workers[i].served;
+    s.busyMs[i] = _workers[i].busyMs;
+  }
+  portEXIT_CRITICAL(&_lock);
+
+  s.workers = HTTP_WORKERS;
+  s.queued = _queue ? uxQueueMessagesWaiting(_queue) : 0;
+  for (int i = 0; i < HTTP_WORKERS; i++) {
+    s.stackFree[i] =
+        _workers[i].task ? uxTaskGetStackHighWaterMark(_workers[i].task) : 0;
+  }
+  return s;
+}
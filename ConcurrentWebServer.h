@@ -0,0 +1,151 @@
+#ifndef CONCURRENT_WEB_SERVER_H
+#define CONCURRENT_WEB_SERVER_H
+
+#include "Metrics.h"          // LatencyHistogram
+#include "RequestScheduler.h" // SCHED_LATENCY_SAMPLES
+#include "TraceRecorder.h"
+#include <Arduino.h>
+#include <WebServer.h>
+#include <vector>
+
+// Task-driven front end for the Arduino WebServer API.
+//
+// An acceptor task owns the listening socket and queues each connection for
+// a pool of worker tasks. Every worker has a private WebServer with the same
+// routes and parses the request with it, so handlers written against
+// `server.arg()/send()/sendContent()` run unchanged: the global `server`
+// forwards each call to the worker serving the calling task. Nothing runs
+// from loop() any more.
+//
+// Handlers are serialized by default, as they were under loop(). Routes
+// registered with onConcurrent() are ones that only touch shared state under
+// its own locks; they run alongside everything else, so a long export or
+// /browse stream only occupies its own worker. A streaming handler blocks
+// in sendContent() while the socket drains, which suspends just that task.
+// Routes that wait on the network (lookups, cover downloads) are concurrent
+// too: every serialized route would otherwise wait out their round trips.
+
+#define HTTP_PORT 80
+#define HTTP_WORKERS 3          // Concurrent connections being served
+#define HTTP_WORKER_STACK 12288 // Handlers keep JSON documents on the stack
+#define HTTP_WORKER_CORE 1      // Where handlers ran under loop()
+#define HTTP_ACCEPT_CORE 0
+#define HTTP_ACCEPT_STACK 4096
+#define HTTP_ACCEPT_QUEUE 8     // Accepted, waiting for a worker
+
+struct HttpRouteStats {
+  const char *uri;
+  HTTPMethod method;
+  bool concurrent;
+  uint32_t requests;
+  uint16_t active;    // In flight now
+  uint16_t maxActive; // Peak in flight
+  uint32_t totalMs;
+  uint32_t maxMs;
+  uint32_t p50Ms;
+  uint32_t p95Ms;
+  LatencyHistogram histogram; // Every request since boot (/api/metrics)
+};
+
+struct HttpServerStats {
+  uint32_t accepted;
+  uint32_t rejected; // Queue full: answered 503 by the acceptor
+  uint32_t queued;   // Waiting for a worker now
+  uint16_t active;   // Handlers running now
+  uint16_t maxActive;
+  uint32_t lockWaitMs; // Time serialized handlers waited for their turn
+  int workers;
+  uint32_t served[HTTP_WORKERS];
+  uint32_t busyMs[HTTP_WORKERS];
+  uint32_t stackFree[HTTP_WORKERS]; // High-water mark, bytes
+};
+
+class HttpWorkerServer;
+
+class ConcurrentWebServer {
+public:
+  explicit ConcurrentWebServer(int port = HTTP_PORT);
+
+  // Route registration; call before begin()
+  void on(const String &uri, HTTPMethod method,
+          WebServer::THandlerFunction fn);
+  void on(const String &uri, HTTPMethod method, WebServer::THandlerFunction fn,
+          WebServer::THandlerFunction ufn);
+  void onConcurrent(const String &uri, HTTPMethod method,
+                    WebServer::THandlerFunction fn);
+  void collectHeaders(const char *headerKeys[], const size_t headerKeysCount);
+
+  // Starts the workers and the acceptor
+  void begin();
+
+  // Request / response of the connection served by the calling task
+  String arg(const String &name);
+  bool hasArg(const String &name);
+  String header(const String &name);
+  HTTPMethod method();
+  HTTPUpload &upload();
+  WiFiClient &client();
+  void sendHeader(const String &name, const String &value, bool first = false);
+  void setContentLength(const size_t contentLength);
+  void send(int code, const char *contentType = NULL,
+            const String &content = String(""));
+  void send(int code, const String &contentType, const String &content);
+  void send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength);
+  void sendContent(const String &content);
+  void sendContent(const char *content, size_t contentLength);
+
+  int getRouteCount();
+  HttpRouteStats getRouteStats(int route);
+  HttpServerStats getStats();
+
+private:
+  struct Route {
+    String uri;
+    HTTPMethod method;
+    bool concurrent;
+    WebServer::THandlerFunction fn;
+    WebServer::THandlerFunction ufn;
+    uint32_t requests = 0;
+    uint16_t active = 0;
+    uint16_t maxActive = 0;
+    uint32_t totalMs = 0;
+    uint32_t maxMs = 0;
+    uint16_t latency[SCHED_LATENCY_SAMPLES];
+    uint8_t latencyCount = 0;
+    uint8_t latencyNext = 0;
+    LatencyHistogram histogram = {};
+  };
+
+  struct Worker {
+    ConcurrentWebServer *owner = nullptr;
+    HttpWorkerServer *server = nullptr;
+    TaskHandle_t task = NULL;
+    uint32_t served = 0;
+    uint32_t busyMs = 0;
+  };
+
+  static void acceptTask(void *pvParameters);
+  static void workerTask(void *pvParameters);
+  void addRoute(const String &uri, HTTPMethod method, bool concurrent,
+                WebServer::THandlerFunction fn,
+                WebServer::THandlerFunction ufn);
+  void registerRoutes(WebServer &ws);
+  void runHandler(int route, bool upload);
+  WebServer &current();
+
+  int _port;
+  std::vector<Route> _routes;
+  const char **_headerKeys = nullptr;
+  size_t _headerKeyCount = 0;
+  Worker _workers[HTTP_WORKERS];
+  QueueHandle_t _queue = NULL;
+  SemaphoreHandle_t _exclusive = NULL; // Taken by non-concurrent handlers
+  portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+  uint32_t _accepted = 0;
+  uint32_t _rejected = 0;
+  uint16_t _active = 0;
+  uint16_t _maxActive = 0;
+  uint32_t _lockWaitMs = 0;
+};
+
+#endif // CONCURRENT_WEB_SERVER_H
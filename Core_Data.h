@@ -53,6 +53,7 @@ struct MBRelease {
   String genre; // Added to support Discogs genre data
   int year;
   bool success;
+  bool notFound = false; // Provider answered "no such barcode" (cacheable)
 };
 
 // --- Lyrics Fetch Result Enum ---
@@ -0,0 +1,495 @@
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESP_IOExpander_Library.h>
+#include <SD.h>
+#include <TJpg_Decoder.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <mbedtls/sha256.h>
+
+#include "AppGlobals.h"
+#include "CoverStore.h"
+#include "ErrorHandler.h"
+#include "LockProfiler.h"
+#include "Storage.h"
+#include "TraceRecorder.h"
+#include "waveshare_sd_card.h"
+
+// The JPEG encoder ships with the esp32-camera component bundled in the
+// Arduino core. Without it, oversized covers are stored as downloaded.
+#if __has_include(<img_converters.h>)
+#include <img_converters.h>
+#define COVER_STORE_CAN_REENCODE 1
+#else
+#define COVER_STORE_CAN_REENCODE 0
+#endif
+
+// Static members
+CoverMap CoverStore::_entries;
+CoverUrlMap CoverStore::_byUrl;
+SemaphoreHandle_t CoverStore::_mutex = NULL;
+bool CoverStore::_dirty = false;
+uint32_t CoverStore::_dedupeHits = 0;
+
+// Decoder target for normalize()
+static uint16_t *_normBuffer = nullptr;
+static int _normWidth = 0;
+static int _normHeight = 0;
+
+static bool norm_output(int16_t x, int16_t y, uint16_t w, uint16_t h,
+                        uint16_t *bitmap) {
+  if (!_normBuffer)
+    return false;
+  for (int16_t j = 0; j < h; j++) {
+    int py = y + j;
+    if (py >= _normHeight)
+      break;
+    int copyW = w;
+    if (x + copyW > _normWidth)
+      copyW = _normWidth - x;
+    if (copyW > 0)
+      memcpy(&_normBuffer[py * _normWidth + x], &bitmap[j * w],
+             copyW * sizeof(uint16_t));
+  }
+  return true;
+}
+
+// FNV-1a, only used to key the URL lookup table
+static uint32_t urlHash(const String &url) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < url.length(); i++) {
+    h ^= (uint8_t)url[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static bool lockStore(SemaphoreHandle_t m) {
+  return m && xSemaphoreTakeRecursive(m, pdMS_TO_TICKS(2000)) == pdPASS;
+}
+
+bool CoverStore::begin() {
+  if (_mutex == NULL)
+    _mutex = xSemaphoreCreateRecursiveMutex();
+
+  _entries.clear();
+  _byUrl.clear();
+
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(2000)) != pdPASS) {
+    Serial.println("!!! I2C LOCK FAIL: CoverStore::begin");
+    return false;
+  }
+  if (sdExpander)
+    sdExpander->digitalWrite(SD_CS, LOW);
+
+  if (!SD.exists("/covers"))
+    SD.mkdir("/covers");
+
+  File file = SD.open(COVER_INDEX_PATH, FILE_READ);
+  if (file) {
+    while (file.available()) {
+      String line = file.readStringUntil('\n');
+      line.trim();
+      if (line.length() == 0)
+        continue;
+
+      StaticJsonDocument<768> doc;
+      if (deserializeJson(doc, line))
+        continue;
+
+      String key = doc["k"] | "";
+      if (key.length() == 0)
+        continue;
+
+      CoverEntry entry;
+      entry.url = (const char *)(doc["u"] | "");
+      entry.refs = doc["r"] | 0;
+      entry.bytes = doc["b"] | 0;
+      entry.width = doc["w"] | 0;
+      entry.height = doc["h"] | 0;
+
+      if (entry.url.length() > 0)
+        _byUrl[urlHash(entry.url.c_str())] = key.c_str();
+      _entries[key.c_str()] = entry;
+    }
+    file.close();
+  }
+
+  if (sdExpander)
+    sdExpander->digitalWrite(SD_CS, HIGH);
+  if (i2cMutex)
+    LOCK_GIVE(i2cMutex);
+
+  Serial.printf("CoverStore: %d covers indexed\n", (int)_entries.size());
+  return true;
+}
+
+void CoverStore::rebuildRefCounts() {
+  if (!lockStore(_mutex))
+    return;
+
+  for (auto &kv : _entries)
+    kv.second.refs = 0;
+
+  MediaMode modes[] = {MODE_CD, MODE_BOOK};
+  for (MediaMode mode : modes) {
+    for (const auto &item : Storage.getVectorForMode(mode)) {
+      String name = item.coverFile.c_str();
+      if (!isStoreFile(name))
+        continue;
+      auto it = _entries.find(name.substring(2, name.length() - 4).c_str());
+      if (it != _entries.end())
+        it->second.refs++;
+    }
+  }
+  _dirty = true;
+  xSemaphoreGiveRecursive(_mutex);
+}
+
+bool CoverStore::isStoreFile(const String &fileName) {
+  // h_ + 16 hex + .jpg
+  return fileName.length() == 22 && fileName.startsWith("h_") &&
+         fileName.endsWith(".jpg");
+}
+
+String CoverStore::fileNameForKey(const String &key) {
+  return "h_" + key + ".jpg";
+}
+
+String CoverStore::hashKey(const uint8_t *data, size_t len) {
+  uint8_t digest[32];
+#if defined(MBEDTLS_VERSION_NUMBER) && MBEDTLS_VERSION_NUMBER >= 0x03000000
+  mbedtls_sha256(data, len, digest, 0);
+#else
+  mbedtls_sha256_ret(data, len, digest, 0);
+#endif
+  char hex[17];
+  for (int i = 0; i < 8; i++)
+    sprintf(hex + i * 2, "%02x", digest[i]);
+  hex[16] = '\0';
+  return String(hex);
+}
+
+String CoverStore::findByUrl(const String &url) {
+  if (url.length() == 0 || !lockStore(_mutex))
+    return "";
+
+  String result = "";
+  auto it = _byUrl.find(urlHash(url));
+  if (it != _byUrl.end()) {
+    auto entry = _entries.find(it->second);
+    if (entry != _entries.end() && entry->second.url == url.c_str())
+      result = fileNameForKey(it->second.c_str());
+  }
+  xSemaphoreGiveRecursive(_mutex);
+  return result;
+}
+
+String CoverStore::retainByUrl(const String &url) {
+  if (!lockStore(_mutex))
+    return "";
+  String result = findByUrl(url); // Recursive lock
+  if (result.length() > 0)
+    retain(result);
+  xSemaphoreGiveRecursive(_mutex);
+  return result;
+}
+
+// Decodes at the smallest TJpgDec scale that fits COVER_MAX_DIM and
+// re-encodes. Returns false when no re-encode is needed or possible, in which
+// case the caller stores the original bytes.
+bool CoverStore::normalize(const uint8_t *data, size_t len, uint8_t **outData,
+                           size_t *outLen, uint16_t &outW, uint16_t &outH) {
+  uint16_t w = outW, h = outH;
+  if (w <= COVER_MAX_DIM && h <= COVER_MAX_DIM)
+    return false;
+  TRACE_SCOPE("cover.normalize");
+
+#if COVER_STORE_CAN_REENCODE
+  uint8_t scale = 1;
+  while (scale < 8 && (w / scale > COVER_MAX_DIM || h / scale > COVER_MAX_DIM))
+    scale *= 2;
+
+  int dw = w / scale;
+  int dh = h / scale;
+  uint16_t *rgb = (uint16_t *)heap_caps_malloc(dw * dh * sizeof(uint16_t),
+                                               MALLOC_CAP_SPIRAM);
+  if (!rgb)
+    return false;
+  memset(rgb, 0, dw * dh * sizeof(uint16_t));
+
+  // TJpgDec is a single shared instance (see jpegMutex)
+  if (jpegMutex)
+    LOCK_TAKE(jpegMutex, portMAX_DELAY);
+  _normBuffer = rgb;
+  _normWidth = dw;
+  _normHeight = dh;
+  TJpgDec.setJpgScale(scale);
+  TJpgDec.setSwapBytes(true); // fmt2jpg expects big-endian RGB565
+  TJpgDec.setCallback(norm_output);
+  JRESULT res = TJpgDec.drawJpg(0, 0, data, len);
+  TJpgDec.setSwapBytes(false);
+  _normBuffer = nullptr;
+  if (jpegMutex)
+    LOCK_GIVE(jpegMutex);
+
+  bool ok = false;
+  if (res == JDR_OK) {
+    ok = fmt2jpg((uint8_t *)rgb, dw * dh * sizeof(uint16_t), dw, dh,
+                 PIXFORMAT_RGB565, COVER_JPEG_QUALITY, outData, outLen);
+  }
+  heap_caps_free(rgb);
+
+  if (ok && *outLen >= len) {
+    // Re-encoding didn't help; keep the original
+    free(*outData);
+    *outData = nullptr;
+    return false;
+  }
+  if (ok) {
+    outW = dw;
+    outH = dh;
+  }
+  return ok;
+#else
+  return false;
+#endif
+}
+
+String CoverStore::ingest(const uint8_t *data, size_t len, const String &url) {
+  if (!data || len == 0)
+    return "";
+
+  // Reject anything TJpgDec can't display (PNG, progressive JPEG, HTML...)
+  uint16_t w = 0, h = 0;
+  if (jpegMutex)
+    LOCK_TAKE(jpegMutex, portMAX_DELAY);
+  JRESULT probe = TJpgDec.getJpgSize(&w, &h, data, len);
+  if (jpegMutex)
+    LOCK_GIVE(jpegMutex);
+  if (probe != JDR_OK || w == 0 || h == 0) {
+    ErrorHandler::logWarn(ERR_CAT_PARSING, "Cover is not a baseline JPEG", url);
+    return "";
+  }
+
+  String key = hashKey(data, len);
+  String fileName = fileNameForKey(key);
+
+  if (!lockStore(_mutex))
+    return "";
+
+  auto existing = _entries.find(key.c_str());
+  if (existing != _entries.end()) {
+    // Already stored: remember this URL too so the next sync skips the GET
+    if (url.length() > 0 && existing->second.url != url.c_str()) {
+      existing->second.url = url.c_str();
+      _byUrl[urlHash(url)] = key.c_str();
+      _dirty = true;
+    }
+    existing->second.refs++; // The caller's reference
+    _dirty = true;
+    _dedupeHits++;
+    xSemaphoreGiveRecursive(_mutex);
+    Serial.printf("CoverStore: Dedupe hit %s\n", fileName.c_str());
+    return fileName;
+  }
+  xSemaphoreGiveRecursive(_mutex);
+
+  uint8_t *normData = nullptr;
+  size_t normLen = 0;
+  bool reencoded = normalize(data, len, &normData, &normLen, w, h);
+
+  const uint8_t *writeData = reencoded ? normData : data;
+  size_t writeLen = reencoded ? normLen : len;
+  bool written = writeFile("/covers/" + fileName, writeData, writeLen);
+  if (normData)
+    free(normData);
+
+  if (!written) {
+    ErrorHandler::logError(ERR_CAT_STORAGE, "Cover write failed: " + fileName,
+                           "CoverStore::ingest");
+    return "";
+  }
+
+  if (reencoded)
+    Serial.printf("CoverStore: %s normalized %u -> %u bytes (%ux%u)\n",
+                  fileName.c_str(), (unsigned)len, (unsigned)writeLen, w, h);
+
+  if (lockStore(_mutex)) {
+    CoverEntry entry;
+    entry.url = url.c_str();
+    entry.refs = 1; // The caller's reference
+    entry.bytes = writeLen;
+    entry.width = w;
+    entry.height = h;
+    _entries[key.c_str()] = entry;
+    if (url.length() > 0)
+      _byUrl[urlHash(url)] = key.c_str();
+    _dirty = true;
+    xSemaphoreGiveRecursive(_mutex);
+  }
+  return fileName;
+}
+
+void CoverStore::retain(const String &fileName) {
+  if (!isStoreFile(fileName) || !lockStore(_mutex))
+    return;
+  auto it = _entries.find(fileName.substring(2, 18).c_str());
+  if (it != _entries.end()) {
+    it->second.refs++;
+    _dirty = true;
+  }
+  xSemaphoreGiveRecursive(_mutex);
+}
+
+void CoverStore::release(const String &fileName) {
+  if (!isStoreFile(fileName) || !lockStore(_mutex))
+    return;
+  bool orphaned = false;
+  auto it = _entries.find(fileName.substring(2, 18).c_str());
+  if (it != _entries.end()) {
+    if (it->second.refs > 0)
+      it->second.refs--;
+    if (it->second.refs == 0) {
+      auto u = _byUrl.find(urlHash(it->second.url.c_str()));
+      if (u != _byUrl.end() && u->second == it->first)
+        _byUrl.erase(u);
+      _entries.erase(it);
+      orphaned = true;
+    }
+    _dirty = true;
+  }
+  xSemaphoreGiveRecursive(_mutex);
+
+  // SD access outside the store lock (flush() nests store -> i2c)
+  if (orphaned) {
+    removeFile("/covers/" + fileName);
+    Serial.printf("CoverStore: Released last reference to %s\n",
+                  fileName.c_str());
+  }
+}
+
+void CoverStore::retarget(const String &oldFile, const String &newFile) {
+  if (oldFile == newFile)
+    return;
+  // Retain first so a same-hash swap never drops to zero
+  retain(newFile);
+  release(oldFile);
+}
+
+bool CoverStore::flush() {
+  if (!lockStore(_mutex))
+    return false;
+  if (!_dirty) {
+    xSemaphoreGiveRecursive(_mutex);
+    return true;
+  }
+
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
+    xSemaphoreGiveRecursive(_mutex);
+    return false;
+  }
+  if (sdExpander)
+    sdExpander->digitalWrite(SD_CS, LOW);
+
+  String tmpPath = String(COVER_INDEX_PATH) + ".tmp";
+  if (SD.exists(tmpPath))
+    SD.remove(tmpPath);
+
+  bool ok = false;
+  File file = SD.open(tmpPath, FILE_WRITE);
+  if (file) {
+    for (const auto &kv : _entries) {
+      StaticJsonDocument<768> doc;
+      doc["k"] = kv.first.c_str();
+      doc["u"] = kv.second.url.c_str();
+      doc["r"] = kv.second.refs;
+      doc["b"] = kv.second.bytes;
+      doc["w"] = kv.second.width;
+      doc["h"] = kv.second.height;
+      serializeJson(doc, file);
+      file.println();
+    }
+    file.close();
+
+    // Atomic Swap
+    if (SD.exists(COVER_INDEX_PATH))
+      SD.remove(COVER_INDEX_PATH);
+    ok = SD.rename(tmpPath, COVER_INDEX_PATH);
+    if (!ok)
+      Serial.println("CoverStore: Index Atomic Rename FAILED!");
+  }
+
+  if (sdExpander)
+    sdExpander->digitalWrite(SD_CS, HIGH);
+  if (i2cMutex)
+    LOCK_GIVE(i2cMutex);
+
+  if (ok)
+    _dirty = false;
+  xSemaphoreGiveRecursive(_mutex);
+  return ok;
+}
+
+bool CoverStore::writeFile(const String &path, const uint8_t *data,
+                           size_t len) {
+  bool success = false;
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(5000)) == pdPASS) {
+    if (sdExpander)
+      sdExpander->digitalWrite(SD_CS, LOW);
+
+    String tmpPath = path + ".tmp";
+    File file = SD.open(tmpPath, FILE_WRITE);
+    if (file) {
+      size_t written = file.write(data, len);
+      file.close();
+      if (written == len) {
+        if (SD.exists(path))
+          SD.remove(path);
+        success = SD.rename(tmpPath, path);
+      } else {
+        SD.remove(tmpPath);
+      }
+    }
+
+    if (sdExpander)
+      sdExpander->digitalWrite(SD_CS, HIGH);
+    LOCK_GIVE(i2cMutex);
+  }
+  return success;
+}
+
+void CoverStore::removeFile(const String &path) {
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
+    if (sdExpander)
+      sdExpander->digitalWrite(SD_CS, LOW);
+    if (SD.exists(path))
+      SD.remove(path);
+    if (sdExpander)
+      sdExpander->digitalWrite(SD_CS, HIGH);
+    LOCK_GIVE(i2cMutex);
+  }
+}
+
+int CoverStore::getRefs(const String &fileName) {
+  if (!isStoreFile(fileName) || !lockStore(_mutex))
+    return -1;
+  auto it = _entries.find(fileName.substring(2, 18).c_str());
+  int refs = it != _entries.end() ? it->second.refs : -1;
+  xSemaphoreGiveRecursive(_mutex);
+  return refs;
+}
+
+int CoverStore::getEntryCount() { return (int)_entries.size(); }
+
+uint32_t CoverStore::getStoredBytes() {
+  uint32_t total = 0;
+  if (lockStore(_mutex)) {
+    for (const auto &kv : _entries)
+      total += kv.second.bytes;
+    xSemaphoreGiveRecursive(_mutex);
+  }
+  return total;
+}
+
+uint32_t CoverStore::getDedupeHits() { return _dedupeHits; }
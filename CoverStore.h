@@ -0,0 +1,92 @@
+#ifndef COVER_STORE_H
+#define COVER_STORE_H
+
+#include "Core_Data.h"
+#include <Arduino.h>
+#include <map>
+
+// Content-addressed cover art store.
+//
+// Covers are written once under /covers/h_<hash>.jpg, where <hash> is the
+// first 64 bits of the SHA-256 of the downloaded bytes. Items that share
+// artwork (box sets, reissues) point at the same file. Each entry keeps a
+// reference count (number of index items whose coverFile names it) and the
+// source URL, persisted in /db/cover_index.jsonl. The file is removed when
+// the last reference is released.
+//
+// Legacy per-item names (cd_<id>.jpg / book_<id>.jpg) are still served as-is;
+// they simply don't participate in refcounting.
+
+#define COVER_MAX_DIM 240 // Matches the 240x240 cover area on the main screen
+#define COVER_JPEG_QUALITY 80
+#define COVER_INDEX_PATH "/db/cover_index.jsonl"
+
+struct CoverEntry {
+  PsramString url; // Source URL (last one ingested for this hash)
+  int refs = 0;
+  uint32_t bytes = 0; // Stored file size (after normalization)
+  uint16_t width = 0;
+  uint16_t height = 0;
+};
+
+typedef std::map<PsramString, CoverEntry, std::less<PsramString>,
+                 PsramAllocator<std::pair<const PsramString, CoverEntry>>>
+    CoverMap;
+typedef std::map<uint32_t, PsramString, std::less<uint32_t>,
+                 PsramAllocator<std::pair<const uint32_t, PsramString>>>
+    CoverUrlMap;
+
+class CoverStore {
+public:
+  // Loads the persisted cover index. Call after Storage.begin().
+  static bool begin();
+
+  // Recounts references from both library indexes (after loadIndex/wipe).
+  static void rebuildRefCounts();
+
+  // Stores an in-memory JPEG. Returns the cover file name (relative to
+  // /covers/) or "" if the data is not a decodable JPEG or the write failed.
+  // If the hash is already present nothing is written.
+  // The caller owns one reference to the returned file: point the item at
+  // it (the index takes its own reference), then release() it. A cover no
+  // item ends up using is removed by that release.
+  static String ingest(const uint8_t *data, size_t len, const String &url);
+
+  // Returns the cover file name already ingested from this URL, or "".
+  static String findByUrl(const String &url);
+  // findByUrl() with a reference for the caller, handled as after ingest()
+  static String retainByUrl(const String &url);
+
+  // Reference bookkeeping. Names outside the store are ignored.
+  static void retain(const String &fileName);
+  static void release(const String &fileName);
+  static void retarget(const String &oldFile, const String &newFile);
+
+  static bool isStoreFile(const String &fileName);
+  // References held on a stored cover, -1 if it isn't in the store
+  static int getRefs(const String &fileName);
+
+  // Persists the cover index if it changed since the last flush.
+  static bool flush();
+
+  // Stats
+  static int getEntryCount();
+  static uint32_t getStoredBytes();
+  static uint32_t getDedupeHits();
+
+private:
+  static String hashKey(const uint8_t *data, size_t len);
+  static String fileNameForKey(const String &key);
+  static bool normalize(const uint8_t *data, size_t len, uint8_t **outData,
+                        size_t *outLen, uint16_t &outW, uint16_t &outH);
+  static bool writeFile(const String &path, const uint8_t *data, size_t len);
+  static void removeFile(const String &path);
+
+  static CoverMap _entries;
+  static CoverUrlMap _byUrl;
+  static SemaphoreHandle_t _mutex;
+  static bool _dirty;
+  static uint32_t _dedupeHits;
+};
+
+#endif // COVER_STORE_H
@@ -15,25 +15,42 @@
 
 #include "AppGlobals.h"       // Global State & Settings
 #include "BackgroundWorker.h" // Core 0 Task (Network/IO)
+#include "ConcurrentWebServer.h" // Web Server Tasks
 #include "Core_Data.h"        // CD/Book Data Structures
+#include "ChunkWriter.h"      // Buffered JSON Output for Handlers
+#include "CoverStore.h"       // Content-Addressed Cover Art
 #include "ErrorHandler.h"     // System-wide Error Logging
+#include "EventBus.h"         // Live State Push to Web Pages
+#include "HttpPool.h"         // Keep-alive Connections for API Hosts
+#include "LibraryRevision.h"  // Change Counter for Web Clients
+#include "LockProfiler.h"     // Lock Holders, Hold & Wait Times
 #include "MediaManager.h"     // API Clients (MusicBrainz, Google Books)
+#include "MetadataCache.h"    // On-SD Cache of Metadata Lookups
+#include "Metrics.h"          // Latency Histograms for /api/metrics
 #include "NavigationCache.h"  // Smart Caching for Smooth UI
 #include "NetworkManager.h"   // WiFi & Connection Management
+#include "ProviderRace.h"     // Hedged Lyrics/Cover Lookups
+#include "RequestScheduler.h" // Metadata API Rate Limiting
 #include "Storage.h"          // SD Card Database Operations
 #include "StorageTests.h"     // Integrity Checks on Boot
+#include "TraceRecorder.h"    // Chrome Trace Timeline of Tasks
 #include "UIManager.h"        // LVGL Interface Logic
 #include "Utils.h"            // String & Helper Functions
 #include "WebInterface.h"     // Remote Control Web Server
 #include "mode_abstraction.h" // Polymorphic Mode Handling
+#if DEBUG_BENCHES
+#include "RotateBench.h" // Rotated Flush Copy Check & Timings
+#include "WriterBench.h" // String vs ChunkWriter Timings
+#endif
 
 // ========================================
 // GLOBAL OBJECTS
 // ========================================
-WebServer server(80);
+ConcurrentWebServer server(HTTP_PORT);
 File uploadFile;
 SemaphoreHandle_t libraryMutex = NULL;
 SemaphoreHandle_t i2cMutex = NULL;
+SemaphoreHandle_t jpegMutex = NULL;
 
 // ========================================
 // HELPER FUNCTIONS
@@ -57,43 +74,100 @@ void printDetailedMemoryStats() {
   Serial.println("--------------------------------\n");
 }
 
-String getCommonCSS() { return String(COMMON_CSS); }
-String getWebFooter() {
-  String f = "<div style='margin-top: 40px; border-top: 1px solid #333; "
-             "padding-top: 20px;'>";
-  f += "<h3 style='text-align:center; color:#fff; font-size: 14px; "
-       "margin-bottom: 15px; text-transform: uppercase; letter-spacing: "
-       "1px;'>Navigation</h3>";
-  f += "<div style='display: grid; grid-template-columns: repeat(7, 1fr); "
-       "gap: 10px;'>";
-  f += "<button onclick=\"location.href='/'\" style='font-size: "
-       "13px; padding: 10px;'>&#127968; Dashboard</button>";
-  f += "<button onclick=\"location.href='/scan'\" style='font-size: "
-       "13px; padding: 10px;'>&#128247; Scanner</button>";
-  f += "<button onclick=\"location.href='/browse'\" style='font-size: "
-       "13px; padding: 10px;'>&#128241; Browse</button>";
-  f += "<button onclick=\"location.href='/link'\" style='font-size: "
-       "13px; padding: 10px;'>&#128444; Covers</button>";
-  f += "<button onclick=\"location.href='/backup'\" style='font-size: "
-       "13px; padding: 10px;'>&#128190; Backup</button>";
-  f += "<button onclick=\"location.href='/manual'\" style='font-size: "
-       "13px; padding: 10px;'>&#128214; Manuals</button>";
-  f += "<button onclick=\"location.href='/errors'\" style='font-size: "
-       "13px; padding: 10px;'>&#128681; Errors</button>";
-  f += "</div></div>";
-  return f;
+// Serves an embedded page or file as stored: gzip-compressed, with its
+// content hash as ETag. Pages are revalidated on every load (304 when
+// unchanged); static files have versioned URLs and are cached for good.
+void sendWebAsset(const WebAsset &asset) {
+  server.sendHeader("ETag", asset.etag);
+  server.sendHeader("Cache-Control", asset.immutable
+                                         ? "public, max-age=31536000, immutable"
+                                         : "no-cache");
+  if (server.header("If-None-Match") == asset.etag) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, asset.contentType, (const char *)asset.gzip,
+                asset.gzipLen);
 }
 
-void sendHTMLPage(const char *title, String body, String script = "") {
-  String html = "<!DOCTYPE html><html><head>";
-  html += "<meta name='viewport' content='width=device-width, initial-scale=1, "
-          "maximum-scale=1'>";
-  html += "<meta charset='UTF-8'><title>" + String(title) + "</title>";
-  html += "<style>" + getCommonCSS() + "</style></head><body>" + body;
-  if (script.length() > 0)
-    html += "<script>" + script + "</script>";
-  html += "</body></html>";
-  server.send(200, "text/html", html);
+// Streamed responses: beginStream(), then write through a
+// ChunkWriter(sendChunk), then endStream(). Sent chunked, one chunk per
+// writer flush.
+void beginStream(int code, const char *contentType) {
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(code, contentType, "");
+}
+
+void sendChunk(const char *data, size_t len) { server.sendContent(data, len); }
+
+void endStream(ChunkWriter &out) {
+  out.flush();
+  server.sendContent(""); // Last chunk
+}
+
+// ========================================
+// LIVE EVENT PAYLOADS (EventBus sources)
+// ========================================
+
+static String event_selection() {
+  StaticJsonDocument<512> doc;
+  if (libraryMutex)
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
+  int idx = getCurrentItemIndex();
+  doc["id"] = idx;
+  doc["title"] = getItemTitle(idx);
+  doc["uniqueID"] = getItemUniqueID(idx);
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
+  String out;
+  serializeJson(doc, out);
+  return out;
+}
+
+static String event_leds() {
+  StaticJsonDocument<512> doc;
+  doc["on"] = led_master_on;
+  JsonArray selected = doc.createNestedArray("selected");
+  if (libraryMutex)
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
+  for (int l : getItemLedIndices(getCurrentItemIndex()))
+    selected.add(l);
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
+  if (filter_active) {
+    JsonObject f = doc.createNestedObject("filter");
+    f["genre"] = filter_genre;
+    f["decade"] = filter_decade;
+    f["favorites"] = filter_favorites_only;
+  }
+  String out;
+  serializeJson(doc, out);
+  return out;
+}
+
+static String event_jobs() {
+  StaticJsonDocument<256> doc;
+  doc["busy"] = BackgroundWorker::isBusy();
+  doc["queued"] = BackgroundWorker::getQueueSize();
+  doc["progress"] = BackgroundWorker::getProgress();
+  doc["status"] = BackgroundWorker::getStatusMessage();
+  String out;
+  serializeJson(doc, out);
+  return out;
+}
+
+static String event_library() {
+  StaticJsonDocument<128> doc;
+  doc["epoch"] = String(LibraryRevision::epoch(), HEX);
+  doc["rev"] = LibraryRevision::current();
+  doc["mode"] = (int)currentMode;
+  doc["count"] = getItemCount();
+  doc["cdCount"] = cdLibrary.size();
+  doc["bookCount"] = bookLibrary.size();
+  String out;
+  serializeJson(doc, out);
+  return out;
 }
 
 // ========================================
@@ -101,21 +175,80 @@ void sendHTMLPage(const char *title, String body, String script = "") {
 // ========================================
 
 void setupWebHandlers() {
-  // 1. Dashboard
-  server.on("/", HTTP_GET, []() {
-    String html = String(INDEX_HTML_TEMPLATE);
-    html.replace("%CSS%", getCommonCSS());
-    server.send(200, "text/html", html);
-  });
+  // Conditional GETs (pages, /api/items, /api/genres)
+  static const char *headerKeys[] = {"If-None-Match"};
+  server.collectHeaders(headerKeys, 1);
+
+  // 1. Pages and static files (web/, embedded by embed_web_assets.py)
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset *asset = &WEB_ASSETS[i];
+    server.onConcurrent(asset->path, HTTP_GET,
+                        [asset]() { sendWebAsset(*asset); });
+  }
 
   // 2. Status API
-  server.on("/api/status", HTTP_GET, []() {
-    StaticJsonDocument<256> doc;
+  server.onConcurrent("/api/status", HTTP_GET, []() {
+    StaticJsonDocument<2816> doc;
     doc["cdCount"] = cdLibrary.size();
     doc["bookCount"] = bookLibrary.size();
     doc["currentMode"] = (int)currentMode;
     doc["heap"] = ESP.getFreeHeap();
     doc["uptime"] = millis() / 1000;
+
+    // Metadata API rate limiting
+    JsonArray apis = doc.createNestedArray("apis");
+    for (int p = 0; p < API_PROVIDER_COUNT; p++) {
+      ApiProviderStats st = RequestScheduler::getStats((ApiProvider)p);
+      JsonObject o = apis.createNestedObject();
+      o["name"] = st.name;
+      o["intervalMs"] = st.intervalMs;
+      o["granted"] = st.granted;
+      o["throttled"] = st.throttled;
+      o["timeouts"] = st.timeouts;
+      o["avgWaitMs"] = st.granted ? st.totalWaitMs / st.granted : 0;
+      o["pausedForMs"] = st.pausedForMs;
+      o["p50Ms"] = st.p50Ms;
+      o["p95Ms"] = st.p95Ms;
+    }
+
+    // Provider races (time to first answer)
+    JsonArray races = doc.createNestedArray("races");
+    for (int k = 0; k < RACE_KIND_COUNT; k++) {
+      RaceStats rs = ProviderRace::getStats((RaceKind)k);
+      JsonObject o = races.createNestedObject();
+      o["name"] = rs.name;
+      o["races"] = rs.races;
+      o["failures"] = rs.failures;
+      o["hedges"] = rs.hedgesStarted;
+      o["p50Ms"] = rs.p50Ms;
+      o["p95Ms"] = rs.p95Ms;
+      JsonObject wins = o.createNestedObject("wins");
+      for (int i = 0; i < RACE_MAX_ENTRANTS; i++) {
+        if (rs.entrants[i])
+          wins[rs.entrants[i]] = rs.wins[i];
+      }
+    }
+
+    // Keep-alive connection reuse
+    HttpPoolStats pool = HttpPool::getStats();
+    JsonObject http = doc.createNestedObject("httpPool");
+    http["connects"] = pool.connects;
+    http["reuses"] = pool.reuses;
+    http["open"] = pool.openSlots;
+
+    // Metadata response cache
+    JsonObject meta = doc.createNestedObject("metaCache");
+    meta["records"] = MetadataCache::getEntryCount();
+    meta["hits"] = MetadataCache::getHits();
+    meta["misses"] = MetadataCache::getMisses();
+
+    // Live event listeners (/api/events)
+    EventBusStats ev = EventBus::getStats();
+    JsonObject events = doc.createNestedObject("events");
+    events["clients"] = ev.clients;
+    events["notifications"] = ev.notifications;
+    events["sent"] = ev.events;
+    events["dropped"] = ev.dropped;
     String out;
     serializeJson(doc, out);
     server.send(200, "application/json", out);
@@ -177,6 +310,521 @@ void setupWebHandlers() {
                 "Detailed heap info printed to Serial Console.");
   });
 
+  // 2.9. Display buffering & frame timings
+  // GET: current strategy + stats. POST (pin): store new strategy (applied
+  // on reboot); reset=1 clears the stats.
+  server.on("/api/display", HTTP_ANY, []() {
+    if (server.method() == HTTP_POST) {
+      if (server.arg("pin") != web_pin) {
+        server.send(401, "text/plain", "Unauthorized");
+        return;
+      }
+      if (server.hasArg("reset")) {
+        lvgl_port_reset_stats();
+      }
+      bool changed = false;
+      if (server.hasArg("mode")) {
+        setting_disp_mode = server.arg("mode").toInt();
+        changed = true;
+      }
+      if (server.hasArg("nbuf")) {
+        setting_disp_buf_num = server.arg("nbuf").toInt();
+        changed = true;
+      }
+      if (server.hasArg("lines")) {
+        setting_disp_buf_lines = server.arg("lines").toInt();
+        changed = true;
+      }
+      if (server.hasArg("psram")) {
+        setting_disp_buf_psram = server.arg("psram") == "1";
+        changed = true;
+      }
+      if (server.hasArg("bounce")) {
+        setting_disp_bounce_lines = server.arg("bounce").toInt();
+        changed = true;
+      }
+      if (changed) {
+        saveSettings();
+        settings_reboot_needed = true;
+      }
+    }
+
+    lvgl_port_config_t cfg;
+    lvgl_port_stats_t stats;
+    lvgl_port_get_config(&cfg);
+    lvgl_port_get_stats(&stats);
+
+    StaticJsonDocument<768> doc;
+    JsonObject active = doc.createNestedObject("active");
+    active["mode"] = cfg.mode;
+    active["nbuf"] = cfg.draw_buf_num;
+    active["lines"] = cfg.draw_buf_lines;
+    active["psram"] = cfg.draw_buf_psram;
+    active["bounce"] = cfg.bounce_buf_lines;
+    active["runtime"] = (bool)LVGL_PORT_RUNTIME_BUFFERING;
+
+    JsonObject saved = doc.createNestedObject("saved");
+    saved["mode"] = setting_disp_mode;
+    saved["nbuf"] = setting_disp_buf_num;
+    saved["lines"] = setting_disp_buf_lines;
+    saved["psram"] = setting_disp_buf_psram;
+    saved["bounce"] = setting_disp_bounce_lines;
+
+    JsonObject timing = doc.createNestedObject("timing");
+    timing["frames"] = stats.frames;
+    timing["renderLastUs"] = stats.render_us_last;
+    timing["renderAvgUs"] = stats.render_us_avg;
+    timing["renderMaxUs"] = stats.render_us_max;
+    timing["flushLastUs"] = stats.flush_us_last;
+    timing["flushAvgUs"] = stats.flush_us_avg;
+    timing["flushMaxUs"] = stats.flush_us_max;
+
+    doc["freeSram"] = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    doc["freePsram"] = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+  });
+
+  // 2.10. Keep-alive connection pool
+  // GET: counters. With url= (pin) fetches it `count` times through the pool
+  // and reports per-request timings, e.g. against a LAN test server.
+  // clear=1 (pin) closes all idle connections first.
+  server.onConcurrent("/api/debug/httppool", HTTP_GET, []() {
+    bool authed = server.arg("pin") == web_pin;
+    if ((server.hasArg("url") || server.hasArg("clear")) && !authed) {
+      server.send(401, "text/plain", "Unauthorized");
+      return;
+    }
+    if (server.hasArg("clear")) {
+      HttpPool::clear();
+    }
+
+    StaticJsonDocument<1024> doc;
+    if (server.hasArg("url")) {
+      String url = server.arg("url");
+      int count = server.hasArg("count") ? server.arg("count").toInt() : 3;
+      count = constrain(count, 1, 10);
+      JsonArray runs = doc.createNestedArray("runs");
+      for (int i = 0; i < count; i++) {
+        HttpPoolStats before = HttpPool::getStats();
+        uint32_t t0 = millis();
+        PooledHttp req(url);
+        int code = req.getFollowingRedirects(10000);
+        int bytes = code > 0 ? req.http().getString().length() : 0;
+        JsonObject r = runs.createNestedObject();
+        r["code"] = code;
+        r["bytes"] = bytes;
+        r["ms"] = millis() - t0;
+        r["reused"] = HttpPool::getStats().reuses > before.reuses;
+      }
+    }
+
+    HttpPoolStats st = HttpPool::getStats();
+    doc["connects"] = st.connects;
+    doc["reuses"] = st.reuses;
+    doc["evictions"] = st.evictions;
+    doc["overflows"] = st.overflows;
+    doc["openSlots"] = st.openSlots;
+    doc["slots"] = HTTP_POOL_SLOTS;
+
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+  });
+
+  // 2.11. Drop the metadata response cache (forces fresh lookups)
+  server.on("/api/metacache/clear", HTTP_POST, []() {
+    if (server.arg("pin") != web_pin) {
+      server.send(401, "text/plain", "Unauthorized");
+      return;
+    }
+    MetadataCache::clear();
+    server.send(200, "application/json", "{\"status\":\"cleared\"}");
+  });
+
+  // 2.12. Background jobs
+  // GET: running, queued and recent jobs (or one with id=), plus worker pool
+  // stats (per-worker and per-core utilization, per-class wait/run times).
+  // POST (pin) cancel=<id>: drop a queued job or stop a running one.
+  server.onConcurrent("/api/jobs", HTTP_ANY, []() {
+    if (server.method() == HTTP_POST) {
+      if (server.arg("pin") != web_pin) {
+        server.send(401, "text/plain", "Unauthorized");
+        return;
+      }
+      uint32_t id = server.arg("cancel").toInt();
+      bool ok = id > 0 && BackgroundWorker::cancel(id);
+      server.send(ok ? 200 : 404, "application/json",
+                  ok ? "{\"status\":\"cancelled\"}"
+                     : "{\"error\":\"no such job\"}");
+      return;
+    }
+
+    std::vector<JobInfo> jobs;
+    if (server.hasArg("id")) {
+      JobInfo info;
+      if (!BackgroundWorker::getJob(server.arg("id").toInt(), info)) {
+        server.send(404, "application/json", "{\"error\":\"no such job\"}");
+        return;
+      }
+      jobs.push_back(info);
+    } else {
+      jobs = BackgroundWorker::getJobs();
+    }
+
+    static const char *stateNames[] = {"queued", "running", "done", "failed",
+                                       "cancelled"};
+    DynamicJsonDocument doc(2048 + jobs.size() * 256);
+    JsonArray arr = doc.createNestedArray("jobs");
+    for (const JobInfo &j : jobs) {
+      JsonObject o = arr.createNestedObject();
+      o["id"] = j.id;
+      o["type"] = (int)j.type;
+      o["priority"] = (int)j.priority;
+      o["class"] = j.jobClass == JOB_CLASS_IO ? "io" : "cpu";
+      if (j.worker >= 0)
+        o["worker"] = j.worker;
+      o["state"] = stateNames[j.state];
+      o["progress"] = j.progress;
+      o["status"] = j.status;
+      o["result"] = j.result;
+    }
+
+    uint32_t uptime = BackgroundWorker::getUptimeMs();
+    uint32_t coreBusyMs[2] = {0, 0};
+    JsonArray workers = doc.createNestedArray("workers");
+    for (int i = 0; i < BackgroundWorker::getWorkerCount(); i++) {
+      WorkerStats ws = BackgroundWorker::getWorkerStats(i);
+      JsonObject o = workers.createNestedObject();
+      o["name"] = ws.name;
+      o["core"] = ws.core;
+      o["home"] = ws.home == JOB_CLASS_IO ? "io" : "cpu";
+      o["busy"] = ws.busy;
+      o["jobs"] = ws.jobs;
+      o["stolen"] = ws.stolen;
+      o["busyMs"] = ws.busyMs;
+      o["stackFree"] = ws.stackFree;
+      if (ws.core >= 0 && ws.core < 2)
+        coreBusyMs[ws.core] += ws.busyMs;
+    }
+    // Share of wall time the pool kept each core busy (can exceed 100 with
+    // several workers on one core: they mostly wait on the network)
+    JsonArray cores = doc.createNestedArray("coreUtilization");
+    for (int c = 0; c < 2; c++)
+      cores.add(uptime ? (uint32_t)((uint64_t)coreBusyMs[c] * 100 / uptime)
+                       : 0);
+
+    JsonObject classes = doc.createNestedObject("classes");
+    for (int c = 0; c < JOB_CLASS_COUNT; c++) {
+      JobClassStats cs = BackgroundWorker::getClassStats((JobClass)c);
+      JsonObject o =
+          classes.createNestedObject(c == JOB_CLASS_IO ? "io" : "cpu");
+      o["jobs"] = cs.jobs;
+      o["avgWaitMs"] = cs.jobs ? cs.totalWaitMs / cs.jobs : 0;
+      o["maxWaitMs"] = cs.maxWaitMs;
+      o["avgRunMs"] = cs.jobs ? cs.totalRunMs / cs.jobs : 0;
+    }
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+  });
+
+  // 2.13. Live events (server-sent): selection, leds, jobs, library. The
+  // connection is handed to EventBus; the worker lets go of it at once so
+  // the stream doesn't tie up a web worker.
+  server.onConcurrent("/api/events", HTTP_GET, []() {
+    WiFiClient client = server.client();
+    if (!EventBus::addClient(client)) {
+      server.send(503, "text/plain", "Too many listeners");
+      return;
+    }
+    server.client().stop(); // Our copy keeps the socket open
+  });
+
+  // 2.14. Web server: connections, worker utilization and per-route
+  // concurrency/latency (p50/p95 over the last 64 requests)
+  server.onConcurrent("/api/debug/http", HTTP_GET, []() {
+    HttpServerStats st = server.getStats();
+    DynamicJsonDocument doc(6144);
+    doc["accepted"] = st.accepted;
+    doc["rejected"] = st.rejected;
+    doc["queued"] = st.queued;
+    doc["active"] = st.active;
+    doc["maxActive"] = st.maxActive;
+    doc["lockWaitMs"] = st.lockWaitMs;
+    JsonArray workers = doc.createNestedArray("workers");
+    for (int i = 0; i < st.workers; i++) {
+      JsonObject w = workers.createNestedObject();
+      w["served"] = st.served[i];
+      w["busyMs"] = st.busyMs[i];
+      w["stackFree"] = st.stackFree[i];
+    }
+    JsonArray routes = doc.createNestedArray("routes");
+    for (int i = 0; i < server.getRouteCount(); i++) {
+      HttpRouteStats rs = server.getRouteStats(i);
+      if (rs.requests == 0 && rs.active == 0)
+        continue;
+      JsonObject r = routes.createNestedObject();
+      r["uri"] = rs.uri;
+      r["concurrent"] = rs.concurrent;
+      r["requests"] = rs.requests;
+      r["active"] = rs.active;
+      r["maxActive"] = rs.maxActive;
+      r["avgMs"] = rs.requests ? rs.totalMs / rs.requests : 0;
+      r["p50Ms"] = rs.p50Ms;
+      r["p95Ms"] = rs.p95Ms;
+      r["maxMs"] = rs.maxMs;
+    }
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+  });
+
+#if DEBUG_BENCHES
+  // 2.15. Benchmark: the library as JSON via String concatenation vs
+  // ChunkWriter (time, size, heap held). passes = 1..20, default 5.
+  server.on("/api/debug/bench/writer", HTTP_GET, []() {
+    if (server.arg("pin") != web_pin) {
+      server.send(401, "text/plain", "Unauthorized");
+      return;
+    }
+    int passes = server.hasArg("passes") ? server.arg("passes").toInt() : 5;
+    server.send(200, "text/plain", WriterBench::run(passes));
+  });
+
+  // 2.15.1. Benchmark: the rotated flush copy against the per-pixel one it
+  // replaced, checked byte for byte, then timed. passes = 1..50, default 10.
+  server.on("/api/debug/bench/rotate", HTTP_GET, []() {
+    if (server.arg("pin") != web_pin) {
+      server.send(401, "text/plain", "Unauthorized");
+      return;
+    }
+    int passes = server.hasArg("passes") ? server.arg("passes").toInt() : 10;
+    server.send(200, "text/plain", RotateBench::run(passes));
+  });
+#endif
+
+  // 2.16. Prometheus scrape target: latency histograms (storage, cover,
+  // search, routes, outbound HTTP, lock waits) and the module counters
+  server.onConcurrent("/api/metrics", HTTP_GET, []() {
+    beginStream(200, "text/plain; version=0.0.4");
+    ChunkWriter out(sendChunk);
+    char labels[96];
+
+    Metrics::writeFamily(out, "librarian_uptime_seconds", "gauge",
+                         "Time since boot");
+    Metrics::writeSample(out, "librarian_uptime_seconds", "", millis() / 1000);
+    Metrics::writeFamily(out, "librarian_heap_free_bytes", "gauge",
+                         "Free heap");
+    Metrics::writeSample(out, "librarian_heap_free_bytes",
+                         "region=\"internal\"",
+                         heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    Metrics::writeSample(out, "librarian_heap_free_bytes", "region=\"psram\"",
+                         heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    Metrics::writeFamily(out, "librarian_heap_largest_block_bytes", "gauge",
+                         "Largest free internal block");
+    Metrics::writeSample(out, "librarian_heap_largest_block_bytes", "",
+                         heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    Metrics::writeFamily(out, "librarian_library_items", "gauge",
+                         "Items per library");
+    Metrics::writeSample(out, "librarian_library_items", "mode=\"cd\"",
+                         cdLibrary.size());
+    Metrics::writeSample(out, "librarian_library_items", "mode=\"book\"",
+                         bookLibrary.size());
+
+    Metrics::writePrometheus(out);
+
+    // Metadata API scheduler
+    Metrics::writeFamily(out, "librarian_api_requests_total", "counter",
+                         "Metadata API requests dispatched");
+    for (int p = 0; p < API_PROVIDER_COUNT; p++) {
+      ApiProviderStats st = RequestScheduler::getStats((ApiProvider)p);
+      snprintf(labels, sizeof(labels), "api=\"%s\"", Metrics::outboundName(p));
+      Metrics::writeSample(out, "librarian_api_requests_total", labels,
+                           st.granted);
+    }
+    Metrics::writeFamily(out, "librarian_api_throttled_total", "counter",
+                         "429/503 responses from metadata APIs");
+    for (int p = 0; p < API_PROVIDER_COUNT; p++) {
+      ApiProviderStats st = RequestScheduler::getStats((ApiProvider)p);
+      snprintf(labels, sizeof(labels), "api=\"%s\"", Metrics::outboundName(p));
+      Metrics::writeSample(out, "librarian_api_throttled_total", labels,
+                           st.throttled);
+    }
+
+    HttpPoolStats pool = HttpPool::getStats();
+    Metrics::writeFamily(out, "librarian_http_pool_connections_total",
+                         "counter", "Outbound connections opened or reused");
+    Metrics::writeSample(out, "librarian_http_pool_connections_total",
+                         "result=\"connect\"", pool.connects);
+    Metrics::writeSample(out, "librarian_http_pool_connections_total",
+                         "result=\"reuse\"", pool.reuses);
+    Metrics::writeFamily(out, "librarian_metadata_cache_lookups_total",
+                         "counter", "Metadata cache lookups");
+    Metrics::writeSample(out, "librarian_metadata_cache_lookups_total",
+                         "result=\"hit\"", MetadataCache::getHits());
+    Metrics::writeSample(out, "librarian_metadata_cache_lookups_total",
+                         "result=\"miss\"", MetadataCache::getMisses());
+
+    // Web server
+    HttpServerStats hs = server.getStats();
+    Metrics::writeFamily(out, "librarian_http_connections_total", "counter",
+                         "Connections accepted, or refused with 503");
+    Metrics::writeSample(out, "librarian_http_connections_total",
+                         "result=\"accepted\"", hs.accepted);
+    Metrics::writeSample(out, "librarian_http_connections_total",
+                         "result=\"rejected\"", hs.rejected);
+    Metrics::writeFamily(out, "librarian_http_request_duration_seconds",
+                         "histogram", "Handler time per route, lock included");
+    for (int i = 0; i < server.getRouteCount(); i++) {
+      HttpRouteStats rs = server.getRouteStats(i);
+      if (rs.histogram.count == 0)
+        continue;
+      snprintf(labels, sizeof(labels), "route=\"%s\"", rs.uri);
+      Metrics::writeHistogram(out, "librarian_http_request_duration_seconds",
+                              labels, rs.histogram);
+    }
+    endStream(out);
+  });
+
+  // 2.17. Lock profiler: who holds each lock now, the call sites with the
+  // longest holds and waits, and recent slow holds and timeouts (newest
+  // first). reset=1 (pin) clears it first.
+  server.onConcurrent("/api/debug/locks", HTTP_GET, []() {
+    if (server.hasArg("reset")) {
+      if (server.arg("pin") != web_pin) {
+        server.send(401, "text/plain", "Unauthorized");
+        return;
+      }
+      LockProfiler::reset();
+    }
+    std::vector<LockSiteStats> sites(LOCK_PROF_SITES);
+    sites.resize(LockProfiler::getSites(sites.data(), LOCK_PROF_SITES));
+    std::vector<LockEvent> events(LOCK_PROF_EVENTS);
+    events.resize(LockProfiler::getEvents(events.data(), LOCK_PROF_EVENTS));
+    const int top = 15;
+
+    beginStream(200, "application/json");
+    ChunkWriter out(sendChunk);
+    char site[48];
+    auto siteName = [&site](const char *file, int line) {
+      snprintf(site, sizeof(site), "%s:%d", file ? file : "?", line);
+      return site;
+    };
+    auto writeSite = [&](const LockSiteStats &s) {
+      out.beginObject();
+      out.key("lock").string(Metrics::lockName(s.lock));
+      out.key("site").string(siteName(s.file, s.line));
+      out.key("takes").number(s.takes);
+      out.key("timeouts").number(s.timeouts);
+      out.key("avgWaitUs").number(
+          (unsigned long)(s.takes ? s.totalWaitUs / s.takes : 0));
+      out.key("maxWaitUs").number(s.maxWaitUs);
+      out.key("avgHoldUs").number(
+          (unsigned long)(s.takes ? s.totalHoldUs / s.takes : 0));
+      out.key("maxHoldUs").number(s.maxHoldUs);
+      out.key("totalHoldMs").number((unsigned long)(s.totalHoldUs / 1000));
+      out.endObject();
+    };
+
+    out.beginObject().key("holders").beginArray();
+    const MetricLock tracked[] = {METRIC_LOCK_LIBRARY, METRIC_LOCK_I2C,
+                                  METRIC_LOCK_LVGL, METRIC_LOCK_JPEG};
+    for (MetricLock l : tracked) {
+      LockHolder h = LockProfiler::getHolder(l);
+      out.beginObject().key("lock").string(Metrics::lockName(l));
+      out.key("held").boolean(h.held);
+      if (h.held) {
+        out.key("task").string(h.task);
+        out.key("site").string(siteName(h.file, h.line));
+        out.key("depth").number(h.depth);
+        out.key("heldForMs").number(h.heldForUs / 1000);
+      }
+      out.endObject();
+    }
+    out.endArray();
+
+    std::sort(sites.begin(), sites.end(),
+              [](const LockSiteStats &a, const LockSiteStats &b) {
+                return a.maxHoldUs > b.maxHoldUs;
+              });
+    out.key("longestHolds").beginArray();
+    for (int i = 0; i < (int)sites.size() && i < top; i++)
+      writeSite(sites[i]);
+    out.endArray();
+
+    std::sort(sites.begin(), sites.end(),
+              [](const LockSiteStats &a, const LockSiteStats &b) {
+                if (a.timeouts != b.timeouts)
+                  return a.timeouts > b.timeouts;
+                return a.maxWaitUs > b.maxWaitUs;
+              });
+    out.key("longestWaits").beginArray();
+    for (int i = 0; i < (int)sites.size() && i < top; i++)
+      writeSite(sites[i]);
+    out.endArray();
+
+    out.key("events").beginArray();
+    for (const LockEvent &e : events) {
+      out.beginObject().key("atMs").number(e.atMs);
+      out.key("lock").string(Metrics::lockName(e.lock));
+      out.key("task").string(e.task);
+      out.key("site").string(siteName(e.file, e.line));
+      out.key("waitUs").number(e.waitUs);
+      if (e.timedOut) {
+        out.key("timedOut").boolean(true);
+        out.key("holder").beginObject();
+        if (e.holderTask[0]) {
+          out.key("task").string(e.holderTask);
+          out.key("site").string(siteName(e.holderFile, e.holderLine));
+        }
+        out.endObject();
+      } else {
+        out.key("holdUs").number(e.holdUs);
+      }
+      out.endObject();
+    }
+    out.endArray().endObject();
+    endStream(out);
+  });
+
+  // 2.18. Trace recorder. GET: the recorded timeline as Chrome Trace JSON
+  // (chrome://tracing, ui.perfetto.dev). POST (pin): enable=0/1, clear=1,
+  // answered with the recorder state.
+  server.onConcurrent("/api/debug/trace", HTTP_ANY, []() {
+    if (server.method() == HTTP_POST) {
+      if (server.arg("pin") != web_pin) {
+        server.send(401, "text/plain", "Unauthorized");
+        return;
+      }
+      if (server.hasArg("clear"))
+        TraceRecorder::clear();
+      if (server.hasArg("enable"))
+        TraceRecorder::setEnabled(server.arg("enable").toInt() != 0);
+      TraceStats st = TraceRecorder::getStats();
+      StaticJsonDocument<256> doc;
+      doc["available"] = st.available;
+      doc["enabled"] = st.enabled;
+      doc["capacityPerCore"] = TRACE_EVENTS_PER_CORE;
+      JsonArray recorded = doc.createNestedArray("recorded");
+      recorded.add(st.recorded[0]);
+      recorded.add(st.recorded[1]);
+      doc["tasks"] = st.tasks;
+      String out;
+      serializeJson(doc, out);
+      server.send(200, "application/json", out);
+      return;
+    }
+    server.sendHeader("Content-Disposition",
+                      "attachment; filename=\"trace.json\"");
+    beginStream(200, "application/json");
+    ChunkWriter out(sendChunk);
+    TraceRecorder::writeJson(out);
+    endStream(out);
+  });
+
   // 3. Remote Control API
   server.on("/api/control", HTTP_ANY, []() {
     String action = server.arg("action");
@@ -419,566 +1067,75 @@ void setupWebHandlers() {
     }
   });
 
-  // LED Selector Web UI
-  server.on("/led-select", HTTP_GET, []() {
-    int cdId = server.arg("cd").toInt();
-    if (cdId < 0 || cdId >= getItemCount()) {
-      server.send(400, "text/plain", "Invalid CD ID");
+  // 3.1. Batch edits. POST (pin) a JSON body
+  // {"ops":[{"op":"edit","id":3,"genre":"Jazz","favorite":true,
+  // "ledIndices":[4,5]}, ...]} with the keys of /api/items ("op" defaults to
+  // "edit"; at most BATCH_MAX_OPS). Every op is checked first and the batch
+  // is applied whole or not at all: one journal, one index write, finished
+  // at boot if power is lost halfway. 200 = committed, 400 = rejected
+  // (see "results"), 503 = storage failed; nothing changed unless 200.
+  server.on("/api/batch", HTTP_POST, []() {
+    if (server.arg("pin") != web_pin) {
+      server.send(401, "text/plain", "Unauthorized");
+      return;
+    }
+    String body = server.arg("plain");
+    BasicJsonDocument<SpiRamAllocator> doc(body.length() * 4 + 1024);
+    if (deserializeJson(doc, body)) {
+      server.send(400, "application/json", "{\"error\":\"invalid JSON\"}");
+      return;
+    }
+    JsonArrayConst ops = doc["ops"];
+    if (ops.isNull() || ops.size() == 0 || ops.size() > BATCH_MAX_OPS) {
+      server.send(400, "application/json",
+                  "{\"error\":\"ops: 1 to " + String(BATCH_MAX_OPS) +
+                      " operations\"}");
       return;
     }
 
-    ItemView cd = getItemAt(cdId);
-    String selectedLEDs = "";
-    for (size_t i = 0; i < cd.ledIndices.size(); i++) {
-      selectedLEDs += String(cd.ledIndices[i]);
-      if (i < cd.ledIndices.size() - 1)
-        selectedLEDs += ",";
-    }
-
-    String html = "<!DOCTYPE html><html><head>";
-    html += "<meta name='viewport' "
-            "content='width=device-width,initial-scale=1,maximum-scale=1,user-"
-            "scalable=no'>";
-    html += "<title>LED Selector - " + cd.title + "</title>";
-    html += "<style>";
-    html += "*{margin:0;padding:0;box-sizing:border-box}";
-    html += "body{font-family:-apple-system,BlinkMacSystemFont,'Segoe "
-            "UI',Roboto,Arial,sans-serif;background:#0a0a0a;color:#fff;padding-"
-            "bottom:80px}";
-    html += ".header{position:sticky;top:0;background:linear-gradient(135deg,#"
-            "1a1a1a,#0f0f0f);padding:15px;border-bottom:2px solid "
-            "#00ff88;box-shadow:0 4px 12px rgba(0,255,136,0.2);z-index:100}";
-    html += ".cd-info{margin-bottom:12px}.cd-title{font-size:20px;font-weight:"
-            "700;color:#00ff88;margin-bottom:4px}.cd-artist{font-size:14px;"
-            "color:#aaa;opacity:0.9}";
-    html += ".actions{display:flex;gap:8px;flex-wrap:wrap;margin-top:10px}";
-    html += ".btn{padding:10px "
-            "16px;border:none;border-radius:8px;font-weight:600;font-size:13px;"
-            "cursor:pointer;transition:all "
-            "0.2s;flex:1;min-width:80px;text-align:center}";
-    html += ".btn-primary{background:#00ff88;color:#000}.btn-primary:active{"
-            "background:#00dd77;transform:scale(0.98)}";
-    html += ".btn-secondary{background:#333;color:#fff}.btn-secondary:active{"
-            "background:#444;transform:scale(0.98)}";
-    html += ".btn-danger{background:#ff4444;color:#fff}.btn-danger:active{"
-            "background:#dd3333;transform:scale(0.98)}";
-    html += ".search-box{width:100%;padding:12px;background:#1a1a1a;border:2px "
-            "solid "
-            "#333;border-radius:8px;color:#fff;font-size:15px;margin-top:10px}";
-    html += ".search-box:focus{outline:none;border-color:#00ff88}";
-    html += ".grid{display:grid;grid-template-columns:repeat(auto-fill,minmax("
-            "50px,1fr));gap:6px;padding:15px;max-width:100%}";
-    html += ".led{aspect-ratio:1;border-radius:8px;border:2px solid "
-            "#333;background:#1a1a1a;display:flex;align-items:center;justify-"
-            "content:center;font-size:11px;font-weight:700;cursor:pointer;"
-            "transition:all "
-            "0.15s;user-select:none;-webkit-tap-highlight-color:transparent}";
-    html += ".led.selected{background:#00ff88;color:#000;border-color:#00ff88;"
-            "box-shadow:0 0 12px rgba(0,255,136,0.6)}";
-    html += ".led:active{transform:scale(0.92)}";
-    html += ".led:hover{border-color:#00ff88;transform:scale(1.05)}";
-    html += ".footer{position:fixed;bottom:0;left:0;right:0;background:linear-"
-            "gradient(135deg,#1a1a1a,#0f0f0f);padding:15px;border-top:2px "
-            "solid #00ff88;box-shadow:0 -4px 12px "
-            "rgba(0,255,136,0.2);display:flex;gap:10px}";
-    html += ".count{text-align:center;padding:10px;background:#1a1a1a;border-"
-            "radius:8px;font-size:14px;color:#00ff88;font-weight:600;flex:1}";
-    html += "@media(max-width:600px){.grid{grid-template-columns:repeat(auto-"
-            "fill,minmax(45px,1fr));gap:5px}.led{font-size:10px}}";
-    html += "</style></head><body>";
-
-    html += "<div class='header'>";
-    html += "<div class='cd-info'><div class='cd-title'>" + cd.title +
-            "</div><div class='cd-artist'>" + cd.artistOrAuthor +
-            "</div></div>";
-    html += "<div class='actions'>";
-    html += "<button class='btn btn-secondary' "
-            "onclick='selectRange()'>Range</button>";
-    html +=
-        "<button class='btn btn-secondary' onclick='clearAll()'>Clear</button>";
-    html += "</div>";
-    html +=
-        "<input type='text' class='search-box' id='search' placeholder='Jump "
-        "to LED # or range (e.g. 10 or 10-20)' onkeyup='handleSearch(event)'>";
-    html += "</div>";
-
-    html += "<div class='grid' id='grid'></div>";
-
-    html += "<div class='footer'>";
-    html += "<div class='count'><div "
-            "style='font-size:11px;opacity:0.7'>SELECTED</div><div "
-            "id='count'>0</div></div>";
-    html += "<button class='btn btn-primary' onclick='save()' "
-            "style='flex:2'>SAVE & CLOSE</button>";
-    html += "</div>";
-
-    html += "<script>";
-    html += "const cdId=" + String(cdId) + ";";
-    html += "const totalLEDs=" + String(led_count) + ";";
-    html += "let selected=new Set([" + selectedLEDs + "]);";
-    html += "const grid=document.getElementById('grid');";
-    html += "const countEl=document.getElementById('count');";
-
-    html += "function createLED(i){";
-    html += "const led=document.createElement('div');";
-    html += "led.className='led'+(selected.has(i)?' selected':'');";
-    html += "led.textContent=i;";
-    html += "led.onclick=()=>toggle(i);";
-    html += "return led;";
-    html += "}";
-
-    html += "function render(){";
-    html += "grid.innerHTML='';";
-    html += "for(let i=0;i<totalLEDs;i++)grid.appendChild(createLED(i));";
-    html += "updateCount();";
-    html += "}";
-
-    html += "function toggle(i){";
-    html += "if(selected.has(i))selected.delete(i);else selected.add(i);";
-    html += "event.target.classList.toggle('selected');";
-    html += "updateCount();";
-    html += "preview();";
-    html += "}";
-
-    html += "function updateCount(){countEl.textContent=selected.size;}";
-
-    html += "function selectAll(){selected=new "
-            "Set([...Array(totalLEDs).keys()]);render();preview();}";
-    html += "function clearAll(){selected.clear();render();preview();}";
-    html += "function invertSelection(){const newSet=new Set();for(let "
-            "i=0;i<totalLEDs;i++)if(!selected.has(i))newSet.add(i);selected="
-            "newSet;render();preview();}";
-
-    html += "function selectRange(){";
-    html += "const range=prompt('Enter range (e.g., 10-20):');";
-    html += "if(!range)return;";
-    html += "const parts=range.split('-').map(s=>parseInt(s.trim()));";
-    html += "if(parts.length===2&&!isNaN(parts[0])&&!isNaN(parts[1])){";
-    html += "for(let "
-            "i=Math.min(...parts);i<=Math.max(...parts);i++)if(i>=0&&i<"
-            "totalLEDs)selected.add(i);";
-    html += "render();preview();";
-    html += "}}";
-
-    html += "function handleSearch(e){";
-    html += "if(e.key!=='Enter')return;";
-    html += "const val=e.target.value.trim();";
-    html += "if(!val)return;";
-    html += "if(val.includes('-')){const "
-            "parts=val.split('-').map(s=>parseInt(s.trim()));";
-    html += "if(parts.length===2&&!isNaN(parts[0])&&!isNaN(parts[1])){";
-    html += "for(let "
-            "i=Math.min(...parts);i<=Math.max(...parts);i++)if(i>=0&&i<"
-            "totalLEDs)selected.add(i);";
-    html += "render();preview();e.target.value='';}}";
-    html += "else{const "
-            "num=parseInt(val);if(!isNaN(num)&&num>=0&&num<totalLEDs){selected."
-            "add(num);render();preview();document.querySelector('.led:nth-"
-            "child('+(num+1)+')').scrollIntoView({block:'center',behavior:'"
-            "smooth'});e.target.value='';}}";
-    html += "}";
-
-    html += "let previewTimer=null;";
-    html += "function preview(){";
-    html += "clearTimeout(previewTimer);";
-    html += "previewTimer=setTimeout(()=>{";
-    html += "const leds=Array.from(selected).join(',');";
-    html += "console.log('Preview LEDs:',leds);";
-    html += "fetch('/api/"
-            "control',{method:'POST',headers:{'Content-Type':'application/"
-            "x-www-form-urlencoded'},body:'action=ledpreview&leds='+leds})";
-    html += ".then(r=>r.text()).then(msg=>console.log('Preview:',msg))";
-    html += ".catch(e=>console.error('Preview error:',e));";
-    html += "},100);";
-    html += "}";
-
-    html += "function save(){";
-    html += "const leds=Array.from(selected).sort((a,b)=>a-b).join(',');";
-    html += "fetch('/api/"
-            "control',{method:'POST',headers:{'Content-Type':'application/"
-            "x-www-form-urlencoded'},body:'action=ledupdate&id='+cdId+'&leds='+"
-            "leds})";
-    html += ".then(r=>r.text()).then(()=>{";
-    html += "console.log('Sending broadcast:', leds);";
-    html += "const msg={type:'led-update',leds:leds};";
-    html += "if(window.opener){window.opener.postMessage(msg,'*');}";
-    html += "try{const bc=new "
-            "BroadcastChannel('led_channel');bc.postMessage(msg);bc.close();}"
-            "catch(e){console.log('BC Err',e);}";
-    html += "alert('LEDs saved!');window.close();";
-    html += "}).catch(e=>alert('Error: '+e));";
-    html += "}";
-
-    html += "render();";
-    html += "</script></body></html>";
-
-    server.send(200, "text/html", html);
-  });
+    std::vector<BatchOpResult> results;
+    std::vector<int> touched;
+    String error;
+    BatchStatus status = applyBatch(ops, results, error, touched);
+    Serial.printf(">> WEB BATCH: %d ops, %d items, status %d\n",
+                  (int)ops.size(), (int)touched.size(), (int)status);
 
-  // 4. Scanner Tool (Full Featured)
-  server.on("/scan", HTTP_GET, []() {
-    String pinArg = server.arg("pin");
-    String codeArg = server.arg("code");
-    if (codeArg.length() == 0)
-      codeArg = server.arg("barcode");
-
-    // Check authentication server-side
-    bool isAuthenticated = (pinArg == web_pin);
-    String displayAuth = isAuthenticated ? "display:none !important;" : "";
-
-    String html = "";
-    html += "<!DOCTYPE html>";
-    html += "<html>";
-    html += "<head>";
-    html += "    <meta name=\"viewport\" content=\"width=device-width, "
-            "initial-scale=1, maximum-scale=1\">";
-    html += "    <meta charset=\"UTF-8\">";
-    html += "    <title>Scanner</title>";
-    html += "    <style>";
-    html += "        :root { --bg: #000000; --card: #111111; --accent: "
-            "#00ff88; --text: #ffffff; --sub: #666666; --err: #ff4444; }";
-    html += "        * { margin: 0; padding: 0; box-sizing: border-box; "
-            "-webkit-font-smoothing: antialiased; }";
-    html +=
-        "        body { background: var(--bg); color: var(--text); "
-        "font-family: -apple-system, BlinkMacSystemFont, 'Inter', Roboto, "
-        "sans-serif; display: flex; flex-direction: column; align-items: "
-        "center; justify-content: center; min-height: 100vh; padding: 20px; }";
-    html += "        .container { width: 100%; max-width: 400px; }";
-    html += "        h1 { font-size: 24px; font-weight: 600; margin-bottom: "
-            "8px; text-align: center; }";
-    html += "        p.subtitle { color: var(--sub); font-size: 14px; "
-            "text-align: center; margin-bottom: 40px; }";
-    html += "        .input-group { position: relative; margin-bottom: 20px; }";
-    html += "        input, textarea { width: 100%; background: var(--card); "
-            "border: 1px "
-            "solid #333; color: white; padding: 16px; font-size: 16px; "
-            "border-radius: 12px; outline: none; display: block; font-family: "
-            "inherit; }";
-    html += "        input { text-align: center; }";
-    html += "        textarea { text-align: left; resize: vertical; "
-            "min-height: 120px; font-family: monospace; }";
-    html +=
-        "        input:focus, textarea:focus { border-color: var(--accent); }";
-    html += "        button { width: 100%; background: var(--accent); color: "
-            "#000; border: none; padding: 16px; font-size: 16px; font-weight: "
-            "700; border-radius: 12px; cursor: pointer; }";
-    html += "        button:disabled { opacity: 0.5; background: var(--sub); }";
-    html += "        .result { margin-bottom: 20px; padding: 20px; "
-            "border-radius: 12px; background: var(--card); text-align: center; "
-            "display: none; border: 1px solid #333; }";
-    html += "        .links { margin-top: 40px; text-align: center; }";
-    html += "        a { color: var(--sub); text-decoration: none; font-size: "
-            "13px; }";
-    html += "    </style>";
-    html += "</head>";
-    html += "<body>";
-    html += "    <div class=\"container\">";
-    html += "        <h1>Add " + getModeName() + "</h1>";
-    String codeLabel = getCodeLabel();
-    if (codeLabel.endsWith(":"))
-      codeLabel = codeLabel.substring(0, codeLabel.length() - 1); // remove ':'
-    html += "        <p class=\"subtitle\">Enter " + codeLabel + " number</p>";
-    html += "        <div id=\"result\"></div>";
-
-    html += "        <form id=\"scanForm\">";
-    html += "            <div class=\"input-group\">";
-    String placeholder = "Scan or paste " + codeLabel + "s (one per line)";
-    html += "                <textarea id=\"barcode\" "
-            "placeholder=\"" +
-            placeholder +
-            "\" required "
-            "autocomplete=\"off\" rows=\"5\">" +
-            codeArg + "</textarea>";
-    html += "            </div>";
-    html += "            <button type=\"submit\">Lookup</button>";
-    html += "        </form>";
-
-    html += "    </div>"; // This closing div is for the container, it should
-                          // remain.
-    html += getWebFooter();
-    html += "</body></html>";
-
-    // Client-side Logic (Main App Only)
-    html += "<script>";
-    html += "    const PIN = '" + pinArg + "';";
-    html += "    if(PIN) localStorage.setItem('web_pin', PIN);";
-
-    html += "    function processQueue(lines, idx, res, btn) {";
-    html += "       if(idx >= lines.length) {";
-    html += "           btn.innerText = 'Lookup'; btn.disabled = false;";
-    html += "           document.getElementById('barcode').value = '';";
-    html += "           return;";
-    html += "       }";
-    html += "       var code = lines[idx];";
-    html +=
-        "       btn.innerText = 'Processing ' + (idx + 1) + '/' + lines.length "
-        "+ '...';";
-    html += "       var itemDiv = document.createElement('div');";
-    html += "       itemDiv.style.borderBottom = '1px solid #333'; "
-            "itemDiv.style.marginBottom = '10px'; itemDiv.style.paddingBottom "
-            "= '10px';";
-    html += "       itemDiv.innerHTML = '<div>Scanning: <b>' + code + "
-            "'</b>...</div>';";
-    html += "       res.prepend(itemDiv);";
-    html += "       var xhr = new XMLHttpRequest();";
-    html += "       xhr.open('GET', '/api/lookup?barcode=' + "
-            "encodeURIComponent(code) + '&pin=' + "
-            "localStorage.getItem('web_pin'), true);";
-    html += "       xhr.onload = function() {";
-    html += "          if(xhr.status === 409) {";
-    html += "             var d = JSON.parse(xhr.responseText);";
-    html += "             if(confirm(`Duplicate found for "
-            "${code}:\\n${d.title}\\nby "
-            "${d.artist}\\n\\nAdd copy anyway?`)) {";
-    html += "                var x2 = new XMLHttpRequest();";
-    html += "                x2.open('GET', '/api/lookup?barcode=' + "
-            "encodeURIComponent(code) + '&pin=' + "
-            "localStorage.getItem('web_pin') + '&force=true', true);";
-    html += "                x2.onload = function(){ disp(itemDiv, x2, code); "
-            "setTimeout(function(){ processQueue(lines, idx+1, res, btn); }, "
-            "2000); };";
-    html += "                x2.onerror = function(){ "
-            "itemDiv.innerHTML='Error'; setTimeout(function(){ "
-            "processQueue(lines, idx+1, res, btn); }, 2000); "
-            "};";
-    html += "                x2.send();";
-    html += "                return;";
-    html += "             } else {";
-    html +=
-        "                itemDiv.innerHTML = '<div>Code: <b>' + code + "
-        "'</b> - <span style=\"color:#888\">Skipped duplicate</span></div>';";
-    html += "                setTimeout(function(){ processQueue(lines, idx+1, "
-            "res, btn); }, 2000);";
-    html += "             }";
-    html += "          } else {";
-    html += "             disp(itemDiv, xhr, code);";
-    html += "             setTimeout(function(){ processQueue(lines, idx+1, "
-            "res, btn); }, 2000);";
-    html += "          }";
-    html += "       };";
-    html += "       xhr.onerror = function() { itemDiv.innerHTML='<div "
-            "style=\"color:red\">Network Error</div>'; setTimeout(function(){ "
-            "processQueue(lines, "
-            "idx+1, res, btn); }, 2000); };";
-    html += "       xhr.send();";
-    html += "    }";
-    html += "    function disp(el, x, code) {";
-    html += "       if(x.status === 200) {";
-    html += "          var d = JSON.parse(x.responseText);";
-    html += "          el.innerHTML = '<div>Code: <b>' + code + '</b> - <span "
-            "style=\"color:#00ff88\">✅ Added</span> <b>' + d.title + "
-            "'</b></div>';";
-    html += "       } else { el.innerHTML = '<div style=\"color:#f44\">Code: "
-            "<b>' + code + '</b> - ' + x.responseText + '</div>'; }";
-    html += "    }";
-    html += "    document.getElementById('scanForm').onsubmit = function(e) {";
-    html += "        e.preventDefault();";
-    html +=
-        "        var txt = document.getElementById('barcode').value.trim();";
-    html += "        if(!txt) return;";
-    html += "        var lines = "
-            "txt.split(/[\\n,]+/).map(s=>s.trim()).filter(s=>s.length>0);";
-    html += "        if(lines.length===0) return;";
-    html += "        var res = document.getElementById('result');";
-    html += "        var btn = document.querySelector('button');";
-    html += "        btn.disabled = true; res.style.display='block'; "
-            "res.innerHTML='';";
-    html += "        processQueue(lines, 0, res, btn);";
-    html += "    };";
-    html +=
-        "    document.getElementById('barcode').addEventListener('keydown', "
-        "function(e) {";
-    html += "       if(e.key === 'Enter' && !e.shiftKey) { e.preventDefault(); "
-            "document.getElementById('scanForm').dispatchEvent(new "
-            "Event('submit')); }";
-    html += "    });";
-
-    // Auto-submit if authorized and code present
-    if (isAuthenticated && codeArg.length() > 0) {
-      html += "    setTimeout(function(){ var e = new Event('submit'); "
-              "document.getElementById('scanForm').dispatchEvent(e); }, 300);";
-    }
-
-    html += "</script>";
-
-    // Login Overlay
-    html += "<div id='login' "
-            "style='position:fixed;top:0;left:0;width:100%;height:100%;"
-            "background:#000;z-index:9999;display:flex;flex-direction:column;"
-            "align-items:center;justify-content:center;" +
-            displayAuth + "'>";
-    html += "    <h2>Security Check</h2><br>";
-    html += "    <input type='password' id='pin' placeholder='Enter PIN' "
-            "style='width:200px;text-align:center;margin-bottom:10px'>";
-    html += "    <button onclick='sP()' style='width:200px'>Unlock</button>";
-    html += "</div>";
-
-    html += "<script>";
-    html += "function sP(){";
-    html += "  var p = document.getElementById('pin').value;";
-    html += "  localStorage.setItem('web_pin', p);";
-    html += "  location.reload();";
-    html += "}";
-    html += "if(localStorage.getItem('web_pin')) {";
-    html += "  var logDiv = document.getElementById('login');";
-    html += "  if(logDiv) logDiv.style.display='none';";
-    html += "}";
-    html += "</script>";
-
-    html += "</body></html>";
-    server.send(200, "text/html", html);
-  });
-
-  // Manual Cover Link Page
-  server.on("/link", HTTP_GET, []() {
-    // 1. Security Check (Standard UI)
-    if (server.arg("pin") != web_pin) {
-      String html =
-          "<!DOCTYPE html><html><head><meta name='viewport' "
-          "content='width=device-width, initial-scale=1'><title>Login</title>";
-      html +=
-          "<style>* { box-sizing: border-box; } "
-          "body{background:#000;color:#fff;font-family:sans-serif;display:flex;"
-          "justify-content:center;align-items:center;height:100vh;margin:0;}";
-      html += ".card{background:#111;padding:30px;border-radius:10px;border:"
-              "1px solid #333;text-align:center;width:90%;max-width:320px;}";
-      html += "input{width:100%;padding:12px;margin:15px "
-              "0;background:#222;border:1px solid "
-              "#444;color:#fff;border-radius:5px;text-align:center;font-size:"
-              "18px;outline:none;}";
-      html += "input:focus{border-color:#00ff88;}";
-      html += "button{width:100%;padding:12px;background:#00ff88;color:#000;"
-              "border:none;border-radius:5px;font-weight:bold;cursor:pointer;"
-              "font-size:16px;text-transform:uppercase;}";
-      html += "</style></head><body>";
-      html += "<div class='card'>";
-      html += "<h2 style='color:#00ff88;margin-top:0'>SECURE LOGIN</h2>";
-      html += "<p style='color:#888;font-size:14px'>Enter PIN to access Cover "
-              "Tool</p>";
-      html += "<form><input type='password' name='pin' placeholder='PIN' "
-              "autofocus>";
-      html += "<button type='submit'>UNLOCK</button></form>";
-      html += "</div></body></html>";
-      server.send(401, "text/html", html);
-      return;
+    if (status == BATCH_COMMITTED) {
+      for (int id : touched) {
+        if (id == getCurrentItemIndex()) {
+          lvgl_port_lock(-1);
+          update_item_display();
+          lvgl_port_unlock();
+          break;
+        }
+      }
     }
 
-    String pinArg = server.arg("pin");
-    String html = "";
-    html += "<!DOCTYPE html><html><head>";
-    html += "<meta name='viewport' content='width=device-width, "
-            "initial-scale=1, maximum-scale=1'>";
-    html += "<meta charset='UTF-8'><title>" + getModeName() + " Art</title>";
-    html += "<style>";
-    html += ":root { --bg: #000000; --card: #111111; --accent: #00ff88; "
-            "--text: #ffffff; --sub: #666666; --err: #ff4444; }";
-    html += "* { margin: 0; padding: 0; box-sizing: border-box; "
-            "-webkit-font-smoothing: antialiased; }";
-    html += "body { background: var(--bg); color: var(--text); font-family: "
-            "sans-serif; display: flex; flex-direction: column; align-items: "
-            "center; justify-content: center; min-height: 100vh; padding: "
-            "20px; }";
-    html += ".container { width: 100%; max-width: 400px; }";
-    html += "h1 { font-size: 24px; font-weight: 600; margin-bottom: 8px; "
-            "text-align: center; color: var(--accent); }";
-    html += ".subtitle { color: var(--sub); font-size: 14px; text-align: "
-            "center; margin-bottom: 40px; }";
-    html += "input { width: 100%; background: var(--card); border: 1px solid "
-            "#333; color: white; padding: 16px; font-size: 16px; "
-            "border-radius: 12px; outline: none; margin-bottom: 20px; }";
-    html += "input:focus { border-color: var(--accent); }";
-    html += "button { width: 100%; background: var(--accent); color: #000; "
-            "border: none; padding: 16px; font-size: 16px; font-weight: 700; "
-            "border-radius: 12px; cursor: pointer; }";
-    html += "button:disabled { opacity: 0.5; }";
-    html += ".result { margin-top: 30px; padding: 20px; border-radius: 12px; "
-            "background: var(--card); text-align: center; border: 1px solid "
-            "#222; }";
-    html += ".success { border-color: var(--accent); color: var(--accent); }";
-    html += ".error { border-color: var(--err); color: var(--err); }";
-    html += ".links { margin-top: 40px; text-align: center; }";
-    html += "a { color: var(--sub); text-decoration: none; }";
-    html += "</style></head><body>";
-
-    html += "<div class='container'>";
-    html += "<h1>Update " + getModeName() + " Art</h1>";
-    html += "<p class='subtitle'>Enter Unique ID and image URL</p>";
-    html += "<div id='result' style='display:none'></div>";
-    html += "<form id='linkForm'>";
-    html += "<input type='text' id='target_id' placeholder='Unique ID' "
-            "required autocomplete='off' style='text-align:center'>";
-    html += "<input type='text' id='url' "
-            "placeholder='https://example.com/image.jpg' required "
-            "autocomplete='off'>";
-    html += "<button type='submit'>Update " + getModeName() + " Art</button>";
-    html += "</form>";
-
-    html += "</div>";
-
-    html += "<script>";
-    html += "    const PIN = '" + pinArg + "';"; // Server-injected PIN
-    html += "    if(PIN) localStorage.setItem('web_pin', PIN);";
-
-    html += "    function sP(){ ";
-    html += "        var p = document.getElementById('pin').value;";
-    html += "        localStorage.setItem('web_pin', p);";
-    html += "        var url = new URL(window.location.href);";
-    html += "        url.searchParams.set('pin', p);";
-    html += "        window.location.href = url.toString();";
-    html += "    }";
-
-    html += "document.getElementById('linkForm').onsubmit = function(e) {";
-    html += "  e.preventDefault();";
-    html += "  var url = document.getElementById('url').value.trim();";
-    html += "  var tid = document.getElementById('target_id').value.trim();";
-    html += "  var res = document.getElementById('result');";
-    html += "  var btn = document.querySelector('button');";
-    html += "  if(url.length < 5 || tid.length < 1) return;";
-    html += "  btn.innerText = 'Downloading...'; btn.disabled = true; "
-            "res.style.display = 'none';";
-    html += "  var finalUrl = '/api/setcover?url=' + encodeURIComponent(url);";
-    html += "  finalUrl += '&id=' + encodeURIComponent(tid) + '&pin=' + "
-            "localStorage.getItem('web_pin');";
-    html += "  var xhr = new XMLHttpRequest();";
-    html += "  xhr.open('GET', finalUrl, true);";
-    html += "  xhr.onload = function() {";
-    html += "    btn.innerText = 'Update Cover'; btn.disabled = false; "
-            "res.style.display = 'block';";
-    html += "    if (xhr.status === 401) { localStorage.removeItem('web_pin'); "
-            "location.reload(); return; }";
-    html += "    if (xhr.status === 200) {";
-    html += "      res.className = 'result success';";
-    html += "      var data = JSON.parse(xhr.responseText);";
-    html += "      res.innerHTML = `<h2>Cover "
-            "Updated</h2><h3>${data.title}</h3><p>${data.artist}</p><p "
-            "style='margin-top:8px'>${data.year} • ${data.genre}</p>`;";
-    html += "      document.getElementById('url').value = '';";
-    html += "    } else {";
-    html += "      res.className = 'result error'; res.innerText = "
-            "xhr.responseText;";
-    html += "    }";
-    html += "  };";
-    html += "  xhr.send();";
-    html += "};";
-
-    html += "    var savedPin = localStorage.getItem('web_pin');";
-    html += "    if (!PIN && savedPin) {";
-    html += "        if (document.getElementById('login').style.display !== "
-            "'none') {";
-    html += "             window.location.href = '/link?pin=' + savedPin;";
-    html += "        }";
-    html += "    }";
-    html += "</script>";
-
-    html += getWebFooter();
-    html += "</body></html>";
-
-    server.send(200, "text/html", html);
+    int code = status == BATCH_COMMITTED ? 200
+               : status == BATCH_INVALID ? 400
+                                         : 503;
+    beginStream(code, "application/json");
+    ChunkWriter out(sendChunk);
+    out.beginObject().key("committed").boolean(status == BATCH_COMMITTED);
+    out.key("items").number(touched.size());
+    if (error.length() > 0)
+      out.key("error").string(error.c_str());
+    out.key("results").beginArray();
+    for (const BatchOpResult &r : results) {
+      out.beginObject().key("id").number(r.id);
+      out.key("ok").boolean(r.error.length() == 0);
+      if (r.error.length() > 0)
+        out.key("error").string(r.error.c_str());
+      out.endObject();
+    }
+    out.endArray().endObject();
+    endStream(out);
   });
 
-  // API to update cover from URL
-  server.on("/api/setcover", HTTP_GET, []() {
+  // API to update cover from URL. Concurrent so the download doesn't hold up
+  // the serialized routes; the item is found again by uniqueID under
+  // libraryMutex once the file is stored.
+  server.onConcurrent("/api/setcover", HTTP_GET, []() {
     if (server.arg("pin") != web_pin) {
       server.send(401, "text/plain", "Unauthorized: Invalid PIN");
       return;
@@ -1005,14 +1162,21 @@ void setupWebHandlers() {
       return;
     }
 
-    int targetIndex = -1;
     // Linear search for ID (RAM only for speed)
-    for (int i = 0; i < getItemCount(); i++) {
-      if (getItemAtRAM(i).uniqueID == targetID) {
-        targetIndex = i;
-        break;
+    auto findTarget = [&targetID]() {
+      for (int i = 0; i < getItemCount(); i++) {
+        if (getItemAtRAM(i).uniqueID == targetID)
+          return i;
       }
-    }
+      return -1;
+    };
+
+    if (libraryMutex)
+      LOCK_TAKE(libraryMutex, portMAX_DELAY);
+    int targetIndex = findTarget();
+    String title = targetIndex >= 0 ? getItemAtRAM(targetIndex).title : "";
+    if (libraryMutex)
+      LOCK_GIVE(libraryMutex);
 
     if (targetIndex == -1) {
       server.send(404, "text/plain",
@@ -1020,730 +1184,487 @@ void setupWebHandlers() {
       return;
     }
 
-    // Use unified view
-    ItemView item = getItemAt(targetIndex);
-
-    Serial.printf("Manual Cover Update for: %s (Index %d)\n",
-                  item.title.c_str(), targetIndex);
+    Serial.printf("Manual Cover Update for: %s (Index %d)\n", title.c_str(),
+                  targetIndex);
     Serial.printf("URL: %s\n", url.c_str());
 
-    // Ensure filename exists
-    if (item.coverFile.length() == 0 || item.coverFile == "cover_default.jpg") {
-      if (item.uniqueID.length() == 0)
-        item.uniqueID = String(millis()) + "_" + String(random(9999));
-
-      String prefix = getUidPrefix();
-      item.coverFile = prefix + item.uniqueID + ".jpg";
+    // Try download (content-addressed; identical art is stored once)
+    String coverFile = AppNetworkManager::downloadCover(url);
+    if (coverFile.length() == 0) {
+      server.send(500, "text/plain", "Download Failed");
+      return;
     }
 
-    // Try download
-    if (AppNetworkManager::downloadCoverImage(url, item.coverFile)) {
-      // Success
-      item.coverUrl = url;
-
-      // Update Target Item
-      setItem(targetIndex, item);
+    // Update Target Item (it may have moved or gone during the download).
+    // Written as the on-device cover search does, so the detail file is
+    // saved and the cover references move with the item.
+    if (libraryMutex)
+      LOCK_TAKE(libraryMutex, portMAX_DELAY);
+    targetIndex = findTarget();
+    ItemView item;
+    if (targetIndex >= 0) {
+      ensureItemDetailsLoaded(targetIndex);
+      setItemCoverUrl(targetIndex, url);
+      setItemCoverFile(targetIndex, coverFile);
+      if (currentMode == MODE_CD)
+        Storage.saveCD(cdLibrary[targetIndex]);
+      else if (currentMode == MODE_BOOK)
+        Storage.saveBook(bookLibrary[targetIndex]);
       saveLibrary();
+      item = getItemAt(targetIndex);
+    }
+    bool visible = targetIndex >= 0 && targetIndex == getCurrentItemIndex();
+    if (libraryMutex)
+      LOCK_GIVE(libraryMutex);
+    // The download's reference; the item holds its own (or, if it is gone,
+    // this drops a cover nothing uses)
+    CoverStore::release(coverFile);
 
-      // Only refresh screen if we updated the CURRENTLY visible item
-      if (targetIndex == getCurrentItemIndex()) {
-        lvgl_port_lock(-1);
-        load_and_show_cover(item.coverFile);
-        lvgl_port_unlock();
-      }
+    if (targetIndex == -1) {
+      server.send(404, "text/plain",
+                  getModeName() + " not found (ID mismatch)");
+      return;
+    }
 
-      StaticJsonDocument<256> doc;
-      doc["title"] = item.title;
-      doc["artist"] = item.artistOrAuthor;
-      doc["year"] = item.year;
-      doc["genre"] = item.genre;
-      String json;
-      serializeJson(doc, json);
-      server.send(200, "application/json", json);
-    } else {
-      server.send(500, "text/plain", "Download Failed");
+    // Only refresh screen if we updated the CURRENTLY visible item
+    if (visible) {
+      lvgl_port_lock(-1);
+      load_and_show_cover(item.coverFile);
+      lvgl_port_unlock();
     }
+
+    StaticJsonDocument<256> doc;
+    doc["title"] = item.title;
+    doc["artist"] = item.artistOrAuthor;
+    doc["year"] = item.year;
+    doc["genre"] = item.genre;
+    String json;
+    serializeJson(doc, json);
+    server.send(200, "application/json", json);
   });
 
   // 5. Metadata Lookup API (Updated with Duplicate Check)
-  server.on("/api/lookup", HTTP_GET, []() {
+  // Returns 202 {"job":id} at once; the lookup runs on a background worker so
+  // the web server keeps serving while MusicBrainz answers.
+  server.onConcurrent("/api/lookup", HTTP_GET, []() {
     if (server.arg("pin") != web_pin) {
       server.send(401, "text/plain", "Unauthorized");
       return;
     }
     String code = server.arg("barcode");
     bool force = (server.arg("force") == "true");
+    if (code.length() == 0) {
+      server.send(400, "text/plain", "Missing barcode");
+      return;
+    }
 
     // 1. Check for duplicate (unless forced)
+    ItemView item;
     if (!force) {
-      for (int i = 0; i < getItemCount(); i++) {
-        ItemView item = getItemAtRAM(i);
-        // Compare barcodes. Logic: if item.barcode is valid and matches
-        // Also check if barcode length is reasonable
-        if (item.codecOrIsbn == code && code.length() > 3) {
-          // Duplicate found!
-          StaticJsonDocument<256> doc;
-          doc["title"] = item.title;
-          doc["artist"] = item.artistOrAuthor;
-          String json;
-          serializeJson(doc, json);
-          server.send(409, "application/json", json); // 409 Conflict
-          return;
-        }
+      if (findItemByCode(code, item) >= 0) {
+        // Duplicate found!
+        StaticJsonDocument<256> doc;
+        doc["title"] = item.title;
+        doc["artist"] = item.artistOrAuthor;
+        String json;
+        serializeJson(doc, json);
+        server.send(409, "application/json", json); // 409 Conflict
+        return;
       }
     }
 
-    // 2. Lookup & Add
-    ItemView out;
-    if (fetchModeMetadata(code, out)) {
-      // Assign Unique ID
-      // Assign Unique ID if not already set by fetcher
-      if (out.uniqueID.length() == 0) {
-        out.uniqueID = String(millis()) + "_" + String(random(9999));
-      }
-
-      // Assign LED (If not already set by metadata fetcher)
-      if (out.ledIndices.empty()) {
-        out.ledIndices.push_back(getNextLedIndex());
-      }
+    // 2. Lookup & Add in the background; poll /api/lookup/status?job=
+    BackgroundJob job;
+    job.type = JOB_LOOKUP_ADD;
+    job.id = code;
+    job.index = (int)currentMode;
+    job.extraData = force ? "force" : "";
+    uint32_t id = BackgroundWorker::addJob(job);
+
+    StaticJsonDocument<128> doc;
+    doc["job"] = id;
+    doc["code"] = code;
+    String json;
+    serializeJson(doc, json);
+    server.send(202, "application/json", json); // 202 Accepted
+  });
 
-      // Add
-      addItemToLibrary(out);
-      saveLibrary();
+  // 5.0.1. Lookup job result. 202 while queued/running, then the final
+  // answer with the old synchronous status codes (200 added, 409 duplicate,
+  // 404 not found). A result is kept until fetched here or for
+  // JOB_RESULT_TTL_MS; after that the job answers 410 "expired".
+  server.onConcurrent("/api/lookup/status", HTTP_GET, []() {
+    if (server.arg("pin") != web_pin) {
+      server.send(401, "text/plain", "Unauthorized");
+      return;
+    }
+    JobInfo info;
+    uint32_t jobId = server.arg("job").toInt();
+    if (!BackgroundWorker::collectJob(jobId, info)) {
+      if (BackgroundWorker::expired(jobId))
+        server.send(410, "application/json", "{\"status\":\"expired\"}");
+      else
+        server.send(404, "application/json",
+                    "{\"status\":\"unknown job\"}");
+      return;
+    }
+    if (info.type != JOB_LOOKUP_ADD) {
+      server.send(404, "application/json", "{\"status\":\"unknown job\"}");
+      return;
+    }
+    if (info.state == JOB_QUEUED || info.state == JOB_RUNNING) {
+      server.send(202, "application/json",
+                  info.state == JOB_QUEUED ? "{\"status\":\"queued\"}"
+                                           : "{\"status\":\"running\"}");
+      return;
+    }
+    if (info.state == JOB_CANCELLED) {
+      server.send(410, "application/json", "{\"status\":\"cancelled\"}");
+      return;
+    }
+    int code = 404;
+    if (info.result.indexOf("\"status\":\"added\"") >= 0)
+      code = 200;
+    else if (info.result.indexOf("\"status\":\"duplicate\"") >= 0)
+      code = 409;
+    else if (info.result.indexOf("\"status\":\"error\"") >= 0)
+      code = 500;
+    server.send(code, "application/json", info.result);
+  });
 
-      // Select & Show
-      setCurrentItemIndex(getItemCount() - 1);
-      lvgl_port_lock(-1);
-      update_item_display();
-      lvgl_port_unlock();
+  // 5.1. Bulk Lookup API: barcodes=a,b,c (at most MB_BARCODE_BATCH per call).
+  // CD barcodes are resolved with one combined MusicBrainz search, queued as
+  // a job the lookups wait on, then each new code is queued as its own
+  // lookup. Returns 202 with one entry per
+  // code: {"code","status":"queued","job"} to poll at /api/lookup/status, or
+  // "duplicate" (use /api/lookup with force=true to add a copy).
+  server.onConcurrent("/api/lookup_batch", HTTP_ANY, []() {
+    if (server.arg("pin") != web_pin) {
+      server.send(401, "text/plain", "Unauthorized");
+      return;
+    }
 
-      StaticJsonDocument<256> doc;
-      doc["title"] = out.title;
-      doc["artist"] = out.artistOrAuthor;
-      doc["year"] = out.year;
-      doc["genre"] = out.genre;
-      String json;
-      serializeJson(doc, json);
-      server.send(200, "application/json", json);
-    } else {
-      server.send(404, "text/plain", "Not Found");
+    std::vector<String> codes;
+    String list = server.arg("barcodes");
+    int start = 0;
+    while (start < (int)list.length() && codes.size() < MB_BARCODE_BATCH) {
+      int comma = list.indexOf(',', start);
+      if (comma < 0)
+        comma = list.length();
+      String code = list.substring(start, comma);
+      code.trim();
+      if (code.length() > 0 &&
+          std::find(codes.begin(), codes.end(), code) == codes.end())
+        codes.push_back(code);
+      start = comma + 1;
+    }
+    if (codes.empty()) {
+      server.send(400, "text/plain", "Missing barcodes");
+      return;
     }
-  });
 
-  // 6. Remote Browser (Full Featured)
-  server.on("/browse", HTTP_GET, []() {
-    String pinArg = server.arg("pin");
-    bool isAuthenticated = (pinArg == web_pin);
-    String displayAuth = isAuthenticated ? "display:none !important;" : "";
-
-    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-    server.send(200, "text/html; charset=utf-8", ""); // Start chunked transfer
-
-    // 1. Send HEAD and STYLES
-    String chunk = "<!DOCTYPE html><html><head>";
-    chunk +=
-        "<meta name='viewport' content='width=device-width, initial-scale=1'>";
-    chunk += "<title>Remote " + getModeName() + " Control</title>";
-    chunk += "<style>";
-    chunk += "* { box-sizing: border-box; }";
-    chunk += "body { background: #000; color: #fff; font-family: sans-serif; "
-             "padding: 20px; padding-bottom: 80px; max-width: 600px; margin: 0 "
-             "auto; }";
-    chunk +=
-        ".cd { background: #111; border: 1px solid #333; padding: 15px; "
-        "margin-bottom: 10px; border-radius: 8px; display: flex; align-items: "
-        "center; justify-content: space-between; gap: 10px; }";
-    chunk += ".cd-info { flex: 1; min-width: 0; padding-right: 10px; overflow: "
-             "hidden; }";
-    chunk += ".cd:active { background: #222; }";
-    chunk +=
-        ".cd h3 { margin: 0; font-size: 16px; color: #00ff88; white-space: "
-        "nowrap; overflow: hidden; text-overflow: ellipsis; }";
-    chunk +=
-        ".cd p { margin: 4px 0 0; color: #888; font-size: 14px; white-space: "
-        "nowrap; overflow: hidden; text-overflow: ellipsis; }";
-
-    // Buttons
-    chunk += ".btn-group { display: flex; align-items: center; gap: 8px; "
-             "flex-shrink: 0; }";
-    chunk += ".btn-go { padding: 10px 18px; background: #00ff88; color: #000; "
-             "border: none; border-radius: 6px; font-weight: bold; cursor: "
-             "pointer; text-transform: uppercase; font-size: 14px; }";
-    chunk +=
-        ".btn-edit { padding: 10px 18px; background: #ff8800; color: #fff; "
-        "border: none; border-radius: 6px; font-weight: bold; cursor: "
-        "pointer; text-transform: uppercase; font-size: 14px; }";
-    chunk += ".btn-edit:hover { background: #ff9922; }";
-
-    chunk += "input { width: 100%; padding: 12px; margin-bottom: 20px; "
-             "background: #222; border: 1px solid #444; color: white; "
-             "border-radius: 8px; font-size: 16px; outline: none; }";
-    chunk += "input:focus { border-color: #00ff88; }";
-
-    // Modal CSS
-    chunk +=
-        ".modal { display:none; position:fixed; top:0; left:0; width:100%; "
-        "height:100%; background:rgba(0,0,0,0.9); z-index:1000; padding:20px; "
-        "box-sizing:border-box; overflow-y:auto; }";
-    chunk += ".modal-content { background:#111; padding:20px; border:1px solid "
-             "#333; border-radius:10px; max-width:500px; margin:20px auto; }";
-    chunk += "label { display:block; margin-bottom:5px; color:#888; "
-             "font-size:12px; }";
-
-    chunk += "</style></head><body>";
-    server.sendContent(chunk);
-
-    // 2. Send BODY Content (Headers & Filters)
-    chunk = "<h1>Library Remote</h1>";
-    chunk += "<input type='text' id='search' placeholder='Search...' "
-             "onkeyup='filter()'>";
-
-    // Filter Controls Container
-    chunk += "<div style='display:flex; gap:10px; margin-bottom:20px; "
-             "flex-wrap:wrap;'>";
-
-    // Genre Filter
-    chunk += "<select id='filterGenre' onchange='filter()' "
-             "style='padding:10px; background:#222; color:white; border:1px "
-             "solid #444; border-radius:6px; height:44px;'>";
-    chunk += "<option value=''>All Genres</option>";
-    server.sendContent(chunk);
-
-    // Build unique genre list (Streamed)
-    std::vector<String> web_genres;
-    int totalItems = getItemCount();
-    for (int i = 0; i < totalItems; i++) {
-      ItemView item = getItemAtRAM(i);
-      bool found = false;
-      for (const auto &g : web_genres)
-        if (g.equalsIgnoreCase(item.genre))
-          found = true;
-      if (!found && item.genre.length() > 0) {
-        web_genres.push_back(item.genre);
-        String safeG = escapeHTML(item.genre);
-        String opt = "<option value=\"" + safeG + "\">" + safeG + "</option>";
-        server.sendContent(opt);
+    DynamicJsonDocument doc(4096);
+    JsonArray results = doc.to<JsonArray>();
+
+    // 1. Duplicates
+    std::vector<String> pending;
+    if (libraryMutex)
+      LOCK_TAKE(libraryMutex, portMAX_DELAY);
+    for (const String &code : codes) {
+      ItemView item;
+      if (findItemByCode(code, item) < 0) {
+        pending.push_back(code);
+        continue;
       }
+      JsonObject r = results.createNestedObject();
+      r["code"] = code;
+      r["status"] = "duplicate";
+      r["title"] = item.title;
+      r["artist"] = item.artistOrAuthor;
     }
-    server.sendContent("</select>");
-
-    // Decade & Favorites Filters
-    chunk = "<select id='filterDecade' onchange='filter()' "
-            "style='padding:10px; background:#222; color:white; border:1px "
-            "solid #444; border-radius:6px; height:44px;'>";
-    chunk += "<option value=''>All Decades</option>";
-    chunk += "<option value='60'>60s</option><option "
-             "value='70'>70s</option><option value='80'>80s</option>";
-    chunk += "<option value='90'>90s</option><option "
-             "value='00'>2000s</option><option "
-             "value='10'>2010s</option><option value='20'>2020s</option>";
-    chunk += "</select>";
-
-    chunk += "<label style='display:flex; align-items:center; gap:8px; "
-             "padding:10px; background:#222; border:1px solid #444; "
-             "border-radius:6px; height:44px;'>";
-    chunk += "<input type='checkbox' id='filterFav' onchange='filter()' "
-             "style='width:auto; margin:0;'>";
-    chunk += "<span>&#9733; Favorites Only</span></label>";
-    chunk += "</div>";
-
-    chunk += "<div id='list'></div>";
-
-    // EDIT MODAL
-    chunk += "<div id='edit-modal' class='modal'><div "
-             "class='modal-content'><h2>Edit Details</h2>";
-    chunk += "<input type='hidden' id='edit-id'>";
-    chunk += "<label>Title</label><input id='edit-title'>";
-    String artistLabel = getArtistOrAuthorLabel();
-    chunk += "<label>" + artistLabel + "</label><input id='edit-artist'>";
-    chunk += "<label>Genre</label><input id='edit-genre'>";
-    chunk += "<label>Year</label><input id='edit-year'>";
-    chunk += "<label>Unique ID</label><input id='edit-uniqueID'>";
-    chunk += "<label>LED Index <span "
-             "style='font-size:11px;opacity:0.6'>(comma-separated, e.g., "
-             "10,11,12)</span></label>";
-    chunk += "<div style='display:flex;gap:8px;align-items:stretch'>";
-    chunk += "<input id='edit-ledIndex' type='text' style='flex:1;padding:10px "
-             "12px;font-size:14px'>";
-    chunk +=
-        "<button onclick='openLEDSelector()' type='button' style='padding:10px "
-        "16px;background:#00ff88;color:#000;border:none;border-radius:6px;font-"
-        "weight:bold;cursor:pointer;white-space:nowrap'>🎯 SELECT "
-        "LEDs</button>";
-    chunk += "</div>";
-    String barcodeLabel = getCodeLabel();
-    if (barcodeLabel.endsWith(":"))
-      barcodeLabel =
-          barcodeLabel.substring(0, barcodeLabel.length() - 1); // remove ':'
-    chunk += "<label>" + barcodeLabel + "</label><input id='edit-barcode'>";
-    chunk += "<label>Notes</label><input id='edit-notes'>";
-    chunk += "<label style='display:flex;align-items:center;gap:10px'><input "
-             "type='checkbox' id='edit-fav' style='width:auto;margin:0'> "
-             "Favorite</label>";
-    chunk += "<div style='display:flex; gap:10px; margin-top:20px;'>";
-    chunk += "<button onclick='saveEdit()' style='flex:1; padding:12px; "
-             "background:#00ff88; color:#000; border:none; border-radius:6px; "
-             "font-weight:bold; cursor:pointer;'>SAVE CHANGES</button>";
-    chunk += "<button "
-             "onclick=\"document.getElementById('edit-modal').style.display='"
-             "none'\" style='flex:1; padding:12px; background:#444; "
-             "color:#fff; border:none; border-radius:6px; font-weight:bold; "
-             "cursor:pointer;'>CANCEL</button>";
-    chunk += "</div>";
-    chunk += "</div></div>";
-
-    server.sendContent(chunk);
-
-    // 3. Send SCRIPT - Start
-    chunk = "<script>";
-    chunk += "window.onerror = function(msg, url, line, col, error) { "
-             "alert('JS Error: ' + msg); return false; };";
-    chunk += "const PIN = '" + escapeJSON(pinArg) + "';"; // ESCAPED PIN
-    chunk += "if(PIN) localStorage.setItem('web_pin', PIN);";
-    chunk += "const library = [";
-    server.sendContent(chunk);
-
-    // 4. Send LIBRARY JSON Data (Streamed item by item)
-    int totalCount = getItemCount();
-    for (int i = 0; i < totalCount; i++) {
-      ItemView iv = getItemAtRAM(i);
-      String item = "{";
-      item += "\"id\":" + String(i) + ",";
-      item += "\"title\":\"" + escapeJSON(iv.title) + "\",";
-      item += "\"artist\":\"" + escapeJSON(iv.artistOrAuthor) + "\",";
-      item += "\"year\":" + String(iv.year) + ",";
-      item += "\"genre\":\"" + escapeJSON(iv.genre) + "\",";
-      item += "\"uniqueID\":\"" + escapeJSON(iv.uniqueID) + "\",";
-      String lArr = "[";
-      for (size_t k = 0; k < iv.ledIndices.size(); k++) {
-        lArr += String(iv.ledIndices[k]);
-        if (k < iv.ledIndices.size() - 1)
-          lArr += ",";
+    if (libraryMutex)
+      LOCK_GIVE(libraryMutex);
+
+    // 2. One combined search for the CD barcodes, queued ahead of the
+    // lookups, which wait for its results
+    if (currentMode == MODE_CD && pending.size() > 1) {
+      std::vector<String> searched;
+      String ids;
+      for (const String &code : pending) {
+        if (!MediaManager::isBarcode(code))
+          continue;
+        searched.push_back(code);
+        if (ids.length() > 0)
+          ids += ",";
+        ids += code;
+      }
+      if (searched.size() > 1) {
+        MediaManager::expectReleases(searched);
+        BackgroundJob job;
+        job.type = JOB_LOOKUP_BATCH;
+        job.id = ids;
+        job.index = (int)currentMode;
+        // Ends the wait even if the search is cancelled before it runs
+        job.onComplete = [searched](bool, String) {
+          MediaManager::stashReleases(searched, {});
+        };
+        BackgroundWorker::addJob(job);
       }
-      lArr += "]";
-      item += "\"ledIndices\":" + lArr + ",";
-
-      // Legacy compatibility: ledIndex = first element or -1
-      int lFirst = iv.ledIndices.empty() ? -1 : iv.ledIndices[0];
-      item += "\"ledIndex\":" + String(lFirst) + ",";
-      item += "\"barcode\":\"" + escapeJSON(iv.codecOrIsbn) + "\",";
-      item += "\"notes\":\"" + escapeJSON(iv.notes) + "\",";
-      item += "\"favorite\":" + String(iv.favorite ? "true" : "false");
-      item += "},";
-      server.sendContent(item);
-      if (i % 10 == 0)
-        yield();
-    }
-    server.sendContent("];");
-
-    // 5. Send Rest of SCRIPT (Render logic)
-    chunk = "const list = document.getElementById('list');";
-    chunk += "function render(items) {";
-    chunk += "  list.innerHTML = '';";
-    chunk += "  items.forEach(cd => {";
-    chunk += "    const div = document.createElement('div');";
-    chunk += "    div.className = 'cd';";
-    chunk +=
-        "    const safeT = cd.title.replace(/\"/g, '&quot;');"; // Extra safety
-    chunk += "    div.innerHTML = `<div "
-             "class='cd-info'><h3>${cd.title}</h3><p>${cd.artist}</p></div>";
-    chunk += "                     <div class='btn-group'>";
-    chunk += "                       <button class='btn-edit' "
-             "onclick='event.stopPropagation(); edit(${cd.id})'>EDIT</button>";
-    chunk += "                       <button class='btn-go' "
-             "onclick='event.stopPropagation(); select(${cd.id})'>GO</button>";
-    chunk += "                     </div>`;";
-    chunk += "    list.appendChild(div);";
-    chunk += "  });";
-    chunk += "}";
-    chunk += "render(library);"; // Initial Render
-
-    // EDIT & SAVE LOGIC
-    chunk += "function edit(id) { ";
-    chunk += "select(id); "; // Select the CD on main UI first!
-    chunk += "const cd = library.find(c=>c.id==id); "
-             "if(!cd)return; ";
-    chunk += "document.getElementById('edit-id').value=id; "
-             "document.getElementById('edit-title').value=cd.title; ";
-    chunk += "document.getElementById('edit-artist').value=cd.artist; "
-             "document.getElementById('edit-genre').value=cd.genre; ";
-    chunk += "document.getElementById('edit-year').value=cd.year; ";
-    chunk += "document.getElementById('edit-uniqueID').value=cd.uniqueID; ";
-    chunk += "document.getElementById('edit-ledIndex').value=cd.ledIndices?cd."
-             "ledIndices.join(','):cd.ledIndex; "; // Support both formats
-    chunk += "document.getElementById('edit-barcode').value=cd.barcode; ";
-    chunk += "document.getElementById('edit-notes').value=cd.notes; ";
-    chunk += "document.getElementById('edit-fav').checked=cd.favorite; ";
-    chunk += "document.getElementById('edit-modal').style.display='block'; ";
-    chunk += "setTimeout(()=>{const "
-             "f=document.getElementById('edit-ledIndex');if(f){f.oninput="
-             "previewEditLEDs;previewEditLEDs();}},100); ";
-    chunk += "}";
-
-    // LED Selector Integration
-    chunk += "let ledSelectorWindow=null;";
-    chunk += "function openLEDSelector(){";
-    chunk += "const id=document.getElementById('edit-id').value;";
-    chunk += "if(!id && id!==0){alert('Please save the CD first');return;}";
-    chunk += "ledSelectorWindow=window.open('/"
-             "led-select?cd='+id,'LEDSelector','width=800,height=600');";
-    chunk += "}";
-
-    // Listen for LED selections from child window
-    chunk += "function handleLedUpdate(leds){";
-    chunk += "console.log('Received LED update:', leds);";
-    chunk += "const el=document.getElementById('edit-ledIndex');";
-    chunk += "if(el){el.value=leds; previewEditLEDs();}";
-    chunk += "const id=document.getElementById('edit-id').value;";
-    chunk += "const cd=library.find(c=>c.id==id);";
-    chunk += "if(cd){cd.ledIndices=leds.split(',').map(n=>parseInt(n));}";
-    chunk += "}";
-
-    chunk += "window.addEventListener('message',function(e){";
-    chunk += "if(e.data && "
-             "e.data.type==='led-update'){handleLedUpdate(e.data.leds);}";
-    chunk += "});";
-
-    chunk +=
-        "try{const bc=new BroadcastChannel('led_channel');bc.onmessage=(e)=>{";
-    chunk += "if(e.data && "
-             "e.data.type==='led-update'){handleLedUpdate(e.data.leds);}";
-    chunk += "};}catch(e){console.log('BC Setup Error',e);}";
-
-    // Real-time LED preview for edit field
-    chunk += "let previewEditTimer=null;";
-    chunk += "function previewEditLEDs(){";
-    chunk += "clearTimeout(previewEditTimer);";
-    chunk += "previewEditTimer=setTimeout(()=>{";
-    chunk += "const leds=document.getElementById('edit-ledIndex').value;";
-    chunk += "if(!leds)return;";
-    chunk += "fetch('/api/"
-             "control',{method:'POST',headers:{'Content-Type':'application/"
-             "x-www-form-urlencoded'},body:'action=ledpreview&leds='+leds})";
-    chunk += ".catch(e=>console.error('Preview error:',e));";
-    chunk += "},200);";
-    chunk += "}";
-
-    // Attach to LED Index field
-    chunk += "document.addEventListener('DOMContentLoaded',function(){";
-    chunk += "const ledField=document.getElementById('edit-ledIndex');";
-    chunk +=
-        "if(ledField){ledField.addEventListener('input',previewEditLEDs);}";
-    chunk += "});";
-    chunk += "";
-
-    chunk += "function saveEdit() {";
-    chunk += "  var id=document.getElementById('edit-id').value; var "
-             "t=document.getElementById('edit-title').value; ";
-    chunk += "  var a=document.getElementById('edit-artist').value; var "
-             "g=document.getElementById('edit-genre').value; ";
-    chunk += "  var y=document.getElementById('edit-year').value; var "
-             "f=document.getElementById('edit-fav').checked; ";
-    chunk += "  var uid=document.getElementById('edit-uniqueID').value; ";
-    chunk += "  var li=document.getElementById('edit-ledIndex').value; ";
-    chunk += "  var bc=document.getElementById('edit-barcode').value; ";
-    chunk += "  var n=document.getElementById('edit-notes').value; ";
-
-    chunk +=
-        "  doAction('edit', "
-        "'&id='+id+'&title='+encodeURIComponent(t)+'&artist='+"
-        "encodeURIComponent(a)+'&genre='+encodeURIComponent(g)+'&year='+y+"
-        "'&fav='+f+'&uniqueID='+encodeURIComponent(uid)+'&ledIndex='+li+'&"
-        "barcode='+encodeURIComponent(bc)+'&notes='+encodeURIComponent(n)); ";
-
-    chunk += "  var cd = library.find(c=>c.id==id); if(cd){ cd.title=t; "
-             "cd.artist=a; cd.genre=g; cd.year=y; cd.favorite=f; "
-             "cd.uniqueID=uid; cd.ledIndex=li; cd.barcode=bc; cd.notes=n; "
-             "render(library); } ";
-    chunk += "  document.getElementById('edit-modal').style.display='none'; }";
-
-    chunk += "function filter() {";
-    chunk +=
-        "  const q = document.getElementById('search').value.toLowerCase();";
-    chunk += "  const genreFilter = "
-             "document.getElementById('filterGenre').value.toLowerCase();";
-    chunk +=
-        "  const decadeFilter = document.getElementById('filterDecade').value;";
-    chunk +=
-        "  const favFilter = document.getElementById('filterFav').checked;";
-    chunk += "  const filtered = library.filter(cd => {";
-    chunk += "    if (q && !cd.title.toLowerCase().includes(q) && "
-             "!cd.artist.toLowerCase().includes(q)) return false;";
-    chunk += "    if (genreFilter && cd.genre.toLowerCase() !== genreFilter) "
-             "return false;";
-    chunk += "    if (decadeFilter) {";
-    chunk += "      const cdDecade = Math.floor(cd.year / 10) * 10;";
-    chunk += "      let targetDecade = parseInt(decadeFilter);";
-    chunk += "      if (targetDecade < 50) targetDecade += 2000; else "
-             "targetDecade += 1900;";
-    chunk += "      if (cdDecade !== targetDecade) return false;";
-    chunk += "    }";
-    chunk += "    if (favFilter && !cd.favorite) return false;";
-    chunk += "    return true;";
-    chunk += "  });";
-    chunk += "  render(filtered);";
-    chunk += "  const hasFilters = genreFilter || decadeFilter || favFilter;";
-
-    // SECURE ACTION CALL
-    chunk += "  if (hasFilters) {";
-    chunk += "    const genre = document.getElementById('filterGenre').value;";
-    chunk +=
-        "    doAction('applyfilter', '&genre=' + encodeURIComponent(genre) + "
-        "'&decade=' + decadeFilter + '&favorites=' + favFilter);";
-    chunk += "  } else {";
-    chunk += "    doAction('clearfilter');";
-    chunk += "  }";
-    chunk += "}";
-
-    chunk += "function select(id) { doAction('select', '&id='+id); }";
-
-    // SECURE doAction
-    chunk += "function doAction(act, params='') {";
-    chunk += "  var p = localStorage.getItem('web_pin');";
-    chunk += "  if (!p) return;";
-    chunk +=
-        "  fetch('/api/control?pin=' + encodeURIComponent(p) + '&action=' + "
-        "encodeURIComponent(act) + params).then(r=>console.log(r.status));";
-    chunk += "}";
-
-    chunk += "</script>";
-
-    // Login Overlay
-    chunk += "<div id='login' "
-             "style='position:fixed;top:0;left:0;width:100%;height:100%;"
-             "background:#000;z-index:9999;display:flex;align-items:center;"
-             "justify-content:center;" +
-             displayAuth + "'>";
-    chunk += "<div "
-             "style='background:#111;padding:30px;border-radius:10px;border:"
-             "1px solid #333;text-align:center;width:90%;max-width:320px;'>";
-    chunk += "<h2 style='color:#00ff88;margin-top:0'>SECURE LOGIN</h2>";
-    chunk +=
-        "<p style='color:#888;font-size:14px'>Enter PIN to access Library</p>";
-    chunk += "<input type='password' id='pin' placeholder='PIN' "
-             "style='width:100%;padding:12px;margin:15px "
-             "0;background:#222;border:1px solid "
-             "#444;color:#fff;border-radius:5px;text-align:center;font-size:"
-             "18px;outline:none;' autofocus>";
-    chunk += "<button onclick='sP()' "
-             "style='width:100%;padding:12px;background:#00ff88;color:#000;"
-             "border:none;border-radius:5px;font-weight:bold;cursor:pointer;"
-             "font-size:16px;text-transform:uppercase;'>UNLOCK</button>";
-    chunk += "</div></div>";
-
-    chunk +=
-        "<script>function sP(){ var p = document.getElementById('pin').value; "
-        "localStorage.setItem('web_pin', p); location.reload(); }";
-    chunk += "if(localStorage.getItem('web_pin')) { var logDiv = "
-             "document.getElementById('login'); if(logDiv) "
-             "logDiv.style.display='none'; }</script>";
-
-    chunk += getWebFooter();
-    chunk += "</body></html>";
-    server.sendContent(chunk);
-    server.sendContent(""); // End chunked transfer
+    }
+
+    // 3. Per-item details, LED, add and save run as JOB_LOOKUP_ADD
+    for (const String &code : pending) {
+      BackgroundJob job;
+      job.type = JOB_LOOKUP_ADD;
+      job.id = code;
+      job.index = (int)currentMode;
+      job.extraData = "";
+      JsonObject r = results.createNestedObject();
+      r["code"] = code;
+      r["status"] = "queued";
+      r["job"] = BackgroundWorker::addJob(job);
+    }
+
+    String json;
+    serializeJson(doc, json);
+    server.send(202, "application/json", json); // 202 Accepted
   });
 
-  // 4. Backup & Restore
-  server.on("/backup", HTTP_GET, []() {
-    if (server.arg("pin") != web_pin) {
-      String html =
-          "<!DOCTYPE html><html><head><meta name='viewport' "
-          "content='width=device-width, initial-scale=1'><title>Login</title>";
-      html +=
-          "<style>* { box-sizing: border-box; } "
-          "body{background:#000;color:#fff;font-family:sans-serif;display:flex;"
-          "justify-content:center;align-items:center;height:100vh;margin:0;}";
-      html += ".card{background:#111;padding:30px;border-radius:10px;border:"
-              "1px solid #333;text-align:center;width:90%;max-width:320px;}";
-      html += "input{width:100%;padding:12px;margin:15px "
-              "0;background:#222;border:1px solid "
-              "#444;color:#fff;border-radius:5px;text-align:center;font-size:"
-              "18px;outline:none;}";
-      html += "input:focus{border-color:#00ff88;} "
-              "button{width:100%;padding:12px;background:#00ff88;color:#000;"
-              "border:none;border-radius:5px;font-weight:bold;cursor:pointer;"
-              "font-size:16px;text-transform:uppercase;}";
-      html +=
-          "</style></head><body><div class='card'><h2 "
-          "style='color:#00ff88;margin-top:0'>SECURE LOGIN</h2><p "
-          "style='color:#888;font-size:14px'>Enter PIN to access backups</p>";
-      html += "<form><input type='password' name='pin' placeholder='PIN' "
-              "autofocus><button "
-              "type='submit'>UNLOCK</button></form></div></body></html>";
-      server.send(401, "text/html", html);
+  // 5.2. Library items, one page per call. limit (default
+  // ITEMS_PAGE_DEFAULT), cursor (the previous page's "next"),
+  // fields=title,artist,... (default all), q (title/artist substring), genre,
+  // decade (e.g. 1990), fav=1; or id=<position> for just that item. The ETag
+  // follows LibraryRevision, so a client revalidating an unchanged library
+  // gets 304. 409 = cursor no longer valid.
+  server.onConcurrent("/api/items", HTTP_GET, []() {
+    String etag = LibraryRevision::etag();
+    if (server.header("If-None-Match") == etag) {
+      server.sendHeader("ETag", etag);
+      server.send(304);
+      return;
+    }
+
+    ItemFilter filter;
+    filter.text = server.arg("q");
+    filter.text.trim();
+    filter.text.toLowerCase();
+    filter.genre = server.arg("genre");
+    filter.decade = server.arg("decade").toInt();
+    filter.favoritesOnly =
+        server.arg("fav") == "1" || server.arg("fav") == "true";
+    int limit = server.hasArg("limit") ? server.arg("limit").toInt()
+                                       : ITEMS_PAGE_DEFAULT;
+    limit = constrain(limit, 1, ITEMS_PAGE_MAX);
+
+    // Built under libraryMutex, so spool it and send once the lock is
+    // released: a slow client mustn't hold up the library
+    ChunkSpool items;
+    items.reserve(limit * 160);
+    ItemPage page;
+    bool ok = true;
+    {
+      ChunkWriter spool(ChunkWriter::into(items));
+      uint16_t fields = parseItemFields(server.arg("fields"));
+      if (server.hasArg("id"))
+        buildItemByPosition(server.arg("id").toInt(), fields, spool, page);
+      else
+        ok = buildItemPage(filter, server.arg("cursor"), limit, fields, spool,
+                           page);
+    }
+    if (!ok) {
+      server.send(409, "application/json", "{\"error\":\"stale cursor\"}");
       return;
     }
 
-    String html =
-        "<!DOCTYPE html><html><head><meta charset='UTF-8'><title>Backup & "
-        "Restore</title><meta name='viewport' content='width=device-width, "
-        "initial-scale=1'></head>";
-    html += "<body style='font-family:sans-serif; background:#000; color:#fff; "
-            "padding:20px; max-width:600px; margin:0 auto;'>";
-    html += "<h1 style='color:#00ff88'>Backup & Restore</h1>";
-    String libFile = getLibraryFileName();
-    html +=
-        "<p>Manage your library database (<code>" + libFile + "</code>).</p>";
-
-    // Export (JSONL)
-    html += "<div style='background:#111; padding:20px; border:1px solid #333; "
-            "border-radius:10px; margin-bottom:20px;'>";
-    html += "<h2>⬇️ Export Library</h2><p style='color:#ccc'>Download all data "
-            "as a single .jsonl file (Line-delimited JSON).</p>";
-    html += "<a href='/api/export_backup?pin=" + String(web_pin) +
-            "' download='library_backup.jsonl'><button style='padding:12px "
-            "25px; background:#00ff88; color:#000; border:none; "
-            "border-radius:5px; font-weight:bold; cursor:pointer;'>EXPORT "
-            "FULL BACKUP</button></a>";
-    html += "</div>";
-
-    // Import (JSONL)
-    html += "<div style='background:#111; padding:20px; border:1px solid #333; "
-            "border-radius:10px;'>";
-    html += "<h2>⬆️ Import Backup</h2><p style='color:#ffaa00'>⚠️ Warning: "
-            "Adds/Overwrites items from the backup file.</p>";
-    html += "<form method='POST' action='/api/import_backup?pin=" +
-            String(web_pin) + "' enctype='multipart/form-data'>";
-    html +=
-        "<input type='file' name='data' accept='.jsonl' onchange='var "
-        "b=document.getElementById(\"btnR\"); b.disabled=!this.files.length; "
-        "b.style.opacity=this.files.length?1:0.5; "
-        "b.style.cursor=this.files.length?\"pointer\":\"not-allowed\";' "
-        "style='margin-bottom:15px; width:100%; padding:10px; background:#222; "
-        "border:1px solid #444; border-radius:5px;'><br>";
-    html +=
-        "<input type='submit' id='btnR' value='RESTORE FROM BACKUP' disabled "
-        "style='padding:12px 25px; background:#ff4444; color:#fff; "
-        "border:none; border-radius:5px; font-weight:bold; "
-        "cursor:not-allowed; opacity:0.5;'>";
-    html += "</form></div>";
-
-    html += "<div style='margin-top: 40px; border-top: 1px solid #333; "
-            "padding-top: 20px;'>";
-    html += "<h3 style='text-align:center; color:#fff; font-size: 14px; "
-            "margin-bottom: 15px; text-transform: uppercase; letter-spacing: "
-            "1px;'>Navigation</h3>";
-    html += "<div style='display: grid; grid-template-columns: repeat(5, 1fr); "
-            "gap: 10px;'>";
-    html += "<button onclick=\"location.href='/browse'\" style='font-size: "
-            "13px; padding: 10px;'>&#128241; Remote</button>";
-    html += "<button onclick=\"location.href='/scan'\" style='font-size: 13px; "
-            "padding: 10px;'>&#128247; Scanner</button>";
-    html += "<button onclick=\"location.href='/link'\" style='font-size: 13px; "
-            "padding: 10px;'>&#128444; Covers</button>";
-    html += "<button onclick=\"location.href='/backup'\" style='font-size: "
-            "13px; padding: 10px;'>&#128190; Backup</button>";
-    html += "<button onclick=\"location.href='/manual'\" style='font-size: "
-            "13px; padding: 10px;'>&#128214; Manuals</button>";
-    html += "</div></div>";
-    html += "</body></html>";
-    server.send(200, "text/html; charset=utf-8", html);
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", "no-cache");
+    beginStream(200, "application/json");
+    ChunkWriter out(sendChunk);
+    out.beginObject().key("epoch").hex(LibraryRevision::epoch());
+    out.key("rev").number(page.rev).key("total").number(page.total);
+    out.key("next");
+    if (page.next.length() > 0)
+      out.string(page.next.c_str());
+    else
+      out.null();
+    out.key("items").beginArray().raw(items.data(), items.size());
+    out.endArray().endObject();
+    endStream(out);
+  });
+
+  // 5.3. Distinct genres of the current library (filter menu), same ETag as
+  // /api/items.
+  server.onConcurrent("/api/genres", HTTP_GET, []() {
+    String etag = LibraryRevision::etag();
+    if (server.header("If-None-Match") == etag) {
+      server.sendHeader("ETag", etag);
+      server.send(304);
+      return;
+    }
+
+    std::vector<String> genres = getLibraryGenres();
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", "no-cache");
+    beginStream(200, "application/json");
+    ChunkWriter out(sendChunk);
+    out.beginObject().key("genres").beginArray();
+    for (const String &g : genres)
+      out.string(g.c_str());
+    out.endArray().endObject();
+    endStream(out);
+  });
+
+  // 5.4. Change feed: what changed in the current library after revision
+  // `since` (the "rev" of /api/items or of an earlier call). Deletes come
+  // first, with the id the item had; then upserts with each item's current
+  // state. "resync":true = the log doesn't reach back that far, the library
+  // was reordered/reloaded, or `epoch` is from before a reboot: reload from
+  // /api/items.
+  server.onConcurrent("/api/changes", HTTP_GET, []() {
+    uint32_t epoch = LibraryRevision::epoch();
+    uint32_t since = strtoul(server.arg("since").c_str(), nullptr, 10);
+    bool sameBoot = !server.hasArg("epoch") ||
+                    strtoul(server.arg("epoch").c_str(), nullptr, 16) == epoch;
+
+    ChunkSpool changes; // Spooled for the same reason as /api/items
+    uint32_t rev = LibraryRevision::current();
+    bool ok = false;
+    if (sameBoot) {
+      ChunkWriter spool(ChunkWriter::into(changes));
+      ok = buildChangesSince(since, spool, rev);
+    }
+
+    server.sendHeader("Cache-Control", "no-store");
+    beginStream(200, "application/json");
+    ChunkWriter out(sendChunk);
+    out.beginObject().key("epoch").hex(epoch).key("rev").number(rev);
+    out.key("resync").boolean(!ok).key("changes").beginArray();
+    out.raw(changes.data(), changes.size()).endArray().endObject();
+    endStream(out);
+  });
+
+  // 5.5. What the static pages need to know about the device: the current
+  // mode's names and labels, LED count, lookup batch size.
+  server.onConcurrent("/api/config", HTTP_GET, []() {
+    StaticJsonDocument<384> doc;
+    String codeLabel = getCodeLabel();
+    if (codeLabel.endsWith(":"))
+      codeLabel.remove(codeLabel.length() - 1);
+    doc["mode"] = (int)currentMode;
+    doc["modeName"] = getModeName();
+    doc["modeNamePlural"] = getModeNamePlural();
+    doc["artistLabel"] = getArtistOrAuthorLabel();
+    doc["codeLabel"] = codeLabel;
+    doc["libraryFile"] = getLibraryFileName();
+    doc["ledCount"] = led_count;
+    doc["batchSize"] = MB_BARCODE_BATCH;
+    String out;
+    serializeJson(doc, out);
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", out);
   });
 
   // 5. Export Backup (JSONL)
-  server.on("/api/export_backup", HTTP_GET, []() {
+  server.onConcurrent("/api/export_backup", HTTP_GET, []() {
     if (server.arg("pin") != web_pin)
       return server.send(401, "text/plain", "Unauthorized");
 
     server.sendHeader("Content-Disposition",
                       "attachment; filename=\"library_backup.jsonl\"");
-    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-    server.send(200, "application/ndjson", ""); // Newline Delimited JSON
-
-    if (sdExpander)
-      sdExpander->digitalWrite(SD_CS, LOW);
+    beginStream(200, "application/ndjson"); // Newline Delimited JSON
+    ChunkWriter out(sendChunk);
+
+    // Runs alongside other handlers: stream from a snapshot of the ids so
+    // the library lock isn't held for the whole download
+    std::vector<String> cdIDs, bookIDs;
+    if (libraryMutex &&
+        LOCK_TAKE(libraryMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
+      endStream(out);
+      return;
+    }
+    cdIDs.reserve(cdLibrary.size());
+    for (const auto &item : cdLibrary)
+      cdIDs.push_back(item.uniqueID.c_str());
+    bookIDs.reserve(bookLibrary.size());
+    for (const auto &item : bookLibrary)
+      bookIDs.push_back(item.uniqueID.c_str());
+    if (libraryMutex)
+      LOCK_GIVE(libraryMutex);
+
+    // No CS toggling here: each Storage load selects the card under i2cMutex
+    // itself, so other handlers can use the expander between records
 
     // Export CDs
-    for (const auto &item : cdLibrary) {
+    for (const auto &uid : cdIDs) {
       CD fullCD;
-      if (Storage.loadCDDetail(item.uniqueID.c_str(), fullCD)) {
-        DynamicJsonDocument doc(2048);
-        doc["type"] = "cd";
-        JsonObject data = doc.createNestedObject("data");
-        data["title"] = fullCD.title.c_str();
-        data["artist"] = fullCD.artist.c_str();
-        data["genre"] = fullCD.genre.c_str();
-        data["year"] = fullCD.year;
-        data["uniqueID"] = fullCD.uniqueID.c_str();
-        data["coverFile"] = fullCD.coverFile.c_str();
-        data["favorite"] = fullCD.favorite;
-        data["notes"] = fullCD.notes.c_str();
-        data["barcode"] = fullCD.barcode.c_str();
-        data["trackCount"] = fullCD.trackCount;
-        data["totalDurationMs"] = fullCD.totalDurationMs;
-        data["releaseMbid"] = fullCD.releaseMbid.c_str();
-
-        // Tracks are stored separately and not included in basic backup
-
-        // Export CD
-        String line;
-        serializeJson(doc, line);
-        server.sendContent(line + "\n");
-
-        // NEW: Export Tracklist if available
-        if (fullCD.releaseMbid.length() > 0) {
-          TrackList *tl = Storage.loadTracklist(fullCD.releaseMbid.c_str());
-          if (tl) {
-            DynamicJsonDocument tlDoc(16384); // Larger buffer for tracklist
-            tlDoc["type"] = "tracklist";
-            tlDoc["mbid"] = fullCD.releaseMbid;
-            JsonObject tlData = tlDoc.createNestedObject("data");
-            tlData["cdTitle"] = tl->cdTitle.c_str();
-            tlData["cdArtist"] = tl->cdArtist.c_str();
-            tlData["fetchedAt"] = tl->fetchedAt.c_str();
-            JsonArray tracks = tlData.createNestedArray("tracks");
-            for (const auto &t : tl->tracks) {
-              JsonObject tObj = tracks.createNestedObject();
-              tObj["trackNo"] = t.trackNo;
-              tObj["title"] = t.title.c_str();
-              tObj["durationMs"] = t.durationMs;
-              tObj["recordingMbid"] = t.recordingMbid.c_str();
-              tObj["isFav"] = t.isFavoriteTrack;
-
-              JsonObject lyr = tObj.createNestedObject("lyrics");
-              lyr["status"] = t.lyrics.status.c_str();
-              lyr["path"] = t.lyrics.path.c_str();
-              lyr["fetchedAt"] = t.lyrics.fetchedAt.c_str();
-              lyr["lang"] = t.lyrics.lang.c_str();
-            }
-            String tlLine;
-            serializeJson(tlDoc, tlLine);
-            server.sendContent(tlLine + "\n");
-            delete tl;
-          }
-        }
+      if (!Storage.loadCDDetail(uid.c_str(), fullCD))
+        continue;
+      out.beginObject().key("type").string("cd").key("data").beginObject();
+      out.key("title").string(fullCD.title.c_str());
+      out.key("artist").string(fullCD.artist.c_str());
+      out.key("genre").string(fullCD.genre.c_str());
+      out.key("year").number(fullCD.year);
+      out.key("uniqueID").string(fullCD.uniqueID.c_str());
+      out.key("coverFile").string(fullCD.coverFile.c_str());
+      out.key("favorite").boolean(fullCD.favorite);
+      out.key("notes").string(fullCD.notes.c_str());
+      out.key("barcode").string(fullCD.barcode.c_str());
+      out.key("trackCount").number(fullCD.trackCount);
+      out.key("totalDurationMs").number(fullCD.totalDurationMs);
+      out.key("releaseMbid").string(fullCD.releaseMbid.c_str());
+      out.endObject().endObject().endLine();
+
+      // Tracklist on a line of its own, after its CD
+      if (fullCD.releaseMbid.length() == 0)
+        continue;
+      TrackList *tl = Storage.loadTracklist(fullCD.releaseMbid.c_str());
+      if (!tl)
+        continue;
+      out.beginObject().key("type").string("tracklist");
+      out.key("mbid").string(fullCD.releaseMbid.c_str());
+      out.key("data").beginObject();
+      out.key("cdTitle").string(tl->cdTitle.c_str());
+      out.key("cdArtist").string(tl->cdArtist.c_str());
+      out.key("fetchedAt").string(tl->fetchedAt.c_str());
+      out.key("tracks").beginArray();
+      for (const auto &t : tl->tracks) {
+        out.beginObject().key("trackNo").number(t.trackNo);
+        out.key("title").string(t.title.c_str());
+        out.key("durationMs").number(t.durationMs);
+        out.key("recordingMbid").string(t.recordingMbid.c_str());
+        out.key("isFav").boolean(t.isFavoriteTrack);
+        out.key("lyrics").beginObject();
+        out.key("status").string(t.lyrics.status.c_str());
+        out.key("path").string(t.lyrics.path.c_str());
+        out.key("fetchedAt").string(t.lyrics.fetchedAt.c_str());
+        out.key("lang").string(t.lyrics.lang.c_str());
+        out.endObject().endObject();
       }
+      out.endArray().endObject().endObject().endLine();
+      delete tl;
     }
 
     // Export Books
-    for (const auto &item : bookLibrary) {
+    for (const auto &uid : bookIDs) {
       Book fullBook;
-      if (Storage.loadBookDetail(item.uniqueID.c_str(), fullBook)) {
-        DynamicJsonDocument doc(2048);
-        doc["type"] = "book";
-        JsonObject data = doc.createNestedObject("data");
-        data["title"] = fullBook.title.c_str();
-        data["author"] = fullBook.author.c_str();
-        data["genre"] = fullBook.genre.c_str();
-        data["year"] = fullBook.year;
-        data["uniqueID"] = fullBook.uniqueID.c_str();
-        data["coverFile"] = fullBook.coverFile.c_str();
-        data["favorite"] = fullBook.favorite;
-        data["notes"] = fullBook.notes.c_str();
-        data["isbn"] = fullBook.isbn.c_str();
-        data["pageCount"] = fullBook.pageCount;
-        data["publisher"] = fullBook.publisher.c_str();
-
-        String line;
-        serializeJson(doc, line);
-        server.sendContent(line + "\n");
-      }
+      if (!Storage.loadBookDetail(uid.c_str(), fullBook))
+        continue;
+      out.beginObject().key("type").string("book").key("data").beginObject();
+      out.key("title").string(fullBook.title.c_str());
+      out.key("author").string(fullBook.author.c_str());
+      out.key("genre").string(fullBook.genre.c_str());
+      out.key("year").number(fullBook.year);
+      out.key("uniqueID").string(fullBook.uniqueID.c_str());
+      out.key("coverFile").string(fullBook.coverFile.c_str());
+      out.key("favorite").boolean(fullBook.favorite);
+      out.key("notes").string(fullBook.notes.c_str());
+      out.key("isbn").string(fullBook.isbn.c_str());
+      out.key("pageCount").number(fullBook.pageCount);
+      out.key("publisher").string(fullBook.publisher.c_str());
+      out.endObject().endObject().endLine();
     }
 
-    if (sdExpander)
-      sdExpander->digitalWrite(SD_CS, HIGH);
-    server.sendContent("");
+    endStream(out);
   });
 
   // 6. Import Backup (JSONL)
@@ -1890,264 +1811,6 @@ void setupWebHandlers() {
         }
       });
 
-  // 3. User Manual
-  server.on("/manual", HTTP_GET, []() {
-    if (server.arg("pin") != web_pin) {
-      String html =
-          "<!DOCTYPE html><html><head><meta name='viewport' "
-          "content='width=device-width, initial-scale=1'><title>Login</title>";
-      html +=
-          "<style>* { box-sizing: border-box; } "
-          "body{background:#000;color:#fff;font-family:sans-serif;display:flex;"
-          "justify-content:center;align-items:center;height:100vh;margin:0;}";
-      html += ".card{background:#111;padding:30px;border-radius:10px;border:"
-              "1px solid #333;text-align:center;width:90%;max-width:320px;}";
-      html += "input{width:100%;padding:12px;margin:15px "
-              "0;background:#222;border:1px solid "
-              "#444;color:#fff;border-radius:5px;text-align:center;font-size:"
-              "18px;outline:none;}";
-      html += "input:focus{border-color:#00ff88;} "
-              "button{width:100%;padding:12px;background:#00ff88;color:#000;"
-              "border:none;border-radius:5px;font-weight:bold;cursor:pointer;"
-              "font-size:16px;text-transform:uppercase;}";
-      html +=
-          "</style></head><body><div class='card'><h2 "
-          "style='color:#00ff88;margin-top:0'>SECURE LOGIN</h2><p "
-          "style='color:#888;font-size:14px'>Enter PIN to access Manual</p>";
-      html += "<form><input type='password' name='pin' placeholder='PIN' "
-              "autofocus><button "
-              "type='submit'>UNLOCK</button></form></div></body></html>";
-      server.send(401, "text/html", html);
-      return;
-    }
-    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-    server.send(200, "text/html; charset=utf-8", "");
-    String chunk =
-        "<!DOCTYPE html><html><head><meta charset='UTF-8'><title>Digital "
-        "Librarian Manual</title><meta name='viewport' "
-        "content='width=device-width, initial-scale=1'>";
-    chunk +=
-        "<style>:root { --bg: #000; --text: #ddd; --accent: #00ff88; --card: "
-        "#111; } body { font-family: sans-serif; line-height: 1.6; max-width: "
-        "800px; margin: 0 auto; padding: 20px; background: var(--bg); color: "
-        "var(--text); } h1, h2 { color: var(--accent); border-bottom: 1px "
-        "solid #333; padding-bottom: 10px; } h3 { color: #fff; margin-top: "
-        "25px; } .btn { display: inline-block; padding: 8px 15px; background: "
-        "var(--accent); color: #000; text-decoration: none; border-radius: "
-        "5px; font-weight: bold; margin: 5px; } code { background: #222; "
-        "padding: 2px 6px; border-radius: 4px; font-family: monospace; color: "
-        "#ff8800; } ul { padding-left: 20px; } li { margin-bottom: 8px; } "
-        "strong { color: #fff; } @media print { :root { --bg: #fff; --text: "
-        "#000; --accent: #000; --card: #fff; } body { color: #000; background: "
-        "#fff; padding: 0; } h1, h2, h3, strong { color: #000; border-color: "
-        "#000; } .no-print { display: none; } code { border: 1px solid #ccc; "
-        "background: #eee; color: #000; } }</style></head><body>";
-    server.sendContent(chunk);
-    chunk =
-        "<div style='display:flex; justify-content:space-between; "
-        "align-items:center;'><h1>Digital Librarian Manual v2.1</h1><button "
-        "class='btn no-print' onclick='window.print()'>🖨️ Print</button></div>";
-    chunk +=
-        "<h2>1. Getting Started</h2><p><strong>Power On:</strong> Connect to "
-        "USB-C power.</p><p><strong>WiFi:</strong> Connect specifically to "
-        "'My_Extender' if using default.</p>";
-    server.sendContent(chunk);
-    chunk = "<h2>2. Device Interface</h2><ul><li><strong>Search:</strong> Top "
-            "Left</li><li><strong>Add (+):</strong> New "
-            "Entry/Scan</li><li><strong>Tracklist (List):</strong> Tracks & "
-            "Lyrics</li><li><strong>Random:</strong> "
-            "Shuffle</li><li><strong>Filter:</strong> "
-            "Genre/Decade</li><li><strong>Sync:</strong> Refresh "
-            "SD</li><li><strong>Eye:</strong> Toggle LED</li></ul>";
-    server.sendContent(chunk);
-    chunk = "<h2>3. Web Features</h2><h3>📱 Remote (/browse)</h3><p>Full "
-            "control.</p><h3>📷 Scanner (/scan)</h3><p>Barcode "
-            "scanning.</p><h3>🎨 Covers (/link)</h3><p>Manual artwork.</p>";
-    server.sendContent(chunk);
-    chunk =
-        "<h2>4. Advanced</h2><ul><li><strong>Lyrics:</strong> "
-        "Synced lyrics from LRCLib.</li><li><strong>Favorites:</strong> "
-        "Magenta "
-        "LEDs.</li><li><strong>Backups:</strong> Full JSON Export/Import.</li>"
-        "<li><strong>Storage:</strong> Database stored in <code>/db/</code> "
-        "folder.</li></ul>";
-
-    chunk += "<div class='no-print'>";
-    chunk += getWebFooter();
-    chunk += "</div></body></html>";
-    server.sendContent(chunk);
-    server.sendContent("");
-  });
-
-  // Error Dashboard Page
-  server.on("/errors", HTTP_GET, []() {
-    String html = "<!DOCTYPE html><html><head><meta charset='UTF-8'>";
-    html +=
-        "<meta name='viewport' content='width=device-width, initial-scale=1'>";
-    html += "<title>Error Dashboard</title>";
-    html += "<style>";
-    html += ":root{--bg:#000;--text:#ddd;--accent:#00ff88;--card:#111;--warn:#"
-            "ff8800;--error:#ff0044;}";
-    html += "body{margin:0;padding:20px;background:var(--bg);color:var(--text);"
-            "font-family:sans-serif;}";
-    html += "h1{color:var(--accent);margin:0 0 20px 0;}";
-    html += ".container{max-width:1200px;margin:0 auto;}";
-    html += ".stats{display:grid;grid-template-columns:repeat(auto-fit,minmax("
-            "200px,1fr));gap:15px;margin-bottom:30px;}";
-    html += ".stat-card{background:var(--card);padding:20px;border-radius:8px;"
-            "border:1px solid #333;}";
-    html += ".stat-card h3{margin:0 0 10px 0;font-size:14px;color:#888;}";
-    html += ".stat-card "
-            ".value{font-size:28px;font-weight:bold;color:var(--accent);}";
-    html += ".stat-card.warn .value{color:var(--warn);}";
-    html += ".stat-card.error .value{color:var(--error);}";
-    html += ".controls{margin-bottom:20px;display:flex;gap:10px;align-items:"
-            "center;}";
-    html += "button{background:var(--accent);color:#000;border:none;padding:"
-            "10px 20px;border-radius:5px;cursor:pointer;font-weight:bold;}";
-    html += "button:hover{opacity:0.8;}";
-    html += "button.danger{background:var(--error);}";
-    html += ".error-table{background:var(--card);border-radius:8px;overflow:"
-            "hidden;border:1px solid #333;}";
-    html += "table{width:100%;border-collapse:collapse;}";
-    html += "th{background:#222;padding:12px;text-align:left;font-size:12px;"
-            "color:#888;text-transform:uppercase;}";
-    html += "td{padding:12px;border-top:1px solid #333;}";
-    html += ".badge{display:inline-block;padding:4px "
-            "8px;border-radius:4px;font-size:11px;font-weight:bold;}";
-    html += ".badge.info{background:#0088ff;color:#fff;}";
-    html += ".badge.warn{background:var(--warn);color:#000;}";
-    html += ".badge.error{background:var(--error);color:#fff;}";
-    html += ".badge.fatal{background:#ff00ff;color:#fff;}";
-    html += ".empty{text-align:center;padding:40px;color:#666;}";
-    html += "</style>";
-    html += "</head><body>";
-    html += "<div class='container'>";
-    html += "<h1>📊 Error Dashboard</h1>";
-
-    html += "<div class='stats'>";
-    html += "<div class='stat-card'><h3>Free Heap</h3><div class='value' "
-            "id='freeHeap'>-</div></div>";
-    html += "<div class='stat-card'><h3>Min Free Heap</h3><div class='value' "
-            "id='minHeap'>-</div></div>";
-    html += "<div class='stat-card'><h3>Uptime</h3><div class='value' "
-            "id='uptime'>-</div></div>";
-    html += "<div class='stat-card'><h3>Error Count</h3><div class='value' "
-            "id='errorCount'>-</div></div>";
-    html += "</div>";
-
-    html += "<div class='controls'>";
-    html += "<button onclick='refresh()'>🔄 Refresh</button>";
-    html += "<button onclick='clearErrors()' class='danger'>🗑️ Clear "
-            "Errors</button>";
-    html += "<label><input type='checkbox' id='autoRefresh'> Auto-refresh "
-            "(5s)</label>";
-    html += "</div>";
-
-    html += "<div class='error-table'>";
-    html += "<table><thead><tr>";
-    html += "<th>Time</th><th>Level</th><th>Category</th><th>Message</"
-            "th><th>Context</th>";
-    html += "</tr></thead><tbody id='errorTable'></tbody></table>";
-    html += "</div>";
-
-    html += "<p "
-            "style='text-align:center;margin-top:20px;color:#666;font-size:"
-            "12px;'>Last updated: <span id='lastUpdate'>-</span></p>";
-    html += "</div>";
-
-    html += "<script>";
-    html += "const levels=['INFO','WARN','ERROR','FATAL'];";
-    html += "const "
-            "categories=['NETWORK','STORAGE','API','PARSING','MEMORY','"
-            "HARDWARE','SYSTEM'];";
-    html += "let autoRefreshInterval=null;";
-
-    html += "async function loadErrors(){";
-    html += "  const res=await fetch('/api/errors');";
-    html += "  const data=await res.json();";
-    html += "  "
-            "document.getElementById('freeHeap').textContent=(data.freeHeap/"
-            "1024).toFixed(1)+'KB';";
-    html += "  "
-            "document.getElementById('minHeap').textContent=(data.minFreeHeap/"
-            "1024).toFixed(1)+'KB';";
-    html += "  "
-            "document.getElementById('uptime').textContent=Math.floor(data."
-            "uptime/60)+'m';";
-    html +=
-        "  "
-        "document.getElementById('errorCount').textContent=data.errors.length;";
-    html += "  const tbody=document.getElementById('errorTable');";
-    html += "  if(data.errors.length===0){";
-    html += "    tbody.innerHTML='<tr><td colspan=5 class=empty>No errors "
-            "logged ✅</td></tr>';";
-    html += "  }else{";
-    html += "    tbody.innerHTML=data.errors.map(e=>{";
-    html += "      const time=new Date(e.timestamp).toLocaleTimeString();";
-    html += "      const level=levels[e.level]||'?';";
-    html += "      const cat=categories[e.category]||'?';";
-    html += "      const badge=level.toLowerCase();";
-    html +=
-        "      return `<tr><td>${time}</td><td><span class='badge "
-        "${badge}'>${level}</span></td><td>${cat}</td><td>${e.message}</td><td "
-        "style='color:#888;font-size:11px'>${e.context||'-'}</td></tr>`;";
-    html += "    }).reverse().join('');";
-    html += "  }";
-    html += "  document.getElementById('lastUpdate').textContent=new "
-            "Date().toLocaleTimeString();";
-    html += "}";
-
-    html += "async function clearErrors(){";
-    html += "  if(!confirm('Clear all error logs?'))return;";
-    html += "  await fetch('/api/errors/clear',{method:'POST'});";
-    html += "  loadErrors();";
-    html += "}";
-
-    html += "function refresh(){loadErrors();}";
-
-    html +=
-        "document.getElementById('autoRefresh').addEventListener('change',e=>{";
-    html += "  if(e.target.checked){";
-    html += "    autoRefreshInterval=setInterval(loadErrors,5000);";
-    html += "  }else{";
-    html += "    clearInterval(autoRefreshInterval);";
-    html += "    autoRefreshInterval=null;";
-    html += "  }";
-    html += "});";
-
-    html += "loadErrors();";
-    html += "</script>";
-
-    // Add global footer
-    html += "<div style='margin-top: 40px; border-top: 1px solid #333; "
-            "padding-top: 20px;'>";
-    html += "<h3 style='text-align:center; color:#fff; font-size: 14px; "
-            "margin-bottom: 15px; text-transform: uppercase; letter-spacing: "
-            "1px;'>Navigation</h3>";
-    html += "<div style='display: grid; grid-template-columns: repeat(7, 1fr); "
-            "gap: 10px;'>";
-    html += "<button onclick=\"location.href='/'\" style='font-size: 13px; "
-            "padding: 10px;'>&#127968; Dashboard</button>";
-    html += "<button onclick=\"location.href='/scan'\" style='font-size: 13px; "
-            "padding: 10px;'>&#128247; Scanner</button>";
-    html += "<button onclick=\"location.href='/browse'\" style='font-size: "
-            "13px; padding: 10px;'>&#128241; Browse</button>";
-    html += "<button onclick=\"location.href='/link'\" style='font-size: 13px; "
-            "padding: 10px;'>&#128444; Covers</button>";
-    html += "<button onclick=\"location.href='/backup'\" style='font-size: "
-            "13px; padding: 10px;'>&#128190; Backup</button>";
-    html += "<button onclick=\"location.href='/manual'\" style='font-size: "
-            "13px; padding: 10px;'>&#128214; Manuals</button>";
-    html += "<button onclick=\"location.href='/errors'\" style='font-size: "
-            "13px; padding: 10px;'>&#128681; Errors</button>";
-    html += "</div></div>";
-
-    html += "</body></html>";
-
-    server.send(200, "text/html", html);
-  });
-
   server.on("/restart", HTTP_GET, []() {
     server.send(200, "text/plain", "Rebooting...");
     delay(1000);
@@ -2167,12 +1830,21 @@ void setup() {
 
   libraryMutex = xSemaphoreCreateRecursiveMutex();
   i2cMutex = xSemaphoreCreateRecursiveMutex();
+  jpegMutex = xSemaphoreCreateRecursiveMutex();
+  LockProfiler::track(libraryMutex, METRIC_LOCK_LIBRARY);
+  LockProfiler::track(i2cMutex, METRIC_LOCK_I2C);
+  LockProfiler::track(jpegMutex, METRIC_LOCK_JPEG);
+  TraceRecorder::begin();
 
   // 1. Settings
   loadSettings();
 
   // Error Handler Init
   ErrorHandler::init();
+  RequestScheduler::begin();
+  LibraryRevision::begin();
+  HttpPool::begin();
+  MediaManager::init();
   ErrorHandler::logInfo(ERR_CAT_SYSTEM, "Digital Librarian starting up",
                         "setup");
 
@@ -2203,6 +1875,15 @@ void setup() {
   // Note: We MUST NOT delete it here and we MUST NOT re-create it in lcd_init
   // or after it. Shared usage is handled by the shared header macro.
 
+  // Display buffering strategy from settings (validated by the port)
+  lvgl_port_config_t disp_cfg = LVGL_PORT_CONFIG_DEFAULT();
+  disp_cfg.mode = (uint8_t)setting_disp_mode;
+  disp_cfg.draw_buf_num = (uint8_t)setting_disp_buf_num;
+  disp_cfg.draw_buf_lines = (uint16_t)setting_disp_buf_lines;
+  disp_cfg.draw_buf_psram = setting_disp_buf_psram;
+  disp_cfg.bounce_buf_lines = (uint16_t)setting_disp_bounce_lines;
+  lvgl_port_set_config(&disp_cfg);
+
   Serial.println("Main Init: lcd_init...");
   lcd_init();
 
@@ -2220,6 +1901,9 @@ void setup() {
   if (SD.begin(SD_SS)) {
     Serial.println("✅ SD Card Mounted");
     Storage.begin();
+    CoverStore::begin();
+    Storage.recoverBatch(); // A batch edit cut short by a reset
+    MetadataCache::begin();
 
     Serial.println("Creating loading screen...");
     // Show loading screen before syncing library
@@ -2280,6 +1964,8 @@ void setup() {
   // 5. Network
   Serial.println("Network Init...");
   AppNetworkManager::init();
+  // UTC wall clock for MetadataCache TTLs; syncs whenever WiFi comes up
+  configTime(0, 0, "pool.ntp.org", "time.google.com");
 
   Serial.println("Connecting to WiFi...");
   if (AppNetworkManager::tryConnectToSavedNetworks()) {
@@ -2324,16 +2010,21 @@ void setup() {
 
   // 7. Start Background Worker (Last step to ensure no bus contention during
   // boot)
-  Serial.println("Starting Background Worker...");
+  Serial.println("Starting Background Workers...");
   BackgroundWorker::begin();
+
+  // 8. Live events for the web pages
+  EventBus::setSource(EVENT_SELECTION, "selection", event_selection);
+  EventBus::setSource(EVENT_LEDS, "leds", event_leds);
+  EventBus::setSource(EVENT_JOBS, "jobs", event_jobs);
+  EventBus::setSource(EVENT_LIBRARY, "library", event_library);
+  EventBus::begin();
 }
 
 // ========================================
 // ARDUINO LOOP
 // ========================================
 void loop() {
-  server.handleClient();
-
   // Screen Saver Logic
   unsigned long timeout_ms = setting_screensaver_min * 60 * 1000;
   bool should_be_off = (setting_screensaver_min > 0) &&
@@ -2342,22 +2033,20 @@ void loop() {
   if (should_be_off && !is_screen_off) {
     Serial.println("💤 Entering Screen Saver Mode...");
     is_screen_off = true;
-    if (i2cMutex &&
-        xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(100)) == pdPASS) {
+    if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(100)) == pdPASS) {
       if (sdExpander)
         sdExpander->digitalWrite(LCD_BL, LOW);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
     FastLED.clear();
     FastLED.show();
   } else if (!should_be_off && is_screen_off) {
     Serial.println("☀️ Waking up...");
     is_screen_off = false;
-    if (i2cMutex &&
-        xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(100)) == pdPASS) {
+    if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(100)) == pdPASS) {
       if (sdExpander)
         sdExpander->digitalWrite(LCD_BL, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
     update_item_display();
   }
@@ -0,0 +1,188 @@
+#include "EventBus.h"
+
+// Static members
+EventBus::Listener EventBus::_listeners[EVENTS_MAX_CLIENTS];
+std::atomic<uint32_t> EventBus::_seq[EVENT_TOPIC_COUNT];
+const char *EventBus::_names[EVENT_TOPIC_COUNT] = {"selection", "leds",
+                                                   "jobs", "library"};
+event_source_t EventBus::_sources[EVENT_TOPIC_COUNT] = {nullptr};
+SemaphoreHandle_t EventBus::_mutex = NULL;
+TaskHandle_t EventBus::_task = NULL;
+std::atomic<uint32_t> EventBus::_notifications{0};
+uint32_t EventBus::_events = 0;
+uint32_t EventBus::_dropped = 0;
+
+void EventBus::begin() {
+  if (_mutex)
+    return;
+  _mutex = xSemaphoreCreateMutex();
+  for (int t = 0; t < EVENT_TOPIC_COUNT; t++)
+    _seq[t] = 1; // Listeners start at 0: first flush sends everything
+  xTaskCreatePinnedToCore(task, "EventBus", EVENTS_TASK_STACK, NULL, 1, &_task,
+                          EVENTS_TASK_CORE);
+}
+
+void EventBus::setSource(EventTopic topic, const char *name,
+                         event_source_t source) {
+  if (topic < 0 || topic >= EVENT_TOPIC_COUNT)
+    return;
+  _names[topic] = name;
+  _sources[topic] = source;
+}
+
+void EventBus::notify(EventTopic topic) {
+  if (topic < 0 || topic >= EVENT_TOPIC_COUNT)
+    return;
+  _seq[topic]++;
+  _notifications++;
+  if (_task)
+    xTaskNotifyGive(_task);
+}
+
+bool EventBus::addClient(WiFiClient &client) {
+  if (!_mutex)
+    return false;
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  Listener *slot = nullptr;
+  for (int i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    if (!_listeners[i].active) {
+      slot = &_listeners[i];
+      break;
+    }
+  }
+  if (!slot) {
+    _dropped++;
+    xSemaphoreGive(_mutex);
+    return false;
+  }
+
+  slot->conn = client; // Shares the socket; it stays open after the handler
+  slot->conn.setNoDelay(true);
+  slot->conn.print("HTTP/1.1 200 OK\r\n"
+                   "Content-Type: text/event-stream\r\n"
+                   "Cache-Control: no-cache\r\n"
+                   "Connection: keep-alive\r\n\r\n"
+                   "retry: 3000\n\n");
+  memset(slot->seen, 0, sizeof(slot->seen));
+  slot->lastFlushAt = 0;
+  slot->lastWriteAt = millis();
+  slot->active = true;
+  xSemaphoreGive(_mutex);
+
+  Serial.printf("EventBus: listener %s connected\n",
+                client.remoteIP().toString().c_str());
+  xTaskNotifyGive(_task);
+  return true;
+}
+
+void EventBus::task(void *pvParameters) {
+  for (;;) {
+    // Woken by notify(); the timeout also releases listeners that were
+    // rate limited on the previous pass
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(EVENTS_MIN_INTERVAL_MS));
+    flush();
+  }
+}
+
+void EventBus::flush() {
+  String payload[EVENT_TOPIC_COUNT];
+  bool built[EVENT_TOPIC_COUNT] = {false};
+
+  // Work on copies: building payloads takes other locks (the library for
+  // selection/leds) and writes can block, neither of which may hold up
+  // addClient() or getStats(). Only this task deactivates a listener, so
+  // the slots copied here still hold the same listeners afterwards.
+  Listener work[EVENTS_MAX_CLIENTS];
+  bool copied[EVENTS_MAX_CLIENTS] = {false};
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  for (int i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    if (_listeners[i].active) {
+      work[i] = _listeners[i];
+      copied[i] = true;
+    }
+  }
+  xSemaphoreGive(_mutex);
+
+  uint32_t now = millis();
+  uint32_t events = 0;
+  for (int i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    Listener &l = work[i];
+    if (!l.active)
+      continue;
+    if (!l.conn.connected()) {
+      l.active = false;
+      continue;
+    }
+    if (now - l.lastFlushAt < EVENTS_MIN_INTERVAL_MS)
+      continue;
+
+    String out;
+    int count = 0;
+    for (int t = 0; t < EVENT_TOPIC_COUNT; t++) {
+      uint32_t seq = _seq[t];
+      if (seq == l.seen[t])
+        continue;
+      if (!built[t]) {
+        payload[t] = _sources[t] ? _sources[t]() : String("{}");
+        built[t] = true;
+      }
+      out += "event: ";
+      out += _names[t];
+      out += "\ndata: ";
+      out += payload[t];
+      out += "\n\n";
+      l.seen[t] = seq;
+      count++;
+    }
+    if (count == 0 && now - l.lastWriteAt >= EVENTS_KEEPALIVE_MS)
+      out = ": ping\n\n";
+    if (out.length() == 0)
+      continue;
+
+    if (l.conn.write((const uint8_t *)out.c_str(), out.length()) !=
+        out.length()) {
+      l.active = false;
+      continue;
+    }
+    l.lastWriteAt = now;
+    if (count > 0) {
+      l.lastFlushAt = now;
+      events += count;
+    }
+  }
+
+  // Reconcile: drop the listeners that went away, keep what the rest saw
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  for (int i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    Listener &l = _listeners[i];
+    if (!copied[i])
+      continue; // Connected during this flush
+    if (!work[i].active) {
+      l.conn.stop();
+      l.active = false;
+      _dropped++;
+      continue;
+    }
+    memcpy(l.seen, work[i].seen, sizeof(l.seen));
+    l.lastFlushAt = work[i].lastFlushAt;
+    l.lastWriteAt = work[i].lastWriteAt;
+  }
+  _events += events;
+  xSemaphoreGive(_mutex);
+}
+
+EventBusStats EventBus::getStats() {
+  EventBusStats s = {};
+  if (_mutex)
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+  for (int i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    if (_listeners[i].active)
+      s.clients++;
+  }
+  s.notifications = _notifications;
+  s.events = _events;
+  s.dropped = _dropped;
+  if (_mutex)
+    xSemaphoreGive(_mutex);
+  return s;
+}
@@ -0,0 +1,82 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <atomic>
+
+// Live device state for the web pages, pushed as server-sent events.
+//
+// Subsystems only call notify(topic) when something changed: a counter bump
+// and a task notification, cheap enough for scroll handlers and per-item job
+// progress. The bus task builds each topic's payload from its registered
+// source at most once per flush and sends it to every listener that hasn't
+// seen it yet, so a burst collapses into the latest state. Each listener
+// gets at most one flush per EVENTS_MIN_INTERVAL_MS, plus a keep-alive
+// comment when idle.
+//
+// GET /api/events hands its connection over with addClient(); the browser's
+// EventSource reconnects by itself if the link drops.
+
+#define EVENTS_MAX_CLIENTS 4
+#define EVENTS_MIN_INTERVAL_MS 250 // Per listener
+#define EVENTS_KEEPALIVE_MS 15000
+#define EVENTS_TASK_STACK 6144
+#define EVENTS_TASK_CORE 0 // Next to the WiFi stack
+
+enum EventTopic {
+  EVENT_SELECTION = 0, // Item shown on the main screen
+  EVENT_LEDS,          // Shelf LEDs on/off, filter highlight
+  EVENT_JOBS,          // Background job queue and progress
+  EVENT_LIBRARY,       // Library revision (see LibraryRevision)
+  EVENT_TOPIC_COUNT
+};
+
+// Builds the JSON payload of a topic. Runs on the bus task.
+typedef String (*event_source_t)();
+
+struct EventBusStats {
+  int clients;
+  uint32_t notifications; // notify() calls
+  uint32_t events;        // Events written (after coalescing)
+  uint32_t dropped;       // Listeners disconnected or refused
+};
+
+class EventBus {
+public:
+  static void begin();
+  static void setSource(EventTopic topic, const char *name,
+                        event_source_t source);
+
+  static void notify(EventTopic topic);
+
+  // Sends the SSE response header and keeps the connection. False if
+  // EVENTS_MAX_CLIENTS are already listening.
+  static bool addClient(WiFiClient &client);
+
+  static EventBusStats getStats();
+
+private:
+  struct Listener {
+    WiFiClient conn;
+    bool active = false;
+    uint32_t seen[EVENT_TOPIC_COUNT];
+    uint32_t lastFlushAt = 0;
+    uint32_t lastWriteAt = 0;
+  };
+
+  static void task(void *pvParameters);
+  static void flush();
+
+  static Listener _listeners[EVENTS_MAX_CLIENTS];
+  static std::atomic<uint32_t> _seq[EVENT_TOPIC_COUNT];
+  static const char *_names[EVENT_TOPIC_COUNT];
+  static event_source_t _sources[EVENT_TOPIC_COUNT];
+  static SemaphoreHandle_t _mutex;
+  static TaskHandle_t _task;
+  static std::atomic<uint32_t> _notifications;
+  static uint32_t _events;
+  static uint32_t _dropped;
+};
+
+#endif // EVENT_BUS_H
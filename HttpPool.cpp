@@ -0,0 +1,456 @@
+#include "HttpPool.h"
+#include "ErrorHandler.h"
+#include "Metrics.h"
+
+// Static members
+HttpPool::Slot HttpPool::_slots[HTTP_POOL_SLOTS];
+SemaphoreHandle_t HttpPool::_mutex = NULL;
+HttpPoolStats HttpPool::_stats = {};
+
+void HttpPool::begin() {
+  if (!_mutex)
+    _mutex = xSemaphoreCreateMutex();
+}
+
+String HttpPool::originOf(const String &url) {
+  int schemeEnd = url.indexOf("://");
+  if (schemeEnd <= 0)
+    return "";
+  String scheme = url.substring(0, schemeEnd);
+  scheme.toLowerCase();
+
+  int hostStart = schemeEnd + 3;
+  int hostEnd = url.indexOf('/', hostStart);
+  String host = hostEnd < 0 ? url.substring(hostStart)
+                            : url.substring(hostStart, hostEnd);
+  int at = host.indexOf('@');
+  if (at >= 0)
+    host = host.substring(at + 1);
+  if (host.length() == 0)
+    return "";
+  host.toLowerCase();
+  if (host.indexOf(':') < 0)
+    host += (scheme == "https") ? ":443" : ":80";
+  return scheme + "://" + host;
+}
+
+WiFiClient *HttpPool::newClient(const String &origin) {
+  if (origin.startsWith("https")) {
+    WiFiClientSecure *c = new WiFiClientSecure();
+    c->setInsecure();
+    c->setHandshakeTimeout(10000);
+    return c;
+  }
+  return new WiFiClient();
+}
+
+// Caller holds _mutex (or owns the slot exclusively)
+void HttpPool::closeSlot(Slot &s) {
+  if (s.http) {
+    s.http->end();
+    delete s.http;
+  }
+  if (s.client) {
+    s.client->stop();
+    delete s.client;
+  }
+  s.http = nullptr;
+  s.client = nullptr;
+  s.origin = "";
+  s.inUse = false;
+}
+
+int HttpPool::acquire(const String &origin, HTTPClient *&http,
+                      WiFiClient *&client) {
+  if (!_mutex)
+    begin();
+
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+
+  if (ErrorHandler::isMemoryLow()) {
+    for (int i = 0; i < HTTP_POOL_SLOTS; i++) {
+      if (_slots[i].http && !_slots[i].inUse) {
+        closeSlot(_slots[i]);
+        _stats.evictions++;
+      }
+    }
+  }
+
+  int pick = -1;
+  // 1. Idle connection to the same origin
+  for (int i = 0; i < HTTP_POOL_SLOTS && pick < 0; i++) {
+    if (_slots[i].http && !_slots[i].inUse && _slots[i].origin == origin)
+      pick = i;
+  }
+  // 2. Empty slot
+  for (int i = 0; i < HTTP_POOL_SLOTS && pick < 0; i++) {
+    if (!_slots[i].http)
+      pick = i;
+  }
+  // 3. Least recently used idle slot of another origin
+  if (pick < 0) {
+    for (int i = 0; i < HTTP_POOL_SLOTS; i++) {
+      if (_slots[i].inUse)
+        continue;
+      if (pick < 0 || (int32_t)(_slots[i].lastUse - _slots[pick].lastUse) < 0)
+        pick = i;
+    }
+    if (pick >= 0) {
+      closeSlot(_slots[pick]);
+      _stats.evictions++;
+    }
+  }
+
+  if (pick < 0) {
+    // Every slot is leased: hand out a one-off connection
+    _stats.overflows++;
+    xSemaphoreGive(_mutex);
+    client = newClient(origin);
+    http = new HTTPClient();
+    return -1;
+  }
+
+  Slot &s = _slots[pick];
+  if (!s.http) {
+    s.client = newClient(origin);
+    s.http = new HTTPClient();
+    s.origin = origin;
+  }
+  s.inUse = true;
+  http = s.http;
+  client = s.client;
+  xSemaphoreGive(_mutex);
+  return pick;
+}
+
+void HttpPool::release(int slot, HTTPClient *http, WiFiClient *client,
+                       bool reusable) {
+  if (slot < 0) {
+    http->end();
+    delete http;
+    client->stop();
+    delete client;
+    return;
+  }
+
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  Slot &s = _slots[slot];
+  if (reusable)
+    http->end(); // Keeps the socket open if the server allowed keep-alive
+  if (!reusable || !client->connected())
+    closeSlot(s);
+  else {
+    s.lastUse = millis();
+    s.inUse = false;
+  }
+  xSemaphoreGive(_mutex);
+}
+
+void HttpPool::evictIdle() {
+  if (!_mutex)
+    return;
+  bool low = ErrorHandler::isMemoryLow();
+  uint32_t now = millis();
+
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  for (int i = 0; i < HTTP_POOL_SLOTS; i++) {
+    Slot &s = _slots[i];
+    if (!s.http || s.inUse)
+      continue;
+    if (low || now - s.lastUse > HTTP_POOL_IDLE_MS || !s.client->connected()) {
+      closeSlot(s);
+      _stats.evictions++;
+    }
+  }
+  xSemaphoreGive(_mutex);
+}
+
+void HttpPool::clear() {
+  if (!_mutex)
+    return;
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  for (int i = 0; i < HTTP_POOL_SLOTS; i++) {
+    if (_slots[i].http && !_slots[i].inUse) {
+      closeSlot(_slots[i]);
+      _stats.evictions++;
+    }
+  }
+  xSemaphoreGive(_mutex);
+}
+
+HttpPoolStats HttpPool::getStats() {
+  HttpPoolStats s = {};
+  if (!_mutex)
+    return s;
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  s = _stats;
+  s.openSlots = 0;
+  for (int i = 0; i < HTTP_POOL_SLOTS; i++) {
+    if (_slots[i].http)
+      s.openSlots++;
+  }
+  xSemaphoreGive(_mutex);
+  return s;
+}
+
+// ==========================================
+// PooledHttp
+// ==========================================
+
+PooledHttp::PooledHttp(const String &url) { lease(url); }
+
+PooledHttp::~PooledHttp() { unlease(); }
+
+void PooledHttp::lease(const String &url) {
+  _url = url;
+  _reusable = true;
+  _slot = HttpPool::acquire(HttpPool::originOf(url), _http, _client);
+
+  // The slot is ours now; count whether this request rides on an open socket
+  bool warm = _client->connected();
+  if (HttpPool::_mutex) {
+    xSemaphoreTake(HttpPool::_mutex, portMAX_DELAY);
+    if (warm)
+      HttpPool::_stats.reuses++;
+    else
+      HttpPool::_stats.connects++;
+    xSemaphoreGive(HttpPool::_mutex);
+  }
+
+  // Reset whatever the previous lessee configured
+  _http->setReuse(true);
+  _http->setTimeout(HTTPCLIENT_DEFAULT_TCP_TIMEOUT);
+  _http->setFollowRedirects(HTTPC_DISABLE_FOLLOW_REDIRECTS);
+  _http->setUserAgent(HTTP_POOL_USER_AGENT);
+  _http->begin(*_client, url);
+}
+
+void PooledHttp::unlease() {
+  if (!_http)
+    return;
+  HttpPool::release(_slot, _http, _client, _reusable);
+  _http = nullptr;
+  _client = nullptr;
+  _slot = -1;
+}
+
+int PooledHttp::getFollowingRedirects(uint16_t timeoutMs, int maxHops) {
+  static const char *headerKeys[] = {"Location", "Transfer-Encoding"};
+
+  for (int hop = 0;; hop++) {
+    _http->setTimeout(timeoutMs);
+    _http->collectHeaders(headerKeys, 2);
+    int64_t start = esp_timer_get_time();
+    int code = _http->GET();
+    Metrics::recordOutbound(METRIC_OUT_DOWNLOAD,
+                            (uint32_t)(esp_timer_get_time() - start), code);
+
+    bool redirect = code == HTTP_CODE_MOVED_PERMANENTLY ||
+                    code == HTTP_CODE_FOUND || code == HTTP_CODE_SEE_OTHER ||
+                    code == HTTP_CODE_TEMPORARY_REDIRECT ||
+                    code == HTTP_CODE_PERMANENT_REDIRECT;
+    if (!redirect || hop >= maxHops)
+      return code;
+
+    String location = _http->header("Location");
+    if (location.startsWith("/"))
+      location = HttpPool::originOf(_url) + location;
+    if (!location.startsWith("http"))
+      return code;
+
+    unlease();
+    lease(location);
+  }
+}
+
+// ==========================================
+// HttpBodyStream
+// ==========================================
+
+HttpBodyStream::HttpBodyStream(HTTPClient &http, uint32_t timeoutMs)
+    : _client(http.getStreamPtr()), _timeoutMs(timeoutMs) {
+  String te = http.header("Transfer-Encoding");
+  te.toLowerCase();
+  _chunked = te.indexOf("chunked") >= 0;
+  frame(http.getSize());
+}
+
+HttpBodyStream::HttpBodyStream(Client &client, int size, bool chunked,
+                               uint32_t timeoutMs)
+    : _client(&client), _timeoutMs(timeoutMs), _chunked(chunked) {
+  frame(size);
+}
+
+void HttpBodyStream::frame(int size) {
+  if (!_client) {
+    _eof = true;
+    _failed = true;
+  } else if (_chunked) {
+    _remaining = 0;
+  } else if (size >= 0) {
+    _remaining = size;
+    _eof = (size == 0);
+  } else {
+    _untilClose = true;
+  }
+}
+
+// One byte straight off the socket (chunk framing), -1 on timeout/close
+int HttpBodyStream::rawByte() {
+  uint32_t start = millis();
+  while (true) {
+    int c = _client->read();
+    if (c >= 0)
+      return c;
+    if (!_client->connected() || millis() - start > _timeoutMs)
+      return -1;
+    delay(1);
+  }
+}
+
+bool HttpBodyStream::readChunkHeader() {
+  if (_chunkCrlf) {
+    if (rawByte() != '\r' || rawByte() != '\n')
+      return false;
+    _chunkCrlf = false;
+  }
+
+  size_t size = 0;
+  int digits = 0;
+  bool inExt = false;
+  while (true) {
+    int c = rawByte();
+    if (c < 0)
+      return false;
+    if (c == '\n')
+      break;
+    if (c == '\r' || inExt)
+      continue;
+    if (c == ';') {
+      inExt = true;
+      continue;
+    }
+    int v = isdigit(c) ? c - '0' : (isxdigit(c) ? (tolower(c) - 'a' + 10) : -1);
+    if (v < 0 || ++digits > 8)
+      return false;
+    size = (size << 4) | v;
+  }
+  if (digits == 0)
+    return false;
+
+  if (size == 0) {
+    // Last chunk: skip trailers up to the empty line
+    int lineLen = 0;
+    while (true) {
+      int c = rawByte();
+      if (c < 0)
+        return false;
+      if (c == '\n') {
+        if (lineLen == 0)
+          break;
+        lineLen = 0;
+      } else if (c != '\r') {
+        lineLen++;
+      }
+    }
+    _eof = true;
+    return true;
+  }
+
+  _remaining = size;
+  return true;
+}
+
+bool HttpBodyStream::fill() {
+  if (_pos < _len)
+    return true;
+  _pos = _len = 0;
+  if (_eof || _failed)
+    return false;
+
+  if (_chunked && _remaining == 0) {
+    if (!readChunkHeader()) {
+      _failed = true;
+      return false;
+    }
+    if (_eof)
+      return false;
+  }
+
+  size_t want = HTTP_BODY_BUF_SIZE;
+  if (!_untilClose && _remaining < want)
+    want = _remaining;
+
+  uint32_t start = millis();
+  while (true) {
+    int n = _client->read(_buf, want);
+    if (n > 0) {
+      _len = n;
+      _total += n;
+      if (!_untilClose) {
+        _remaining -= n;
+        if (_remaining == 0) {
+          if (_chunked)
+            _chunkCrlf = true;
+          else
+            _eof = true;
+        }
+      }
+      return true;
+    }
+    if (!_client->connected() && _client->available() <= 0) {
+      // A close ends a close-delimited body; anything else is truncated
+      if (_untilClose)
+        _eof = true;
+      else
+        _failed = true;
+      return false;
+    }
+    if (millis() - start > _timeoutMs) {
+      _failed = true;
+      return false;
+    }
+    delay(1);
+  }
+}
+
+int HttpBodyStream::available() {
+  if (_pos < _len)
+    return _len - _pos;
+  return fill() ? _len - _pos : 0;
+}
+
+int HttpBodyStream::read() {
+  if (!fill())
+    return -1;
+  return _buf[_pos++];
+}
+
+int HttpBodyStream::peek() {
+  if (!fill())
+    return -1;
+  return _buf[_pos];
+}
+
+size_t HttpBodyStream::readBytes(char *buffer, size_t length) {
+  size_t got = 0;
+  while (got < length && fill()) {
+    size_t n = _len - _pos;
+    if (n > length - got)
+      n = length - got;
+    memcpy(buffer + got, _buf + _pos, n);
+    _pos += n;
+    got += n;
+  }
+  return got;
+}
+
+bool HttpBodyStream::finish() {
+  size_t drained = 0;
+  while (drained < HTTP_BODY_DRAIN_MAX && fill()) {
+    drained += _len - _pos;
+    _pos = _len;
+  }
+  // Close-delimited bodies never leave a reusable socket behind
+  return _eof && !_failed && !_untilClose;
+}
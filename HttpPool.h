@@ -0,0 +1,165 @@
+#ifndef HTTP_POOL_H
+#define HTTP_POOL_H
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFiClient.h>
+#include <WiFiClientSecure.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Keep-alive connection pool for the metadata and cover hosts.
+//
+// Each slot owns a client (WiFiClientSecure for https, with setInsecure() as
+// before) plus the HTTPClient bound to it, keyed by scheme://host:port.
+// HTTPClient must live as long as the connection (its destructor closes the
+// socket), which is why the pool hands out both. A slot is leased to one
+// caller at a time; when every slot is busy the lease gets a throw-away
+// connection instead of waiting.
+//
+// Connections idle for HTTP_POOL_IDLE_MS are closed by evictIdle(), and all
+// idle ones are dropped when the heap runs low. The Arduino TLS client has no
+// session-ticket API, so the saving comes from not reconnecting at all.
+
+#define HTTP_POOL_SLOTS 4
+#define HTTP_POOL_IDLE_MS 30000
+#define HTTP_POOL_MAX_REDIRECTS 5
+#define HTTP_POOL_USER_AGENT "DigitalLibrarian/1.0"
+
+struct HttpPoolStats {
+  uint32_t connects;  // Requests that needed a new TCP/TLS connection
+  uint32_t reuses;    // Requests sent on a kept-alive connection
+  uint32_t evictions; // Idle/low-memory closes
+  uint32_t overflows; // Leases served outside the pool (all slots busy)
+  int openSlots;      // Currently connected slots
+};
+
+class HttpPool {
+public:
+  static void begin();
+
+  // Closes connections idle for longer than HTTP_POOL_IDLE_MS.
+  static void evictIdle();
+  // Closes every idle connection.
+  static void clear();
+
+  static HttpPoolStats getStats();
+
+  // "https://host:port" for a URL ("" if unparseable)
+  static String originOf(const String &url);
+
+private:
+  friend class PooledHttp;
+
+  struct Slot {
+    String origin;
+    HTTPClient *http = nullptr;
+    WiFiClient *client = nullptr;
+    uint32_t lastUse = 0;
+    bool inUse = false;
+  };
+
+  // Returns a slot index, or -1 for an unpooled connection (created into
+  // http/client, freed by the caller through release()).
+  static int acquire(const String &origin, HTTPClient *&http,
+                     WiFiClient *&client);
+  static void release(int slot, HTTPClient *http, WiFiClient *client,
+                      bool reusable);
+  static WiFiClient *newClient(const String &origin);
+  static void closeSlot(Slot &s);
+
+  static Slot _slots[HTTP_POOL_SLOTS];
+  static SemaphoreHandle_t _mutex;
+  static HttpPoolStats _stats;
+};
+
+// Scoped lease of a pooled connection, begun on `url`.
+//
+//   PooledHttp req(url);
+//   HTTPClient &http = req.http();
+//   int code = http.GET(); // or RequestScheduler::get(...)
+//   ... read the body ...
+//   // destructor ends the request and returns the connection
+//
+// Read the whole body (getString()/stream) or the connection is not reused.
+class PooledHttp {
+public:
+  explicit PooledHttp(const String &url);
+  ~PooledHttp();
+
+  HTTPClient &http() { return *_http; }
+
+  // GET that follows redirects by re-leasing for each new origin, so a kept
+  // connection never ends up pointing at a different host than its slot.
+  int getFollowingRedirects(uint16_t timeoutMs = HTTPCLIENT_DEFAULT_TCP_TIMEOUT,
+                            int maxHops = HTTP_POOL_MAX_REDIRECTS);
+
+  // Don't return the connection to the pool (body abandoned half-read).
+  void close() { _reusable = false; }
+
+private:
+  PooledHttp(const PooledHttp &) = delete;
+  PooledHttp &operator=(const PooledHttp &) = delete;
+
+  void lease(const String &url);
+  void unlease();
+
+  String _url;
+  int _slot = -1;
+  bool _reusable = true;
+  HTTPClient *_http = nullptr;
+  WiFiClient *_client = nullptr;
+};
+
+// Response body as a Stream, for parsing straight off the socket
+// (deserializeJson(doc, body, ...)). Handles Content-Length, chunked and
+// close-delimited bodies and reads the socket in HTTP_BODY_BUF_SIZE blocks.
+// Needs "Transfer-Encoding" among the collected headers (RequestScheduler::get
+// and PooledHttp::getFollowingRedirects collect it).
+//
+// Call finish() when done: it consumes what the parser left (trailing
+// whitespace, the last chunk) and reports whether the body end was reached,
+// i.e. whether the connection can go back to the pool.
+
+#define HTTP_BODY_BUF_SIZE 512
+#define HTTP_BODY_DRAIN_MAX 4096 // finish() gives up past this many bytes
+
+class HttpBodyStream : public Stream {
+public:
+  HttpBodyStream(HTTPClient &http, uint32_t timeoutMs = 10000);
+  // Body framed by the caller: `size` bytes, or until the peer closes when
+  // -1 (ignored if chunked). Replays captured responses in StorageTests.
+  HttpBodyStream(Client &client, int size, bool chunked,
+                 uint32_t timeoutMs = 10000);
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t readBytes(char *buffer, size_t length) override;
+  size_t write(uint8_t) override { return 0; }
+
+  bool finish();
+  bool complete() const { return _eof; }
+  size_t bytesRead() const { return _total; }
+
+private:
+  bool fill();
+  int rawByte();
+  bool readChunkHeader();
+  void frame(int size);
+
+  Client *_client;
+  uint32_t _timeoutMs;
+  bool _chunked;
+  bool _eof = false;
+  bool _failed = false;
+  bool _untilClose = false;
+  bool _chunkCrlf = false; // CRLF after chunk data still to be consumed
+  size_t _remaining = 0;   // Bytes left in the body / current chunk
+  size_t _total = 0;
+  uint8_t _buf[HTTP_BODY_BUF_SIZE];
+  size_t _pos = 0;
+  size_t _len = 0;
+};
+
+#endif // HTTP_POOL_H
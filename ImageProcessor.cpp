@@ -9,6 +9,7 @@
 #include "AppGlobals.h"
 #include "ErrorHandler.h"
 #include "ImageProcessor.h"
+#include "LockProfiler.h"
 #include "waveshare_sd_card.h"
 #include <HTTPClient.h>
 
@@ -46,14 +47,13 @@ void ImageProcessor::init() { TJpgDec.setCallback(tjpg_callback); }
 bool ImageProcessor::decodeToBuffer(String filename, uint16_t *buffer,
                                     int maxWidth, int maxHeight) {
   bool exists = false;
-  if (i2cMutex &&
-      xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(2000)) == pdPASS) {
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(2000)) == pdPASS) {
     if (sdExpander)
       sdExpander->digitalWrite(SD_CS, LOW);
     exists = SD.exists(filename);
     if (sdExpander)
       sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   } else {
     return false;
   }
@@ -73,8 +73,7 @@ bool ImageProcessor::decodeToBuffer(String filename, uint16_t *buffer,
   memset(buffer, 0, maxWidth * maxHeight * sizeof(uint16_t));
 
   uint8_t result = 1; // Default fail
-  if (i2cMutex &&
-      xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(5000)) == pdPASS) {
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(5000)) == pdPASS) {
     if (sdExpander)
       sdExpander->digitalWrite(SD_CS, LOW);
 
@@ -99,7 +98,7 @@ bool ImageProcessor::decodeToBuffer(String filename, uint16_t *buffer,
     if (sdExpander)
       sdExpander->digitalWrite(SD_CS, HIGH);
 
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   if (result != 0) {
@@ -0,0 +1,113 @@
+#include "LibraryRevision.h"
+#include "EventBus.h"
+
+// Static members
+std::atomic<uint32_t> LibraryRevision::_rev{1};
+uint32_t LibraryRevision::_epoch = 0;
+std::deque<LibraryChange> LibraryRevision::_log;
+uint32_t LibraryRevision::_floor = 1;
+int LibraryRevision::_bulkDepth = 0;
+SemaphoreHandle_t LibraryRevision::_mutex = NULL;
+
+void LibraryRevision::begin() {
+  if (_mutex)
+    return;
+  _mutex = xSemaphoreCreateMutex();
+  _epoch = esp_random() | 1;
+}
+
+uint32_t LibraryRevision::current() { return _rev.load(); }
+
+uint32_t LibraryRevision::epoch() { return _epoch; }
+
+uint32_t LibraryRevision::bump() {
+  uint32_t rev = ++_rev;
+  EventBus::notify(EVENT_LIBRARY);
+  return rev;
+}
+
+void LibraryRevision::record(MediaMode mode, LibraryChangeOp op,
+                             const char *uniqueID, int position) {
+  if (_mutex)
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+  uint32_t rev = ++_rev;
+  if (_bulkDepth == 0) {
+    LibraryChange c;
+    c.rev = rev;
+    c.mode = mode;
+    c.op = op;
+    c.position = position;
+    c.uniqueID = uniqueID ? uniqueID : "";
+    _log.push_back(c);
+    if (_log.size() > LIBRARY_CHANGE_LOG) {
+      _floor = _log.front().rev;
+      _log.pop_front();
+    }
+  }
+  if (_mutex)
+    xSemaphoreGive(_mutex);
+  EventBus::notify(EVENT_LIBRARY);
+}
+
+void LibraryRevision::recordUpsert(MediaMode mode, const char *uniqueID) {
+  record(mode, CHANGE_UPSERT, uniqueID, -1);
+}
+
+void LibraryRevision::recordDelete(MediaMode mode, const char *uniqueID,
+                                   int position) {
+  record(mode, CHANGE_DELETE, uniqueID, position);
+}
+
+void LibraryRevision::recordReset(MediaMode mode) {
+  record(mode, CHANGE_RESET, nullptr, -1);
+}
+
+void LibraryRevision::beginBulk() {
+  if (_mutex)
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+  _bulkDepth++;
+  if (_mutex)
+    xSemaphoreGive(_mutex);
+}
+
+void LibraryRevision::endBulk(MediaMode mode) {
+  if (_mutex)
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+  if (_bulkDepth > 0)
+    _bulkDepth--;
+  bool last = (_bulkDepth == 0);
+  if (_mutex)
+    xSemaphoreGive(_mutex);
+  if (last)
+    recordReset(mode);
+}
+
+bool LibraryRevision::changesSince(uint32_t since, MediaMode mode,
+                                   std::vector<LibraryChange> &out,
+                                   uint32_t &rev) {
+  out.clear();
+  if (_mutex)
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+  rev = _rev.load();
+  bool ok = since >= _floor && since <= rev;
+  for (auto it = _log.begin(); ok && it != _log.end(); ++it) {
+    if (it->rev <= since || it->mode != mode)
+      continue;
+    if (it->op == CHANGE_RESET)
+      ok = false;
+    else
+      out.push_back(*it);
+  }
+  if (_mutex)
+    xSemaphoreGive(_mutex);
+  if (!ok)
+    out.clear();
+  return ok;
+}
+
+String LibraryRevision::etag() {
+  char buf[40];
+  snprintf(buf, sizeof(buf), "\"%08lx-%d-%lu\"", (unsigned long)_epoch,
+           (int)currentMode, (unsigned long)_rev.load());
+  return String(buf);
+}
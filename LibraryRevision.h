@@ -0,0 +1,80 @@
+#ifndef LIBRARY_REVISION_H
+#define LIBRARY_REVISION_H
+
+#include "Core_Data.h"
+#include <Arduino.h>
+#include <atomic>
+#include <deque>
+#include <vector>
+
+// Library revision counter and change log.
+//
+// Every change to the in-RAM library (add, edit, delete, reorder, reload or
+// wipe) takes the next revision. Web clients use it to tell whether data they
+// already hold is still current: /api/items and /api/genres send it as their
+// ETag, and /api/changes?since=<rev> replays what changed after a revision.
+//
+// The log keeps the last LIBRARY_CHANGE_LOG entries. Upserts name the item by
+// uniqueID (its current state is read when the log is replayed); deletes also
+// keep the position the item had, since positions are the item ids on the
+// web. Reorders and reloads are logged as a reset, as is a rolled-over log:
+// a client that asks from before one of those has to reload everything.
+//
+// The epoch is random per boot, so a revision a browser kept from before a
+// reboot never matches the restarted counter.
+
+#define LIBRARY_CHANGE_LOG 128
+
+enum LibraryChangeOp : uint8_t {
+  CHANGE_UPSERT = 0, // Added or edited
+  CHANGE_DELETE,
+  CHANGE_RESET // Reordered / reloaded: positions are no longer comparable
+};
+
+struct LibraryChange {
+  uint32_t rev;
+  MediaMode mode;
+  LibraryChangeOp op;
+  int position; // CHANGE_DELETE: position before removal
+  PsramString uniqueID;
+};
+
+class LibraryRevision {
+public:
+  static void begin();
+
+  static uint32_t current();
+  static uint32_t epoch();
+  static uint32_t bump(); // No log entry; returns the new revision
+
+  static void recordUpsert(MediaMode mode, const char *uniqueID);
+  static void recordDelete(MediaMode mode, const char *uniqueID, int position);
+  static void recordReset(MediaMode mode);
+
+  // While a bulk update runs (library reload) individual records only bump
+  // the counter; endBulk() logs a single reset. Calls nest.
+  static void beginBulk();
+  static void endBulk(MediaMode mode);
+
+  // Entries for `mode` after `since`, oldest first, up to `rev` (the
+  // revision at the time of the call). False if the client has to reload:
+  // the log no longer reaches back that far, or a reset happened.
+  static bool changesSince(uint32_t since, MediaMode mode,
+                           std::vector<LibraryChange> &out, uint32_t &rev);
+
+  // Quoted ETag for data derived from the current mode's library
+  static String etag();
+
+private:
+  static void record(MediaMode mode, LibraryChangeOp op, const char *uniqueID,
+                     int position);
+
+  static std::atomic<uint32_t> _rev;
+  static uint32_t _epoch;
+  static std::deque<LibraryChange> _log;
+  static uint32_t _floor; // Oldest `since` the log can answer
+  static int _bulkDepth;
+  static SemaphoreHandle_t _mutex;
+};
+
+#endif // LIBRARY_REVISION_H
@@ -0,0 +1,259 @@
+#include "LockProfiler.h"
+#include "TraceRecorder.h"
+#include <esp_timer.h>
+
+// Trace spans: waits nest on the waiting task's track; holds are async
+// spans (id = lock), one track per lock whichever task holds it
+static const char *WAIT_TRACE[METRIC_LOCK_COUNT] = {
+    "wait library", "wait i2c", "wait lvgl", "wait http", "wait jpeg"};
+static const char *HOLD_TRACE[METRIC_LOCK_COUNT] = {
+    "hold library", "hold i2c", "hold lvgl", "hold http", "hold jpeg"};
+#define TRACE_WAIT_MIN_US 100 // Shorter waits would only clutter the trace
+
+// Static members
+LockProfiler::Tracked LockProfiler::_tracked[METRIC_LOCK_COUNT] = {};
+LockSiteStats LockProfiler::_sites[LOCK_PROF_SITES] = {};
+LockEvent LockProfiler::_events[LOCK_PROF_EVENTS] = {};
+int LockProfiler::_eventNext = 0;
+int LockProfiler::_eventCount = 0;
+portMUX_TYPE LockProfiler::_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// __FILE__ is a full path in Arduino builds
+static const char *baseName(const char *path) {
+  const char *slash = strrchr(path, '/');
+  return slash ? slash + 1 : path;
+}
+
+static void copyName(char *dst, const char *src) {
+  strncpy(dst, src ? src : "?", LOCK_PROF_NAME_LEN - 1);
+  dst[LOCK_PROF_NAME_LEN - 1] = '\0';
+}
+
+void LockProfiler::track(SemaphoreHandle_t mutex, MetricLock lock) {
+  if (lock < 0 || lock >= METRIC_LOCK_COUNT)
+    return;
+  _tracked[lock].mutex = mutex;
+  _tracked[lock].site = -1;
+}
+
+// The table is filled once at boot (track()), so no lock is needed
+LockProfiler::Tracked *LockProfiler::find(SemaphoreHandle_t mutex) {
+  if (!mutex)
+    return nullptr;
+  for (int i = 0; i < METRIC_LOCK_COUNT; i++) {
+    if (_tracked[i].mutex == mutex)
+      return &_tracked[i];
+  }
+  return nullptr;
+}
+
+// Slot for a call site, claimed on first use; -1 when the table is full.
+// Keyed on the name rather than the pointer: a header's __FILE__ is a
+// different string in every file that includes it. Caller holds _lock.
+int LockProfiler::siteFor(MetricLock lock, const char *file, int line) {
+  int slot = ((unsigned)line * 31u + lock) % LOCK_PROF_SITES;
+  for (int probe = 0; probe < LOCK_PROF_SITES; probe++) {
+    LockSiteStats &s = _sites[slot];
+    if (!s.file) {
+      s.lock = lock;
+      s.file = file;
+      s.line = line;
+      return slot;
+    }
+    if (s.line == line && s.lock == lock &&
+        (s.file == file || strcmp(s.file, file) == 0))
+      return slot;
+    slot = (slot + 1) % LOCK_PROF_SITES;
+  }
+  return -1;
+}
+
+// Caller holds _lock
+void LockProfiler::pushEvent(const LockEvent &e) {
+  _events[_eventNext] = e;
+  _eventNext = (_eventNext + 1) % LOCK_PROF_EVENTS;
+  if (_eventCount < LOCK_PROF_EVENTS)
+    _eventCount++;
+}
+
+BaseType_t LockProfiler::take(SemaphoreHandle_t mutex, TickType_t timeout,
+                              const char *file, int line) {
+  Tracked *t = find(mutex);
+  if (!t)
+    return xSemaphoreTakeRecursive(mutex, timeout);
+
+  MetricLock lock = (MetricLock)(t - _tracked);
+  int64_t start = esp_timer_get_time();
+  BaseType_t got = xSemaphoreTakeRecursive(mutex, timeout);
+  int64_t now = esp_timer_get_time();
+  uint32_t waitUs = (uint32_t)(now - start);
+  Metrics::recordLockWait(lock, waitUs, got == pdTRUE);
+  file = baseName(file);
+
+  if (got == pdTRUE) {
+    const char *task = pcTaskGetName(NULL);
+    portENTER_CRITICAL(&_lock);
+    int site = siteFor(lock, file, line);
+    if (site >= 0) {
+      LockSiteStats &s = _sites[site];
+      s.takes++;
+      s.totalWaitUs += waitUs;
+      if (waitUs > s.maxWaitUs)
+        s.maxWaitUs = waitUs;
+    }
+    bool outermost = t->depth++ == 0;
+    if (outermost) {
+      t->owner = xTaskGetCurrentTaskHandle();
+      t->since = now;
+      t->site = site;
+      t->waitUs = waitUs;
+      copyName(t->task, task);
+    }
+    portEXIT_CRITICAL(&_lock);
+
+    if (outermost && TraceRecorder::isEnabled()) {
+      if (waitUs >= TRACE_WAIT_MIN_US) {
+        TraceRecorder::record('B', WAIT_TRACE[lock], start);
+        TraceRecorder::record('E', WAIT_TRACE[lock], now);
+      }
+      TraceRecorder::record('b', HOLD_TRACE[lock], now, lock);
+    }
+    return got;
+  }
+
+  // Timed out: note who had it
+  LockEvent e = {};
+  e.atMs = millis();
+  e.lock = lock;
+  e.timedOut = true;
+  copyName(e.task, pcTaskGetName(NULL));
+  e.file = file;
+  e.line = line;
+  e.waitUs = waitUs;
+  uint32_t heldForUs = 0;
+  portENTER_CRITICAL(&_lock);
+  int site = siteFor(lock, file, line);
+  if (site >= 0)
+    _sites[site].timeouts++;
+  if (t->depth > 0) {
+    copyName(e.holderTask, t->task);
+    if (t->site >= 0) {
+      e.holderFile = _sites[t->site].file;
+      e.holderLine = _sites[t->site].line;
+    }
+    heldForUs = (uint32_t)(now - t->since);
+  }
+  pushEvent(e);
+  portEXIT_CRITICAL(&_lock);
+
+  if (waitUs < LOCK_PROF_LOG_MS * 1000UL)
+    return got;
+  Serial.printf("LOCK: %s timed out after %lu ms at %s:%d (%s); ",
+                Metrics::lockName(lock), (unsigned long)(waitUs / 1000), file,
+                line, e.task);
+  if (e.holderTask[0])
+    Serial.printf("held by %s from %s:%d for %lu ms\n", e.holderTask,
+                  e.holderFile ? e.holderFile : "?", e.holderLine,
+                  (unsigned long)(heldForUs / 1000));
+  else
+    Serial.println("released meanwhile");
+  return got;
+}
+
+BaseType_t LockProfiler::give(SemaphoreHandle_t mutex) {
+  Tracked *t = find(mutex);
+  if (t) {
+    int64_t now = esp_timer_get_time();
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    bool released = false;
+    portENTER_CRITICAL(&_lock);
+    // Bookkeeping before the mutex is released: once it is, the next owner
+    // overwrites it
+    if (t->depth > 0 && t->owner == self && --t->depth == 0) {
+      uint32_t holdUs = (uint32_t)(now - t->since);
+      if (t->site >= 0) {
+        LockSiteStats &s = _sites[t->site];
+        s.totalHoldUs += holdUs;
+        if (holdUs > s.maxHoldUs)
+          s.maxHoldUs = holdUs;
+      }
+      if (holdUs >= LOCK_PROF_SLOW_US || t->waitUs >= LOCK_PROF_SLOW_US) {
+        LockEvent e = {};
+        e.atMs = millis();
+        e.lock = (MetricLock)(t - _tracked);
+        memcpy(e.task, t->task, LOCK_PROF_NAME_LEN);
+        if (t->site >= 0) {
+          e.file = _sites[t->site].file;
+          e.line = _sites[t->site].line;
+        }
+        e.waitUs = t->waitUs;
+        e.holdUs = holdUs;
+        pushEvent(e);
+      }
+      t->owner = NULL;
+      released = true;
+    }
+    portEXIT_CRITICAL(&_lock);
+
+    if (released && TraceRecorder::isEnabled()) {
+      MetricLock lock = (MetricLock)(t - _tracked);
+      TraceRecorder::record('e', HOLD_TRACE[lock], now, lock);
+    }
+  }
+  return xSemaphoreGiveRecursive(mutex);
+}
+
+int LockProfiler::getSites(LockSiteStats *out, int max) {
+  int n = 0;
+  portENTER_CRITICAL(&_lock);
+  for (int i = 0; i < LOCK_PROF_SITES && n < max; i++) {
+    if (_sites[i].file)
+      out[n++] = _sites[i];
+  }
+  portEXIT_CRITICAL(&_lock);
+  return n;
+}
+
+int LockProfiler::getEvents(LockEvent *out, int max) {
+  int n = 0;
+  portENTER_CRITICAL(&_lock);
+  for (int i = 0; i < _eventCount && n < max; i++) {
+    int idx = (_eventNext - 1 - i + LOCK_PROF_EVENTS) % LOCK_PROF_EVENTS;
+    out[n++] = _events[idx];
+  }
+  portEXIT_CRITICAL(&_lock);
+  return n;
+}
+
+LockHolder LockProfiler::getHolder(MetricLock lock) {
+  LockHolder h = {};
+  if (lock < 0 || lock >= METRIC_LOCK_COUNT)
+    return h;
+  int64_t now = esp_timer_get_time();
+  const Tracked &t = _tracked[lock];
+  portENTER_CRITICAL(&_lock);
+  if (t.depth > 0) {
+    h.held = true;
+    memcpy(h.task, t.task, LOCK_PROF_NAME_LEN);
+    if (t.site >= 0) {
+      h.file = _sites[t.site].file;
+      h.line = _sites[t.site].line;
+    }
+    h.depth = t.depth;
+    h.heldForUs = (uint32_t)(now - t.since);
+  }
+  portEXIT_CRITICAL(&_lock);
+  return h;
+}
+
+// Holds in progress keep running but aren't attributed to a site
+void LockProfiler::reset() {
+  portENTER_CRITICAL(&_lock);
+  for (int i = 0; i < LOCK_PROF_SITES; i++)
+    _sites[i] = LockSiteStats();
+  for (int k = 0; k < METRIC_LOCK_COUNT; k++)
+    _tracked[k].site = -1;
+  _eventNext = 0;
+  _eventCount = 0;
+  portEXIT_CRITICAL(&_lock);
+}
@@ -0,0 +1,113 @@
+#ifndef LOCK_PROFILER_H
+#define LOCK_PROFILER_H
+
+#include "Metrics.h" // MetricLock
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Who holds libraryMutex, i2cMutex, jpegMutex and the LVGL lock, from where,
+// and for how long.
+//
+// Takes and gives of a tracked mutex go through LOCK_TAKE()/LOCK_GIVE()
+// (lvgl_port_lock()/unlock() do it themselves), which note the task and
+// call site of the outermost take and time the wait and the hold. Each call
+// site keeps totals and worst cases; holds or waits of LOCK_PROF_SLOW_US and
+// more, and every timeout, also go into a ring of recent events. A timeout
+// names the task and call site holding the lock at that moment, and one
+// that waited LOCK_PROF_LOG_MS or more (not a quick try, like the touch
+// poll) says so on Serial, so "I2C LOCK FAIL" comes with its culprit.
+// Waits also feed the lock-wait histograms of /api/metrics, and with the
+// trace recorder on, waits and holds show on its timeline.
+//
+//   if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
+//     ...
+//     LOCK_GIVE(i2cMutex);
+//   }
+
+#define LOCK_PROF_SITES 128     // Distinct (lock, call site) pairs kept
+#define LOCK_PROF_EVENTS 64     // Ring of slow holds/waits and timeouts
+#define LOCK_PROF_SLOW_US 20000 // Holds or waits this long go in the ring
+#define LOCK_PROF_LOG_MS 250    // Timeouts after waiting this long are logged
+#define LOCK_PROF_NAME_LEN 16   // configMAX_TASK_NAME_LEN
+
+struct LockSiteStats {
+  MetricLock lock;
+  const char *file; // Base name
+  int line;
+  uint32_t takes;
+  uint32_t timeouts;
+  uint64_t totalWaitUs;
+  uint64_t totalHoldUs;
+  uint32_t maxWaitUs;
+  uint32_t maxHoldUs; // Outermost take to last give
+};
+
+struct LockEvent {
+  uint32_t atMs; // millis() when it ended
+  MetricLock lock;
+  bool timedOut;
+  char task[LOCK_PROF_NAME_LEN];
+  const char *file;
+  int line;
+  uint32_t waitUs;
+  uint32_t holdUs; // 0 for a timeout
+  // Timeouts: who had the lock
+  char holderTask[LOCK_PROF_NAME_LEN];
+  const char *holderFile;
+  int holderLine;
+};
+
+struct LockHolder {
+  bool held;
+  char task[LOCK_PROF_NAME_LEN];
+  const char *file;
+  int line;
+  uint16_t depth; // Recursive takes outstanding
+  uint32_t heldForUs;
+};
+
+class LockProfiler {
+public:
+  // Registers a mutex; takes of untracked mutexes pass straight through
+  static void track(SemaphoreHandle_t mutex, MetricLock lock);
+
+  static BaseType_t take(SemaphoreHandle_t mutex, TickType_t timeout,
+                         const char *file, int line);
+  static BaseType_t give(SemaphoreHandle_t mutex);
+
+  // Copies of the site table (unsorted) and of the ring (newest first).
+  // Return the number copied.
+  static int getSites(LockSiteStats *out, int max);
+  static int getEvents(LockEvent *out, int max);
+  static LockHolder getHolder(MetricLock lock);
+  static void reset();
+
+private:
+  struct Tracked {
+    SemaphoreHandle_t mutex;
+    TaskHandle_t owner;
+    uint16_t depth;
+    int64_t since; // Outermost take
+    int site;      // Of the outermost take, -1 if the table was full
+    uint32_t waitUs;
+    char task[LOCK_PROF_NAME_LEN];
+  };
+
+  static Tracked *find(SemaphoreHandle_t mutex);
+  static int siteFor(MetricLock lock, const char *file, int line);
+  static void pushEvent(const LockEvent &e);
+
+  static Tracked _tracked[METRIC_LOCK_COUNT];
+  static LockSiteStats _sites[LOCK_PROF_SITES]; // Open addressing, by line
+  static LockEvent _events[LOCK_PROF_EVENTS];
+  static int _eventNext;
+  static int _eventCount;
+  static portMUX_TYPE _lock;
+};
+
+#define LOCK_TAKE(mutex, timeout)                                             \
+  LockProfiler::take((mutex), (timeout), __FILE__, __LINE__)
+#define LOCK_GIVE(mutex) LockProfiler::give(mutex)
+
+#endif // LOCK_PROFILER_H
@@ -1,28 +1,43 @@
 #include "MediaManager.h"
 #include "AppGlobals.h"
 #include "BackgroundWorker.h"
+#include "HttpPool.h"
+#include "LibraryRevision.h"
+#include "MetadataCache.h"
+#include "Metrics.h"
 #include "NavigationCache.h"
+#include "ProviderRace.h"
+#include "RequestScheduler.h"
+#include <algorithm>
 #include "mode_abstraction.h"
 #include <FastLED.h>
 #include <esp_heap_caps.h>
 
 bool MediaManager::_taskBusy = false;
-
-void MediaManager::init() { _taskBusy = false; }
+std::map<String, MBRelease> MediaManager::_stash;
+std::map<String, uint32_t> MediaManager::_awaited;
+SemaphoreHandle_t MediaManager::_stashMutex = NULL;
+
+void MediaManager::init() {
+  _taskBusy = false;
+  if (!_stashMutex)
+    _stashMutex = xSemaphoreCreateMutex();
+}
 
 void MediaManager::syncFromStorage() {
   Storage.loadIndex(MODE_CD);
   Storage.loadIndex(MODE_BOOK);
+  CoverStore::rebuildRefCounts();
   syncLibraryFromStorage();
 }
 
 void MediaManager::filter(const char *query, int filterMode, bool ledMasterOn) {
   if (query == nullptr)
     return;
+  METRIC_SCOPE(METRIC_OP_FILTER);
 
   // Clear and reset results
   search_matches.clear();
-  search_display_offset = 0;
 
   String q = String(query);
   q.toLowerCase();
@@ -90,9 +105,643 @@ void MediaManager::filter(const char *query, int filterMode, bool ledMasterOn) {
 // INTERNAL API HELPERS
 // ============================================================================
 
+// Parses the response body straight off the socket, keeping only what
+// `filter` selects: memory use follows the filter, not the response size.
+static DeserializationError parseFiltered(HttpBodyStream &body,
+                                          JsonDocument &doc,
+                                          const JsonDocument &filter) {
+  DeserializationError error =
+      deserializeJson(doc, body, DeserializationOption::Filter(filter));
+  Serial.printf("MediaManager: parsed %u bytes into %u byte doc (%s)\n",
+                (unsigned)body.bytesRead(), (unsigned)doc.memoryUsage(),
+                error.c_str());
+  return error;
+}
+
+// Consumes what the parser left of the body
+static void endBody(PooledHttp &req, HttpBodyStream &body) {
+  if (!body.finish())
+    req.close(); // Body not fully consumed, socket can't be reused
+}
+
+static DeserializationError readJsonBody(PooledHttp &req, JsonDocument &doc,
+                                         const JsonDocument &filter,
+                                         uint32_t timeoutMs) {
+  HttpBodyStream body(req.http(), timeoutMs);
+  DeserializationError error = parseFiltered(body, doc, filter);
+  endBody(req, body);
+  return error;
+}
+
+// ============================================================================
+// PROVIDER RACE ENTRANTS
+// ============================================================================
+
+// Cover URL race entrants. args: {artist, album}
+
+// iTunes search, artwork upscaled to 240x240
+static RaceResult coverUrlFromItunes(const std::vector<String> &args,
+                                     String &out) {
+  const String &artist = args[0];
+  const String &album = args[1];
+  RaceResult result = RACE_FAILED;
+
+  // Try up to 2 times only (reduced from 3 for faster bulk checks)
+  for (int attempt = 1; attempt <= 2; attempt++) {
+
+    String searchQuery = artist + " " + album;
+    String encodedQuery = urlEncode(searchQuery);
+
+    String url = "https://itunes.apple.com/search?term=" + encodedQuery +
+                 "&entity=album&limit=1";
+
+    if (attempt == 1) {
+      Serial.printf("Fetching URL for: %s - %s\n", artist.c_str(),
+                    album.c_str());
+    } else
+      Serial.printf("  Retry #%d...\n", attempt);
+
+    PooledHttp req(url);
+    HTTPClient &http = req.http();
+
+    // Add headers to mimic a browser
+    http.setUserAgent("Mozilla/5.0 (Windows NT 10.0; Win64; x64) "
+                      "AppleWebKit/537.36 (KHTML, "
+                      "like Gecko) Chrome/112.0.0.0 Safari/537.36");
+    http.addHeader("Accept", "*/*");
+
+    // Reduce timeout
+    http.setTimeout(2000);
+
+    int httpCode = RequestScheduler::get(API_ITUNES, http);
+
+    if (httpCode == 200) {
+      String payload = http.getString();
+      int artworkIndex = payload.indexOf("\"artworkUrl100\":\"");
+      if (artworkIndex > 0) {
+        int startIndex = artworkIndex + 17;
+        int endIndex = payload.indexOf("\"", startIndex);
+        out = payload.substring(startIndex, endIndex);
+
+        // Request 240x240 image
+        out.replace("100x100", "240x240");
+        Serial.printf("  ✓ Found: %s\n", out.c_str());
+        result = RACE_FOUND;
+      } else {
+        result = RACE_NOT_FOUND;
+      }
+      http.end();
+      break; // Success!
+    } else if (httpCode == -1 || httpCode == -11) {
+      // Timeout or connection error - don't retry
+      Serial.printf("  ✗ Timeout/Connection Error: %d - Skipping\n", httpCode);
+      http.end();
+      break; // Skip this album, don't retry
+    } else {
+      ErrorHandler::logError(ERR_CAT_NETWORK,
+                             String("iTunes HTTP Error: ") + String(httpCode) +
+                                 " (Query: " + artist + " - " + album + ")",
+                             "fetchAlbumCoverUrl");
+      Serial.printf("  ✗ HTTP Error: %d\n", httpCode);
+      http.end();
+    }
+  }
+
+  return result;
+}
+
+// Deezer album search, 250x250 artwork
+static RaceResult coverUrlFromDeezer(const std::vector<String> &args,
+                                     String &out) {
+  String query = "artist:\"" + args[0] + "\" album:\"" + args[1] + "\"";
+  String url = "https://api.deezer.com/search/album?q=" + urlEncode(query) +
+               "&limit=1";
+
+  PooledHttp req(url);
+  HTTPClient &http = req.http();
+  http.setTimeout(5000);
+
+  int httpCode = RequestScheduler::get(API_DEEZER, http);
+  if (httpCode != 200) {
+    Serial.printf("  ✗ Deezer HTTP Error: %d\n", httpCode);
+    http.end();
+    return RACE_FAILED;
+  }
+
+  StaticJsonDocument<64> filter;
+  filter["data"][0]["cover_medium"] = true;
+  filter["error"] = true;
+
+  StaticJsonDocument<512> doc;
+  DeserializationError error = readJsonBody(req, doc, filter, 5000);
+  http.end();
+  // Deezer reports quota/server errors as 200 + {"error":{...}}
+  if (error || !doc["error"].isNull())
+    return RACE_FAILED;
+
+  out = doc["data"][0]["cover_medium"] | "";
+  if (out.length() == 0)
+    return RACE_NOT_FOUND;
+  Serial.printf("  ✓ Found (Deezer): %s\n", out.c_str());
+  return RACE_FOUND;
+}
+
+// ============================================================================
+// CACHED LOOKUPS (MetadataCache in front of the online lookups)
+// ============================================================================
+
+static void releaseToJson(const MBRelease &r, JsonDocument &doc) {
+  doc["id"] = r.releaseMbid;
+  doc["t"] = r.title;
+  doc["a"] = r.artist;
+  doc["g"] = r.genre;
+  doc["y"] = r.year;
+}
+
+static void releaseFromJson(const JsonDocument &doc, MBRelease &r) {
+  r.releaseMbid = doc["id"] | "";
+  r.title = doc["t"] | "";
+  r.artist = doc["a"] | "";
+  r.genre = doc["g"] | "";
+  r.year = doc["y"] | 0;
+  r.success = r.releaseMbid.length() > 0;
+}
+
+// Serves `key` from the cache. Returns false on a miss.
+static bool cachedRelease(const String &key, MBRelease &r) {
+  StaticJsonDocument<512> doc;
+  MetaCacheResult res = MetadataCache::get(key, doc);
+  if (res == META_MISS)
+    return false;
+  r.success = false;
+  r.notFound = (res == META_NOT_FOUND);
+  r.year = 0;
+  if (res == META_HIT)
+    releaseFromJson(doc, r);
+  Serial.printf("MediaManager: %s served from cache (%s)\n", key.c_str(),
+                r.success ? "hit" : "not found");
+  return true;
+}
+
+static void storeRelease(const String &key, const MBRelease &r) {
+  if (r.success) {
+    StaticJsonDocument<512> doc;
+    releaseToJson(r, doc);
+    MetadataCache::put(key, doc, META_TTL_RELEASE);
+  } else if (r.notFound) {
+    MetadataCache::putNotFound(key);
+  }
+}
+
 MBRelease MediaManager::fetchReleaseByBarcode(const char *barcode) {
+  String key = String("mb:") + barcode;
+  MBRelease result;
+  if (cachedRelease(key, result))
+    return result;
+  result = lookupReleaseOnline(barcode);
+  storeRelease(key, result);
+  return result;
+}
+
+MBRelease MediaManager::fetchReleaseFromDiscogs(const char *barcode) {
+  String key = String("dg:") + barcode;
+  MBRelease result;
+  if (cachedRelease(key, result))
+    return result;
+  result = lookupDiscogsOnline(barcode);
+  storeRelease(key, result);
+  return result;
+}
+
+std::vector<Track> MediaManager::fetchTracklist(const char *releaseMbid,
+                                                String *outGenre) {
+  std::vector<Track> tracks;
+  if (!releaseMbid || !*releaseMbid)
+    return tracks;
+  String key = String("tl:") + releaseMbid;
+
+  BasicJsonDocument<SpiRamAllocator> doc(TRACKLIST_JSON_DOC_SIZE);
+  if (MetadataCache::get(key, doc) == META_HIT) {
+    for (JsonArray t : doc["tr"].as<JsonArray>()) {
+      Track track;
+      track.trackNo = t[0] | (int)(tracks.size() + 1);
+      track.title = (const char *)(t[1] | "");
+      track.durationMs = t[2] | 0;
+      track.recordingMbid = (const char *)(t[3] | "");
+      track.lyrics.status = "unchecked";
+      tracks.push_back(track);
+    }
+    if (outGenre)
+      *outGenre = doc["g"] | "Unknown";
+    Serial.printf("fetchTracklist: %d tracks served from cache\n",
+                  (int)tracks.size());
+    return tracks;
+  }
+
+  String genre;
+  tracks = lookupTracklistOnline(releaseMbid, &genre);
+  if (outGenre)
+    *outGenre = genre;
+  if (tracks.empty())
+    return tracks; // Failures aren't cached; the release exists
+
+  doc.clear();
+  doc["g"] = genre;
+  JsonArray arr = doc.createNestedArray("tr");
+  for (const Track &track : tracks) {
+    JsonArray t = arr.createNestedArray();
+    t.add(track.trackNo);
+    t.add(track.title.c_str());
+    t.add(track.durationMs);
+    t.add(track.recordingMbid.c_str());
+  }
+  MetadataCache::put(key, doc, META_TTL_TRACKLIST);
+  return tracks;
+}
+
+bool MediaManager::fetchBookByISBN(const char *isbn, Book &book) {
+  String key = String("isbn:") + isbn;
+
+  StaticJsonDocument<1024> doc;
+  MetaCacheResult res = MetadataCache::get(key, doc);
+  if (res == META_NOT_FOUND) {
+    Serial.printf("No book found for ISBN: %s (cached)\n", isbn);
+    return false;
+  }
+  if (res == META_HIT) {
+    book.title = (const char *)(doc["t"] | "Unknown");
+    book.author = (const char *)(doc["a"] | "Unknown");
+    book.genre = (const char *)(doc["g"] | "Unknown");
+    book.year = doc["y"] | 0;
+    book.isbn = isbn;
+    book.publisher = (const char *)(doc["p"] | "");
+    book.pageCount = doc["pc"] | 0;
+    book.coverUrl = (const char *)(doc["c"] | "");
+    Serial.printf("Book metadata for ISBN %s served from cache\n", isbn);
+    return true;
+  }
+
+  bool notFound = false;
+  if (!lookupBookOnline(isbn, book, notFound)) {
+    if (notFound)
+      MetadataCache::putNotFound(key);
+    return false;
+  }
+
+  doc.clear();
+  doc["t"] = book.title.c_str();
+  doc["a"] = book.author.c_str();
+  doc["g"] = book.genre.c_str();
+  doc["y"] = book.year;
+  doc["p"] = book.publisher.c_str();
+  doc["pc"] = book.pageCount;
+  doc["c"] = book.coverUrl.c_str();
+  MetadataCache::put(key, doc, META_TTL_BOOK);
+  return true;
+}
+
+String MediaManager::fetchAlbumCoverUrl(const char *artist, const char *album) {
+  String key = String("cover:") + artist + "|" + album;
+  key.toLowerCase();
+
+  StaticJsonDocument<384> doc;
+  MetaCacheResult res = MetadataCache::get(key, doc);
+  if (res == META_NOT_FOUND)
+    return "";
+  if (res == META_HIT)
+    return doc["u"] | "";
+
+  // Cover URL providers, see coverUrlFromItunes / coverUrlFromDeezer
+  static const RaceEntrant providers[] = {
+      {"iTunes", coverUrlFromItunes, 0},
+      {"Deezer", coverUrlFromDeezer, COVER_HEDGE_MS},
+  };
+  bool notFound = false;
+  String url;
+  ProviderRace::run(RACE_COVER_URL, providers, 2, {artist, album}, url,
+                    COVER_RACE_TIMEOUT_MS, &notFound);
+  if (url.length() > 0) {
+    doc["u"] = url;
+    MetadataCache::put(key, doc, META_TTL_COVER_URL);
+  } else if (notFound) {
+    MetadataCache::putNotFound(key);
+  }
+  return url;
+}
+
+// ============================================================================
+// RESPONSE PARSERS
+// ============================================================================
+//
+// What each lookup does with its response body, kept apart from the request
+// so StorageTests can replay captured responses through the same filters.
+
+DeserializationError MediaManager::parseReleaseSearch(HttpBodyStream &body,
+                                                      MBRelease &out) {
+  StaticJsonDocument<256> filter;
+  JsonObject f = filter["releases"].createNestedObject();
+  f["id"] = true;
+  f["title"] = true;
+  f["date"] = true;
+  f["release-events"][0]["date"] = true;
+  f["artist-credit"][0]["name"] = true;
+
+  DynamicJsonDocument doc(2048);
+  DeserializationError error = parseFiltered(body, doc, filter);
+  out.success = false;
+  JsonObject rel = doc["releases"][0];
+  if (error || rel.isNull())
+    return error;
+
+  out.releaseMbid = rel["id"] | "";
+  out.title = rel["title"] | "";
+  decodeHTMLEntities(out.title);
+  out.title = toTitleCase(out.title); // Capitalize Album Title
+
+  out.artist = rel["artist-credit"][0]["name"] | "";
+  decodeHTMLEntities(out.artist);
+  out.artist = toTitleCase(out.artist); // Capitalize first letters
+
+  // Year
+  String date = rel["date"] | "";
+  if (date.length() < 4)
+    date = rel["release-events"][0]["date"] | "";
+  if (date.length() >= 4)
+    out.year = date.substring(0, 4).toInt();
+
+  out.success = (out.releaseMbid.length() > 0);
+  return error;
+}
+
+DeserializationError MediaManager::parseDiscogsSearch(HttpBodyStream &body,
+                                                      MBRelease &out) {
+  StaticJsonDocument<192> filter;
+  JsonObject f = filter["results"].createNestedObject();
+  f["id"] = true;
+  f["title"] = true;
+  f["year"] = true;
+  f["artist"] = true;
+  f["genre"] = true;
+  f["style"] = true;
+
+  DynamicJsonDocument doc(2048);
+  DeserializationError error = parseFiltered(body, doc, filter);
+  out.success = false;
+  if (error)
+    return error;
+  JsonArray results = doc["results"];
+  if (results.size() == 0) {
+    out.notFound = true;
+    return error;
+  }
+  JsonObject release = results[0];
+
+  // Extract title - Discogs returns combined "Artist - Title" format
+  String fullTitle = release["title"].as<String>();
+  out.year = release["year"].as<String>().toInt(); // Sent as a string
+
+  // Discogs doesn't provide MusicBrainz IDs, use Discogs ID as placeholder
+  out.releaseMbid = "discogs_" + release["id"].as<String>();
+
+  // Parse artist and title from combined string
+  // Discogs search results typically return "Artist - Album Title"
+  int dashPos = fullTitle.indexOf(" - ");
+  if (dashPos > 0) {
+    out.artist = fullTitle.substring(0, dashPos);
+    out.title = fullTitle.substring(dashPos + 3);
+  } else {
+    // Fallback: use full title and check for artist field
+    out.title = fullTitle;
+    if (release.containsKey("artist")) {
+      out.artist = release["artist"].as<String>();
+    } else {
+      out.artist = "Various Artists";
+    }
+  }
+
+  // Extract genre/style information
+  // Discogs provides both "genre" (broad) and "style" (specific) arrays
+  if (release.containsKey("genre") && release["genre"].size() > 0) {
+    out.genre = release["genre"][0].as<String>();
+  } else if (release.containsKey("style") && release["style"].size() > 0) {
+    out.genre = release["style"][0].as<String>();
+  }
+
+  // Clean up titles
+  decodeHTMLEntities(out.title);
+  decodeHTMLEntities(out.artist);
+  out.title = toTitleCase(out.title);
+  out.artist = toTitleCase(out.artist);
+  if (out.genre.length() > 0) {
+    out.genre = toTitleCase(out.genre);
+  }
+
+  out.success = true;
+  return error;
+}
+
+DeserializationError MediaManager::parseTracklist(HttpBodyStream &body,
+                                                  std::vector<Track> &tracks,
+                                                  String *outGenre,
+                                                  bool &truncated) {
+  // Box sets run to hundreds of KB; keep only the fields used below so the
+  // document size depends on the track count, not the response size.
+  StaticJsonDocument<512> filter;
+  filter["genres"][0]["name"] = true;
+  filter["tags"][0]["name"] = true;
+  filter["release-group"]["genres"][0]["name"] = true;
+  filter["release-group"]["tags"][0]["name"] = true;
+  JsonObject ft = filter["media"][0]["tracks"].createNestedObject();
+  ft["position"] = true;
+  ft["title"] = true;
+  ft["length"] = true;
+  ft["id"] = true;
+  ft["recording"]["id"] = true;
+  ft["recording"]["length"] = true;
+  JsonObject fr = filter["recordings"].createNestedObject();
+  fr["title"] = true;
+  fr["length"] = true;
+  fr["id"] = true;
+
+  BasicJsonDocument<SpiRamAllocator> doc(TRACKLIST_JSON_DOC_SIZE);
+  DeserializationError error = parseFiltered(body, doc, filter);
+
+  // Past the cap, keep the tracks parsed so far
+  truncated = (error == DeserializationError::NoMemory);
+  if (truncated)
+    error = DeserializationError::Ok;
+
+  if (!error) {
+    // 1. Extract Genre
+    if (outGenre) {
+      *outGenre = "";
+      // Helper to find first valid genre using a simple blacklist
+      auto findValidGenre = [](JsonArray arr) -> String {
+        for (JsonObject obj : arr) {
+          String name = obj["name"].as<String>();
+          String lower = name;
+          lower.toLowerCase();
+          // Blacklist: skip non-genre tags
+          if (lower == "hidden track" || lower.indexOf("bonus") >= 0 ||
+              lower.indexOf("edition") >= 0 || lower == "remastered" ||
+              lower == "cc-by-nc-sa" || lower.indexOf("copy protest") >= 0) {
+            continue;
+          }
+          return name; // Found a good one
+        }
+        return "";
+      };
+
+      if (doc.containsKey("genres") && doc["genres"].size() > 0) {
+        *outGenre = findValidGenre(doc["genres"]);
+      }
+
+      if (outGenre->length() == 0 && doc.containsKey("tags") &&
+          doc["tags"].size() > 0) {
+        *outGenre = findValidGenre(doc["tags"]);
+      }
+
+      // Check Release Group as fallback
+      if (outGenre->length() == 0 && doc.containsKey("release-group")) {
+        JsonObject rg = doc["release-group"];
+        if (rg.containsKey("genres") && rg["genres"].size() > 0) {
+          *outGenre = findValidGenre(rg["genres"]);
+        }
+        if (outGenre->length() == 0 && rg.containsKey("tags") &&
+            rg["tags"].size() > 0) {
+          *outGenre = findValidGenre(rg["tags"]);
+        }
+      }
+
+      if (outGenre->length() == 0)
+        *outGenre = "Unknown";
+
+      *outGenre = toTitleCase(*outGenre); // Capitalize Genre
+    }
+
+    // 2. Extract Tracks
+    // Try "media" array first (Standard structure)
+    if (doc.containsKey("media")) {
+      JsonArray media = doc["media"];
+      for (JsonObject medium : media) {
+        int positionOffset =
+            tracks.size(); // Continues numbering for multi-disc
+        if (medium.containsKey("tracks")) {
+          JsonArray trkArray = medium["tracks"];
+          for (JsonObject t : trkArray) {
+            Track track;
+            track.trackNo =
+                t["position"] | (tracks.size() + 1); // Or logical ordering
+            track.title = t["title"] | "Unknown Track";
+            // Length is usually in "recording" object or "length" field
+            if (t.containsKey("recording")) {
+              track.durationMs = t["recording"]["length"] | 0;
+              track.recordingMbid = t["recording"]["id"] | "";
+            } else {
+              track.durationMs = t["length"] | 0;
+              track.recordingMbid = t["id"] | "";
+            }
+
+            // Sanitize
+            // Sanitize
+            String tempTitle = track.title.c_str();
+            decodeHTMLEntities(tempTitle);
+            tempTitle = sanitizeText(tempTitle);
+            tempTitle = toTitleCase(tempTitle); // Capitalize Track Title
+            track.title = tempTitle.c_str();
+
+            track.lyrics.status = "unchecked";
+            tracks.push_back(track);
+          }
+        }
+      }
+    }
+    // Fallback: Check if "recordings" exists (unlikely for this endpoint but
+    // safe to check)
+    else if (doc.containsKey("recordings")) {
+      JsonArray recs = doc["recordings"];
+      for (JsonObject r : recs) {
+        Track track;
+        track.title = r["title"] | "Unknown";
+        track.durationMs = r["length"] | 0;
+        track.recordingMbid = r["id"] | "";
+        track.trackNo = tracks.size() + 1;
+        track.lyrics.status = "unchecked";
+        String tempTitle = track.title.c_str();
+        track.title = toTitleCase(tempTitle)
+                          .c_str(); // Capitalize Track Title (Fallback)
+        tracks.push_back(track);
+      }
+    }
+  }
+  return error;
+}
+
+DeserializationError MediaManager::parseBookVolume(HttpBodyStream &body,
+                                                   const char *isbn,
+                                                   Book &book, bool &notFound) {
+  // Volume records carry descriptions, sale info etc. we never read
+  StaticJsonDocument<384> filter;
+  filter["totalItems"] = true;
+  JsonObject fv = filter["items"][0]["volumeInfo"].to<JsonObject>();
+  fv["title"] = true;
+  fv["authors"] = true;
+  fv["categories"] = true;
+  fv["publishedDate"] = true;
+  fv["publisher"] = true;
+  fv["pageCount"] = true;
+  fv["imageLinks"]["thumbnail"] = true;
+
+  DynamicJsonDocument doc(2048);
+  DeserializationError error = parseFiltered(body, doc, filter);
+  notFound = false;
+  if (error)
+    return error;
+  if (doc["totalItems"] == 0) {
+    notFound = true;
+    return error;
+  }
+
+  JsonObject info = doc["items"][0]["volumeInfo"];
+  book.title = (const char *)(info["title"] | "Unknown");
+  book.author = (info["authors"].size() > 0)
+                    ? info["authors"][0].as<String>().c_str()
+                    : "Unknown";
+  book.genre = (info["categories"].size() > 0)
+                   ? info["categories"][0].as<String>().c_str()
+                   : "Unknown";
+
+  // Apply Title Case
+  book.title = toTitleCase(book.title.c_str()).c_str();
+  book.author = toTitleCase(book.author.c_str()).c_str();
+  book.genre = toTitleCase(book.genre.c_str()).c_str();
+
+  String date = info["publishedDate"] | "";
+  if (date.length() >= 4)
+    book.year = date.substring(0, 4).toInt();
+
+  book.isbn = (const char *)isbn;
+  book.publisher = (const char *)(info["publisher"] | "");
+  book.pageCount = info["pageCount"] | 0;
+
+  // Extract cover URL from Google Books API (prefer their thumbnail)
+  if (info["imageLinks"]["thumbnail"]) {
+    book.coverUrl = info["imageLinks"]["thumbnail"].as<String>().c_str();
+    Serial.printf("Found cover URL: %s\n", book.coverUrl.c_str());
+  } else {
+    // Fallback to Open Library if Google doesn't have a cover
+    book.coverUrl =
+        ("https://covers.openlibrary.org/b/isbn/" + String(isbn) + "-M.jpg")
+            .c_str();
+    Serial.printf("No Google Books cover, using Open Library fallback\n");
+  }
+  return error;
+}
+
+MBRelease MediaManager::lookupReleaseOnline(const char *barcode) {
   MBRelease result;
   result.success = false;
+  result.year = 0;
 
   if (WiFi.status() != WL_CONNECTED) {
     ErrorHandler::logWarn(ERR_CAT_NETWORK, "WiFi not connected",
@@ -100,118 +749,257 @@ MBRelease MediaManager::fetchReleaseByBarcode(const char *barcode) {
     return result;
   }
 
-  HTTPClient http;
-  WiFiClientSecure client;
-  client.setInsecure();
-  client.setHandshakeTimeout(10000);
-
+  // Only the best match is used
   String url =
       "https://musicbrainz.org/ws/2/release/?query=barcode:" + String(barcode) +
-      "&fmt=json";
+      "&limit=1&fmt=json";
 
   Serial.printf("MediaManager: MusicBrainz Searching barcode %s\n", barcode);
 
-  http.begin(client, url);
-  http.addHeader("User-Agent", "DigitalLibrarian/1.0");
+  PooledHttp req(url);
+  HTTPClient &http = req.http();
   http.setTimeout(10000);
 
-  int httpCode = http.GET();
+  int httpCode = RequestScheduler::get(API_MUSICBRAINZ, http);
 
   if (httpCode == 200) {
-    String payload = http.getString();
+    HttpBodyStream body(http, 10000);
+    DeserializationError error = parseReleaseSearch(body, result);
+    endBody(req, body);
     http.end();
-    client.stop();
 
-    int releasesIdx = payload.indexOf("\"releases\":[");
-    if (releasesIdx < 0) {
-      Serial.println("MediaManager: No releases found in MusicBrainz, trying "
-                     "Discogs fallback...");
-      return fetchReleaseFromDiscogs(barcode);
+    if (error) {
+      Serial.println("MediaManager: MusicBrainz parse failed, trying Discogs "
+                     "fallback...");
+      MBRelease fallback = fetchReleaseFromDiscogs(barcode);
+      fallback.notFound = false;
+      return fallback;
     }
 
-    int releaseStart = payload.indexOf("{", releasesIdx);
-    if (releaseStart < 0) {
-      Serial.println(
-          "MediaManager: Invalid release format, trying Discogs fallback...");
-      return fetchReleaseFromDiscogs(barcode);
-    }
-
-    result.releaseMbid = extractJSONString(payload, "id", releaseStart);
-    result.title = extractJSONString(payload, "title", releaseStart);
-    decodeHTMLEntities(result.title);
-
-    // Artist
-    int artistIdx = payload.indexOf("\"artist-credit\"", releaseStart);
-    if (artistIdx > 0) {
-      result.artist = extractJSONString(payload, "name", artistIdx);
-      decodeHTMLEntities(result.artist);
-      result.artist = toTitleCase(result.artist); // Capitalize first letters
-    }
-
-    result.title = toTitleCase(result.title); // Capitalize Album Title
-
-    // Year
-    int dateIdx = payload.indexOf("\"date\":\"", releaseStart);
-    if (dateIdx > 0) {
-      result.year = payload.substring(dateIdx + 8, dateIdx + 12).toInt();
-    }
-
-    result.success = (result.releaseMbid.length() > 0);
-
     if (!result.success) {
-      Serial.println("MediaManager: MusicBrainz returned incomplete data, "
-                     "trying Discogs fallback...");
+      Serial.println("MediaManager: No usable release in MusicBrainz, trying "
+                     "Discogs fallback...");
       return fetchReleaseFromDiscogs(barcode);
     }
 
-    // Supplement with Discogs data for missing year/genre
-    // MusicBrainz often lacks genre info, so we proactively fetch from Discogs
-    bool needsDiscogs = (result.year == 0);
-
-    if (needsDiscogs) {
-      Serial.println(
-          "MediaManager: MusicBrainz missing year, fetching from Discogs...");
-      MBRelease discogsData = fetchReleaseFromDiscogs(barcode);
-      if (discogsData.success) {
-        if (discogsData.year > 0) {
-          result.year = discogsData.year;
-          Serial.printf("MediaManager: Supplemented year from Discogs: %d\n",
-                        result.year);
-        }
-        if (discogsData.genre.length() > 0) {
-          result.genre = discogsData.genre;
-          Serial.printf("MediaManager: Got genre from Discogs: %s\n",
-                        result.genre.c_str());
-        }
-      }
-    } else {
-      // Even if year is present, try to get genre from Discogs
-      // since MusicBrainz barcode search doesn't include genre
-      Serial.println("MediaManager: Fetching genre from Discogs to supplement "
-                     "MusicBrainz...");
-      MBRelease discogsData = fetchReleaseFromDiscogs(barcode);
-      if (discogsData.success && discogsData.genre.length() > 0) {
-        result.genre = discogsData.genre;
-        Serial.printf("MediaManager: Got genre from Discogs: %s\n",
-                      result.genre.c_str());
-      }
-    }
+    // MusicBrainz barcode search doesn't include genre (and often lacks the
+    // year), so supplement from Discogs
+    supplementFromDiscogs(barcode, result);
   } else {
     http.end();
-    client.stop();
     ErrorHandler::logError(
         ERR_CAT_NETWORK, String("MusicBrainz HTTP Error: ") + String(httpCode),
         "fetchReleaseByBarcode");
     Serial.printf(
         "MediaManager: MusicBrainz HTTP Error %d, trying Discogs fallback...\n",
         httpCode);
-    return fetchReleaseFromDiscogs(barcode);
+    MBRelease fallback = fetchReleaseFromDiscogs(barcode);
+    fallback.notFound = false; // MusicBrainz never answered
+    return fallback;
   }
   return result;
 }
 
+void MediaManager::supplementFromDiscogs(const char *barcode,
+                                        MBRelease &release) {
+  Serial.println("MediaManager: Fetching year/genre from Discogs to "
+                 "supplement MusicBrainz...");
+  MBRelease discogsData = fetchReleaseFromDiscogs(barcode);
+  if (!discogsData.success)
+    return;
+
+  if (release.year == 0 && discogsData.year > 0) {
+    release.year = discogsData.year;
+    Serial.printf("MediaManager: Supplemented year from Discogs: %d\n",
+                  release.year);
+  }
+  if (discogsData.genre.length() > 0) {
+    release.genre = discogsData.genre;
+    Serial.printf("MediaManager: Got genre from Discogs: %s\n",
+                  release.genre.c_str());
+  }
+}
+
+int MediaManager::fetchReleasesByBarcodes(const std::vector<String> &barcodes,
+                                          std::map<String, MBRelease> &out) {
+  if (barcodes.empty())
+    return 0;
+
+  // Cached barcodes (found or not) stay out of the search
+  int found = 0;
+  std::vector<String> pending;
+  for (size_t i = 0; i < barcodes.size() && i < MB_BARCODE_BATCH; i++) {
+    const String &code = barcodes[i];
+    if (!isBarcode(code) || out.count(code) ||
+        std::find(pending.begin(), pending.end(), code) != pending.end())
+      continue;
+    MBRelease cached;
+    if (!cachedRelease("mb:" + code, cached)) {
+      pending.push_back(code);
+    } else if (cached.success) {
+      out[code] = cached;
+      found++;
+    }
+  }
+  if (pending.empty() || WiFi.status() != WL_CONNECTED)
+    return found;
+
+  found += searchBarcodes(pending, out);
+  Serial.printf("MediaManager: Batch search matched %d/%d barcodes\n", found,
+                (int)barcodes.size());
+  return found;
+}
+
+int MediaManager::searchBarcodes(const std::vector<String> &barcodes,
+                                 std::map<String, MBRelease> &out) {
+  String query = "";
+  for (const String &code : barcodes) {
+    if (query.length() > 0)
+      query += " OR ";
+    query += "barcode:" + code;
+  }
+
+  String url = "https://musicbrainz.org/ws/2/release/?query=" +
+               urlEncode(query) + "&limit=100&fmt=json";
+
+  Serial.printf("MediaManager: MusicBrainz batch search (%d barcodes)\n",
+                (int)barcodes.size());
+
+  PooledHttp req(url);
+  HTTPClient &http = req.http();
+  http.setTimeout(20000);
+
+  int httpCode = RequestScheduler::get(API_MUSICBRAINZ, http);
+  if (httpCode != 200) {
+    http.end();
+    ErrorHandler::logError(ERR_CAT_NETWORK,
+                           String("MusicBrainz batch HTTP Error: ") +
+                               String(httpCode),
+                           "fetchReleasesByBarcodes");
+    return 0;
+  }
+
+  // Keep only what we use; full search results are ~3KB per release
+  StaticJsonDocument<256> filter;
+  JsonObject f = filter["releases"].createNestedObject();
+  f["id"] = true;
+  f["title"] = true;
+  f["barcode"] = true;
+  f["date"] = true;
+  f["artist-credit"][0]["name"] = true;
+
+  BasicJsonDocument<SpiRamAllocator> doc(MB_BATCH_DOC_SIZE);
+  DeserializationError error = readJsonBody(req, doc, filter, 20000);
+  http.end();
+  if (error == DeserializationError::NoMemory && barcodes.size() > 1) {
+    // Too many matching releases for one page: search each half instead of
+    // dropping them all. Single barcodes left over get their own lookup.
+    doc.clear();
+    size_t half = barcodes.size() / 2;
+    std::vector<String> first(barcodes.begin(), barcodes.begin() + half);
+    std::vector<String> second(barcodes.begin() + half, barcodes.end());
+    return searchBarcodes(first, out) + searchBarcodes(second, out);
+  }
+  if (error) {
+    Serial.printf("MediaManager: Batch JSON Parse Error: %s\n", error.c_str());
+    return 0;
+  }
+
+  // Results are ordered by score: the first release per barcode wins
+  int found = 0;
+  for (JsonObject rel : doc["releases"].as<JsonArray>()) {
+    String code = rel["barcode"] | "";
+    if (code.length() == 0 || out.count(code))
+      continue;
+    if (std::find(barcodes.begin(), barcodes.end(), code) == barcodes.end())
+      continue;
+
+    MBRelease r;
+    r.releaseMbid = rel["id"] | "";
+    r.title = rel["title"] | "";
+    r.artist = rel["artist-credit"][0]["name"] | "";
+    String date = rel["date"] | "";
+    r.year = (date.length() >= 4) ? date.substring(0, 4).toInt() : 0;
+    decodeHTMLEntities(r.title);
+    decodeHTMLEntities(r.artist);
+    r.title = toTitleCase(r.title);
+    r.artist = toTitleCase(r.artist);
+    r.success = r.releaseMbid.length() > 0;
+    if (!r.success)
+      continue;
+
+    out[code] = r;
+    found++;
+  }
+  return found;
+}
+
+bool MediaManager::isBarcode(const String &code) {
+  if (code.length() < 8 || code.length() > 14)
+    return false;
+  for (size_t i = 0; i < code.length(); i++) {
+    if (!isDigit(code[i]))
+      return false;
+  }
+  return true;
+}
+
+void MediaManager::expectReleases(const std::vector<String> &barcodes) {
+  if (!_stashMutex)
+    return;
+  uint32_t giveUp = millis() + MB_BATCH_WAIT_MS;
+  xSemaphoreTake(_stashMutex, portMAX_DELAY);
+  for (const String &code : barcodes) {
+    if (_awaited.size() >= MB_STASH_MAX && !_awaited.count(code))
+      _awaited.erase(_awaited.begin());
+    _awaited[code] = giveUp;
+  }
+  xSemaphoreGive(_stashMutex);
+}
+
+void MediaManager::stashReleases(const std::vector<String> &searched,
+                                 const std::map<String, MBRelease> &releases) {
+  if (!_stashMutex)
+    return;
+  xSemaphoreTake(_stashMutex, portMAX_DELAY);
+  for (auto &r : releases) {
+    // Unclaimed ones (mode changed, job cancelled) make room for new ones
+    if (_stash.size() >= MB_STASH_MAX && !_stash.count(r.first))
+      _stash.erase(_stash.begin());
+    _stash[r.first] = r.second;
+  }
+  for (const String &code : searched)
+    _awaited.erase(code);
+  xSemaphoreGive(_stashMutex);
+}
+
+bool MediaManager::takeStashedRelease(const char *barcode, MBRelease &out) {
+  if (!_stashMutex)
+    return false;
+  String code = barcode;
+  xSemaphoreTake(_stashMutex, portMAX_DELAY);
+  // The batch search for this barcode is queued or running
+  auto wait = _awaited.find(code);
+  while (wait != _awaited.end() && (int32_t)(millis() - wait->second) < 0) {
+    xSemaphoreGive(_stashMutex);
+    vTaskDelay(pdMS_TO_TICKS(100));
+    xSemaphoreTake(_stashMutex, portMAX_DELAY);
+    wait = _awaited.find(code);
+  }
+  if (wait != _awaited.end())
+    _awaited.erase(wait); // Gave up; the search never settled
+  auto it = _stash.find(code);
+  bool found = it != _stash.end();
+  if (found) {
+    out = it->second;
+    _stash.erase(it);
+  }
+  xSemaphoreGive(_stashMutex);
+  return found;
+}
+
 // Discogs API Fallback
-MBRelease MediaManager::fetchReleaseFromDiscogs(const char *barcode) {
+MBRelease MediaManager::lookupDiscogsOnline(const char *barcode) {
   MBRelease result;
   result.success = false;
 
@@ -222,11 +1010,6 @@ MBRelease MediaManager::fetchReleaseFromDiscogs(const char *barcode) {
     return result;
   }
 
-  HTTPClient http;
-  WiFiClientSecure client;
-  client.setInsecure();
-  client.setHandshakeTimeout(10000);
-
   // Discogs barcode search endpoint with API token
   String url =
       "https://api.discogs.com/database/search?barcode=" + String(barcode) +
@@ -234,77 +1017,26 @@ MBRelease MediaManager::fetchReleaseFromDiscogs(const char *barcode) {
 
   Serial.printf("MediaManager: Discogs Searching barcode %s\n", barcode);
 
-  http.begin(client, url);
-  http.addHeader("User-Agent", "DigitalLibrarian/1.0");
+  PooledHttp req(url);
+  HTTPClient &http = req.http();
   http.setTimeout(10000);
 
-  int httpCode = http.GET();
+  int httpCode = RequestScheduler::get(API_DISCOGS, http);
 
   if (httpCode == 200) {
-    String payload = http.getString();
+    HttpBodyStream body(http, 10000);
+    DeserializationError error = parseDiscogsSearch(body, result);
+    endBody(req, body);
     http.end();
-    client.stop();
-
-    // Use PSRAM for JSON to save Heap
-    BasicJsonDocument<SpiRamAllocator> doc(32768);
-    DeserializationError error = deserializeJson(doc, payload);
-
-    if (!error) {
-      JsonArray results = doc["results"];
-      if (results.size() > 0) {
-        JsonObject release = results[0];
-
-        // Extract title - Discogs returns combined "Artist - Title" format
-        String fullTitle = release["title"].as<String>();
-        result.year = release["year"] | 0;
-
-        // Discogs doesn't provide MusicBrainz IDs, use Discogs ID as
-        // placeholder
-        result.releaseMbid = "discogs_" + release["id"].as<String>();
-
-        // Parse artist and title from combined string
-        // Discogs search results typically return "Artist - Album Title"
-        int dashPos = fullTitle.indexOf(" - ");
-        if (dashPos > 0) {
-          result.artist = fullTitle.substring(0, dashPos);
-          result.title = fullTitle.substring(dashPos + 3);
-        } else {
-          // Fallback: use full title and check for artist field
-          result.title = fullTitle;
-          if (release.containsKey("artist")) {
-            result.artist = release["artist"].as<String>();
-          } else {
-            result.artist = "Various Artists";
-          }
-        }
-
-        // Extract genre/style information
-        // Discogs provides both "genre" (broad) and "style" (specific) arrays
-        if (release.containsKey("genre") && release["genre"].size() > 0) {
-          result.genre = release["genre"][0].as<String>();
-        } else if (release.containsKey("style") &&
-                   release["style"].size() > 0) {
-          result.genre = release["style"][0].as<String>();
-        }
 
-        // Clean up titles
-        decodeHTMLEntities(result.title);
-        decodeHTMLEntities(result.artist);
-        result.title = toTitleCase(result.title);
-        result.artist = toTitleCase(result.artist);
-        if (result.genre.length() > 0) {
-          result.genre = toTitleCase(result.genre);
-        }
-
-        result.success = true;
-        Serial.println("MediaManager: Successfully fetched from Discogs!");
-      } else {
-        ErrorHandler::logWarn(ERR_CAT_API, "No results from Discogs",
-                              "fetchReleaseFromDiscogs");
-      }
-    } else {
+    if (error) {
       Serial.printf("MediaManager: Discogs JSON Parse Error: %s\n",
                     error.c_str());
+    } else if (result.success) {
+      Serial.println("MediaManager: Successfully fetched from Discogs!");
+    } else {
+      ErrorHandler::logWarn(ERR_CAT_API, "No results from Discogs",
+                            "fetchReleaseFromDiscogs");
     }
   } else {
     http.end();
@@ -315,199 +1047,39 @@ MBRelease MediaManager::fetchReleaseFromDiscogs(const char *barcode) {
   return result;
 }
 
-std::vector<Track> MediaManager::fetchTracklist(const char *releaseMbid,
-                                                String *outGenre) {
+std::vector<Track>
+MediaManager::lookupTracklistOnline(const char *releaseMbid, String *outGenre) {
   std::vector<Track> tracks;
   if (WiFi.status() != WL_CONNECTED || !releaseMbid)
     return tracks;
 
-  delay(1000); // MusicBrainz rate limit
-
-  HTTPClient http;
-  WiFiClientSecure client;
-  client.setInsecure();
-  client.setHandshakeTimeout(10000);
-  client.setTimeout(30000); // 30s TCP timeout (Increase to fix IncompleteInput)
-
   // Fetch release with included recordings and genres
   String url = "https://musicbrainz.org/ws/2/release/" + String(releaseMbid) +
                "?inc=recordings+genres+tags+release-groups&fmt=json";
 
-  http.begin(client, url);
-  http.addHeader("User-Agent", "DigitalLibrarian/1.0");
+  PooledHttp req(url);
+  HTTPClient &http = req.http();
   http.setTimeout(30000); // Increased timeout for large JSON
 
-  int httpCode = http.GET();
-  int contentLen = http.getSize();
+  // Paced with the barcode search by the MusicBrainz bucket (1 req/s)
+  int httpCode = RequestScheduler::get(API_MUSICBRAINZ, http);
   Serial.printf("fetchTracklist: HTTP %d, Content-Length: %d bytes\n", httpCode,
-                contentLen);
-  Serial.printf("fetchTracklist: Heap Free: %d, PSRAM Free: %d\n",
-                ESP.getFreeHeap(), ESP.getFreePsram());
+                http.getSize());
 
   if (httpCode == 200) {
-    // Robust Download to PSRAM Buffer:
-    // 1. Allocate buffer in PSRAM
-    // 2. Read entire stream
-    // 3. Deserialize from buffer
-
-    // Safety check for size
-    if (contentLen <= 0) {
-      // Chunked transfer or unknown size - fallback to old method or just try
-      // reading For MusicBrainz, we usually get a Content-Length. If 0 or -1,
-      // we can't safely malloc. But usually MB returns size. Let's assume size
-      // is valid for now or default to a safe max for Stream (e.g. 128KB) if
-      // unknown.
-      if (contentLen < 0)
-        contentLen = 128 * 1024; // Cap at 128KB if unknown
+    HttpBodyStream body(http, 30000);
+    bool truncated = false;
+    DeserializationError error =
+        parseTracklist(body, tracks, outGenre, truncated);
+    endBody(req, body);
+
+    if (truncated) {
+      ErrorHandler::logWarn(ERR_CAT_PARSING,
+                            String("Tracklist truncated (MBID: ") +
+                                String(releaseMbid) + ")",
+                            "fetchTracklist");
     }
-
-    char *psBuffer = (char *)ps_malloc(contentLen + 1);
-    if (!psBuffer) {
-      Serial.println("fetchTracklist: PSRAM Allocation Failed!");
-      http.end();
-      client.stop();
-      return tracks;
-    }
-
-    // Read loop
-    WiFiClient *stream = http.getStreamPtr();
-    int totalRead = 0;
-    unsigned long startRead = millis();
-    while (http.connected() && (totalRead < contentLen || contentLen == -1)) {
-      size_t avail = stream->available();
-      if (avail) {
-        int toRead = avail;
-        if (contentLen > 0 && totalRead + toRead > contentLen) {
-          toRead = contentLen - totalRead;
-        }
-        int readBytes = stream->readBytes(psBuffer + totalRead, toRead);
-        totalRead += readBytes;
-      } else {
-        delay(10);
-        if (millis() - startRead > 30000) { // 30s Hard Timeout
-          Serial.println("fetchTracklist: Download Timeout!");
-          break;
-        }
-      }
-      if (contentLen > 0 && totalRead >= contentLen)
-        break;
-    }
-    psBuffer[totalRead] = 0; // Null Check
-
-    Serial.printf("fetchTracklist: Downloaded %d bytes to PSRAM\n", totalRead);
-
-    BasicJsonDocument<SpiRamAllocator> doc(98304);
-    DeserializationError error = deserializeJson(doc, psBuffer);
-
-    free(psBuffer); // Important!
-
-    Serial.printf("fetchTracklist: deserializeJson result: %s\n",
-                  error.c_str());
-
-    if (!error) {
-      // 1. Extract Genre
-      if (outGenre) {
-        *outGenre = "";
-        // Helper to find first valid genre using a simple blacklist
-        auto findValidGenre = [](JsonArray arr) -> String {
-          for (JsonObject obj : arr) {
-            String name = obj["name"].as<String>();
-            String lower = name;
-            lower.toLowerCase();
-            // Blacklist: skip non-genre tags
-            if (lower == "hidden track" || lower.indexOf("bonus") >= 0 ||
-                lower.indexOf("edition") >= 0 || lower == "remastered" ||
-                lower == "cc-by-nc-sa" || lower.indexOf("copy protest") >= 0) {
-              continue;
-            }
-            return name; // Found a good one
-          }
-          return "";
-        };
-
-        if (doc.containsKey("genres") && doc["genres"].size() > 0) {
-          *outGenre = findValidGenre(doc["genres"]);
-        }
-
-        if (outGenre->length() == 0 && doc.containsKey("tags") &&
-            doc["tags"].size() > 0) {
-          *outGenre = findValidGenre(doc["tags"]);
-        }
-
-        // Check Release Group as fallback
-        if (outGenre->length() == 0 && doc.containsKey("release-group")) {
-          JsonObject rg = doc["release-group"];
-          if (rg.containsKey("genres") && rg["genres"].size() > 0) {
-            *outGenre = findValidGenre(rg["genres"]);
-          }
-          if (outGenre->length() == 0 && rg.containsKey("tags") &&
-              rg["tags"].size() > 0) {
-            *outGenre = findValidGenre(rg["tags"]);
-          }
-        }
-
-        if (outGenre->length() == 0)
-          *outGenre = "Unknown";
-
-        *outGenre = toTitleCase(*outGenre); // Capitalize Genre
-      }
-
-      // 2. Extract Tracks
-      // Try "media" array first (Standard structure)
-      if (doc.containsKey("media")) {
-        JsonArray media = doc["media"];
-        for (JsonObject medium : media) {
-          int positionOffset =
-              tracks.size(); // Continues numbering for multi-disc
-          if (medium.containsKey("tracks")) {
-            JsonArray trkArray = medium["tracks"];
-            for (JsonObject t : trkArray) {
-              Track track;
-              track.trackNo =
-                  t["position"] | (tracks.size() + 1); // Or logical ordering
-              track.title = t["title"] | "Unknown Track";
-              // Length is usually in "recording" object or "length" field
-              if (t.containsKey("recording")) {
-                track.durationMs = t["recording"]["length"] | 0;
-                track.recordingMbid = t["recording"]["id"] | "";
-              } else {
-                track.durationMs = t["length"] | 0;
-                track.recordingMbid = t["id"] | "";
-              }
-
-              // Sanitize
-              // Sanitize
-              String tempTitle = track.title.c_str();
-              decodeHTMLEntities(tempTitle);
-              tempTitle = sanitizeText(tempTitle);
-              tempTitle = toTitleCase(tempTitle); // Capitalize Track Title
-              track.title = tempTitle.c_str();
-
-              track.lyrics.status = "unchecked";
-              tracks.push_back(track);
-            }
-          }
-        }
-      }
-      // Fallback: Check if "recordings" exists (unlikely for this endpoint but
-      // safe to check)
-      else if (doc.containsKey("recordings")) {
-        JsonArray recs = doc["recordings"];
-        for (JsonObject r : recs) {
-          Track track;
-          track.title = r["title"] | "Unknown";
-          track.durationMs = r["length"] | 0;
-          track.recordingMbid = r["id"] | "";
-          track.trackNo = tracks.size() + 1;
-          track.lyrics.status = "unchecked";
-          String tempTitle = track.title.c_str();
-          track.title = toTitleCase(tempTitle)
-                            .c_str(); // Capitalize Track Title (Fallback)
-          tracks.push_back(track);
-        }
-      }
-
-    } else {
+    if (error) {
       Serial.print("fetchTracklist: JSON Parse Error: ");
       Serial.println(error.c_str());
     }
@@ -520,76 +1092,37 @@ std::vector<Track> MediaManager::fetchTracklist(const char *releaseMbid,
     Serial.printf("fetchTracklist: HTTP Error %d\n", httpCode);
   }
   http.end();
-  client.stop();
-  delay(50); // Allow socket cleanup
   return tracks;
 }
 
-bool MediaManager::fetchBookByISBN(const char *isbn, Book &book) {
+bool MediaManager::lookupBookOnline(const char *isbn, Book &book,
+                                    bool &notFound) {
+  notFound = false;
   if (WiFi.status() != WL_CONNECTED)
     return false;
 
   Serial.printf("Fetching book metadata for ISBN: %s\n", isbn);
 
-  HTTPClient http;
-  WiFiClientSecure client;
-  client.setInsecure();
-  // client.setBufferSizes(1024, 512); // Optimize Buffers
-
-  String url =
-      "https://www.googleapis.com/books/v1/volumes?q=isbn:" + String(isbn);
-  http.begin(client, url);
+  // Only the first volume is used
+  String url = "https://www.googleapis.com/books/v1/volumes?q=isbn:" +
+               String(isbn) + "&maxResults=1";
+  PooledHttp req(url);
+  HTTPClient &http = req.http();
   http.setTimeout(10000);
 
-  int httpCode = http.GET();
+  int httpCode = RequestScheduler::get(API_GOOGLE_BOOKS, http);
   if (httpCode == 200) {
-    String payload = http.getString();
+    HttpBodyStream body(http, 10000);
+    DeserializationError error = parseBookVolume(body, isbn, book, notFound);
+    endBody(req, body);
     http.end();
-
-    // Use PSRAM for JSON to save Heap
-    BasicJsonDocument<SpiRamAllocator> doc(32768);
-    if (deserializeJson(doc, payload))
+    if (error)
       return false;
-
-    if (doc["totalItems"] == 0) {
+    if (notFound) {
       Serial.printf("No book found for ISBN: %s\n", isbn);
       return false;
     }
 
-    JsonObject info = doc["items"][0]["volumeInfo"];
-    book.title = (const char *)(info["title"] | "Unknown");
-    book.author = (info["authors"].size() > 0)
-                      ? info["authors"][0].as<String>().c_str()
-                      : "Unknown";
-    book.genre = (info["categories"].size() > 0)
-                     ? info["categories"][0].as<String>().c_str()
-                     : "Unknown";
-
-    // Apply Title Case
-    book.title = toTitleCase(book.title.c_str()).c_str();
-    book.author = toTitleCase(book.author.c_str()).c_str();
-    book.genre = toTitleCase(book.genre.c_str()).c_str();
-
-    String date = info["publishedDate"] | "";
-    if (date.length() >= 4)
-      book.year = date.substring(0, 4).toInt();
-
-    book.isbn = (const char *)isbn;
-    book.publisher = (const char *)(info["publisher"] | "");
-    book.pageCount = info["pageCount"] | 0;
-
-    // Extract cover URL from Google Books API (prefer their thumbnail)
-    if (info["imageLinks"]["thumbnail"]) {
-      book.coverUrl = info["imageLinks"]["thumbnail"].as<String>().c_str();
-      Serial.printf("Found cover URL: %s\n", book.coverUrl.c_str());
-    } else {
-      // Fallback to Open Library if Google doesn't have a cover
-      book.coverUrl =
-          ("https://covers.openlibrary.org/b/isbn/" + String(isbn) + "-M.jpg")
-              .c_str();
-      Serial.printf("No Google Books cover, using Open Library fallback\n");
-    }
-
     // Small delay to prevent heap fragmentation during bulk sync
     delay(500);
     return true;
@@ -604,8 +1137,10 @@ bool MediaManager::fetchBookByISBN(const char *isbn, Book &book) {
 
 // Metadata Fetching (Online)
 bool MediaManager::fetchMetadataForBarcode(const char *barcode,
-                                           ItemView &outView) {
-  if (!barcode || WiFi.status() != WL_CONNECTED) {
+                                           ItemView &outView,
+                                           const MBRelease *prefetched) {
+  // No WiFi check: cached lookups work offline, the online ones check it
+  if (!barcode) {
     return false;
   }
 
@@ -631,7 +1166,18 @@ bool MediaManager::fetchMetadataForBarcode(const char *barcode,
       itemID = String(millis()) + "_" + String(random(9999));
   }
 
-  MBRelease release = fetchReleaseByBarcode(barcode);
+  MBRelease stashed;
+  if (!prefetched && takeStashedRelease(barcode, stashed))
+    prefetched = &stashed;
+
+  MBRelease release;
+  if (prefetched && prefetched->success) {
+    release = *prefetched;
+    supplementFromDiscogs(barcode, release);
+    storeRelease(String("mb:") + barcode, release);
+  } else {
+    release = fetchReleaseByBarcode(barcode);
+  }
   if (!release.success)
     return false;
 
@@ -650,9 +1196,6 @@ bool MediaManager::fetchMetadataForBarcode(const char *barcode,
                   cd.genre.c_str());
   }
 
-  // MusicBrainz rate limit is 1 req/sec. Adding delay before tracklist fetch.
-  delay(1000);
-
   String gen = "";
   std::vector<Track> tracks;
   // Retry tracklist fetch up to 2 times
@@ -662,7 +1205,6 @@ bool MediaManager::fetchMetadataForBarcode(const char *barcode,
       break;
     Serial.printf("fetchMetadata: Track fetch empty, retrying (%d/2)...\n",
                   i + 1);
-    delay(1000);
   }
 
   Serial.printf("fetchMetadata: Before tracklist - cd.genre = '%s'\n",
@@ -795,7 +1337,7 @@ bool MediaManager::fetchMetadataForBarcode(const char *barcode,
 }
 
 bool MediaManager::fetchMetadataForISBN(const char *isbn, ItemView &outView) {
-  if (!isbn || WiFi.status() != WL_CONNECTED)
+  if (!isbn) // Cached lookups work offline
     return false;
 
   String preservedCover = outView.coverFile;
@@ -875,79 +1417,6 @@ bool MediaManager::fetchMetadataForISBN(const char *isbn, ItemView &outView) {
   return true;
 }
 
-// Fetch Album Cover URL from iTunes API
-String MediaManager::fetchAlbumCoverUrl(const char *artist, const char *album) {
-  String coverUrl = "";
-
-  // Try up to 2 times only (reduced from 3 for faster bulk checks)
-  for (int attempt = 1; attempt <= 2; attempt++) {
-    HTTPClient http;
-    WiFiClientSecure client;
-    client.setInsecure();
-    client.setHandshakeTimeout(2000); // Reduced to 2s
-    client.setTimeout(5000);          // Read timeout
-
-    String searchQuery = String(artist) + " " + String(album);
-    String encodedQuery = urlEncode(searchQuery);
-
-    String url = "https://itunes.apple.com/search?term=" + encodedQuery +
-                 "&entity=album&limit=1";
-
-    if (attempt == 1) {
-      Serial.printf("Fetching URL for: %s - %s\n", artist, album);
-    } else
-      Serial.printf("  Retry #%d...\n", attempt);
-
-    http.begin(client, url);
-
-    // Add headers to mimic a browser
-    http.setUserAgent("Mozilla/5.0 (Windows NT 10.0; Win64; x64) "
-                      "AppleWebKit/537.36 (KHTML, "
-                      "like Gecko) Chrome/112.0.0.0 Safari/537.36");
-    http.addHeader("Accept", "*/*");
-    http.addHeader("Connection", "close");
-
-    // Reduce timeout
-    http.setTimeout(2000);
-
-    int httpCode = http.GET();
-
-    if (httpCode == 200) {
-      String payload = http.getString();
-      int artworkIndex = payload.indexOf("\"artworkUrl100\":\"");
-      if (artworkIndex > 0) {
-        int startIndex = artworkIndex + 17;
-        int endIndex = payload.indexOf("\"", startIndex);
-        coverUrl = payload.substring(startIndex, endIndex);
-
-        // Request 240x240 image
-        coverUrl.replace("100x100", "240x240");
-        Serial.printf("  ✓ Found: %s\n", coverUrl.c_str());
-      }
-      http.end();
-      break; // Success!
-    } else if (httpCode == -1 || httpCode == -11) {
-      // Timeout or connection error - don't retry
-      Serial.printf("  ✗ Timeout/Connection Error: %d - Skipping\n", httpCode);
-      http.end();
-      break; // Skip this album, don't retry
-    } else {
-      ErrorHandler::logError(ERR_CAT_NETWORK,
-                             String("iTunes HTTP Error: ") + String(httpCode) +
-                                 " (Query: " + String(artist) + " - " +
-                                 String(album) + ")",
-                             "fetchAlbumCoverUrl");
-      Serial.printf("  ✗ HTTP Error: %d\n", httpCode);
-      http.end();
-    }
-    delay(100);
-  }
-
-  return coverUrl;
-}
-
-#include <algorithm>
-
 void MediaManager::sortByArtistOrAuthor() {
   switch (currentMode) {
   case MODE_CD:
@@ -977,6 +1446,8 @@ void MediaManager::sortByArtistOrAuthor() {
     break;
   }
 
+  LibraryRevision::recordReset(currentMode);
+
   // REBUILD CACHE after sorting to avoid indexing mismatches
   rebuildNavigationCache(getCurrentItemIndex());
   saveLibrary();
@@ -986,6 +1457,84 @@ void MediaManager::sortByArtistOrAuthor() {
 // LYRICS IMPLEMENTATION
 // ============================================================================
 
+// Lyrics race entrants. args: {artist, title, album}
+
+// Schema: https://api.lyrics.ovh/v1/artist/title
+static RaceResult lyricsFromOvh(const std::vector<String> &args, String &out) {
+  String url = "https://api.lyrics.ovh/v1/" + urlEncode(args[0]) + "/" +
+               urlEncode(args[1]);
+
+  Serial.printf("Query URL: %s\n", url.c_str());
+
+  PooledHttp req(url);
+  HTTPClient &http = req.http();
+  int code = RequestScheduler::get(API_LYRICS_OVH, http);
+
+  RaceResult result = RACE_FAILED;
+  if (code == 200) {
+    String payload = http.getString();
+    DynamicJsonDocument doc(8192); // Slightly larger buffer for full lyrics
+    DeserializationError err = deserializeJson(doc, payload);
+
+    if (!err) {
+      out = doc["lyrics"].as<String>();
+      result = (out.length() > 0 && out != "null") ? RACE_FOUND
+                                                   : RACE_NOT_FOUND;
+    }
+  } else if (code == 404) {
+    result = RACE_NOT_FOUND;
+  } else {
+    ErrorHandler::logError(ERR_CAT_NETWORK,
+                           String("Lyrics.ovh HTTP Error: ") + String(code) +
+                               " (Track: " + args[1] + ")",
+                           "fetchLyricsIfNeeded");
+    Serial.printf("  -> Lyrics.ovh HTTP Error %d\n", code);
+  }
+  http.end();
+  return result;
+}
+
+static RaceResult lyricsFromLrclib(const std::vector<String> &args,
+                                   String &out) {
+  String url = "https://lrclib.net/api/get?artist_name=" + urlEncode(args[0]) +
+               "&track_name=" + urlEncode(args[1]) +
+               "&album_name=" + urlEncode(args[2]);
+
+  Serial.printf("Query URL (LRCLib): %s\n", url.c_str());
+
+  PooledHttp req(url);
+  HTTPClient &http = req.http();
+  http.setTimeout(10000);
+
+  int code = RequestScheduler::get(API_LRCLIB, http);
+  RaceResult result = RACE_FAILED;
+  if (code == 200) {
+    String payload = http.getString();
+    DynamicJsonDocument doc(4096);
+    DeserializationError err = deserializeJson(doc, payload);
+
+    if (!err) {
+      out = doc["plainLyrics"].as<String>();
+
+      if (out.length() == 0 || out == "null")
+        out = doc["syncedLyrics"].as<String>();
+
+      result = (out.length() > 0 && out != "null") ? RACE_FOUND
+                                                   : RACE_NOT_FOUND;
+    }
+  } else if (code == 404) {
+    result = RACE_NOT_FOUND;
+  } else {
+    ErrorHandler::logError(ERR_CAT_NETWORK,
+                           String("LRCLib HTTP Error: ") + String(code) +
+                               " (Track: " + args[1] + ")",
+                           "fetchLyricsIfNeeded");
+    Serial.printf("  -> LRCLib HTTP Error %d\n", code);
+  }
+  http.end();
+  return result;
+}
+
 // Improved fetchLyricsIfNeeded with better timeouts
 LyricsResult fetchLyricsIfNeeded(const char *releaseMbid, int trackIndex,
                                  bool force) {
@@ -1024,96 +1573,19 @@ LyricsResult fetchLyricsIfNeeded(const char *releaseMbid, int trackIndex,
     }
   }
 
-  // 2. Fetch from API
-  // 2. Fetch from API
+  // 2. Fetch from API: Lyrics.ovh, with LRCLib hedged in if it is slow
+  static const RaceEntrant providers[] = {
+      {"Lyrics.ovh", lyricsFromOvh, 0},
+      {"LRCLib", lyricsFromLrclib, LYRICS_HEDGE_MS},
+  };
   String finalLyrics = "";
-  bool found = false;
-
-  // --- STRATEGY 1: LYRICS.OVH ---
-  {
-    Serial.println("Using Strategy 1: Lyrics.ovh...");
-    HTTPClient http;
-    WiFiClientSecure client;
-    client.setInsecure();
-    client.setTimeout(10000);
-
-    // Schema: https://api.lyrics.ovh/v1/artist/title
-    String url = "https://api.lyrics.ovh/v1/" +
-                 urlEncode(tl->cdArtist.c_str()) + "/" +
-                 urlEncode(track.title.c_str());
-
-    Serial.printf("Query URL: %s\n", url.c_str());
-
-    http.begin(client, url);
-    http.addHeader("User-Agent", "DigitalLibrarian/1.0");
-    int code = http.GET();
-
-    if (code == 200) {
-      String payload = http.getString();
-      DynamicJsonDocument doc(8192); // Slightly larger buffer for full lyrics
-      DeserializationError err = deserializeJson(doc, payload);
-
-      if (!err) {
-        finalLyrics = doc["lyrics"].as<String>();
-        if (finalLyrics.length() > 0)
-          found = true;
-      }
-    } else {
-      ErrorHandler::logError(ERR_CAT_NETWORK,
-                             String("Lyrics.ovh HTTP Error: ") + String(code) +
-                                 " (Track: " + String(track.title.c_str()) +
-                                 ")",
-                             "fetchLyricsIfNeeded");
-      Serial.printf("  -> Lyrics.ovh HTTP Error %d\n", code);
-    }
-    http.end();
-  }
-
-  // --- STRATEGY 2: LRCLIB (Fallback) ---
-  if (!found) {
-    Serial.println("  -> Lyrics.ovh failed, trying LRCLib...");
-    HTTPClient http;
-    WiFiClientSecure client;
-    client.setInsecure();
-    client.setHandshakeTimeout(10000);
-    client.setTimeout(10000);
-
-    String url = "https://lrclib.net/api/get?artist_name=" +
-                 urlEncode(tl->cdArtist.c_str()) +
-                 "&track_name=" + urlEncode(track.title.c_str()) +
-                 "&album_name=" + urlEncode(tl->cdTitle.c_str());
-
-    Serial.printf("Query URL (Fallback): %s\n", url.c_str());
-
-    http.begin(client, url);
-    http.addHeader("User-Agent", "DigitalLibrarian/1.0");
-    http.setTimeout(10000);
-
-    int code = http.GET();
-    if (code == 200) {
-      String payload = http.getString();
-      DynamicJsonDocument doc(4096);
-      DeserializationError err = deserializeJson(doc, payload);
-
-      if (!err) {
-        finalLyrics = doc["plainLyrics"].as<String>();
-
-        if (finalLyrics.length() == 0 || finalLyrics == "null")
-          finalLyrics = doc["syncedLyrics"].as<String>();
-
-        if (finalLyrics.length() > 0 && finalLyrics != "null")
-          found = true;
-      }
-    } else {
-      ErrorHandler::logError(ERR_CAT_NETWORK,
-                             String("LRCLib HTTP Error: ") + String(code) +
-                                 " (Track: " + String(track.title.c_str()) +
-                                 ")",
-                             "fetchLyricsIfNeeded");
-      Serial.printf("  -> LRCLib HTTP Error %d\n", code);
-    }
-    http.end();
-  }
+  int winner = ProviderRace::run(
+      RACE_LYRICS, providers, 2,
+      {tl->cdArtist.c_str(), track.title.c_str(), tl->cdTitle.c_str()},
+      finalLyrics, LYRICS_RACE_TIMEOUT_MS);
+  bool found = winner >= 0;
+  if (found)
+    Serial.printf("  -> Answered by %s\n", providers[winner].name);
 
   if (found) {
     String filename = "/lyrics/" + String(releaseMbid) + "/" +
@@ -1173,6 +1645,8 @@ void MediaManager::sortByLedIndex() {
     break;
   }
 
+  LibraryRevision::recordReset(currentMode);
+
   // REBUILD CACHE after sorting to avoid indexing mismatches
   rebuildNavigationCache(getCurrentItemIndex());
   saveLibrary();
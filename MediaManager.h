@@ -6,14 +6,40 @@
 #include <HTTPClient.h>
 #include <WiFi.h>
 #include <WiFiClientSecure.h>
+#include <map>
 #include <vector>
 
 #include "Core_Data.h"
 
-// Forward declaration of search pagination state
+// Barcodes per combined MusicBrainz search (barcode:A OR barcode:B ...).
+// Bounded by URL length and the 100-result page (a barcode can match several
+// releases).
+#define MB_BARCODE_BATCH 20
+// Batch search results waiting for their per-barcode lookup (stashReleases)
+#define MB_STASH_MAX (2 * MB_BARCODE_BATCH)
+// How long a batch lookup waits for its queued combined search before it
+// searches alone (expectReleases)
+#define MB_BATCH_WAIT_MS 60000
+// Filtered batch search results; ~250 bytes per release. A page that doesn't
+// fit is searched again in halves.
+#define MB_BATCH_DOC_SIZE 32768
+
+// Cap for the filtered release document in fetchTracklist (PSRAM). ~120 bytes
+// per track after filtering, so this covers ~400-track box sets; longer
+// releases are truncated rather than growing the allocation.
+#define TRACKLIST_JSON_DOC_SIZE 49152
+
+// Provider races (ProviderRace): the backup provider is only started if the
+// first hasn't answered after the hedge delay.
+#define LYRICS_HEDGE_MS 1500
+#define LYRICS_RACE_TIMEOUT_MS 25000
+#define COVER_HEDGE_MS 800
+#define COVER_RACE_TIMEOUT_MS 12000
+
+class HttpBodyStream;
+
+// Forward declaration of search state
 extern std::vector<int> search_matches;
-extern int search_display_offset;
-extern const int SEARCH_PAGE_SIZE;
 
 // Exposed helper
 LyricsResult fetchLyricsIfNeeded(const char *releaseMbid, int trackIndex,
@@ -30,7 +56,10 @@ public:
   static void filter(const char *query, int filterMode, bool ledMasterOn);
 
   // Metadata Fetching (Online)
-  static bool fetchMetadataForBarcode(const char *barcode, ItemView &outView);
+  // `prefetched` (from fetchReleasesByBarcodes) skips the barcode search;
+  // without it a stashed release for the barcode is used if there is one.
+  static bool fetchMetadataForBarcode(const char *barcode, ItemView &outView,
+                                      const MBRelease *prefetched = nullptr);
   static bool fetchMetadataForISBN(const char *isbn, ItemView &outView);
 
   // Sorting
@@ -44,13 +73,59 @@ public:
   // Internal API Helpers (Made Public for Abstraction Layer)
   static MBRelease fetchReleaseByBarcode(const char *barcode);
   static MBRelease fetchReleaseFromDiscogs(const char *barcode); // Fallback API
+  // One MusicBrainz search for up to MB_BARCODE_BATCH barcodes. Adds the
+  // best-scored release of each barcode found to `out`; returns how many.
+  // Duplicates and codes that aren't barcodes (isBarcode) are left out.
+  static int fetchReleasesByBarcodes(const std::vector<String> &barcodes,
+                                     std::map<String, MBRelease> &out);
+  // 8-14 digits (EAN-8 to GTIN-14)
+  static bool isBarcode(const String &code);
+  // /api/lookup_batch queues a JOB_LOOKUP_BATCH search, then one
+  // JOB_LOOKUP_ADD per barcode. expectReleases() marks the barcodes so their
+  // lookups wait (up to MB_BATCH_WAIT_MS) in takeStashedRelease;
+  // stashReleases() keeps the results, each used once, and ends the wait for
+  // every barcode in `searched`.
+  static void expectReleases(const std::vector<String> &barcodes);
+  static void stashReleases(const std::vector<String> &searched,
+                            const std::map<String, MBRelease> &releases);
+  static bool takeStashedRelease(const char *barcode, MBRelease &out);
+  static void supplementFromDiscogs(const char *barcode, MBRelease &release);
   static std::vector<Track> fetchTracklist(const char *releaseMbid,
                                            String *outGenre = NULL);
   static bool fetchBookByISBN(const char *isbn, Book &book);
   static String fetchAlbumCoverUrl(const char *artist, const char *album);
 
+  // Response parsers: the body of each lookup through its filter, as the
+  // online lookups use them. Public for the replay tests (StorageTests).
+  static DeserializationError parseReleaseSearch(HttpBodyStream &body,
+                                                 MBRelease &out);
+  static DeserializationError parseDiscogsSearch(HttpBodyStream &body,
+                                                 MBRelease &out);
+  // `truncated`: the document cap was hit, `tracks` has what fit
+  static DeserializationError parseTracklist(HttpBodyStream &body,
+                                             std::vector<Track> &tracks,
+                                             String *outGenre,
+                                             bool &truncated);
+  static DeserializationError parseBookVolume(HttpBodyStream &body,
+                                              const char *isbn, Book &book,
+                                              bool &notFound);
+
 private:
+  // Network halves of the lookups above; the public versions go through
+  // MetadataCache first and store what these return.
+  static MBRelease lookupReleaseOnline(const char *barcode);
+  static MBRelease lookupDiscogsOnline(const char *barcode);
+  static std::vector<Track> lookupTracklistOnline(const char *releaseMbid,
+                                                  String *outGenre);
+  static bool lookupBookOnline(const char *isbn, Book &book, bool &notFound);
+  // The combined search for validated, uncached barcodes
+  static int searchBarcodes(const std::vector<String> &barcodes,
+                            std::map<String, MBRelease> &out);
+
   static bool _taskBusy;
+  static std::map<String, MBRelease> _stash;
+  static std::map<String, uint32_t> _awaited; // Barcode -> give-up millis()
+  static SemaphoreHandle_t _stashMutex;
 };
 
 #endif // MEDIA_MANAGER_H
@@ -0,0 +1,390 @@
+#include <Arduino.h>
+#include <ESP_IOExpander_Library.h>
+#include <SD.h>
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <time.h>
+
+#include "AppGlobals.h"
+#include "LockProfiler.h"
+#include "MetadataCache.h"
+#include "waveshare_sd_card.h"
+
+// Static members
+MetaCacheMap MetadataCache::_entries;
+SemaphoreHandle_t MetadataCache::_mutex = NULL;
+uint32_t MetadataCache::_logLines = 0;
+uint32_t MetadataCache::_hits = 0;
+uint32_t MetadataCache::_misses = 0;
+
+// Anything earlier means SNTP hasn't set the clock yet
+#define META_CLOCK_VALID_AFTER 1700000000UL
+
+static bool lockCache(SemaphoreHandle_t m) {
+  return m && xSemaphoreTakeRecursive(m, pdMS_TO_TICKS(2000)) == pdPASS;
+}
+
+static bool lockSD(uint32_t timeoutMs) {
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(timeoutMs)) != pdPASS)
+    return false;
+  if (sdExpander)
+    sdExpander->digitalWrite(SD_CS, LOW);
+  return true;
+}
+
+static void unlockSD() {
+  if (sdExpander)
+    sdExpander->digitalWrite(SD_CS, HIGH);
+  if (i2cMutex)
+    LOCK_GIVE(i2cMutex);
+}
+
+// FNV-1a, names the side files
+static uint32_t keyHash(const String &key) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < key.length(); i++) {
+    h ^= (uint8_t)key[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+uint32_t MetadataCache::now() {
+  time_t t = time(nullptr);
+  return (t > (time_t)META_CLOCK_VALID_AFTER) ? (uint32_t)t : 0;
+}
+
+bool MetadataCache::begin() {
+  if (_mutex == NULL)
+    _mutex = xSemaphoreCreateRecursiveMutex();
+
+  _entries.clear();
+  _logLines = 0;
+
+  if (!lockSD(2000)) {
+    Serial.println("!!! I2C LOCK FAIL: MetadataCache::begin");
+    return false;
+  }
+
+  if (!SD.exists(META_CACHE_DIR))
+    SD.mkdir(META_CACHE_DIR);
+
+  File file = SD.open(META_CACHE_LOG_PATH, FILE_READ);
+  if (file) {
+    DynamicJsonDocument doc(META_CACHE_INLINE_MAX + 512);
+    while (file.available()) {
+      String line = file.readStringUntil('\n');
+      line.trim();
+      if (line.length() == 0)
+        continue;
+      _logLines++;
+
+      doc.clear();
+      if (deserializeJson(doc, line))
+        continue;
+
+      String key = doc["k"] | "";
+      if (key.length() == 0)
+        continue;
+      if ((doc["d"] | 0) != 0) {
+        _entries.erase(key.c_str());
+        continue;
+      }
+
+      MetaCacheEntry e;
+      e.writtenAt = doc["t"] | 0;
+      e.ttl = doc["l"] | 0;
+      e.negative = (doc["n"] | 0) != 0;
+      e.file = (const char *)(doc["f"] | "");
+      if (!e.negative && e.file.empty()) {
+        String v;
+        serializeJson(doc["v"], v);
+        e.value = v.c_str();
+      }
+      _entries[key.c_str()] = e;
+    }
+    file.close();
+  }
+  unlockSD();
+
+  Serial.printf("MetadataCache: %d records (%lu log lines)\n",
+                (int)_entries.size(), (unsigned long)_logLines);
+
+  if (_logLines > 2 * _entries.size() + 64)
+    compact();
+  return true;
+}
+
+// Caller holds _mutex
+bool MetadataCache::isFresh(MetaCacheEntry &e, const String &key) {
+  uint32_t t = now();
+  if (t == 0)
+    return true; // Clock unknown: can't age anything
+  if (e.writtenAt == 0) {
+    e.writtenAt = t; // Written before the clock was set
+    appendLog(key, e);
+    return true;
+  }
+  if (t - e.writtenAt <= e.ttl)
+    return true;
+  // Stale, but better than nothing while offline
+  return WiFi.status() != WL_CONNECTED;
+}
+
+MetaCacheResult MetadataCache::get(const String &key, JsonDocument &out) {
+  if (!lockCache(_mutex))
+    return META_MISS;
+
+  MetaCacheResult result = META_MISS;
+  auto it = _entries.find(key.c_str());
+  if (it != _entries.end() && isFresh(it->second, key)) {
+    MetaCacheEntry &e = it->second;
+    if (e.negative)
+      result = META_NOT_FOUND;
+    else if (!e.file.empty())
+      result = readSideFile(e.file.c_str(), key, out) ? META_HIT : META_MISS;
+    else
+      result = deserializeJson(out, e.value.c_str()) ? META_MISS : META_HIT;
+  }
+
+  if (result == META_MISS)
+    _misses++;
+  else
+    _hits++;
+  xSemaphoreGiveRecursive(_mutex);
+  return result;
+}
+
+void MetadataCache::put(const String &key, JsonVariantConst value,
+                        uint32_t ttl) {
+  if (!lockCache(_mutex))
+    return;
+
+  String json;
+  serializeJson(value, json);
+
+  MetaCacheEntry e;
+  e.writtenAt = now();
+  e.ttl = ttl;
+
+  auto old = _entries.find(key.c_str());
+  String oldFile = (old != _entries.end()) ? old->second.file.c_str() : "";
+
+  if (json.length() > META_CACHE_INLINE_MAX) {
+    String name = fileForKey(key);
+    if (!writeSideFile(name, key, json)) {
+      xSemaphoreGiveRecursive(_mutex);
+      return;
+    }
+    e.file = name.c_str();
+  } else {
+    e.value = json.c_str();
+  }
+  if (oldFile.length() > 0 && oldFile != String(e.file.c_str()))
+    removeSideFile(oldFile);
+
+  _entries[key.c_str()] = e;
+  appendLog(key, e);
+  xSemaphoreGiveRecursive(_mutex);
+}
+
+void MetadataCache::putNotFound(const String &key, uint32_t ttl) {
+  if (!lockCache(_mutex))
+    return;
+
+  auto old = _entries.find(key.c_str());
+  if (old != _entries.end() && !old->second.file.empty())
+    removeSideFile(old->second.file.c_str());
+
+  MetaCacheEntry e;
+  e.writtenAt = now();
+  e.ttl = ttl;
+  e.negative = true;
+  _entries[key.c_str()] = e;
+  appendLog(key, e);
+  xSemaphoreGiveRecursive(_mutex);
+}
+
+void MetadataCache::remove(const String &key) {
+  if (!lockCache(_mutex))
+    return;
+  auto it = _entries.find(key.c_str());
+  if (it != _entries.end()) {
+    if (!it->second.file.empty())
+      removeSideFile(it->second.file.c_str());
+    _entries.erase(it);
+
+    if (lockSD(1000)) {
+      File file = SD.open(META_CACHE_LOG_PATH, FILE_APPEND);
+      if (file) {
+        StaticJsonDocument<256> doc;
+        doc["k"] = key;
+        doc["d"] = 1;
+        serializeJson(doc, file);
+        file.println();
+        file.close();
+        _logLines++;
+      }
+      unlockSD();
+    }
+  }
+  xSemaphoreGiveRecursive(_mutex);
+}
+
+void MetadataCache::clear() {
+  if (!lockCache(_mutex))
+    return;
+  for (const auto &kv : _entries) {
+    if (!kv.second.file.empty())
+      removeSideFile(kv.second.file.c_str());
+  }
+  _entries.clear();
+  _logLines = 0;
+  if (lockSD(2000)) {
+    if (SD.exists(META_CACHE_LOG_PATH))
+      SD.remove(META_CACHE_LOG_PATH);
+    unlockSD();
+  }
+  xSemaphoreGiveRecursive(_mutex);
+  Serial.println("MetadataCache: cleared");
+}
+
+// One log line per record. Caller holds _mutex.
+static void writeRecord(File &file, const String &key,
+                        const MetaCacheEntry &e) {
+  DynamicJsonDocument doc(META_CACHE_INLINE_MAX + 512);
+  doc["k"] = key;
+  doc["t"] = e.writtenAt;
+  doc["l"] = e.ttl;
+  if (e.negative)
+    doc["n"] = 1;
+  else if (!e.file.empty())
+    doc["f"] = e.file.c_str();
+  else
+    doc["v"] = serialized(e.value.c_str());
+  serializeJson(doc, file);
+  file.println();
+}
+
+void MetadataCache::appendLog(const String &key, const MetaCacheEntry &e) {
+  if (!lockSD(2000))
+    return;
+  File file = SD.open(META_CACHE_LOG_PATH, FILE_APPEND);
+  if (file) {
+    writeRecord(file, key, e);
+    file.close();
+    _logLines++;
+  }
+  unlockSD();
+}
+
+bool MetadataCache::compact() {
+  if (!lockCache(_mutex))
+    return false;
+  if (!lockSD(5000)) {
+    xSemaphoreGiveRecursive(_mutex);
+    return false;
+  }
+
+  String tmpPath = String(META_CACHE_LOG_PATH) + ".tmp";
+  if (SD.exists(tmpPath))
+    SD.remove(tmpPath);
+
+  bool ok = false;
+  File file = SD.open(tmpPath, FILE_WRITE);
+  if (file) {
+    for (const auto &kv : _entries)
+      writeRecord(file, kv.first.c_str(), kv.second);
+    file.close();
+
+    // Atomic Swap
+    if (SD.exists(META_CACHE_LOG_PATH))
+      SD.remove(META_CACHE_LOG_PATH);
+    ok = SD.rename(tmpPath, META_CACHE_LOG_PATH);
+    if (!ok)
+      Serial.println("MetadataCache: Log Atomic Rename FAILED!");
+  }
+  unlockSD();
+
+  if (ok) {
+    Serial.printf("MetadataCache: compacted %lu -> %d lines\n",
+                  (unsigned long)_logLines, (int)_entries.size());
+    _logLines = _entries.size();
+  }
+  xSemaphoreGiveRecursive(_mutex);
+  return ok;
+}
+
+String MetadataCache::fileForKey(const String &key) {
+  char name[16];
+  snprintf(name, sizeof(name), "%08lx.json", (unsigned long)keyHash(key));
+  return String(name);
+}
+
+bool MetadataCache::writeSideFile(const String &name, const String &key,
+                                  const String &json) {
+  if (!lockSD(5000))
+    return false;
+
+  String path = String(META_CACHE_DIR) + "/" + name;
+  String tmpPath = path + ".tmp";
+  bool ok = false;
+  File file = SD.open(tmpPath, FILE_WRITE);
+  if (file) {
+    // The key guards against hash collisions on read
+    file.print("{\"k\":");
+    StaticJsonDocument<256> k;
+    k.set(key);
+    serializeJson(k, file);
+    file.print(",\"v\":");
+    size_t written = file.print(json);
+    file.print("}");
+    file.close();
+    if (written == json.length()) {
+      if (SD.exists(path))
+        SD.remove(path);
+      ok = SD.rename(tmpPath, path);
+    } else {
+      SD.remove(tmpPath);
+    }
+  }
+  unlockSD();
+  return ok;
+}
+
+bool MetadataCache::readSideFile(const String &name, const String &key,
+                                 JsonDocument &out) {
+  if (!lockSD(2000))
+    return false;
+
+  bool ok = false;
+  BasicJsonDocument<SpiRamAllocator> wrapper(out.capacity() + 256);
+  File file = SD.open(String(META_CACHE_DIR) + "/" + name, FILE_READ);
+  if (file) {
+    DeserializationError err = deserializeJson(wrapper, file);
+    file.close();
+    ok = !err && wrapper["k"] == key;
+  }
+  unlockSD();
+
+  // Unwrap {"k":..,"v":..} into the caller's document
+  if (ok)
+    ok = out.set(wrapper["v"]);
+  return ok;
+}
+
+void MetadataCache::removeSideFile(const String &name) {
+  if (!lockSD(1000))
+    return;
+  String path = String(META_CACHE_DIR) + "/" + name;
+  if (SD.exists(path))
+    SD.remove(path);
+  unlockSD();
+}
+
+int MetadataCache::getEntryCount() { return (int)_entries.size(); }
+
+uint32_t MetadataCache::getHits() { return _hits; }
+
+uint32_t MetadataCache::getMisses() { return _misses; }
@@ -0,0 +1,95 @@
+#ifndef METADATA_CACHE_H
+#define METADATA_CACHE_H
+
+#include "Core_Data.h"
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <map>
+
+// Persistent cache of metadata API results, consulted by MediaManager before
+// any network call.
+//
+// Keys are "<kind>:<id>" (e.g. "mb:0724384260927", "isbn:9780141036144",
+// "tl:<release mbid>"). Values are the compact JSON a lookup produced, or a
+// negative record for "the provider has nothing for this id". Each record
+// carries its write time and TTL; expired records are still served while
+// offline.
+//
+// The index lives in PSRAM and is persisted as an append-only log
+// (/db/meta_cache.jsonl, later lines win), compacted at boot once it holds
+// more superseded than live lines. Values over META_CACHE_INLINE_MAX bytes
+// (tracklists) are kept in /db/meta/<hash>.json and read on demand.
+//
+// TTLs need wall-clock time (SNTP). Until the clock is set, records are
+// treated as fresh and written with time 0; they are stamped on first use
+// once the clock is known.
+
+#define META_CACHE_LOG_PATH "/db/meta_cache.jsonl"
+#define META_CACHE_DIR "/db/meta"
+#define META_CACHE_INLINE_MAX 512
+
+#define META_TTL_RELEASE (90UL * 24 * 3600)    // Barcode -> release
+#define META_TTL_TRACKLIST (180UL * 24 * 3600) // MBID -> tracks
+#define META_TTL_BOOK (90UL * 24 * 3600)       // ISBN -> book
+#define META_TTL_COVER_URL (30UL * 24 * 3600)  // Artist/album -> cover URL
+#define META_TTL_NEGATIVE (3UL * 24 * 3600)    // "Not found" of any kind
+
+enum MetaCacheResult {
+  META_MISS = 0,
+  META_HIT,
+  META_NOT_FOUND // Negative record: provider had nothing
+};
+
+struct MetaCacheEntry {
+  PsramString value; // Inline JSON ("" if stored in a file or negative)
+  PsramString file;  // Side file under META_CACHE_DIR, or ""
+  uint32_t writtenAt = 0; // Unix time, 0 if the clock wasn't set
+  uint32_t ttl = 0;
+  bool negative = false;
+};
+
+typedef std::map<PsramString, MetaCacheEntry, std::less<PsramString>,
+                 PsramAllocator<std::pair<const PsramString, MetaCacheEntry>>>
+    MetaCacheMap;
+
+class MetadataCache {
+public:
+  // Loads (and if needed compacts) the log. Call after Storage.begin().
+  static bool begin();
+
+  // Fills `out` on META_HIT.
+  static MetaCacheResult get(const String &key, JsonDocument &out);
+  static void put(const String &key, JsonVariantConst value, uint32_t ttl);
+  static void putNotFound(const String &key, uint32_t ttl = META_TTL_NEGATIVE);
+  static void remove(const String &key);
+
+  // Drops every record and file.
+  static void clear();
+
+  // Unix time, or 0 while the clock is not set.
+  static uint32_t now();
+
+  // Stats
+  static int getEntryCount();
+  static uint32_t getHits();
+  static uint32_t getMisses();
+
+private:
+  static bool isFresh(MetaCacheEntry &e, const String &key);
+  static void appendLog(const String &key, const MetaCacheEntry &e);
+  static bool compact();
+  static String fileForKey(const String &key);
+  static bool writeSideFile(const String &name, const String &key,
+                            const String &json);
+  static bool readSideFile(const String &name, const String &key,
+                           JsonDocument &out);
+  static void removeSideFile(const String &name);
+
+  static MetaCacheMap _entries;
+  static SemaphoreHandle_t _mutex;
+  static uint32_t _logLines;
+  static uint32_t _hits;
+  static uint32_t _misses;
+};
+
+#endif // METADATA_CACHE_H
@@ -0,0 +1,195 @@
+#include "Metrics.h"
+
+// Upper bounds in microseconds, and as exported (seconds)
+static const uint32_t BUCKET_US[METRIC_BUCKETS] = {
+    1000,   2500,   5000,    10000,   25000,   50000,   100000,
+    250000, 500000, 1000000, 2500000, 5000000, 10000000};
+static const char *BUCKET_LE[METRIC_BUCKETS] = {
+    "0.001", "0.0025", "0.005", "0.01", "0.025", "0.05", "0.1",
+    "0.25",  "0.5",    "1",     "2.5",  "5",     "10"};
+
+static const char *OP_NAMES[METRIC_OP_COUNT] = {
+    "load_index", "rewrite_index", "load_cd_detail", "show_cover", "filter"};
+
+// ApiProvider order, then MetricOutbound
+static const char *OUTBOUND_NAMES[METRIC_OUT_COUNT] = {
+    "musicbrainz", "discogs", "google_books", "itunes",  "lyrics_ovh",
+    "lrclib",      "deezer",  "download",     "wled"};
+static_assert(METRIC_OUT_COUNT == API_PROVIDER_COUNT + 2,
+              "OUTBOUND_NAMES out of step with ApiProvider");
+
+static const char *LOCK_NAMES[METRIC_LOCK_COUNT] = {"library", "i2c", "lvgl",
+                                                    "http", "jpeg"};
+
+// Static members
+LatencyHistogram Metrics::_ops[METRIC_OP_COUNT] = {};
+LatencyHistogram Metrics::_outbound[METRIC_OUT_COUNT] = {};
+uint32_t Metrics::_outboundFailures[METRIC_OUT_COUNT] = {};
+LatencyHistogram Metrics::_lockWaits[METRIC_LOCK_COUNT] = {};
+uint32_t Metrics::_lockTimeouts[METRIC_LOCK_COUNT] = {};
+portMUX_TYPE Metrics::_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void LatencyHistogram::add(uint32_t us) {
+  for (int i = 0; i < METRIC_BUCKETS; i++) {
+    if (us <= BUCKET_US[i]) {
+      buckets[i]++;
+      break;
+    }
+  }
+  count++;
+  sumUs += us;
+}
+
+void Metrics::record(MetricOp op, uint32_t us) {
+  if (op < 0 || op >= METRIC_OP_COUNT)
+    return;
+  portENTER_CRITICAL(&_lock);
+  _ops[op].add(us);
+  portEXIT_CRITICAL(&_lock);
+}
+
+void Metrics::recordOutbound(int target, uint32_t us, int httpCode) {
+  if (target < 0 || target >= METRIC_OUT_COUNT)
+    return;
+  portENTER_CRITICAL(&_lock);
+  _outbound[target].add(us);
+  if (httpCode <= 0 || httpCode >= 400)
+    _outboundFailures[target]++;
+  portEXIT_CRITICAL(&_lock);
+}
+
+void Metrics::recordLockWait(MetricLock lock, uint32_t us, bool acquired) {
+  if (lock < 0 || lock >= METRIC_LOCK_COUNT)
+    return;
+  portENTER_CRITICAL(&_lock);
+  _lockWaits[lock].add(us);
+  if (!acquired)
+    _lockTimeouts[lock]++;
+  portEXIT_CRITICAL(&_lock);
+}
+
+const char *Metrics::outboundName(int target) {
+  if (target < 0 || target >= METRIC_OUT_COUNT)
+    return "unknown";
+  return OUTBOUND_NAMES[target];
+}
+
+const char *Metrics::lockName(MetricLock lock) {
+  if (lock < 0 || lock >= METRIC_LOCK_COUNT)
+    return "unknown";
+  return LOCK_NAMES[lock];
+}
+
+// ==========================================
+// Exposition
+// ==========================================
+
+void Metrics::writeFamily(ChunkWriter &out, const char *name,
+                          const char *type, const char *help) {
+  out.raw("# HELP ").raw(name).raw(' ').raw(help).raw('\n');
+  out.raw("# TYPE ").raw(name).raw(' ').raw(type).raw('\n');
+}
+
+void Metrics::writeSample(ChunkWriter &out, const char *name,
+                          const char *labels, unsigned long value) {
+  char digits[12];
+  ultoa(value, digits, 10);
+  out.raw(name);
+  if (labels[0])
+    out.raw('{').raw(labels).raw('}');
+  out.raw(' ').raw(digits).raw('\n');
+}
+
+void Metrics::writeSeconds(ChunkWriter &out, uint64_t us) {
+  char text[24];
+  snprintf(text, sizeof(text), "%lu.%06lu", (unsigned long)(us / 1000000),
+           (unsigned long)(us % 1000000));
+  out.raw(text);
+}
+
+void Metrics::writeHistogram(ChunkWriter &out, const char *name,
+                             const char *labels, const LatencyHistogram &h) {
+  char digits[12];
+  uint32_t cumulative = 0;
+  for (int i = 0; i <= METRIC_BUCKETS; i++) {
+    cumulative = i < METRIC_BUCKETS ? cumulative + h.buckets[i] : h.count;
+    out.raw(name).raw("_bucket{");
+    if (labels[0])
+      out.raw(labels).raw(',');
+    out.raw("le=\"").raw(i < METRIC_BUCKETS ? BUCKET_LE[i] : "+Inf");
+    ultoa(cumulative, digits, 10);
+    out.raw("\"} ").raw(digits).raw('\n');
+  }
+
+  out.raw(name).raw("_sum");
+  if (labels[0])
+    out.raw('{').raw(labels).raw('}');
+  out.raw(' ');
+  writeSeconds(out, h.sumUs);
+  out.raw('\n');
+
+  out.raw(name).raw("_count");
+  if (labels[0])
+    out.raw('{').raw(labels).raw('}');
+  ultoa(h.count, digits, 10);
+  out.raw(' ').raw(digits).raw('\n');
+}
+
+void Metrics::writePrometheus(ChunkWriter &out) {
+  // One histogram copied at a time: the writer may block on the socket, so
+  // nothing is written inside the critical section
+  LatencyHistogram h;
+  uint32_t n;
+  char labels[48];
+
+  writeFamily(out, "librarian_op_duration_seconds", "histogram",
+              "Storage, cover and search operations");
+  for (int i = 0; i < METRIC_OP_COUNT; i++) {
+    portENTER_CRITICAL(&_lock);
+    h = _ops[i];
+    portEXIT_CRITICAL(&_lock);
+    snprintf(labels, sizeof(labels), "op=\"%s\"", OP_NAMES[i]);
+    writeHistogram(out, "librarian_op_duration_seconds", labels, h);
+  }
+
+  writeFamily(out, "librarian_outbound_request_duration_seconds",
+              "histogram", "Outbound HTTP requests, send to response headers");
+  for (int i = 0; i < METRIC_OUT_COUNT; i++) {
+    portENTER_CRITICAL(&_lock);
+    h = _outbound[i];
+    portEXIT_CRITICAL(&_lock);
+    snprintf(labels, sizeof(labels), "api=\"%s\"", OUTBOUND_NAMES[i]);
+    writeHistogram(out, "librarian_outbound_request_duration_seconds",
+                   labels, h);
+  }
+
+  writeFamily(out, "librarian_outbound_failures_total", "counter",
+              "Outbound HTTP requests that failed or returned >= 400");
+  for (int i = 0; i < METRIC_OUT_COUNT; i++) {
+    portENTER_CRITICAL(&_lock);
+    n = _outboundFailures[i];
+    portEXIT_CRITICAL(&_lock);
+    snprintf(labels, sizeof(labels), "api=\"%s\"", OUTBOUND_NAMES[i]);
+    writeSample(out, "librarian_outbound_failures_total", labels, n);
+  }
+
+  writeFamily(out, "librarian_lock_wait_seconds", "histogram",
+              "Time spent waiting to take a lock");
+  for (int i = 0; i < METRIC_LOCK_COUNT; i++) {
+    portENTER_CRITICAL(&_lock);
+    h = _lockWaits[i];
+    portEXIT_CRITICAL(&_lock);
+    snprintf(labels, sizeof(labels), "lock=\"%s\"", LOCK_NAMES[i]);
+    writeHistogram(out, "librarian_lock_wait_seconds", labels, h);
+  }
+
+  writeFamily(out, "librarian_lock_timeouts_total", "counter",
+              "Lock takes that gave up");
+  for (int i = 0; i < METRIC_LOCK_COUNT; i++) {
+    portENTER_CRITICAL(&_lock);
+    n = _lockTimeouts[i];
+    portEXIT_CRITICAL(&_lock);
+    snprintf(labels, sizeof(labels), "lock=\"%s\"", LOCK_NAMES[i]);
+    writeSample(out, "librarian_lock_timeouts_total", labels, n);
+  }
+}
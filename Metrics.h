@@ -0,0 +1,113 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "ChunkWriter.h"
+#include "RequestScheduler.h" // API_PROVIDER_COUNT
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+
+// Latency histograms and counters, served by /api/metrics in Prometheus
+// text format.
+//
+// Recording is a short bucket search and a few increments under a spinlock,
+// cheap enough for hot paths. Every histogram has the same fixed buckets
+// (1 ms .. 10 s); values are kept in microseconds and exported in seconds.
+// Nothing resets: a scraper takes rates from the running totals, and two
+// firmware builds compare by running the same workload against each.
+//
+//   bool LibrarianStorage::loadIndex(MediaMode mode) {
+//     METRIC_SCOPE(METRIC_OP_LOAD_INDEX);
+//     ...
+
+#define METRIC_BUCKETS 13 // Finite bounds; +Inf is the total count
+
+// Histogram data. add() isn't synchronized: the owner holds its own lock
+// around it (Metrics' spinlock, or ConcurrentWebServer's for routes).
+struct LatencyHistogram {
+  uint32_t buckets[METRIC_BUCKETS]; // Per bucket, not cumulative
+  uint32_t count;
+  uint64_t sumUs;
+
+  void add(uint32_t us);
+};
+
+// Timed operations, label op="..."
+enum MetricOp {
+  METRIC_OP_LOAD_INDEX = 0,
+  METRIC_OP_REWRITE_INDEX,
+  METRIC_OP_LOAD_CD_DETAIL,
+  METRIC_OP_SHOW_COVER,
+  METRIC_OP_FILTER,
+  METRIC_OP_COUNT
+};
+
+// Outbound HTTP, label api="...": one per ApiProvider, then these
+enum MetricOutbound {
+  METRIC_OUT_DOWNLOAD = API_PROVIDER_COUNT, // getFollowingRedirects()
+  METRIC_OUT_WLED,
+  METRIC_OUT_COUNT
+};
+
+// Lock waits, label lock="..."
+enum MetricLock {
+  METRIC_LOCK_LIBRARY = 0,
+  METRIC_LOCK_I2C,
+  METRIC_LOCK_LVGL,
+  METRIC_LOCK_HTTP, // Turn of a serialized web handler
+  METRIC_LOCK_JPEG, // TJpgDec (covers, thumbnails, cover ingest)
+  METRIC_LOCK_COUNT
+};
+
+class Metrics {
+public:
+  static void record(MetricOp op, uint32_t us);
+  // httpCode as returned by HTTPClient; <= 0 and >= 400 count as failures
+  static void recordOutbound(int target, uint32_t us, int httpCode);
+  static void recordLockWait(MetricLock lock, uint32_t us, bool acquired);
+
+  // Label value for an ApiProvider or MetricOutbound
+  static const char *outboundName(int target);
+  static const char *lockName(MetricLock lock);
+
+  // Every family kept here
+  static void writePrometheus(ChunkWriter &out);
+
+  // Exposition pieces, also for families kept elsewhere. labels is the
+  // inside of the braces ("route=\"/x\"") or "" for none.
+  static void writeFamily(ChunkWriter &out, const char *name,
+                          const char *type, const char *help);
+  static void writeSample(ChunkWriter &out, const char *name,
+                          const char *labels, unsigned long value);
+  static void writeHistogram(ChunkWriter &out, const char *name,
+                             const char *labels, const LatencyHistogram &h);
+
+private:
+  static void writeSeconds(ChunkWriter &out, uint64_t us);
+
+  static LatencyHistogram _ops[METRIC_OP_COUNT];
+  static LatencyHistogram _outbound[METRIC_OUT_COUNT];
+  static uint32_t _outboundFailures[METRIC_OUT_COUNT];
+  static LatencyHistogram _lockWaits[METRIC_LOCK_COUNT];
+  static uint32_t _lockTimeouts[METRIC_LOCK_COUNT];
+  static portMUX_TYPE _lock;
+};
+
+// Records the time to the end of the enclosing scope
+class MetricScope {
+public:
+  explicit MetricScope(MetricOp op) : _op(op), _start(esp_timer_get_time()) {}
+  ~MetricScope() {
+    Metrics::record(_op, (uint32_t)(esp_timer_get_time() - _start));
+  }
+  MetricScope(const MetricScope &) = delete;
+  MetricScope &operator=(const MetricScope &) = delete;
+
+private:
+  MetricOp _op;
+  int64_t _start;
+};
+
+#define METRIC_SCOPE(op) MetricScope _metricScope(op)
+
+#endif // METRICS_H
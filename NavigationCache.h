@@ -2,6 +2,7 @@
 #define NAVIGATION_CACHE_H
 
 #include "Core_Data.h"
+#include "LockProfiler.h"
 #include "Storage.h"
 #include "mode_abstraction.h" // Needed for ensureItemDetailsLoaded and getItemCount
 #include <Arduino.h>
@@ -89,7 +90,7 @@ inline bool loadItemIntoCache(int libraryIndex, int cacheIndex) {
 // Rebuild cache centered on current index
 inline void rebuildNavigationCache(int centerIndex) {
   if (libraryMutex)
-    xSemaphoreTakeRecursive(libraryMutex, portMAX_DELAY);
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
 
   Serial.printf("Rebuilding navigation cache centered on index %d\n",
                 centerIndex);
@@ -98,7 +99,7 @@ inline void rebuildNavigationCache(int centerIndex) {
   if (totalItems == 0) {
     initNavigationCache();
     if (libraryMutex)
-      xSemaphoreGiveRecursive(libraryMutex);
+      LOCK_GIVE(libraryMutex);
     return;
   }
 
@@ -125,7 +126,7 @@ inline void rebuildNavigationCache(int centerIndex) {
   }
 
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
 }
 
 // Get item from cache if available, otherwise load from SD
@@ -174,14 +175,14 @@ inline void shiftCacheWindow(bool forward) {
     return; // No cache operations during filtering
 
   if (libraryMutex)
-    xSemaphoreTakeRecursive(libraryMutex, portMAX_DELAY);
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
 
   int currentIndex = getCurrentItemIndex();
   int totalItems = getItemCount();
 
   if (totalItems == 0) {
     if (libraryMutex)
-      xSemaphoreGiveRecursive(libraryMutex);
+      LOCK_GIVE(libraryMutex);
     return;
   }
 
@@ -196,7 +197,7 @@ inline void shiftCacheWindow(bool forward) {
       currentIndex < (cacheStartIndex + navCache.cacheSize)) {
     if (abs(distanceFromCenter) < (navCache.cacheCenter - 1)) {
       if (libraryMutex)
-        xSemaphoreGiveRecursive(libraryMutex);
+        LOCK_GIVE(libraryMutex);
       return;
     }
   }
@@ -204,7 +205,7 @@ inline void shiftCacheWindow(bool forward) {
   // Outside or near edge - Rebuild or Shift
   if (abs(distanceFromCenter) > navCache.cacheCenter) {
     if (libraryMutex)
-      xSemaphoreGiveRecursive(libraryMutex);
+      LOCK_GIVE(libraryMutex);
     rebuildNavigationCache(currentIndex);
     return;
   } else {
@@ -247,7 +248,7 @@ inline void shiftCacheWindow(bool forward) {
   }
 
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
 }
 
 #endif // NAVIGATION_CACHE_H
@@ -2,7 +2,11 @@
 
 #include "NetworkManager.h"
 #include "AppGlobals.h"
+#include "CoverStore.h"
 #include "ErrorHandler.h"
+#include "HttpPool.h"
+#include "LockProfiler.h"
+#include "Metrics.h"
 #include <esp_heap_caps.h>
 
 void AppNetworkManager::init() {
@@ -169,21 +173,9 @@ String AppNetworkManager::fetchURL(String url, int timeout) {
   if (WiFi.status() != WL_CONNECTED)
     return "";
 
-  HTTPClient http;
-  WiFiClientSecure clientSecure;
-  WiFiClient clientInsecure;
-
-  if (url.startsWith("https://")) {
-    clientSecure.setInsecure();
-    http.begin(clientSecure, url);
-  } else {
-    http.begin(clientInsecure, url);
-  }
-
-  http.setFollowRedirects(HTTPC_FORCE_FOLLOW_REDIRECTS);
-  http.setTimeout(timeout);
-
-  int httpCode = http.GET();
+  PooledHttp req(url);
+  int httpCode = req.getFollowingRedirects(timeout);
+  HTTPClient &http = req.http();
   String payload = "";
 
   if (httpCode == HTTP_CODE_OK) {
@@ -195,45 +187,36 @@ String AppNetworkManager::fetchURL(String url, int timeout) {
   return payload;
 }
 
-bool AppNetworkManager::downloadCoverImage(const String &url,
-                                           const String &savePath) {
+uint8_t *AppNetworkManager::downloadToBuffer(const String &url,
+                                             size_t &outLen) {
+  outLen = 0;
   if (WiFi.status() != WL_CONNECTED)
-    return false;
+    return nullptr;
   if (url.isEmpty())
-    return false;
-
-  HTTPClient http;
-  WiFiClientSecure clientSecure;
-  WiFiClient clientInsecure;
-
-  if (url.startsWith("https://")) {
-    clientSecure.setInsecure();
-    http.begin(clientSecure, url);
-  } else {
-    http.begin(clientInsecure, url);
-  }
-
-  http.setFollowRedirects(HTTPC_FORCE_FOLLOW_REDIRECTS);
-  http.setTimeout(15000);
+    return nullptr;
 
-  int httpCode = http.GET();
+  PooledHttp req(url);
+  int httpCode = req.getFollowingRedirects(15000);
+  HTTPClient &http = req.http();
   if (httpCode != HTTP_CODE_OK) {
     http.end();
-    return false;
+    return nullptr;
   }
 
   int len = http.getSize();
   if (len <= 0) {
+    req.close();
     http.end();
-    return false;
+    return nullptr;
   }
 
-  // 1. Download to PSRAM first (No I2C buffering needed)
+  // Download to PSRAM first (No I2C buffering needed)
   uint8_t *downloadBuffer =
       (uint8_t *)heap_caps_malloc(len, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
   if (!downloadBuffer) {
+    req.close();
     http.end();
-    return false;
+    return nullptr;
   }
 
   WiFiClient *stream = http.getStreamPtr();
@@ -247,36 +230,64 @@ bool AppNetworkManager::downloadCoverImage(const String &url,
     }
     delay(1);
   }
+  if (totalRead < len)
+    req.close();
   http.end();
 
   if (totalRead < len) {
     heap_caps_free(downloadBuffer);
-    return false;
+    return nullptr;
   }
 
-  // 2. Write to SD with exclusive lock (Rapid block write)
+  outLen = totalRead;
+  return downloadBuffer;
+}
+
+bool AppNetworkManager::downloadCoverImage(const String &url,
+                                           const String &savePath) {
+  size_t len = 0;
+  uint8_t *downloadBuffer = downloadToBuffer(url, len);
+  if (!downloadBuffer)
+    return false;
+
+  // Write to SD with exclusive lock (Rapid block write)
   bool success = false;
-  if (i2cMutex &&
-      xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(5000)) == pdPASS) {
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(5000)) == pdPASS) {
     if (sdExpander)
       sdExpander->digitalWrite(SD_CS, LOW);
 
     File file = SD.open(savePath.c_str(), FILE_WRITE);
     if (file) {
-      size_t written = file.write(downloadBuffer, totalRead);
+      size_t written = file.write(downloadBuffer, len);
       file.close();
-      success = (written == (size_t)totalRead);
+      success = (written == len);
     }
 
     if (sdExpander)
       sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   heap_caps_free(downloadBuffer);
   return success;
 }
 
+String AppNetworkManager::downloadCover(const String &url) {
+  // A URL we've already ingested needs no network round trip
+  String known = CoverStore::retainByUrl(url);
+  if (known.length() > 0)
+    return known;
+
+  size_t len = 0;
+  uint8_t *downloadBuffer = downloadToBuffer(url, len);
+  if (!downloadBuffer)
+    return "";
+
+  String fileName = CoverStore::ingest(downloadBuffer, len, url);
+  heap_caps_free(downloadBuffer);
+  return fileName;
+}
+
 void AppNetworkManager::forceUpdateWLED() {
   if (!led_use_wled)
     return;
@@ -310,7 +321,10 @@ void AppNetworkManager::forceUpdateWLED() {
   }
   json += "]}}";
 
+  int64_t start = esp_timer_get_time();
   int httpCode = http.POST(json);
+  Metrics::recordOutbound(METRIC_OUT_WLED,
+                          (uint32_t)(esp_timer_get_time() - start), httpCode);
   if (httpCode <= 0) {
     Serial.printf("WLED Error: %s\n", http.errorToString(httpCode).c_str());
   }
@@ -23,6 +23,12 @@ public:
   // Shared HTTP helper
   static String fetchURL(String url, int timeout = 5000);
   static bool downloadCoverImage(const String &url, const String &savePath);
+  // Downloads into the content-addressed cover store. Returns the cover file
+  // name (relative to /covers/) or "" on failure. The caller releases the
+  // reference that comes with it (see CoverStore::ingest()).
+  static String downloadCover(const String &url);
+  // Caller frees the returned PSRAM buffer with heap_caps_free()
+  static uint8_t *downloadToBuffer(const String &url, size_t &outLen);
   static void forceUpdateWLED();
 };
 
@@ -0,0 +1,191 @@
+#include "ProviderRace.h"
+#include "ErrorHandler.h"
+#include <freertos/event_groups.h>
+
+// Static members
+RaceStats ProviderRace::_stats[RACE_KIND_COUNT] = {{"lyrics"}, {"coverUrl"}};
+uint16_t ProviderRace::_samples[RACE_KIND_COUNT][SCHED_LATENCY_SAMPLES];
+uint8_t ProviderRace::_sampleCount[RACE_KIND_COUNT] = {0};
+uint8_t ProviderRace::_sampleNext[RACE_KIND_COUNT] = {0};
+portMUX_TYPE ProviderRace::_lock = portMUX_INITIALIZER_UNLOCKED;
+
+#define RACE_SETTLED BIT0 // Winner known or caller gave up: skip hedges
+#define RACE_DONE BIT1    // Caller can stop waiting
+
+// Shared by the caller and every entrant task; freed by the last one out.
+struct RaceState {
+  RaceKind kind;
+  RaceEntrant entrants[RACE_MAX_ENTRANTS];
+  int count;
+  std::vector<String> args;
+  EventGroupHandle_t events;
+  SemaphoreHandle_t mutex;
+  int winner = -1;
+  String answer;
+  int finished = 0;
+  int notFound = 0;
+  int refs = 0;
+};
+
+struct RaceTaskArg {
+  RaceState *st;
+  int index;
+};
+
+// Drops one reference. Caller holds st->mutex; it is released here.
+static void race_release(RaceState *st) {
+  bool last = (--st->refs == 0);
+  xSemaphoreGive(st->mutex);
+  if (last) {
+    vEventGroupDelete(st->events);
+    vSemaphoreDelete(st->mutex);
+    delete st;
+  }
+}
+
+static void race_task(void *param) {
+  RaceTaskArg *arg = (RaceTaskArg *)param;
+  RaceState *st = arg->st;
+  int index = arg->index;
+  delete arg;
+
+  const RaceEntrant &e = st->entrants[index];
+  bool run = true;
+  if (e.startAfterMs > 0) {
+    // Hedge: only start if nobody has answered in time
+    EventBits_t bits = xEventGroupWaitBits(st->events, RACE_SETTLED, pdFALSE,
+                                           pdFALSE,
+                                           pdMS_TO_TICKS(e.startAfterMs));
+    run = !(bits & RACE_SETTLED);
+    if (run)
+      ProviderRace::countHedge(st->kind);
+  }
+
+  String out;
+  RaceResult result = run ? e.fn(st->args, out) : RACE_FAILED;
+
+  xSemaphoreTake(st->mutex, portMAX_DELAY);
+  st->finished++;
+  if (result == RACE_NOT_FOUND)
+    st->notFound++;
+  if (result == RACE_FOUND && st->winner < 0) {
+    st->winner = index;
+    st->answer = out;
+    xEventGroupSetBits(st->events, RACE_SETTLED | RACE_DONE);
+  } else if (st->finished == st->count) {
+    xEventGroupSetBits(st->events, RACE_DONE);
+  }
+  race_release(st);
+  vTaskDelete(NULL);
+}
+
+int ProviderRace::run(RaceKind kind, const RaceEntrant *entrants, int count,
+                      const std::vector<String> &args, String &out,
+                      uint32_t timeoutMs, bool *allNotFound) {
+  if (allNotFound)
+    *allNotFound = false;
+  if (count <= 0)
+    return -1;
+  if (count > RACE_MAX_ENTRANTS)
+    count = RACE_MAX_ENTRANTS;
+
+  portENTER_CRITICAL(&_lock);
+  for (int i = 0; i < count; i++)
+    _stats[kind].entrants[i] = entrants[i].name;
+  portEXIT_CRITICAL(&_lock);
+
+  uint32_t start = millis();
+
+  // Each concurrent TLS session costs ~40KB of internal RAM
+  if (ErrorHandler::isMemoryLow()) {
+    int notFound = 0;
+    for (int i = 0; i < count; i++) {
+      RaceResult result = entrants[i].fn(args, out);
+      if (result == RACE_FOUND) {
+        record(kind, i, millis() - start);
+        return i;
+      }
+      if (result == RACE_NOT_FOUND)
+        notFound++;
+    }
+    if (allNotFound)
+      *allNotFound = (notFound == count);
+    out = "";
+    record(kind, -1, millis() - start);
+    return -1;
+  }
+
+  RaceState *st = new RaceState();
+  st->kind = kind;
+  st->count = count;
+  st->args = args;
+  for (int i = 0; i < count; i++)
+    st->entrants[i] = entrants[i];
+  st->events = xEventGroupCreate();
+  st->mutex = xSemaphoreCreateMutex();
+  st->refs = count + 1;
+
+  for (int i = 0; i < count; i++) {
+    RaceTaskArg *arg = new RaceTaskArg{st, i};
+    // Named after the provider: its trace track and the task list say who
+    if (xTaskCreatePinnedToCore(race_task, entrants[i].name, RACE_TASK_STACK,
+                                arg, 1, NULL, 1) != pdPASS) {
+      delete arg;
+      xSemaphoreTake(st->mutex, portMAX_DELAY);
+      st->finished++;
+      if (st->finished == st->count)
+        xEventGroupSetBits(st->events, RACE_DONE);
+      st->refs--; // Never started; can't be the last reference
+      xSemaphoreGive(st->mutex);
+    }
+  }
+
+  xEventGroupWaitBits(st->events, RACE_DONE, pdFALSE, pdFALSE,
+                      pdMS_TO_TICKS(timeoutMs));
+  xEventGroupSetBits(st->events, RACE_SETTLED); // Pending hedges stand down
+
+  xSemaphoreTake(st->mutex, portMAX_DELAY);
+  int winner = st->winner;
+  if (winner >= 0)
+    out = st->answer;
+  else if (allNotFound)
+    *allNotFound = (st->notFound == st->count);
+  race_release(st);
+
+  record(kind, winner, millis() - start);
+  return winner;
+}
+
+void ProviderRace::record(RaceKind kind, int winner, uint32_t ms) {
+  portENTER_CRITICAL(&_lock);
+  RaceStats &s = _stats[kind];
+  s.races++;
+  if (winner >= 0) {
+    s.wins[winner]++;
+    _samples[kind][_sampleNext[kind]] = ms > 0xFFFF ? 0xFFFF : ms;
+    _sampleNext[kind] = (_sampleNext[kind] + 1) % SCHED_LATENCY_SAMPLES;
+    if (_sampleCount[kind] < SCHED_LATENCY_SAMPLES)
+      _sampleCount[kind]++;
+  } else {
+    s.failures++;
+  }
+  portEXIT_CRITICAL(&_lock);
+}
+
+void ProviderRace::countHedge(RaceKind kind) {
+  portENTER_CRITICAL(&_lock);
+  _stats[kind].hedgesStarted++;
+  portEXIT_CRITICAL(&_lock);
+}
+
+RaceStats ProviderRace::getStats(RaceKind kind) {
+  uint16_t samples[SCHED_LATENCY_SAMPLES];
+  portENTER_CRITICAL(&_lock);
+  RaceStats s = _stats[kind];
+  int n = _sampleCount[kind];
+  memcpy(samples, _samples[kind], sizeof(samples));
+  portEXIT_CRITICAL(&_lock);
+
+  latency_percentiles(samples, n, s.p50Ms, s.p95Ms);
+  return s;
+}
@@ -0,0 +1,76 @@
+#ifndef PROVIDER_RACE_H
+#define PROVIDER_RACE_H
+
+#include "RequestScheduler.h"
+#include <Arduino.h>
+#include <vector>
+
+// Hedged lookups across interchangeable providers (lyrics, cover URLs).
+//
+// Each entrant runs in its own task, started `startAfterMs` after the race
+// begins (0 = immediately, >0 = hedge only if nobody has answered by then).
+// The first entrant to return RACE_FOUND wins and the caller gets its answer
+// at once. Entrants that haven't started are skipped. Ones already in flight
+// can't abort their HTTP request, so they finish in the background and their
+// answer is dropped. Every entrant still goes through RequestScheduler, so a
+// race never exceeds a provider's rate limit.
+//
+// Entrant functions get a copy of `args`, so losers may outlive the caller.
+// When memory is low the entrants run one after another in the caller's
+// task instead.
+
+#define RACE_MAX_ENTRANTS 4
+#define RACE_TASK_STACK 16384 // TLS handshake runs on this stack
+
+enum RaceResult {
+  RACE_FOUND = 0, // `out` holds the answer
+  RACE_NOT_FOUND, // Provider answered: nothing for this query
+  RACE_FAILED     // Error/timeout, says nothing about the query
+};
+
+typedef RaceResult (*race_fn_t)(const std::vector<String> &args, String &out);
+
+struct RaceEntrant {
+  const char *name;
+  race_fn_t fn;
+  uint32_t startAfterMs;
+};
+
+struct RaceStats {
+  const char *name;
+  uint32_t races;
+  const char *entrants[RACE_MAX_ENTRANTS]; // As of the last race
+  uint32_t wins[RACE_MAX_ENTRANTS];
+  uint32_t failures;                // Nobody answered
+  uint32_t hedgesStarted;           // Delayed entrants that did run
+  uint32_t p50Ms;                   // Time to the winning answer
+  uint32_t p95Ms;
+};
+
+enum RaceKind { RACE_LYRICS = 0, RACE_COVER_URL, RACE_KIND_COUNT };
+
+class ProviderRace {
+public:
+  // Returns the winning entrant's index (answer in `out`), or -1 if every
+  // entrant failed or `timeoutMs` passed. `allNotFound` is set when every
+  // entrant ran and answered RACE_NOT_FOUND (safe to cache as a miss).
+  static int run(RaceKind kind, const RaceEntrant *entrants, int count,
+                 const std::vector<String> &args, String &out,
+                 uint32_t timeoutMs, bool *allNotFound = nullptr);
+
+  static RaceStats getStats(RaceKind kind);
+
+  // Called by race tasks
+  static void countHedge(RaceKind kind);
+
+private:
+  static void record(RaceKind kind, int winner, uint32_t ms);
+
+  static RaceStats _stats[RACE_KIND_COUNT];
+  static uint16_t _samples[RACE_KIND_COUNT][SCHED_LATENCY_SAMPLES];
+  static uint8_t _sampleCount[RACE_KIND_COUNT];
+  static uint8_t _sampleNext[RACE_KIND_COUNT];
+  static portMUX_TYPE _lock;
+};
+
+#endif // PROVIDER_RACE_H
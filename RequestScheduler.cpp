@@ -0,0 +1,203 @@
+#include "RequestScheduler.h"
+#include "ErrorHandler.h"
+#include "Metrics.h"
+#include <algorithm>
+
+// Static members. Rates follow each provider's published limits (or a
+// conservative guess where none is published).
+RequestScheduler::Bucket RequestScheduler::_buckets[API_PROVIDER_COUNT] = {
+    {"MusicBrainz", 1000, 1}, // 1 req/s per client
+    {"Discogs", 1000, 3},     // 60/min authenticated
+    {"GoogleBooks", 200, 5},
+    {"iTunes", 3000, 5}, // ~20/min
+    {"Lyrics.ovh", 500, 2},
+    {"LRCLib", 500, 2},
+    {"Deezer", 200, 5}, // 50 per 5s
+};
+SemaphoreHandle_t RequestScheduler::_mutex = NULL;
+
+void RequestScheduler::begin() {
+  if (_mutex)
+    return;
+  _mutex = xSemaphoreCreateMutex();
+  uint32_t now = millis();
+  for (int i = 0; i < API_PROVIDER_COUNT; i++) {
+    Bucket &b = _buckets[i];
+    b.tat = now;
+    b.blocked = false;
+    b.backoffLevel = 0;
+    b.queue = xSemaphoreCreateMutex();
+  }
+}
+
+// Milliseconds until the bucket can dispatch (0 = now). Caller holds _mutex.
+int32_t RequestScheduler::waitTimeMs(Bucket &b, uint32_t now) {
+  int32_t wait = 0;
+  if (b.blocked) {
+    int32_t left = (int32_t)(b.blockedUntil - now);
+    if (left > 0)
+      wait = left;
+    else
+      b.blocked = false;
+  }
+  uint32_t tolerance = (uint32_t)(b.burst - 1) * b.intervalMs;
+  int32_t due = (int32_t)(b.tat - tolerance - now);
+  return (due > wait) ? due : wait;
+}
+
+bool RequestScheduler::acquire(ApiProvider provider, uint32_t maxWaitMs) {
+  if (provider < 0 || provider >= API_PROVIDER_COUNT || !_mutex)
+    return true; // Unscheduled (begin() not called yet)
+
+  Bucket &b = _buckets[provider];
+  uint32_t start = millis();
+
+  // Queue behind earlier callers
+  if (xSemaphoreTake(b.queue, pdMS_TO_TICKS(maxWaitMs)) != pdTRUE) {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    b.timeouts++;
+    xSemaphoreGive(_mutex);
+    return false;
+  }
+
+  // Head of the queue: sleep until the next token is due. A 429/503 reported
+  // meanwhile moves the deadline, so re-check after each sleep.
+  bool granted = false;
+  while (true) {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    uint32_t now = millis();
+    int32_t wait = waitTimeMs(b, now);
+
+    if (wait <= 0) {
+      if ((int32_t)(now - b.tat) > 0)
+        b.tat = now;
+      b.tat += b.intervalMs;
+      b.granted++;
+      b.totalWaitMs += now - start;
+      granted = true;
+      xSemaphoreGive(_mutex);
+      break;
+    }
+    if ((now - start) + (uint32_t)wait > maxWaitMs) {
+      b.timeouts++;
+      xSemaphoreGive(_mutex);
+      break;
+    }
+    xSemaphoreGive(_mutex);
+    vTaskDelay(pdMS_TO_TICKS(wait) > 0 ? pdMS_TO_TICKS(wait) : 1);
+  }
+
+  xSemaphoreGive(b.queue);
+
+  if (!granted) {
+    ErrorHandler::logWarn(ERR_CAT_API,
+                          String(b.name) + " rate limit: request dropped",
+                          "RequestScheduler");
+  }
+  return granted;
+}
+
+void RequestScheduler::report(ApiProvider provider, int httpCode,
+                              const String &retryAfter) {
+  if (provider < 0 || provider >= API_PROVIDER_COUNT || !_mutex)
+    return;
+
+  Bucket &b = _buckets[provider];
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+
+  if (httpCode == 429 || httpCode == 503) {
+    uint32_t pauseMs = 0;
+    // Only the delta-seconds form; HTTP-dates fall back to backoff
+    long seconds = retryAfter.length() > 0 ? retryAfter.toInt() : 0;
+    if (seconds > 0) {
+      pauseMs = (uint32_t)seconds * 1000;
+      if (pauseMs > SCHED_MAX_WAIT_MS)
+        pauseMs = SCHED_MAX_WAIT_MS;
+    } else {
+      pauseMs = SCHED_BACKOFF_MIN_MS << b.backoffLevel;
+      if (pauseMs >= SCHED_BACKOFF_MAX_MS)
+        pauseMs = SCHED_BACKOFF_MAX_MS;
+      else
+        b.backoffLevel++;
+    }
+
+    uint32_t until = millis() + pauseMs;
+    if (!b.blocked || (int32_t)(until - b.blockedUntil) > 0)
+      b.blockedUntil = until;
+    b.blocked = true;
+    b.throttled++;
+    xSemaphoreGive(_mutex);
+
+    Serial.printf("RequestScheduler: %s returned %d, pausing %lu ms\n", b.name,
+                  httpCode, (unsigned long)pauseMs);
+    return;
+  }
+
+  if (httpCode > 0)
+    b.backoffLevel = 0;
+  xSemaphoreGive(_mutex);
+}
+
+int RequestScheduler::get(ApiProvider provider, HTTPClient &http) {
+  if (!acquire(provider))
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+
+  // Transfer-Encoding is needed to stream the body (HttpBodyStream)
+  static const char *headerKeys[] = {"Retry-After", "Transfer-Encoding"};
+  http.collectHeaders(headerKeys, 2);
+
+  int64_t start = esp_timer_get_time();
+  int code = http.GET();
+  uint32_t elapsedUs = (uint32_t)(esp_timer_get_time() - start);
+  uint32_t elapsed = elapsedUs / 1000;
+  Metrics::recordOutbound(provider, elapsedUs, code);
+  report(provider, code, http.header("Retry-After"));
+
+  if (code > 0 && _mutex) {
+    Bucket &b = _buckets[provider];
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    b.latency[b.latencyNext] = elapsed > 0xFFFF ? 0xFFFF : elapsed;
+    b.latencyNext = (b.latencyNext + 1) % SCHED_LATENCY_SAMPLES;
+    if (b.latencyCount < SCHED_LATENCY_SAMPLES)
+      b.latencyCount++;
+    xSemaphoreGive(_mutex);
+  }
+  return code;
+}
+
+void latency_percentiles(const uint16_t *samples, int count, uint32_t &p50,
+                         uint32_t &p95) {
+  p50 = p95 = 0;
+  if (count <= 0)
+    return;
+  uint16_t sorted[SCHED_LATENCY_SAMPLES];
+  if (count > SCHED_LATENCY_SAMPLES)
+    count = SCHED_LATENCY_SAMPLES;
+  memcpy(sorted, samples, count * sizeof(uint16_t));
+  std::sort(sorted, sorted + count);
+  p50 = sorted[(count - 1) * 50 / 100];
+  p95 = sorted[(count - 1) * 95 / 100];
+}
+
+ApiProviderStats RequestScheduler::getStats(ApiProvider provider) {
+  ApiProviderStats s = {};
+  if (provider < 0 || provider >= API_PROVIDER_COUNT)
+    return s;
+
+  Bucket &b = _buckets[provider];
+  if (_mutex)
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+  s.name = b.name;
+  s.intervalMs = b.intervalMs;
+  s.burst = b.burst;
+  s.granted = b.granted;
+  s.throttled = b.throttled;
+  s.timeouts = b.timeouts;
+  s.totalWaitMs = b.totalWaitMs;
+  int32_t left = (int32_t)(b.blockedUntil - millis());
+  s.pausedForMs = (b.blocked && left > 0) ? left : 0;
+  latency_percentiles(b.latency, b.latencyCount, s.p50Ms, s.p95Ms);
+  if (_mutex)
+    xSemaphoreGive(_mutex);
+  return s;
+}
@@ -0,0 +1,100 @@
+#ifndef REQUEST_SCHEDULER_H
+#define REQUEST_SCHEDULER_H
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Shared rate limiter for the metadata APIs.
+//
+// Each provider has a token bucket (kept in GCRA form: one "theoretical
+// arrival time" per provider) refilling at its published rate, with a small
+// burst allowance. Callers from any task queue on the provider in FIFO order
+// and the head of the queue sleeps exactly until the next token is due, so a
+// bulk run goes out at the allowed rate with no fixed sleeps in between.
+//
+// 429/503 responses pause the provider: for Retry-After seconds when the
+// header is present, otherwise with exponential backoff (2s .. 60s) that
+// resets on the next success.
+
+enum ApiProvider {
+  API_MUSICBRAINZ = 0,
+  API_DISCOGS,
+  API_GOOGLE_BOOKS,
+  API_ITUNES,
+  API_LYRICS_OVH,
+  API_LRCLIB,
+  API_DEEZER,
+  API_PROVIDER_COUNT
+};
+
+#define SCHED_MAX_WAIT_MS 90000 // Give up instead of queueing longer
+#define SCHED_BACKOFF_MIN_MS 2000
+#define SCHED_BACKOFF_MAX_MS 60000
+#define SCHED_LATENCY_SAMPLES 64 // Ring of recent request times per provider
+
+struct ApiProviderStats {
+  const char *name;
+  uint32_t intervalMs; // One token per interval
+  uint8_t burst;
+  uint32_t granted;     // Requests dispatched
+  uint32_t throttled;   // 429/503 responses
+  uint32_t timeouts;    // acquire() gave up
+  uint32_t totalWaitMs; // Time spent queued
+  int32_t pausedForMs;  // Remaining Retry-After/backoff pause, 0 if none
+  uint32_t p50Ms;       // Request time (send to response headers), recent
+  uint32_t p95Ms;
+};
+
+// p50/p95 of a ring of millisecond samples (order doesn't matter).
+void latency_percentiles(const uint16_t *samples, int count, uint32_t &p50,
+                         uint32_t &p95);
+
+class RequestScheduler {
+public:
+  static void begin();
+
+  // Waits for the provider's next token (FIFO with other callers).
+  // Returns false if it would have to wait longer than maxWaitMs.
+  static bool acquire(ApiProvider provider,
+                      uint32_t maxWaitMs = SCHED_MAX_WAIT_MS);
+
+  // Feeds an HTTP result back (handles 429/503 and Retry-After).
+  static void report(ApiProvider provider, int httpCode,
+                     const String &retryAfter = "");
+
+  // acquire() + GET + report() on a client that has been begin()'d. Also
+  // records the request time for the latency percentiles.
+  // Returns the HTTP code, or HTTPC_ERROR_CONNECTION_REFUSED if no token
+  // could be obtained in time (the request is not sent).
+  static int get(ApiProvider provider, HTTPClient &http);
+
+  static ApiProviderStats getStats(ApiProvider provider);
+
+private:
+  struct Bucket {
+    const char *name;
+    uint32_t intervalMs;
+    uint8_t burst;
+    uint32_t tat;          // Theoretical arrival time of the next request
+    uint32_t blockedUntil; // Retry-After / backoff pause
+    bool blocked;
+    uint8_t backoffLevel;
+    SemaphoreHandle_t queue; // Serializes waiters in arrival order
+    uint32_t granted;
+    uint32_t throttled;
+    uint32_t timeouts;
+    uint32_t totalWaitMs;
+    uint16_t latency[SCHED_LATENCY_SAMPLES];
+    uint8_t latencyCount;
+    uint8_t latencyNext;
+  };
+
+  static int32_t waitTimeMs(Bucket &b, uint32_t now);
+
+  static Bucket _buckets[API_PROVIDER_COUNT];
+  static SemaphoreHandle_t _mutex; // Guards bucket state
+};
+
+#endif // REQUEST_SCHEDULER_H
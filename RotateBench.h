@@ -0,0 +1,186 @@
+#ifndef ROTATE_BENCH_H
+#define ROTATE_BENCH_H
+
+#include "Waveshare_ST7262_LVGL.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <lvgl.h>
+
+#define ROTATE_BENCH_CAPS (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+
+// Checks the tiled/quad rotation of the flush (lvgl_port_rotate_copy)
+// against the per-pixel copy it replaced, then times both:
+//   check  - 90/180/270 over even and odd frame sizes, odd area bounds and a
+//            misaligned buffer; the whole destination must match byte for
+//            byte
+//   timing - the full frame and a 20-line strip (one partial buffer), in
+//            PSRAM like the real frame buffers
+// Needs three full-frame buffers of PSRAM while it runs.
+class RotateBench {
+public:
+  static String run(int passes) {
+    passes = constrain(passes, 1, 50);
+    String log = "=== Rotated flush copy: per-pixel vs tiled ===\n";
+
+    const int w = LVGL_PORT_DISP_WIDTH, h = LVGL_PORT_DISP_HEIGHT;
+    size_t bytes = (size_t)w * h * sizeof(lv_color_t) + 4; // + misalign
+    lv_color_t *src = (lv_color_t *)heap_caps_malloc(bytes, ROTATE_BENCH_CAPS);
+    lv_color_t *ref = (lv_color_t *)heap_caps_malloc(bytes, ROTATE_BENCH_CAPS);
+    lv_color_t *out = (lv_color_t *)heap_caps_malloc(bytes, ROTATE_BENCH_CAPS);
+    if (!src || !ref || !out) {
+      heap_caps_free(src);
+      heap_caps_free(ref);
+      heap_caps_free(out);
+      return log + "Not enough PSRAM for three frame buffers\n";
+    }
+
+    uint32_t seed = 0x2545F491;
+    uint8_t *fill = (uint8_t *)src;
+    for (size_t i = 0; i < bytes; i++) {
+      seed = seed * 1664525u + 1013904223u; // LCG: same data every run
+      fill[i] = seed >> 24;
+    }
+
+    // Frame sizes (even, odd width, odd height, both odd, tiny) x areas
+    // (whole frame, odd-bounded inner area, single column, single row)
+    const int frames[][2] = {{w, h}, {w - 1, h}, {w, h - 1},
+                             {w - 1, h - 1}, {37, 23}, {2, 2}};
+    const uint16_t angles[] = {90, 180, 270};
+    int cases = 0, failed = 0;
+    for (auto &f : frames) {
+      int fw = f[0], fh = f[1];
+      const int areas[][4] = {{0, 0, fw - 1, fh - 1},
+                              {fw / 5 | 1, fh / 7 | 1, fw - 2, fh - 2},
+                              {fw / 2, 0, fw / 2, fh - 1},
+                              {0, fh / 2, fw - 1, fh / 2}};
+      for (auto &a : areas) {
+        if (a[0] > a[2] || a[1] > a[3])
+          continue;
+        for (uint16_t rot : angles) {
+          for (int shift = 0; shift < 2; shift++) {
+            // shift = 1: 2-byte aligned source, the quad path must stand down
+            const lv_color_t *from = src + shift;
+            cases++;
+            if (!matches(from, ref, out, bytes, a, fw, fh, rot)) {
+              failed++;
+              char line[96];
+              snprintf(line, sizeof(line),
+                       "MISMATCH %dx%d area %d,%d-%d,%d rot %u shift %d\n",
+                       fw, fh, a[0], a[1], a[2], a[3], rot, shift);
+              log += line;
+            }
+          }
+        }
+      }
+    }
+    log += "check: " + String(cases - failed) + "/" + String(cases) +
+           " identical\n";
+
+    // Timings
+    log += String(passes) + " passes, us per copy (old -> new)\n";
+    const int strip = h < 20 ? h : 20;
+    for (uint16_t rot : angles) {
+      for (int pass = 0; pass < 2; pass++) {
+        int y0 = pass == 0 ? 0 : (h - strip) / 2;
+        int y1 = pass == 0 ? h - 1 : y0 + strip - 1;
+        uint32_t oldUs =
+            timeCopy(true, src, ref, 0, y0, w - 1, y1, w, h, rot, passes);
+        uint32_t newUs =
+            timeCopy(false, src, out, 0, y0, w - 1, y1, w, h, rot, passes);
+        char line[96];
+        snprintf(line, sizeof(line), "%3u  %-6s %dx%-4d %7lu -> %7lu\n", rot,
+                 pass == 0 ? "frame" : "strip", w, y1 - y0 + 1,
+                 (unsigned long)oldUs, (unsigned long)newUs);
+        log += line;
+        Serial.print("[BENCH] ");
+        Serial.print(line);
+      }
+    }
+
+    heap_caps_free(src);
+    heap_caps_free(ref);
+    heap_caps_free(out);
+    return log;
+  }
+
+private:
+  // rotate_copy_pixel() before the tiling: one pixel at a time, the
+  // destination walked with a stride for 90/270
+  static void rotateReference(const lv_color_t *from, lv_color_t *to,
+                              uint16_t x_start, uint16_t y_start,
+                              uint16_t x_end, uint16_t y_end, uint16_t w,
+                              uint16_t h, uint16_t rotate) {
+    int from_index = 0;
+    int to_index = 0;
+    int to_index_const = 0;
+
+    switch (rotate) {
+    case 90:
+      to_index_const = (w - x_start - 1) * h;
+      for (int from_y = y_start; from_y < y_end + 1; from_y++) {
+        from_index = from_y * w + x_start;
+        to_index = to_index_const + from_y;
+        for (int from_x = x_start; from_x < x_end + 1; from_x++) {
+          *(to + to_index) = *(from + from_index);
+          from_index += 1;
+          to_index -= h;
+        }
+      }
+      break;
+    case 180:
+      to_index_const = h * w - x_start - 1;
+      for (int from_y = y_start; from_y < y_end + 1; from_y++) {
+        from_index = from_y * w + x_start;
+        to_index = to_index_const - from_y * w;
+        for (int from_x = x_start; from_x < x_end + 1; from_x++) {
+          *(to + to_index) = *(from + from_index);
+          from_index += 1;
+          to_index -= 1;
+        }
+      }
+      break;
+    case 270:
+      to_index_const = (x_start + 1) * h - 1;
+      for (int from_y = y_start; from_y < y_end + 1; from_y++) {
+        from_index = from_y * w + x_start;
+        to_index = to_index_const - from_y;
+        for (int from_x = x_start; from_x < x_end + 1; from_x++) {
+          *(to + to_index) = *(from + from_index);
+          from_index += 1;
+          to_index += h;
+        }
+      }
+      break;
+    default:
+      break;
+    }
+  }
+
+  // Both copies into destinations pre-filled alike, compared whole: a stray
+  // write outside the area counts as a mismatch too
+  static bool matches(const lv_color_t *from, lv_color_t *ref,
+                      lv_color_t *out, size_t bytes, const int a[4], int w,
+                      int h, uint16_t rot) {
+    memset(ref, 0xA5, bytes);
+    memset(out, 0xA5, bytes);
+    rotateReference(from, ref, a[0], a[1], a[2], a[3], w, h, rot);
+    lvgl_port_rotate_copy(from, out, a[0], a[1], a[2], a[3], w, h, rot);
+    return memcmp(ref, out, bytes) == 0;
+  }
+
+  static uint32_t timeCopy(bool reference, const lv_color_t *from,
+                           lv_color_t *to, int x0, int y0, int x1, int y1,
+                           int w, int h, uint16_t rot, int passes) {
+    int64_t start = esp_timer_get_time();
+    for (int p = 0; p < passes; p++) {
+      if (reference)
+        rotateReference(from, to, x0, y0, x1, y1, w, h, rot);
+      else
+        lvgl_port_rotate_copy(from, to, x0, y0, x1, y1, w, h, rot);
+    }
+    return (uint32_t)((esp_timer_get_time() - start) / passes);
+  }
+};
+
+#endif // ROTATE_BENCH_H
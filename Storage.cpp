@@ -1,6 +1,12 @@
 #include "Storage.h"
 #include "AppGlobals.h"
+#include "ChunkWriter.h"
+#include "CoverStore.h"
 #include "ErrorHandler.h"
+#include "LibraryRevision.h"
+#include "LockProfiler.h"
+#include "Metrics.h"
+#include "TraceRecorder.h"
 #include "Utils.h"
 #include "waveshare_sd_card.h" // For SD_CS and sdExpander
 #include <SD.h>
@@ -67,15 +73,101 @@ IndexVector &LibrarianStorage::getIndex() {
   return getVectorForMode(currentMode);
 }
 
-// --- SAVE (Core Function) ---
+// --- Detail JSON (item files and the batch journal) ---
+
+static void itemToJson(const CD &cd, JsonDocument &doc) {
+  doc["title"] = cd.title.c_str();
+  doc["artist"] = cd.artist.c_str();
+  doc["genre"] = cd.genre.c_str();
+  doc["year"] = cd.year;
+  doc["uniqueID"] = cd.uniqueID.c_str();
+  doc["coverUrl"] = cd.coverUrl.c_str();
+  doc["coverFile"] = cd.coverFile.c_str();
+  doc["favorite"] = cd.favorite;
+  doc["notes"] = cd.notes.c_str();
+  doc["barcode"] = cd.barcode.c_str();
+  doc["releaseMbid"] = cd.releaseMbid.c_str();
+  doc["trackCount"] = cd.trackCount;
+  doc["totalDurationMs"] = cd.totalDurationMs;
+
+  JsonArray leds = doc.createNestedArray("ledIndices");
+  for (int led : cd.ledIndices) {
+    leds.add(led);
+  }
+}
+
+// Everything but uniqueID, which callers take from the file name
+static void itemFromJson(JsonDocument &doc, CD &outCD) {
+  outCD.title = (const char *)(doc["title"] | "");
+  outCD.artist = (const char *)(doc["artist"] | "");
+  outCD.genre = (const char *)(doc["genre"] | "");
+  outCD.year = doc["year"] | 0;
+  outCD.coverUrl = (const char *)(doc["coverUrl"] | "");
+  outCD.coverFile = (const char *)(doc["coverFile"] | "");
+  outCD.favorite = doc["favorite"] | false;
+  outCD.notes = (const char *)(doc["notes"] | "");
+  outCD.barcode = (const char *)(doc["barcode"] | "");
+  outCD.releaseMbid = (const char *)(doc["releaseMbid"] | "");
+  outCD.trackCount = doc["trackCount"] | 0;
+  outCD.totalDurationMs = doc["totalDurationMs"] | 0;
+
+  outCD.ledIndices.clear();
+  JsonArray leds = doc["ledIndices"];
+  for (int val : leds)
+    outCD.ledIndices.push_back(val);
+}
+
+static void itemToJson(const Book &book, JsonDocument &doc) {
+  doc["title"] = book.title.c_str();
+  doc["artist"] =
+      book.author.c_str(); // Store Author in "artist" field for consistency
+  doc["author"] = book.author.c_str(); // Explicit
+  doc["genre"] = book.genre.c_str();
+  doc["year"] = book.year;
+  doc["uniqueID"] = book.uniqueID.c_str();
+  doc["coverUrl"] = book.coverUrl.c_str();
+  doc["coverFile"] = book.coverFile.c_str();
+  doc["favorite"] = book.favorite;
+  doc["notes"] = book.notes.c_str();
+  doc["isbn"] = book.isbn.c_str();
+  doc["publisher"] = book.publisher.c_str();
+  doc["pageCount"] = book.pageCount;
+  doc["currentPage"] = book.currentPage;
+
+  JsonArray leds = doc.createNestedArray("ledIndices");
+  for (int led : book.ledIndices) {
+    leds.add(led);
+  }
+}
+
+static void itemFromJson(JsonDocument &doc, Book &outBook) {
+  outBook.title = (const char *)(doc["title"] | "");
+  outBook.author = (const char *)(doc["author"] | doc["artist"] | "");
+  outBook.genre = (const char *)(doc["genre"] | "");
+  outBook.year = doc["year"] | 0;
+  outBook.coverUrl = (const char *)(doc["coverUrl"] | "");
+  outBook.coverFile = (const char *)(doc["coverFile"] | "");
+  outBook.favorite = doc["favorite"] | false;
+  outBook.notes = (const char *)(doc["notes"] | "");
+  outBook.isbn = (const char *)(doc["isbn"] | "");
+  outBook.publisher = (const char *)(doc["publisher"] | "");
+  outBook.pageCount = doc["pageCount"] | 0;
+  outBook.currentPage = doc["currentPage"] | 0;
+
+  outBook.ledIndices.clear();
+  JsonArray leds = doc["ledIndices"];
+  for (int val : leds)
+    outBook.ledIndices.push_back(val);
+}
 
 // --- SAVE (Core Function) ---
 bool LibrarianStorage::saveCD(const CD &cd, const char *oldUniqueID,
                               bool skipIndexRewrite) {
+  TRACE_SCOPE("storage.saveCD");
   if (oldUniqueID && strlen(oldUniqueID) > 0 && cd.uniqueID != oldUniqueID) {
     String oldPath = getFilePath(oldUniqueID, MODE_CD);
     if (sdExpander && i2cMutex) {
-      if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
+      if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
         sdExpander->digitalWrite(SD_CS, LOW);
         if (SD.exists(oldPath)) {
           SD.remove(oldPath);
@@ -83,13 +175,13 @@ bool LibrarianStorage::saveCD(const CD &cd, const char *oldUniqueID,
                         oldPath.c_str());
         }
         sdExpander->digitalWrite(SD_CS, HIGH);
-        xSemaphoreGiveRecursive(i2cMutex);
+        LOCK_GIVE(i2cMutex);
       }
     }
   }
 
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
       sdExpander->digitalWrite(SD_CS, LOW);
     }
   }
@@ -112,29 +204,11 @@ bool LibrarianStorage::saveCD(const CD &cd, const char *oldUniqueID,
   }
 
   DynamicJsonDocument doc(4096); // 4KB is plenty for one item
-  doc["title"] = cd.title.c_str();
-  doc["artist"] = cd.artist.c_str();
-  doc["genre"] = cd.genre.c_str();
-  doc["year"] = cd.year;
-  doc["uniqueID"] = cd.uniqueID.c_str();
-  doc["coverUrl"] = cd.coverUrl.c_str();
-  doc["coverFile"] = cd.coverFile.c_str();
-  doc["favorite"] = cd.favorite;
-  doc["notes"] = cd.notes.c_str();
-  doc["barcode"] = cd.barcode.c_str();
-  doc["releaseMbid"] = cd.releaseMbid.c_str();
+  itemToJson(cd, doc);
   Serial.printf("Storage: Saving CD %s (MBID: '%s', Tracks: %d, Cover: '%s')\n",
                 cd.uniqueID.c_str(), cd.releaseMbid.c_str(), cd.trackCount,
                 cd.coverFile.c_str());
 
-  doc["trackCount"] = cd.trackCount;
-  doc["totalDurationMs"] = cd.totalDurationMs;
-
-  JsonArray leds = doc.createNestedArray("ledIndices");
-  for (int led : cd.ledIndices) {
-    leds.add(led);
-  }
-
   serializeJson(doc, file);
   file.close();
 
@@ -151,7 +225,7 @@ bool LibrarianStorage::saveCD(const CD &cd, const char *oldUniqueID,
 
   if (sdExpander && i2cMutex) {
     sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   // 2. Update Index
@@ -165,6 +239,7 @@ bool LibrarianStorage::saveCD(const CD &cd, const char *oldUniqueID,
       item.uniqueID = cd.uniqueID.c_str();
       item.title = cd.title.c_str();
       item.artist = cd.artist.c_str();
+      CoverStore::retarget(item.coverFile.c_str(), cd.coverFile.c_str());
       item.coverFile = cd.coverFile.c_str();
       item.year = cd.year;
       item.genre = cd.genre.c_str();
@@ -183,6 +258,7 @@ bool LibrarianStorage::saveCD(const CD &cd, const char *oldUniqueID,
     newItem.title = cd.title.c_str();
     newItem.artist = cd.artist.c_str();
     newItem.coverFile = cd.coverFile.c_str();
+    CoverStore::retain(cd.coverFile.c_str());
     newItem.year = cd.year;
     newItem.genre = cd.genre.c_str();
     newItem.favorite = cd.favorite;
@@ -191,6 +267,7 @@ bool LibrarianStorage::saveCD(const CD &cd, const char *oldUniqueID,
     newItem.metaString = cd.barcode.c_str();
     vec.push_back(newItem);
   }
+  LibraryRevision::recordUpsert(MODE_CD, cd.uniqueID.c_str());
 
   if (skipIndexRewrite)
     return true;
@@ -199,21 +276,30 @@ bool LibrarianStorage::saveCD(const CD &cd, const char *oldUniqueID,
 
 // --- LOAD INDEX ---
 bool LibrarianStorage::loadIndex(MediaMode mode) {
+  METRIC_SCOPE(METRIC_OP_LOAD_INDEX);
+  TRACE_SCOPE("storage.loadIndex");
   auto &vec = getVectorForMode(mode);
   vec.clear();
   String path = getIndexPath(mode);
 
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
       sdExpander->digitalWrite(SD_CS, LOW);
     }
   }
+  // rewriteIndex() removes the old index before renaming the new one into
+  // place; a reset in between leaves only the (complete) .tmp
+  String tmpPath = path + ".tmp";
+  if (!SD.exists(path) && SD.exists(tmpPath)) {
+    Serial.printf("Storage: Recovering %s from .tmp\n", path.c_str());
+    SD.rename(tmpPath, path);
+  }
   File file = SD.open(path, FILE_READ);
 
   if (!file) {
     if (sdExpander && i2cMutex) {
       sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
     return false; // No index yet
   }
@@ -251,19 +337,209 @@ bool LibrarianStorage::loadIndex(MediaMode mode) {
   file.close();
   if (sdExpander && i2cMutex) {
     sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
+  LibraryRevision::recordReset(mode);
   return true;
 }
 
+// --- BATCH COMMIT (write-ahead journal) ---
+//
+// Journal: a header line {"mode","count"}, one line per item (its detail JSON
+// plus "oldUniqueID"), then {"commit":count}. Without the commit line the
+// journal was cut short before anything else was touched, and is dropped.
+
+static bool saveEntry(LibrarianStorage &st, const BatchEntry<CD> &e) {
+  return st.saveCD(e.item, e.oldUniqueID.c_str(), true);
+}
+
+static bool saveEntry(LibrarianStorage &st, const BatchEntry<Book> &e) {
+  return st.saveBook(e.item, e.oldUniqueID.c_str(), true);
+}
+
+template <typename T>
+bool LibrarianStorage::commitEntries(
+    MediaMode mode, const std::vector<BatchEntry<T>> &entries) {
+  // A batch whose apply failed earlier goes first; ours would replace its
+  // journal
+  if (!recoverBatch())
+    return false;
+
+  if (sdExpander && i2cMutex) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
+      Serial.println("!!! I2C LOCK FAIL: commitBatch");
+      return false;
+    }
+    sdExpander->digitalWrite(SD_CS, LOW);
+  }
+
+  // Any short write (card full, I/O error) leaves the journal without its
+  // commit line, so recoverBatch() drops it rather than replaying half of it
+  bool journaled = false;
+  File file = SD.open(BATCH_JOURNAL_PATH, FILE_WRITE);
+  if (file) {
+    journaled = file.printf("{\"mode\":%d,\"count\":%d}\n", (int)mode,
+                            (int)entries.size()) > 0;
+    for (size_t i = 0; i < entries.size() && journaled; i++) {
+      DynamicJsonDocument doc(4096);
+      itemToJson(entries[i].item, doc);
+      doc["oldUniqueID"] = entries[i].oldUniqueID;
+      journaled = !doc.overflowed() &&
+                  serializeJson(doc, file) == measureJson(doc) &&
+                  file.println() > 0;
+    }
+    if (journaled)
+      journaled = file.printf("{\"commit\":%d}\n", (int)entries.size()) > 0;
+    file.close();
+    if (!journaled)
+      SD.remove(BATCH_JOURNAL_PATH);
+  }
+
+  if (sdExpander && i2cMutex) {
+    sdExpander->digitalWrite(SD_CS, HIGH);
+    LOCK_GIVE(i2cMutex);
+  }
+  if (!journaled) {
+    ErrorHandler::logError(ERR_CAT_STORAGE, "Could not write batch journal",
+                           "Storage::commitBatch");
+    return false;
+  }
+
+  // Committed: from here on a reset or a failed write is finished by
+  // recoverBatch()
+  bool ok = true;
+  for (const auto &e : entries)
+    ok = saveEntry(*this, e) && ok;
+  ok = rewriteIndex(mode) && ok;
+
+  if (ok) {
+    removeBatchJournal();
+  } else {
+    ErrorHandler::logError(ERR_CAT_STORAGE,
+                           "Batch partly written, journal kept for replay",
+                           "Storage::commitBatch");
+  }
+  return true;
+}
+
+bool LibrarianStorage::commitBatch(
+    const std::vector<BatchEntry<CD>> &entries) {
+  return commitEntries(MODE_CD, entries);
+}
+
+bool LibrarianStorage::commitBatch(
+    const std::vector<BatchEntry<Book>> &entries) {
+  return commitEntries(MODE_BOOK, entries);
+}
+
+void LibrarianStorage::removeBatchJournal() {
+  if (sdExpander && i2cMutex) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(2000)) != pdPASS)
+      return; // Replayed again later: harmless, every entry is a full state
+    sdExpander->digitalWrite(SD_CS, LOW);
+  }
+  SD.remove(BATCH_JOURNAL_PATH);
+  if (sdExpander && i2cMutex) {
+    sdExpander->digitalWrite(SD_CS, HIGH);
+    LOCK_GIVE(i2cMutex);
+  }
+}
+
+template <typename T>
+bool LibrarianStorage::replayEntries(MediaMode mode,
+                                     std::vector<BatchEntry<T>> &entries) {
+  Serial.printf("Storage: Replaying batch journal (%d items)\n",
+                (int)entries.size());
+  // Every entry is the item's complete final state, so replaying a journal
+  // that was already partly (or fully) applied gives the same result
+  loadIndex(mode);
+  bool ok = true;
+  for (const auto &e : entries)
+    ok = saveEntry(*this, e) && ok;
+  ok = rewriteIndex(mode) && ok;
+  if (ok)
+    removeBatchJournal();
+  else
+    Serial.println("Storage: Batch replay incomplete, will retry");
+  return ok;
+}
+
+bool LibrarianStorage::recoverBatch() {
+  if (sdExpander && i2cMutex) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
+      Serial.println("!!! I2C LOCK FAIL: recoverBatch");
+      return false;
+    }
+    sdExpander->digitalWrite(SD_CS, LOW);
+  }
+
+  std::vector<BatchEntry<CD>> cds;
+  std::vector<BatchEntry<Book>> books;
+  int mode = -1;
+  int count = -1;
+  bool committed = false;
+  File file = SD.open(BATCH_JOURNAL_PATH, FILE_READ);
+  bool found = (bool)file;
+  while (file && file.available()) {
+    String line = file.readStringUntil('\n');
+    line.trim();
+    if (line.length() == 0)
+      continue;
+    DynamicJsonDocument doc(4096);
+    if (deserializeJson(doc, line))
+      break; // Torn write: the commit line can't follow
+    if (mode < 0) {
+      mode = doc["mode"] | -1;
+      count = doc["count"] | -1;
+    } else if (doc.containsKey("commit")) {
+      committed = (doc["commit"] | -2) == count &&
+                  count == (int)(cds.size() + books.size());
+      break;
+    } else if (mode == MODE_CD) {
+      BatchEntry<CD> e;
+      itemFromJson(doc, e.item);
+      e.item.uniqueID = (const char *)(doc["uniqueID"] | "");
+      e.item.detailsLoaded = true;
+      e.oldUniqueID = doc["oldUniqueID"] | "";
+      cds.push_back(e);
+    } else if (mode == MODE_BOOK) {
+      BatchEntry<Book> e;
+      itemFromJson(doc, e.item);
+      e.item.uniqueID = (const char *)(doc["uniqueID"] | "");
+      e.item.detailsLoaded = true;
+      e.oldUniqueID = doc["oldUniqueID"] | "";
+      books.push_back(e);
+    }
+  }
+  if (file)
+    file.close();
+  if (found && !committed) {
+    Serial.println("Storage: Dropping incomplete batch journal");
+    SD.remove(BATCH_JOURNAL_PATH);
+  }
+
+  if (sdExpander && i2cMutex) {
+    sdExpander->digitalWrite(SD_CS, HIGH);
+    LOCK_GIVE(i2cMutex);
+  }
+
+  if (!committed)
+    return true;
+  if (mode == MODE_CD)
+    return replayEntries(MODE_CD, cds);
+  return replayEntries(MODE_BOOK, books);
+}
+
 // --- REWRITE INDEX FILE ---
 bool LibrarianStorage::rewriteIndex(MediaMode mode) {
+  METRIC_SCOPE(METRIC_OP_REWRITE_INDEX);
+  TRACE_SCOPE("storage.rewriteIndex");
   auto &vec = getVectorForMode(mode);
   String path = getIndexPath(mode);
   String tmpPath = path + ".tmp";
 
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
       return false;
     }
     sdExpander->digitalWrite(SD_CS, LOW);
@@ -311,17 +587,22 @@ bool LibrarianStorage::rewriteIndex(MediaMode mode) {
 
   if (sdExpander && i2cMutex) {
     sdExpander->digitalWrite(SD_CS, HIGH); // DESELECT
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
+
+  // Cover refcounts ride along with the index write (outside the i2c lock)
+  CoverStore::flush();
   return true;
 }
 
 bool LibrarianStorage::loadCDDetail(String uniqueID, CD &outCD) {
+  METRIC_SCOPE(METRIC_OP_LOAD_CD_DETAIL);
+  TRACE_SCOPE("storage.loadCDDetail");
   String path = getFilePath(uniqueID, MODE_CD);
   Serial.printf("Storage: Loading CD Detail: %s\n", path.c_str());
 
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(2000)) != pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(2000)) != pdPASS) {
       Serial.println("!!! I2C LOCK FAIL: loadCDDetail");
       return false;
     }
@@ -331,37 +612,24 @@ bool LibrarianStorage::loadCDDetail(String uniqueID, CD &outCD) {
   if (!file) {
     if (sdExpander && i2cMutex) {
       sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
     return false;
   }
 
   DynamicJsonDocument doc(4096);
-  deserializeJson(doc, file);
+  {
+    TRACE_SCOPE("storage.read_json");
+    deserializeJson(doc, file);
+  }
   file.close();
   if (sdExpander && i2cMutex) {
     sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   outCD.uniqueID = uniqueID.c_str();
-  outCD.title = (const char *)(doc["title"] | "");
-  outCD.artist = (const char *)(doc["artist"] | "");
-  outCD.genre = (const char *)(doc["genre"] | "");
-  outCD.year = doc["year"] | 0;
-  outCD.coverUrl = (const char *)(doc["coverUrl"] | "");
-  outCD.coverFile = (const char *)(doc["coverFile"] | "");
-  outCD.favorite = doc["favorite"] | false;
-  outCD.notes = (const char *)(doc["notes"] | "");
-  outCD.barcode = (const char *)(doc["barcode"] | "");
-  outCD.releaseMbid = (const char *)(doc["releaseMbid"] | "");
-  outCD.trackCount = doc["trackCount"] | 0;
-  outCD.totalDurationMs = doc["totalDurationMs"] | 0;
-
-  outCD.ledIndices.clear();
-  JsonArray leds = doc["ledIndices"];
-  for (int val : leds)
-    outCD.ledIndices.push_back(val);
+  itemFromJson(doc, outCD);
 
   Serial.printf("Storage: Loaded CD %s details. ReleaseMbid: '%s', Cover: "
                 "'%s', LEDs: %d\n",
@@ -378,10 +646,11 @@ bool LibrarianStorage::loadCDDetail(String uniqueID, CD &outCD) {
 // --- SAVE BOOK ---
 bool LibrarianStorage::saveBook(const Book &book, const char *oldUniqueID,
                                 bool skipIndexRewrite) {
+  TRACE_SCOPE("storage.saveBook");
   if (oldUniqueID && strlen(oldUniqueID) > 0 && book.uniqueID != oldUniqueID) {
     String oldPath = getFilePath(oldUniqueID, MODE_BOOK);
     if (sdExpander && i2cMutex) {
-      if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
+      if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
         sdExpander->digitalWrite(SD_CS, LOW);
         if (SD.exists(oldPath)) {
           SD.remove(oldPath);
@@ -389,13 +658,13 @@ bool LibrarianStorage::saveBook(const Book &book, const char *oldUniqueID,
                         oldPath.c_str());
         }
         sdExpander->digitalWrite(SD_CS, HIGH);
-        xSemaphoreGiveRecursive(i2cMutex);
+        LOCK_GIVE(i2cMutex);
       }
     }
   }
 
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(2000)) != pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(2000)) != pdPASS) {
       Serial.println("!!! I2C LOCK FAIL: saveBook");
       return false;
     }
@@ -413,33 +682,13 @@ bool LibrarianStorage::saveBook(const Book &book, const char *oldUniqueID,
   if (!file) {
     if (sdExpander && i2cMutex) {
       sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
     return false;
   }
 
   DynamicJsonDocument doc(4096);
-  doc["title"] = book.title.c_str();
-  doc["artist"] =
-      book.author.c_str(); // Store Author in "artist" field for consistency
-  doc["author"] = book.author.c_str(); // Explicit
-  doc["genre"] = book.genre.c_str();
-  doc["year"] = book.year;
-  doc["uniqueID"] = book.uniqueID.c_str();
-  doc["coverUrl"] = book.coverUrl.c_str();
-  doc["coverFile"] = book.coverFile.c_str();
-  doc["favorite"] = book.favorite;
-  doc["notes"] = book.notes.c_str();
-  doc["isbn"] = book.isbn.c_str();
-  doc["publisher"] = book.publisher.c_str();
-  doc["pageCount"] = book.pageCount;
-  doc["currentPage"] = book.currentPage;
-
-  JsonArray leds = doc.createNestedArray("ledIndices");
-  for (int led : book.ledIndices) {
-    leds.add(led);
-  }
-
+  itemToJson(book, doc);
   serializeJson(doc, file);
   file.close();
 
@@ -453,7 +702,7 @@ bool LibrarianStorage::saveBook(const Book &book, const char *oldUniqueID,
 
   if (sdExpander && i2cMutex) {
     sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   // 2. Update Index (RAM)
@@ -466,6 +715,7 @@ bool LibrarianStorage::saveBook(const Book &book, const char *oldUniqueID,
       item.uniqueID = book.uniqueID.c_str();
       item.title = book.title.c_str();
       item.artist = book.author.c_str(); // Map Author -> Artist for Index
+      CoverStore::retarget(item.coverFile.c_str(), book.coverFile.c_str());
       item.coverFile = book.coverFile.c_str();
       item.year = book.year;
       item.genre = book.genre.c_str();
@@ -484,6 +734,7 @@ bool LibrarianStorage::saveBook(const Book &book, const char *oldUniqueID,
     newItem.title = book.title.c_str();
     newItem.artist = book.author.c_str();
     newItem.coverFile = book.coverFile.c_str();
+    CoverStore::retain(book.coverFile.c_str());
     newItem.year = book.year;
     newItem.genre = book.genre.c_str();
     newItem.favorite = book.favorite;
@@ -492,6 +743,7 @@ bool LibrarianStorage::saveBook(const Book &book, const char *oldUniqueID,
     newItem.metaString = book.isbn.c_str(); // NEW: ISBN
     vec.push_back(newItem);
   }
+  LibraryRevision::recordUpsert(MODE_BOOK, book.uniqueID.c_str());
 
   if (skipIndexRewrite)
     return true;
@@ -500,11 +752,12 @@ bool LibrarianStorage::saveBook(const Book &book, const char *oldUniqueID,
 
 // --- LOAD BOOK DETAIL ---
 bool LibrarianStorage::loadBookDetail(String uniqueID, Book &outBook) {
+  TRACE_SCOPE("storage.loadBookDetail");
   String path = getFilePath(uniqueID, MODE_BOOK);
   Serial.printf("Storage: Loading Book Detail: %s\n", path.c_str());
 
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(2000)) != pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(2000)) != pdPASS) {
       Serial.println("!!! I2C LOCK FAIL: loadBookDetail");
       return false;
     }
@@ -514,37 +767,24 @@ bool LibrarianStorage::loadBookDetail(String uniqueID, Book &outBook) {
   if (!file) {
     if (sdExpander && i2cMutex) {
       sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
     return false;
   }
 
   DynamicJsonDocument doc(4096);
-  deserializeJson(doc, file);
+  {
+    TRACE_SCOPE("storage.read_json");
+    deserializeJson(doc, file);
+  }
   file.close();
   if (sdExpander && i2cMutex) {
     sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   outBook.uniqueID = uniqueID.c_str();
-  outBook.title = (const char *)(doc["title"] | "");
-  outBook.author = (const char *)(doc["author"] | doc["artist"] | "");
-  outBook.genre = (const char *)(doc["genre"] | "");
-  outBook.year = doc["year"] | 0;
-  outBook.coverUrl = (const char *)(doc["coverUrl"] | "");
-  outBook.coverFile = (const char *)(doc["coverFile"] | "");
-  outBook.favorite = doc["favorite"] | false;
-  outBook.notes = (const char *)(doc["notes"] | "");
-  outBook.isbn = (const char *)(doc["isbn"] | "");
-  outBook.publisher = (const char *)(doc["publisher"] | "");
-  outBook.pageCount = doc["pageCount"] | 0;
-  outBook.currentPage = doc["currentPage"] | 0;
-
-  outBook.ledIndices.clear();
-  JsonArray leds = doc["ledIndices"];
-  for (int val : leds)
-    outBook.ledIndices.push_back(val);
+  itemFromJson(doc, outBook);
 
   Serial.printf("Storage: Loaded Book %s details (Publisher: '%s', Cover: "
                 "'%s', LEDs: %d)\n",
@@ -562,8 +802,7 @@ bool LibrarianStorage::deleteItem(String uniqueID, MediaMode mode) {
   String path = getFilePath(uniqueID, mode);
   Serial.printf("Storage: Deleting %s\n", path.c_str());
 
-  if (i2cMutex &&
-      xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
     if (sdExpander)
       sdExpander->digitalWrite(SD_CS, LOW);
 
@@ -576,17 +815,20 @@ bool LibrarianStorage::deleteItem(String uniqueID, MediaMode mode) {
 
     if (sdExpander)
       sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   // Remove from RAM Index
   auto &vec = getVectorForMode(mode);
   for (auto it = vec.begin(); it != vec.end(); ++it) {
     if (it->uniqueID == uniqueID.c_str()) {
+      CoverStore::release(it->coverFile.c_str());
       vec.erase(it);
       break;
     }
   }
+  // Logged by deleteItemAt(), which knows the item's position in the list
+  LibraryRevision::bump();
 
   // Persist Index Update
   return rewriteIndex(mode);
@@ -607,7 +849,7 @@ bool LibrarianStorage::wipeLibrary(MediaMode mode) {
   Serial.printf("⚠️ Wiping Library Data: %s\n", dataDir.c_str());
 
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
       return false;
     }
     sdExpander->digitalWrite(SD_CS, LOW);
@@ -650,11 +892,14 @@ bool LibrarianStorage::wipeLibrary(MediaMode mode) {
 
   if (sdExpander && i2cMutex) {
     sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   // 3. Clear RAM Index
   getVectorForMode(mode).clear();
+  LibraryRevision::recordReset(mode);
+  CoverStore::rebuildRefCounts();
+  CoverStore::flush();
 
   return true;
 }
@@ -664,6 +909,7 @@ bool LibrarianStorage::wipeLibrary(MediaMode mode) {
 // ============================================================================
 
 TrackList *LibrarianStorage::loadTracklist(const char *releaseMbid) {
+  TRACE_SCOPE("storage.loadTracklist");
   if (!releaseMbid || strlen(releaseMbid) == 0) {
     Serial.println("Storage: Invalid releaseMbid for trackload");
     return nullptr;
@@ -672,7 +918,7 @@ TrackList *LibrarianStorage::loadTracklist(const char *releaseMbid) {
   String filename = "/tracks/" + String(releaseMbid) + ".json";
 
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(1000)) != pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(1000)) != pdPASS) {
       return nullptr;
     }
     sdExpander->digitalWrite(SD_CS, LOW);
@@ -682,7 +928,7 @@ TrackList *LibrarianStorage::loadTracklist(const char *releaseMbid) {
   if (!file) {
     if (sdExpander && i2cMutex) {
       sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
     return nullptr;
   }
@@ -696,7 +942,7 @@ TrackList *LibrarianStorage::loadTracklist(const char *releaseMbid) {
 
   if (sdExpander && i2cMutex) {
     sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   if (error) {
@@ -744,12 +990,13 @@ TrackList *LibrarianStorage::loadTracklist(const char *releaseMbid) {
 
 bool LibrarianStorage::saveTracklist(const char *releaseMbid,
                                      TrackList *trackList) {
+  TRACE_SCOPE("storage.saveTracklist");
   if (!trackList || !releaseMbid)
     return false;
 
   bool mutexTaken = false;
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(2000)) == pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(2000)) == pdPASS) {
       sdExpander->digitalWrite(SD_CS, LOW);
       mutexTaken = true;
     }
@@ -768,58 +1015,49 @@ bool LibrarianStorage::saveTracklist(const char *releaseMbid,
   if (!file) {
     if (sdExpander && i2cMutex && mutexTaken) {
       sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
     return false;
   }
 
   // Stream JSON directly to file to save Heap
-  file.print("{");
-  file.printf("\"releaseMbid\":\"%s\",", releaseMbid);
-  file.print("\"cdTitle\":\"" + escapeJSON(trackList->cdTitle.c_str()) + "\",");
-  file.print("\"cdArtist\":\"" + escapeJSON(trackList->cdArtist.c_str()) +
-             "\",");
-  file.printf("\"fetchedAt\":\"%s\",", trackList->fetchedAt.c_str());
-  file.print("\"tracks\":[");
-
-  for (size_t i = 0; i < trackList->tracks.size(); i++) {
-    Track &track = trackList->tracks[i];
-    if (i > 0)
-      file.print(",");
-
-    file.print("{");
-    file.printf("\"trackNo\":%d,", track.trackNo);
-    file.print("\"title\":\"" + escapeJSON(track.title.c_str()) + "\",");
-    file.printf("\"durationMs\":%lu,", track.durationMs);
-    file.print("\"recordingMbid\":\"" + String(track.recordingMbid.c_str()) +
-               "\",");
-
-    file.print("\"lyrics\":{");
-    file.print("\"status\":\"" + String(track.lyrics.status.c_str()) + "\"");
-
-    // String comparisons with PsramString work if PsramString is std::string
-    if (track.lyrics.status == "cached") {
-      file.print(",\"path\":\"" + escapeJSON(track.lyrics.path.c_str()) + "\"");
-      file.print(",\"fetchedAt\":\"" + String(track.lyrics.fetchedAt.c_str()) +
-                 "\"");
-      file.print(",\"lang\":\"" + String(track.lyrics.lang.c_str()) + "\"");
-    } else if (track.lyrics.status == "missing") {
-      file.print(",\"lastTriedAt\":\"" +
-                 String(track.lyrics.lastTriedAt.c_str()) + "\"");
-      file.print(",\"error\":\"" + escapeJSON(track.lyrics.error.c_str()) +
-                 "\"");
-    }
-    file.print("},");
-    file.printf("\"isFavoriteTrack\":%s",
-                track.isFavoriteTrack ? "true" : "false");
-    file.print("}");
-  }
-  file.print("]}");
+  {
+    ChunkWriter out([&file](const char *data, size_t len) {
+      file.write((const uint8_t *)data, len);
+    });
+    out.beginObject().key("releaseMbid").string(releaseMbid);
+    out.key("cdTitle").string(trackList->cdTitle.c_str());
+    out.key("cdArtist").string(trackList->cdArtist.c_str());
+    out.key("fetchedAt").string(trackList->fetchedAt.c_str());
+    out.key("tracks").beginArray();
+
+    for (const Track &track : trackList->tracks) {
+      out.beginObject().key("trackNo").number(track.trackNo);
+      out.key("title").string(track.title.c_str());
+      out.key("durationMs").number(track.durationMs);
+      out.key("recordingMbid").string(track.recordingMbid.c_str());
+
+      out.key("lyrics").beginObject();
+      out.key("status").string(track.lyrics.status.c_str());
+      if (track.lyrics.status == "cached") {
+        out.key("path").string(track.lyrics.path.c_str());
+        out.key("fetchedAt").string(track.lyrics.fetchedAt.c_str());
+        out.key("lang").string(track.lyrics.lang.c_str());
+      } else if (track.lyrics.status == "missing") {
+        out.key("lastTriedAt").string(track.lyrics.lastTriedAt.c_str());
+        out.key("error").string(track.lyrics.error.c_str());
+      }
+      out.endObject();
+      out.key("isFavoriteTrack").boolean(track.isFavoriteTrack);
+      out.endObject();
+    }
+    out.endArray().endObject();
+  } // Flushed here
   file.close();
 
   if (sdExpander && i2cMutex && mutexTaken) {
     sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   return true;
@@ -853,7 +1091,7 @@ String LibrarianStorage::loadLyrics(const char *lyricsPath) {
 
   String content = "";
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(2000)) == pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(2000)) == pdPASS) {
       sdExpander->digitalWrite(SD_CS, LOW);
       if (SD.exists(path)) {
         File file = SD.open(path, FILE_READ);
@@ -875,7 +1113,7 @@ String LibrarianStorage::loadLyrics(const char *lyricsPath) {
         }
       }
       sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
   }
 
@@ -910,19 +1148,19 @@ bool LibrarianStorage::saveLyrics(const char *lyricsPath, String lyricsText,
   if (lastSlash > 0) {
     String dir = path.substring(0, lastSlash);
     if (sdExpander && i2cMutex) {
-      if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(2000)) == pdPASS) {
+      if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(2000)) == pdPASS) {
         sdExpander->digitalWrite(SD_CS, LOW);
         if (!SD.exists(dir)) {
           SD.mkdir(dir);
         }
         sdExpander->digitalWrite(SD_CS, HIGH);
-        xSemaphoreGiveRecursive(i2cMutex);
+        LOCK_GIVE(i2cMutex);
       }
     }
   }
 
   if (sdExpander && i2cMutex) {
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(2000)) == pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(2000)) == pdPASS) {
       sdExpander->digitalWrite(SD_CS, LOW);
     }
   }
@@ -938,7 +1176,7 @@ bool LibrarianStorage::saveLyrics(const char *lyricsPath, String lyricsText,
   if (!file) {
     if (sdExpander && i2cMutex) {
       sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
     return false;
   }
@@ -956,7 +1194,7 @@ bool LibrarianStorage::saveLyrics(const char *lyricsPath, String lyricsText,
 
   if (sdExpander && i2cMutex) {
     sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
   }
 
   return true;
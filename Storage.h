@@ -35,6 +35,14 @@ struct LibraryIndexItem {
 typedef std::vector<LibraryIndexItem, PsramAllocator<LibraryIndexItem>>
     IndexVector;
 
+#define BATCH_JOURNAL_PATH "/db/batch.journal"
+
+// One item of a batch commit
+template <typename T> struct BatchEntry {
+  T item;             // Complete new state (details loaded)
+  String oldUniqueID; // Its id before the batch
+};
+
 class LibrarianStorage {
 public:
   LibrarianStorage();
@@ -69,6 +77,18 @@ public:
 
   bool rewriteIndex(MediaMode mode);
 
+  // Multi-item edits (/api/batch). Every item's new state goes to a journal
+  // first; then the detail files are written, the index is rewritten once,
+  // and the journal is removed. False if the journal couldn't be written
+  // (nothing changed). Once it is, the batch is durable: a reset or failed
+  // write after that point is finished by recoverBatch().
+  bool commitBatch(const std::vector<BatchEntry<CD>> &entries);
+  bool commitBatch(const std::vector<BatchEntry<Book>> &entries);
+  // Replays a committed journal, drops an incomplete one. Called at boot
+  // (after CoverStore::begin(), before the library is loaded) and before
+  // each new batch.
+  bool recoverBatch();
+
   // Lyrics Management
   String loadLyrics(const char *lyricsPath);
   bool saveLyrics(const char *lyricsPath, String lyricsText,
@@ -84,6 +104,12 @@ private:
 
   // Helper to append/rewrite index file
   bool appendToIndex(const LibraryIndexItem &item, MediaMode mode);
+
+  template <typename T>
+  bool commitEntries(MediaMode mode, const std::vector<BatchEntry<T>> &entries);
+  template <typename T>
+  bool replayEntries(MediaMode mode, std::vector<BatchEntry<T>> &entries);
+  void removeBatchJournal();
 };
 
 // Global Instance
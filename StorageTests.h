@@ -2,11 +2,133 @@
 #define STORAGE_TESTS_H
 
 #include "AppGlobals.h"
+#include "Core_Data.h" // PsramString
+#include "CoverStore.h"
+#include "HttpPool.h"
+#include "LockProfiler.h"
+#include "MediaManager.h"
 #include "Storage.h"
 #include <Arduino.h>
+#include <Client.h>
 #include <Waveshare_ST7262_LVGL.h>
+#include <functional>
 #include <vector>
 
+#define JOURNAL_TEST_ID "TEST_JOURNAL_CD"
+
+// Smallest baseline JPEG TJpgDec accepts: 8x8, three components, one MCU of
+// mid grey (flat quantization, one-code Huffman tables)
+static const uint8_t TEST_JPEG[] = {
+    0xFF, 0xD8,                                           // SOI
+    0xFF, 0xDB, 0x00, 0x43, 0x00,                         // DQT 0
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0xFF, 0xC0, 0x00, 0x11, 0x08, 0x00, 0x08, 0x00, 0x08, // SOF0 8x8
+    0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x00, 0x03, 0x11, 0x00,
+    0xFF, 0xC4, 0x00, 0x14, 0x00,                         // DHT DC 0
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x00,
+    0xFF, 0xC4, 0x00, 0x14, 0x10,                         // DHT AC 0
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x00,
+    0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x00, // SOS
+    0x03, 0x00, 0x00, 0x3F, 0x00,
+    0x03,      // Y, Cb, Cr: DC diff 0 + EOB each, padded with 1s
+    0xFF, 0xD9 // EOI
+};
+
+// Captured API responses, trimmed to a single result but otherwise as the
+// services send them: the filters have to skip everything not kept.
+static const char REPLAY_MB_SEARCH[] = R"json({"created":"2025-11-02T18:21:07.412Z","count":1,"offset":0,"releases":[{"id":"52709206-8816-3c12-9ff6-13c5e5d7c9c1","score":100,"status-id":"4e304316-386d-3409-af2e-78857eec5cfe","packaging-id":"ec27701a-4a22-37f4-bfac-6616e0f9750a","artist-credit-id":"b1b9e9c3-5ea4-3a8e-a0bb-e3f6f8c2e8a2","count":1,"title":"OK Computer","status":"Official","packaging":"Jewel Case","text-representation":{"language":"eng","script":"Latn"},"artist-credit":[{"name":"Radiohead","artist":{"id":"a74b1b7f-71a5-4011-9441-d0b5e4122711","name":"Radiohead","sort-name":"Radiohead","aliases":[{"sort-name":"R.H.","name":"R.H.","locale":null,"type":null,"primary":null,"begin-date":null,"end-date":null}]}}],"release-group":{"id":"b1392450-e666-3926-a536-22c65f834433","type-id":"f529b476-6e62-324f-b0aa-1f3e33d313fc","primary-type-id":"f529b476-6e62-324f-b0aa-1f3e33d313fc","title":"OK Computer","primary-type":"Album"},"release-events":[{"date":"1997-05-21","area":{"id":"8a754a16-0027-3a29-b6d7-2b40ea0481ed","name":"United Kingdom","sort-name":"United Kingdom","iso-3166-1-codes":["GB"]}}],"barcode":"724385522925","asin":"B000002UJQ","label-info":[{"catalog-number":"CDNODATA 02","label":{"id":"df7d1c7f-ef95-425f-8eef-445b3d7bcbd9","name":"Parlophone"}}],"track-count":12,"media":[{"format":"CD","disc-count":1,"track-count":12}]}]})json";
+
+static const char REPLAY_DISCOGS_SEARCH[] = R"json({"pagination":{"page":1,"pages":1,"per_page":1,"items":1,"urls":{}},"results":[{"country":"US","year":"1968","format":["Vinyl","LP","Album","Stereo"],"label":["Columbia"],"type":"release","genre":["Rock","Pop"],"style":["Folk Rock","Soft Rock"],"id":1462853,"barcode":["0 7464-09529-2 3","KCS 9529"],"user_data":{"in_wantlist":false,"in_collection":false},"master_id":24146,"master_url":"https://api.discogs.com/masters/24146","uri":"/release/1462853-Simon-Garfunkel-Bookends","catno":"KCS 9529","title":"Simon &amp; Garfunkel - Bookends","thumb":"https://i.discogs.com/thumb.jpeg","cover_image":"https://i.discogs.com/cover.jpeg","resource_url":"https://api.discogs.com/releases/1462853","community":{"want":512,"have":9321},"format_quantity":1,"formats":[{"name":"Vinyl","qty":"1","descriptions":["LP","Album","Stereo"]}]}]})json";
+
+static const char REPLAY_DISCOGS_EMPTY[] = R"json({"pagination":{"page":1,"pages":0,"per_page":1,"items":0,"urls":{}},"results":[]})json";
+
+static const char REPLAY_BOOKS_VOLUME[] = R"json({
+  "kind": "books#volumes",
+  "totalItems": 1,
+  "items": [
+    {
+      "kind": "books#volume",
+      "id": "5wBQEp6ruIAC",
+      "etag": "x5y0qDtGk2M",
+      "selfLink": "https://www.googleapis.com/books/v1/volumes/5wBQEp6ruIAC",
+      "volumeInfo": {
+        "title": "The Pragmatic Programmer",
+        "subtitle": "From Journeyman to Master",
+        "authors": ["Andrew Hunt", "David Thomas"],
+        "publisher": "Addison-Wesley Professional",
+        "publishedDate": "1999-10-20",
+        "description": "Straight from the programming trenches, The Pragmatic Programmer cuts through the increasing specialization and technicalities of modern software development to examine the core process.",
+        "industryIdentifiers": [
+          {"type": "ISBN_10", "identifier": "020161622X"},
+          {"type": "ISBN_13", "identifier": "9780201616224"}
+        ],
+        "readingModes": {"text": false, "image": true},
+        "pageCount": 352,
+        "printType": "BOOK",
+        "categories": ["Computers"],
+        "averageRating": 4.5,
+        "ratingsCount": 38,
+        "maturityRating": "NOT_MATURE",
+        "imageLinks": {
+          "smallThumbnail": "http://books.google.com/books/content?id=5wBQEp6ruIAC&printsec=frontcover&img=1&zoom=5&source=gbs_api",
+          "thumbnail": "http://books.google.com/books/content?id=5wBQEp6ruIAC&printsec=frontcover&img=1&zoom=1&source=gbs_api"
+        },
+        "language": "en"
+      },
+      "saleInfo": {"country": "DE", "saleability": "NOT_FOR_SALE", "isEbook": false},
+      "accessInfo": {"country": "DE", "viewability": "PARTIAL", "embeddable": true, "publicDomain": false},
+      "searchInfo": {"textSnippet": "Straight from the programming trenches, <b>The Pragmatic Programmer</b> cuts through ..."}
+    }
+  ]
+}
+)json";
+
+static const char REPLAY_BOOKS_EMPTY[] = R"json({
+  "kind": "books#volumes",
+  "totalItems": 0
+}
+)json";
+
+static const char REPLAY_MB_RELEASE[] = R"json({"id":"3a5fc8a5-12ea-4f4b-a8c5-4a3b7b5cf0b5","title":"Songs &amp; Sketches","status":"Official","quality":"normal","barcode":"5099902988627","date":"2009-03-02","country":"XE","cover-art-archive":{"artwork":true,"count":3,"front":true,"back":true,"darkened":false},"genres":[{"name":"bonus tracks","count":4,"disambiguation":"","id":"00000000-0000-0000-0000-000000000001"},{"name":"art pop","count":2,"disambiguation":"","id":"00000000-0000-0000-0000-000000000002"}],"tags":[{"name":"art pop","count":2}],"release-group":{"id":"d5b3a1f2-63cc-4d55-91e8-1b0b2b4c2f6e","title":"Songs & Sketches","primary-type":"Album","secondary-types":[],"genres":[],"tags":[]},"media":[{"position":1,"format":"CD","title":"","track-offset":0,"track-count":2,"tracks":[{"id":"9d1f2b6e-0001-4e0e-8a3e-7a1d2f9c0001","position":1,"number":"1","title":"opening &amp; close","length":201000,"recording":{"id":"1c0b7e4a-0001-4a4c-9d0e-2f6b8e7a0001","title":"Opening & Close","length":201333,"video":false,"disambiguation":"","first-release-date":"2009-03-02"}},{"id":"9d1f2b6e-0002-4e0e-8a3e-7a1d2f9c0002","position":2,"number":"2","title":"Second Song","length":187000,"recording":{"id":"1c0b7e4a-0002-4a4c-9d0e-2f6b8e7a0002","title":"Second Song","length":187500,"video":false,"disambiguation":"","first-release-date":"2009-03-02"}}]},{"position":2,"format":"CD","title":"Sketches","track-offset":0,"track-count":1,"tracks":[{"id":"9d1f2b6e-0003-4e0e-8a3e-7a1d2f9c0003","position":1,"number":"1","title":"Demo","length":95000,"recording":{"id":"1c0b7e4a-0003-4a4c-9d0e-2f6b8e7a0003","title":"Demo","length":95040,"video":false,"disambiguation":"demo","first-release-date":"2009-03-02"}}]}]})json";
+
+// Serves a captured body as if it came off a socket: in small, uneven
+// reads, and "disconnected" once everything has been read.
+class ReplayClient : public Client {
+public:
+  ReplayClient(const char *data, size_t len, size_t step = 61)
+      : _data(data), _len(len), _step(step) {}
+
+  int connect(IPAddress ip, uint16_t port) { return 0; }
+  int connect(const char *host, uint16_t port) { return 0; }
+  int connect(IPAddress ip, uint16_t port, int32_t timeout) { return 0; }
+  int connect(const char *host, uint16_t port, int32_t timeout) { return 0; }
+  size_t write(uint8_t) { return 0; }
+  size_t write(const uint8_t *buf, size_t size) { return 0; }
+  int available() { return _len - _pos; }
+  int read() { return _pos < _len ? (uint8_t)_data[_pos++] : -1; }
+  int read(uint8_t *buf, size_t size) {
+    size_t n = size < _step ? size : _step;
+    if (n > _len - _pos)
+      n = _len - _pos;
+    memcpy(buf, _data + _pos, n);
+    _pos += n;
+    return n;
+  }
+  int peek() { return _pos < _len ? (uint8_t)_data[_pos] : -1; }
+  void flush() {}
+  void stop() { _pos = _len; }
+  uint8_t connected() { return _pos < _len; }
+  operator bool() { return true; }
+
+private:
+  const char *_data;
+  size_t _len;
+  size_t _step;
+  size_t _pos = 0;
+};
+
 class StorageTests {
 public:
   static String runTests() {
@@ -192,6 +314,10 @@ public:
       runAssert(false, "Load Tracklist Failed");
     }
 
+    runReplaySuite(log, runAssert);
+    runJournalSuite(log, runAssert);
+    runCoverStoreSuite(log, runAssert);
+
     // --- FINAL CLEANUP ---
     log += "\n[Final Cleanup]\n";
     Storage.deleteItem("TEST_CD_RENAMED", MODE_CD);
@@ -208,6 +334,358 @@ public:
 
     return log;
   }
+
+private:
+  typedef std::function<void(bool, String)> Check;
+
+  // Chunked transfer coding of `body`, `size` bytes per chunk; the first
+  // chunk carries an extension, which the reader must skip
+  static PsramString chunked(const char *body, size_t len, size_t size) {
+    PsramString out;
+    char header[24];
+    for (size_t pos = 0; pos < len; pos += size) {
+      size_t n = len - pos < size ? len - pos : size;
+      snprintf(header, sizeof(header), pos == 0 ? "%x;name=v\r\n" : "%X\r\n",
+               (unsigned)n);
+      out += header;
+      out.append(body + pos, n);
+      out += "\r\n";
+    }
+    out += "0\r\n\r\n";
+    return out;
+  }
+
+  // MusicBrainz release with `count` tracks, padded like the real thing
+  static PsramString bigRelease(int count) {
+    PsramString out = "{\"id\":\"big\",\"title\":\"Box\",\"media\":[{"
+                      "\"position\":1,\"format\":\"CD\",\"tracks\":[";
+    char track[320];
+    for (int i = 1; i <= count; i++) {
+      snprintf(track, sizeof(track),
+               "%s{\"id\":\"00000000-0000-4000-8000-%012d\",\"position\":%d,"
+               "\"number\":\"%d\",\"title\":\"Track %d\",\"length\":%d,"
+               "\"recording\":{\"id\":\"10000000-0000-4000-8000-%012d\","
+               "\"title\":\"Track %d\",\"length\":%d,\"video\":false,"
+               "\"disambiguation\":\"\",\"first-release-date\":\"2001\"}}",
+               i > 1 ? "," : "", i, i, i, i, 180000 + i, i, i, 180000 + i);
+      out += track;
+    }
+    out += "]}]}";
+    return out;
+  }
+
+  // Runs `fn` with the card selected, under i2cMutex as Storage does
+  static void onCard(const std::function<void()> &fn) {
+    if (i2cMutex)
+      LOCK_TAKE(i2cMutex, portMAX_DELAY);
+    if (sdExpander)
+      sdExpander->digitalWrite(SD_CS, LOW);
+    fn();
+    if (sdExpander)
+      sdExpander->digitalWrite(SD_CS, HIGH);
+    if (i2cMutex)
+      LOCK_GIVE(i2cMutex);
+  }
+
+  static void writeFile(const char *path, const String &text) {
+    onCard([&]() {
+      File file = SD.open(path, FILE_WRITE);
+      if (file) {
+        file.print(text);
+        file.close();
+      }
+    });
+  }
+
+  static String readFile(const String &path) { // "" if missing
+    String text;
+    onCard([&]() {
+      File file = SD.open(path, FILE_READ);
+      if (file) {
+        text = file.readString();
+        file.close();
+      }
+    });
+    return text;
+  }
+
+  static bool fileExists(const String &path) {
+    bool exists = false;
+    onCard([&]() { exists = SD.exists(path); });
+    return exists;
+  }
+
+  // Batch journal for one CD (JOURNAL_TEST_ID) titled `title`, as
+  // commitBatch() writes it, with or without the commit line
+  static String journal(const char *title, bool commit) {
+    char line[192];
+    String out;
+    snprintf(line, sizeof(line), "{\"mode\":%d,\"count\":1}\n",
+             (int)MODE_CD);
+    out += line;
+    snprintf(line, sizeof(line),
+             "{\"title\":\"%s\",\"artist\":\"Journal\",\"uniqueID\":\"%s\","
+             "\"ledIndices\":[7],\"oldUniqueID\":\"\"}\n",
+             title, JOURNAL_TEST_ID);
+    out += line;
+    if (commit)
+      out += "{\"commit\":1}\n";
+    return out;
+  }
+
+  static int indexCount(const char *uniqueID) {
+    int count = 0;
+    for (const auto &item : Storage.getVectorForMode(MODE_CD)) {
+      if (item.uniqueID == uniqueID)
+        count++;
+    }
+    return count;
+  }
+
+  // Crash recovery: journals as a reset leaves them, and the index as
+  // rewriteIndex() leaves it between removing the old file and renaming
+  static void runJournalSuite(String &log, const Check &check) {
+    log += "\n[Batch Journal Suite]\n";
+    String detail = String("/db/cds/") + JOURNAL_TEST_ID + ".json";
+
+    // Committed, not yet applied
+    writeFile(BATCH_JOURNAL_PATH, journal("Journal Replayed", true));
+    check(Storage.recoverBatch(), "Committed journal recovered");
+    check(!fileExists(BATCH_JOURNAL_PATH), "Replayed journal removed");
+    CD cd;
+    check(Storage.loadCDDetail(JOURNAL_TEST_ID, cd) &&
+              cd.title == "Journal Replayed" && cd.ledIndices.size() == 1 &&
+              cd.ledIndices[0] == 7,
+          "Journal entry applied");
+    check(indexCount(JOURNAL_TEST_ID) == 1, "Journal entry indexed");
+    String applied = readFile(detail);
+
+    // Committed and already applied (reset before the journal was removed)
+    writeFile(BATCH_JOURNAL_PATH, journal("Journal Replayed", true));
+    check(Storage.recoverBatch(), "Applied journal recovered");
+    check(readFile(detail) == applied && applied.length() > 0,
+          "Second replay leaves the item as it was");
+    check(indexCount(JOURNAL_TEST_ID) == 1, "Second replay adds no entry");
+
+    // Cut before the commit line, and torn inside it
+    const String torn[] = {journal("Torn Title", false),
+                           journal("Torn Title", false) + "{\"comm"};
+    for (const String &text : torn) {
+      writeFile(BATCH_JOURNAL_PATH, text);
+      check(Storage.recoverBatch(), "Uncommitted journal recovered");
+      check(!fileExists(BATCH_JOURNAL_PATH), "Uncommitted journal dropped");
+      check(readFile(detail) == applied, "Uncommitted journal not applied");
+    }
+
+    // Only the .tmp index left
+    String index = "/db/cd_index.jsonl";
+    String tmp = index + ".tmp";
+    check(Storage.rewriteIndex(MODE_CD), "Index rewritten");
+    onCard([&]() {
+      if (SD.exists(tmp))
+        SD.remove(tmp);
+      SD.rename(index, tmp);
+    });
+    check(Storage.loadIndex(MODE_CD), "Index loaded with only .tmp left");
+    check(fileExists(index) && !fileExists(tmp), "Index restored from .tmp");
+    check(indexCount(JOURNAL_TEST_ID) == 1, "Restored index complete");
+
+    Storage.deleteItem(JOURNAL_TEST_ID, MODE_CD);
+    check(!fileExists(detail), "Cleanup journal CD");
+  }
+
+  // Reference counting of the content-addressed store: what ingest() hands
+  // out, sharing, retarget, and removal with the last reference
+  static void runCoverStoreSuite(String &log, const Check &check) {
+    log += "\n[Cover Store Suite]\n";
+    check(CoverStore::ingest((const uint8_t *)"<html>", 6, "") == "",
+          "Non-JPEG rejected");
+
+    String a = CoverStore::ingest(TEST_JPEG, sizeof(TEST_JPEG),
+                                  "test://cover-a");
+    check(CoverStore::isStoreFile(a) && fileExists("/covers/" + a),
+          "Cover ingested");
+    check(CoverStore::getRefs(a) == 1, "Ingest holds the caller's reference");
+    check(CoverStore::ingest(TEST_JPEG, sizeof(TEST_JPEG), "test://cover-a2") ==
+                  a &&
+              CoverStore::getRefs(a) == 2,
+          "Same bytes stored once, second reference");
+    check(CoverStore::findByUrl("test://cover-a2") == a, "Found by URL");
+
+    CoverStore::retain(a);
+    CoverStore::release(a);
+    CoverStore::release(a);
+    check(CoverStore::getRefs(a) == 1 && fileExists("/covers/" + a),
+          "Shared cover kept while referenced");
+
+    // Bytes after EOI: same image, different hash
+    uint8_t variant[sizeof(TEST_JPEG) + 1];
+    memcpy(variant, TEST_JPEG, sizeof(TEST_JPEG));
+    variant[sizeof(TEST_JPEG)] = 0;
+    String b = CoverStore::ingest(variant, sizeof(variant), "test://cover-b");
+    check(CoverStore::isStoreFile(b) && b != a, "Second cover ingested");
+
+    CoverStore::retarget(b, b);
+    check(CoverStore::getRefs(b) == 1, "Retarget to itself changes nothing");
+    CoverStore::retarget(a, b);
+    check(CoverStore::getRefs(b) == 2, "Retarget takes the new reference");
+    check(CoverStore::getRefs(a) == -1 && !fileExists("/covers/" + a),
+          "Retarget released the old cover's last reference");
+
+    CoverStore::release(b);
+    CoverStore::release(b);
+    check(CoverStore::getRefs(b) == -1 && !fileExists("/covers/" + b),
+          "Last release removes the file");
+    check(CoverStore::findByUrl("test://cover-b") == "",
+          "Removed cover not found by URL");
+    CoverStore::flush();
+  }
+
+  // Captured responses through HttpBodyStream and the lookup filters, in
+  // each framing a server may use
+  static void runReplaySuite(String &log, const Check &check) {
+    log += "\n[API Replay Suite]\n";
+
+    // MusicBrainz barcode search, Content-Length
+    {
+      ReplayClient client(REPLAY_MB_SEARCH, strlen(REPLAY_MB_SEARCH));
+      HttpBodyStream body(client, strlen(REPLAY_MB_SEARCH), false);
+      MBRelease r;
+      r.year = 0;
+      bool ok = !MediaManager::parseReleaseSearch(body, r);
+      check(ok && r.success, "MB search (length) parsed");
+      check(r.releaseMbid == "52709206-8816-3c12-9ff6-13c5e5d7c9c1" &&
+                r.title == "Ok Computer" && r.artist == "Radiohead",
+            "MB search fields");
+      check(r.year == 1997, "MB year from release-events");
+      check(body.finish(), "MB search (length) socket reusable");
+    }
+
+    // Same response, chunked
+    {
+      PsramString wire =
+          chunked(REPLAY_MB_SEARCH, strlen(REPLAY_MB_SEARCH), 100);
+      ReplayClient client(wire.data(), wire.size());
+      HttpBodyStream body(client, -1, true);
+      MBRelease r;
+      r.year = 0;
+      bool ok = !MediaManager::parseReleaseSearch(body, r);
+      check(ok && r.title == "Ok Computer" && r.year == 1997,
+            "MB search (chunked) parsed");
+      check(body.finish() && body.bytesRead() == strlen(REPLAY_MB_SEARCH),
+            "MB search (chunked) framing consumed");
+    }
+
+    // Discogs search, close-delimited
+    {
+      ReplayClient client(REPLAY_DISCOGS_SEARCH, strlen(REPLAY_DISCOGS_SEARCH));
+      HttpBodyStream body(client, -1, false);
+      MBRelease r;
+      r.year = 0;
+      bool ok = !MediaManager::parseDiscogsSearch(body, r);
+      check(ok && r.success, "Discogs (close) parsed");
+      check(r.releaseMbid == "discogs_1462853" &&
+                r.artist == "Simon & Garfunkel" && r.title == "Bookends",
+            "Discogs title split, entities decoded");
+      check(r.year == 1968 && r.genre == "Rock", "Discogs year and genre");
+      check(!body.finish() && body.complete(),
+            "Discogs (close) complete, socket not reused");
+    }
+    {
+      ReplayClient client(REPLAY_DISCOGS_EMPTY, strlen(REPLAY_DISCOGS_EMPTY));
+      HttpBodyStream body(client, strlen(REPLAY_DISCOGS_EMPTY), false);
+      MBRelease r;
+      r.year = 0;
+      bool ok = !MediaManager::parseDiscogsSearch(body, r);
+      check(ok && !r.success && r.notFound, "Discogs no results = not found");
+    }
+
+    // Google Books, chunked (as Google serves it)
+    {
+      PsramString wire =
+          chunked(REPLAY_BOOKS_VOLUME, strlen(REPLAY_BOOKS_VOLUME), 512);
+      ReplayClient client(wire.data(), wire.size());
+      HttpBodyStream body(client, -1, true);
+      Book b;
+      bool notFound = true;
+      bool ok = !MediaManager::parseBookVolume(body, "9780201616224", b,
+                                               notFound);
+      check(ok && !notFound, "Books (chunked) parsed");
+      check(b.title == "The Pragmatic Programmer" &&
+                b.author == "Andrew Hunt" && b.genre == "Computers",
+            "Books fields");
+      check(b.year == 1999 && b.pageCount == 352 &&
+                b.publisher == "Addison-Wesley Professional",
+            "Books year, pages, publisher");
+      check(String(b.coverUrl.c_str()).indexOf("zoom=1") > 0,
+            "Books thumbnail kept");
+      check(body.finish(), "Books (chunked) socket reusable");
+    }
+    {
+      ReplayClient client(REPLAY_BOOKS_EMPTY, strlen(REPLAY_BOOKS_EMPTY));
+      HttpBodyStream body(client, strlen(REPLAY_BOOKS_EMPTY), false);
+      Book b;
+      bool notFound = false;
+      bool ok = !MediaManager::parseBookVolume(body, "0000000000", b,
+                                               notFound);
+      check(ok && notFound, "Books totalItems 0 = not found");
+    }
+
+    // MusicBrainz release with recordings, two discs
+    {
+      ReplayClient client(REPLAY_MB_RELEASE, strlen(REPLAY_MB_RELEASE));
+      HttpBodyStream body(client, strlen(REPLAY_MB_RELEASE), false);
+      std::vector<Track> tracks;
+      String genre;
+      bool truncated = true;
+      bool ok =
+          !MediaManager::parseTracklist(body, tracks, &genre, truncated);
+      check(ok && !truncated && tracks.size() == 3, "Tracklist parsed");
+      if (tracks.size() == 3) {
+        check(tracks[0].title == "Opening & Close" &&
+                  tracks[0].durationMs == 201333 &&
+                  tracks[0].recordingMbid ==
+                      "1c0b7e4a-0001-4a4c-9d0e-2f6b8e7a0001",
+              "Tracklist track fields from the recording");
+        check(tracks[2].title == "Demo" && tracks[2].trackNo == 1,
+              "Tracklist second disc");
+      }
+      check(genre == "Art Pop", "Tracklist genre skips blacklisted tags");
+      check(body.finish(), "Tracklist socket reusable");
+    }
+
+    // Box set past TRACKLIST_JSON_DOC_SIZE, chunked: the tracks that fit are
+    // kept
+    {
+      const int count = 600;
+      PsramString json = bigRelease(count);
+      PsramString wire = chunked(json.data(), json.size(), 4000);
+      ReplayClient client(wire.data(), wire.size(), 1460);
+      HttpBodyStream body(client, -1, true, 30000);
+      std::vector<Track> tracks;
+      bool truncated = false;
+      bool ok = !MediaManager::parseTracklist(body, tracks, nullptr, truncated);
+      check(ok && truncated, "Oversized tracklist flagged truncated");
+      check(tracks.size() > 100 && tracks.size() < (size_t)count,
+            "Oversized tracklist keeps " + String((int)tracks.size()) +
+                " tracks");
+      check(!tracks.empty() && tracks[0].title == "Track 1",
+            "Oversized tracklist starts at track 1");
+      log += "  (" + String((int)json.size()) + " byte body)\n";
+    }
+
+    // Content-Length promising more than arrives
+    {
+      size_t len = strlen(REPLAY_MB_SEARCH);
+      ReplayClient client(REPLAY_MB_SEARCH, len / 2);
+      HttpBodyStream body(client, len, false, 100);
+      MBRelease r;
+      r.year = 0;
+      bool failed = (bool)MediaManager::parseReleaseSearch(body, r);
+      check(failed && !r.success, "Cut-off body fails to parse");
+      check(!body.finish(), "Cut-off body not reused");
+    }
+  }
 };
 
 #endif
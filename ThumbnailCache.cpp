@@ -0,0 +1,217 @@
+#include <Arduino.h>
+#include <ESP_IOExpander_Library.h>
+#include <SD.h>
+#include <TJpg_Decoder.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "AppGlobals.h"
+#include "LockProfiler.h"
+#include "ThumbnailCache.h"
+#include "TraceRecorder.h"
+#include "waveshare_sd_card.h"
+
+// Static members
+ThumbnailCache::Slot ThumbnailCache::_slots[THUMB_CACHE_SLOTS];
+uint16_t *ThumbnailCache::_pixels = nullptr;
+uint32_t ThumbnailCache::_clock = 0;
+uint32_t ThumbnailCache::_hits = 0;
+uint32_t ThumbnailCache::_misses = 0;
+
+#define THUMB_PIXELS (THUMB_SIZE * THUMB_SIZE)
+
+// Decoder target (one decode at a time, see header)
+static uint16_t *_thumbTarget = nullptr;
+
+static bool thumb_output(int16_t x, int16_t y, uint16_t w, uint16_t h,
+                         uint16_t *bitmap) {
+  if (!_thumbTarget || y >= THUMB_SIZE)
+    return false;
+  int16_t out_w = w;
+  if (x + w > THUMB_SIZE)
+    out_w = THUMB_SIZE - x;
+  int16_t out_h = h;
+  if (y + h > THUMB_SIZE)
+    out_h = THUMB_SIZE - y;
+  if (out_w <= 0 || x < 0 || y < 0)
+    return true;
+
+  for (int16_t j = 0; j < out_h; j++) {
+    memcpy(&_thumbTarget[(y + j) * THUMB_SIZE + x], &bitmap[j * w], out_w * 2);
+  }
+  return true;
+}
+
+bool ThumbnailCache::init() {
+  if (_pixels)
+    return true;
+
+  _pixels = (uint16_t *)heap_caps_malloc(
+      THUMB_CACHE_SLOTS * THUMB_PIXELS * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+  if (!_pixels) {
+    Serial.println("ThumbnailCache: Failed to allocate PSRAM pool");
+    return false;
+  }
+
+  for (int i = 0; i < THUMB_CACHE_SLOTS; i++) {
+    Slot &s = _slots[i];
+    s.key.clear();
+    s.valid = false;
+    s.failed = false;
+    s.lastUse = 0;
+    s.dsc.header.always_zero = 0;
+    s.dsc.header.w = THUMB_SIZE;
+    s.dsc.header.h = THUMB_SIZE;
+    s.dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    s.dsc.data_size = THUMB_PIXELS * sizeof(uint16_t);
+    s.dsc.data = (const uint8_t *)&_pixels[i * THUMB_PIXELS];
+  }
+  return true;
+}
+
+int ThumbnailCache::findSlot(const String &coverFile) {
+  for (int i = 0; i < THUMB_CACHE_SLOTS; i++) {
+    if ((_slots[i].valid || _slots[i].failed) &&
+        _slots[i].key == coverFile.c_str())
+      return i;
+  }
+  return -1;
+}
+
+int ThumbnailCache::evictSlot() {
+  int victim = 0;
+  for (int i = 0; i < THUMB_CACHE_SLOTS; i++) {
+    if (!_slots[i].valid && !_slots[i].failed)
+      return i; // Free slot
+    if (_slots[i].lastUse < _slots[victim].lastUse)
+      victim = i;
+  }
+  return victim;
+}
+
+const lv_img_dsc_t *ThumbnailCache::get(const String &coverFile) {
+  if (!_pixels || coverFile.length() == 0)
+    return nullptr;
+  int i = findSlot(coverFile);
+  if (i < 0 || !_slots[i].valid)
+    return nullptr;
+  _slots[i].lastUse = ++_clock;
+  _hits++;
+  return &_slots[i].dsc;
+}
+
+bool ThumbnailCache::hasFailed(const String &coverFile) {
+  int i = findSlot(coverFile);
+  return i >= 0 && _slots[i].failed;
+}
+
+const lv_img_dsc_t *ThumbnailCache::load(const String &coverFile) {
+  if (!_pixels && !init())
+    return nullptr;
+  if (coverFile.length() == 0)
+    return nullptr;
+
+  int i = findSlot(coverFile);
+  if (i >= 0) {
+    _slots[i].lastUse = ++_clock;
+    if (_slots[i].failed)
+      return nullptr;
+    _hits++;
+    return &_slots[i].dsc;
+  }
+
+  _misses++;
+  i = evictSlot();
+  Slot &s = _slots[i];
+  s.key = coverFile.c_str();
+  s.lastUse = ++_clock;
+  s.valid = decodeInto(coverFile, (uint16_t *)s.dsc.data);
+  s.failed = !s.valid;
+  return s.valid ? &s.dsc : nullptr;
+}
+
+bool ThumbnailCache::decodeInto(const String &coverFile, uint16_t *pixels) {
+  TRACE_SCOPE("thumb.decode");
+  // Container background (0x333333 -> 0x3186 in RGB565), as on the main screen
+  for (int i = 0; i < THUMB_PIXELS; i++)
+    pixels[i] = 0x3186;
+
+  uint8_t *jpg_data = nullptr;
+  size_t jpg_size = 0;
+
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(200)) == pdPASS) {
+    if (sdExpander)
+      sdExpander->digitalWrite(SD_CS, LOW);
+
+    File f = SD.open("/covers/" + coverFile, FILE_READ);
+    if (f) {
+      jpg_size = f.size();
+      jpg_data = (uint8_t *)heap_caps_malloc(jpg_size, MALLOC_CAP_SPIRAM);
+      if (jpg_data && f.read(jpg_data, jpg_size) != jpg_size) {
+        heap_caps_free(jpg_data);
+        jpg_data = nullptr;
+      }
+      f.close();
+    }
+
+    if (sdExpander)
+      sdExpander->digitalWrite(SD_CS, HIGH);
+    LOCK_GIVE(i2cMutex);
+  }
+
+  if (!jpg_data)
+    return false;
+
+  uint16_t w = 0, h = 0;
+  bool ok = false;
+  if (jpegMutex)
+    LOCK_TAKE(jpegMutex, portMAX_DELAY);
+  if (TJpgDec.getJpgSize(&w, &h, jpg_data, jpg_size) == JDR_OK && w > 0 &&
+      h > 0) {
+    uint8_t scale = 1;
+    while (scale < 8 && (w / scale > THUMB_SIZE || h / scale > THUMB_SIZE))
+      scale *= 2;
+
+    int off_x = (THUMB_SIZE - w / scale) / 2;
+    int off_y = (THUMB_SIZE - h / scale) / 2;
+    if (off_x < 0)
+      off_x = 0;
+    if (off_y < 0)
+      off_y = 0;
+
+    _thumbTarget = pixels;
+    TJpgDec.setJpgScale(scale);
+    TJpgDec.setSwapBytes(false);
+    TJpgDec.setCallback(thumb_output);
+    ok = TJpgDec.drawJpg(off_x, off_y, jpg_data, jpg_size) == JDR_OK;
+    _thumbTarget = nullptr;
+  }
+  if (jpegMutex)
+    LOCK_GIVE(jpegMutex);
+
+  heap_caps_free(jpg_data);
+  return ok;
+}
+
+void ThumbnailCache::dropFailed() {
+  for (int i = 0; i < THUMB_CACHE_SLOTS; i++) {
+    if (_slots[i].failed) {
+      _slots[i].key.clear();
+      _slots[i].failed = false;
+      _slots[i].lastUse = 0;
+    }
+  }
+}
+
+void ThumbnailCache::clear() {
+  for (int i = 0; i < THUMB_CACHE_SLOTS; i++) {
+    _slots[i].key.clear();
+    _slots[i].valid = false;
+    _slots[i].failed = false;
+    _slots[i].lastUse = 0;
+  }
+}
+
+uint32_t ThumbnailCache::getHits() { return _hits; }
+uint32_t ThumbnailCache::getMisses() { return _misses; }
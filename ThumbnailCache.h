@@ -0,0 +1,64 @@
+#ifndef THUMBNAIL_CACHE_H
+#define THUMBNAIL_CACHE_H
+
+#include "Core_Data.h"
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Pre-decoded cover thumbnails for the grid browser.
+//
+// A fixed PSRAM pool of THUMB_CACHE_SLOTS RGB565 tiles (THUMB_SIZE square),
+// keyed by cover file name and evicted least-recently-used. 120px is the 1/2
+// TJpgDec scale of a normalized 240px cover, so a decode costs a quarter of a
+// full-size one. Content-addressed covers shared by several items occupy a
+// single slot.
+//
+// Not thread safe: call from the LVGL task (or with lvgl_port_lock held).
+// Decodes take jpegMutex, which the shared TJpgDec instance is used under.
+
+#define THUMB_SIZE 120
+#define THUMB_CACHE_SLOTS 48 // ~1.4MB PSRAM; must exceed visible grid cells
+
+class ThumbnailCache {
+public:
+  static bool init();
+
+  // Cached thumbnail, or nullptr. Never touches the SD card.
+  static const lv_img_dsc_t *get(const String &coverFile);
+
+  // Cached thumbnail, decoding from /covers/ on a miss. Returns nullptr if
+  // the file is missing or undecodable (remembered, so it isn't retried).
+  static const lv_img_dsc_t *load(const String &coverFile);
+
+  // True if load() already failed for this file.
+  static bool hasFailed(const String &coverFile);
+
+  // Forget negative entries (covers may have been downloaded since).
+  static void dropFailed();
+  static void clear();
+
+  // Stats
+  static uint32_t getHits();
+  static uint32_t getMisses();
+
+private:
+  struct Slot {
+    PsramString key;
+    uint32_t lastUse = 0;
+    bool valid = false;  // Pixels hold a decoded thumbnail
+    bool failed = false; // Decode failed; keeps the key as a negative entry
+    lv_img_dsc_t dsc;
+  };
+
+  static int findSlot(const String &coverFile);
+  static int evictSlot();
+  static bool decodeInto(const String &coverFile, uint16_t *pixels);
+
+  static Slot _slots[THUMB_CACHE_SLOTS];
+  static uint16_t *_pixels;
+  static uint32_t _clock;
+  static uint32_t _hits;
+  static uint32_t _misses;
+};
+
+#endif // THUMBNAIL_CACHE_H
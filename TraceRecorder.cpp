@@ -0,0 +1,145 @@
+#include "TraceRecorder.h"
+#include <esp_heap_caps.h>
+
+// Static members
+TraceEvent *TraceRecorder::_events = nullptr;
+std::atomic<uint32_t> TraceRecorder::_next[2];
+std::atomic<bool> TraceRecorder::_enabled(false);
+char TraceRecorder::_taskNames[TRACE_MAX_TASKS][16] = {};
+std::atomic<int> TraceRecorder::_taskCount(0);
+portMUX_TYPE TraceRecorder::_taskLock = portMUX_INITIALIZER_UNLOCKED;
+
+bool TraceRecorder::begin() {
+  if (_events)
+    return true;
+  _events = (TraceEvent *)heap_caps_calloc(
+      2 * TRACE_EVENTS_PER_CORE, sizeof(TraceEvent), MALLOC_CAP_SPIRAM);
+  if (!_events) {
+    Serial.println("Trace: no PSRAM for the event rings, tracing disabled");
+    return false;
+  }
+  _next[0] = 0;
+  _next[1] = 0;
+  return true;
+}
+
+void TraceRecorder::setEnabled(bool on) {
+  _enabled.store(on && _events != nullptr);
+  Serial.printf("Trace: recording %s\n", isEnabled() ? "on" : "off");
+}
+
+void TraceRecorder::clear() {
+  bool was = _enabled.exchange(false);
+  vTaskDelay(pdMS_TO_TICKS(2)); // Writers mid-record finish first
+  _next[0] = 0;
+  _next[1] = 0;
+  _enabled.store(was);
+}
+
+// Track of the calling task's name, given one on first use. Names past
+// TRACE_MAX_TASKS share the last track.
+uint8_t TraceRecorder::taskIndex() {
+  const char *self = pcTaskGetName(NULL);
+  const size_t len = sizeof(_taskNames[0]) - 1;
+  int n = _taskCount.load(std::memory_order_acquire);
+  for (int i = 0; i < n; i++) {
+    if (strncmp(_taskNames[i], self, len) == 0)
+      return i;
+  }
+
+  int found = TRACE_MAX_TASKS;
+  portENTER_CRITICAL(&_taskLock);
+  n = _taskCount.load(std::memory_order_relaxed);
+  for (int i = 0; i < n && found == TRACE_MAX_TASKS; i++) {
+    if (strncmp(_taskNames[i], self, len) == 0)
+      found = i;
+  }
+  if (found == TRACE_MAX_TASKS && n < TRACE_MAX_TASKS) {
+    strncpy(_taskNames[n], self, len);
+    _taskCount.store(n + 1, std::memory_order_release);
+    found = n;
+  }
+  portEXIT_CRITICAL(&_taskLock);
+  return found;
+}
+
+void TraceRecorder::record(char phase, const char *name, int64_t ts,
+                           uint16_t id) {
+  if (!_events)
+    return;
+  int core = xPortGetCoreID();
+  uint32_t slot = _next[core].fetch_add(1, std::memory_order_relaxed);
+  TraceEvent &e =
+      _events[core * TRACE_EVENTS_PER_CORE + slot % TRACE_EVENTS_PER_CORE];
+  e.ts = ts;
+  e.name = name;
+  e.phase = phase;
+  e.task = taskIndex();
+  e.id = id;
+}
+
+void TraceRecorder::writeJson(ChunkWriter &out) {
+  bool was = _enabled.exchange(false);
+  vTaskDelay(pdMS_TO_TICKS(2)); // Writers mid-record finish first
+
+  uint32_t first[2] = {0, 0};
+  uint32_t end[2] = {0, 0};
+  int64_t base = INT64_MAX;
+  for (int core = 0; core < 2 && _events; core++) {
+    end[core] = _next[core].load();
+    first[core] = end[core] > TRACE_EVENTS_PER_CORE
+                      ? end[core] - TRACE_EVENTS_PER_CORE
+                      : 0;
+    if (end[core] > first[core]) {
+      const TraceEvent &oldest =
+          _events[core * TRACE_EVENTS_PER_CORE +
+                  first[core] % TRACE_EVENTS_PER_CORE];
+      if (oldest.ts < base)
+        base = oldest.ts;
+    }
+  }
+
+  out.beginObject().key("displayTimeUnit").string("ms");
+  out.key("traceEvents").beginArray();
+
+  int tasks = _taskCount.load();
+  for (int i = 0; i <= tasks && i <= TRACE_MAX_TASKS; i++) {
+    out.beginObject().key("name").string("thread_name");
+    out.key("ph").string("M").key("pid").number(1).key("tid").number(i);
+    out.key("args").beginObject();
+    out.key("name").string(i < tasks ? _taskNames[i] : "other");
+    out.endObject().endObject();
+  }
+
+  // Times relative to the oldest event kept, in microseconds
+  char phase[2] = {0, 0};
+  for (int core = 0; core < 2 && _events; core++) {
+    for (uint32_t k = first[core]; k != end[core]; k++) {
+      const TraceEvent &e =
+          _events[core * TRACE_EVENTS_PER_CORE + k % TRACE_EVENTS_PER_CORE];
+      if (!e.name)
+        continue;
+      phase[0] = e.phase;
+      out.beginObject().key("name").string(e.name);
+      out.key("cat").string("librarian").key("ph").string(phase);
+      out.key("ts").number((unsigned long)(e.ts > base ? e.ts - base : 0));
+      out.key("pid").number(1).key("tid").number(e.task);
+      if (e.phase == 'b' || e.phase == 'e')
+        out.key("id").number(e.id);
+      out.endObject();
+    }
+  }
+  out.endArray().endObject();
+
+  _enabled.store(was);
+}
+
+TraceStats TraceRecorder::getStats() {
+  TraceStats s = {};
+  s.available = _events != nullptr;
+  s.enabled = isEnabled();
+  s.recorded[0] = _next[0].load();
+  s.recorded[1] = _next[1].load();
+  s.tasks = _taskCount.load();
+  return s;
+}
@@ -0,0 +1,94 @@
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include "ChunkWriter.h"
+#include <Arduino.h>
+#include <atomic>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+
+// Timeline of what every task was doing, downloadable as Chrome Trace JSON
+// (chrome://tracing, ui.perfetto.dev).
+//
+// Events go into one ring per core, in PSRAM. A writer claims its slot with
+// an atomic increment, so tasks on either core record without taking a
+// lock; once a ring is full the oldest events are overwritten. Recording is
+// off until enabled at runtime. Off, a TRACE_SCOPE costs one flag test.
+//
+// Names are static strings: the ring keeps the pointer. Tracks are per task
+// name, so short-lived tasks (provider races) come back to their name's track
+// and a recycled task handle never inherits another task's.
+//
+//   void update_item_display() {
+//     TRACE_SCOPE("ui.update_item_display");
+//     ...
+
+#define TRACE_EVENTS_PER_CORE 8192 // 16 bytes each
+#define TRACE_MAX_TASKS 24         // Task names given a track (tid) of their own
+
+struct TraceEvent {
+  int64_t ts;       // esp_timer_get_time()
+  const char *name;
+  char phase;       // 'B'/'E' nested on the task, 'b'/'e' async (by id)
+  uint8_t task;     // Index into the task table
+  uint16_t id;      // Async events: which span
+};
+
+struct TraceStats {
+  bool available; // Rings allocated
+  bool enabled;
+  uint32_t recorded[2]; // Per core since the last clear, overwritten included
+  int tasks;
+};
+
+class TraceRecorder {
+public:
+  // Allocates the rings; until then (or if PSRAM is short) nothing records
+  static bool begin();
+
+  static void setEnabled(bool on);
+  static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+  static void clear();
+
+  static void record(char phase, const char *name, int64_t ts,
+                     uint16_t id = 0);
+
+  // The rings, oldest first, as {"traceEvents":[...]}. Recording pauses
+  // while it runs.
+  static void writeJson(ChunkWriter &out);
+
+  static TraceStats getStats();
+
+private:
+  static uint8_t taskIndex();
+
+  static TraceEvent *_events; // Core 0 ring, then core 1
+  static std::atomic<uint32_t> _next[2];
+  static std::atomic<bool> _enabled;
+  static char _taskNames[TRACE_MAX_TASKS][16];
+  static std::atomic<int> _taskCount;
+  static portMUX_TYPE _taskLock;
+};
+
+// Begin/end pair around the enclosing scope, on the calling task's track
+class TraceScope {
+public:
+  explicit TraceScope(const char *name)
+      : _name(TraceRecorder::isEnabled() ? name : nullptr) {
+    if (_name)
+      TraceRecorder::record('B', _name, esp_timer_get_time());
+  }
+  ~TraceScope() {
+    if (_name)
+      TraceRecorder::record('E', _name, esp_timer_get_time());
+  }
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+
+private:
+  const char *_name;
+};
+
+#define TRACE_SCOPE(name) TraceScope _traceScope(name)
+
+#endif // TRACE_RECORDER_H
@@ -1,12 +1,18 @@
 #include "UIManager.h"
 #include "AppGlobals.h"
 #include "BackgroundWorker.h"
+#include "EventBus.h"
+#include "LockProfiler.h"
 #include "MediaManager.h"
+#include "Metrics.h"
 #include "NavigationCache.h"
 #include "NetworkManager.h"
 #include "Storage.h"
+#include "ThumbnailCache.h"
+#include "TraceRecorder.h"
 #include "UI_Styles.h"
 #include "Utils.h"
+#include "VirtualList.h"
 #include "Waveshare_ST7262_LVGL.h"
 #include "mode_abstraction.h"
 #include <Arduino.h>
@@ -101,6 +107,7 @@ lv_obj_t *btn_qr = NULL;
 lv_obj_t *label_qr = NULL;
 lv_obj_t *btn_restart_h = NULL;
 lv_obj_t *lbl_restart_h = NULL;
+lv_obj_t *btn_grid = NULL;
 
 // --- Modal Specific Objects ---
 // Search UI
@@ -162,6 +169,8 @@ void show_lyrics_popup(String trackTitle, String lyricsText);
 void close_lyrics_popup();
 void show_qr_ui();
 void close_qr_ui();
+void show_cover_grid_ui();
+void close_cover_grid_ui();
 void show_led_selector_ui(lv_obj_t *target_ta);
 void show_confirmation_popup(const char *title, const char *message,
                              lv_event_cb_t yes_cb, lv_event_cb_t no_cb,
@@ -324,9 +333,19 @@ void show_lyrics_popup(String trackTitle, String lyricsText) {
   lvgl_port_unlock();
 }
 
-static void trackClickHandler(lv_event_t *e) {
+// Per-panel tracklist state, owned by tracklist_panel (freed on delete)
+struct TracklistView {
+  TrackList *tl;
+  std::vector<int> rows; // Track indices shown (blank titles skipped)
+  String mbid;
+};
+
+static void trackClickHandler(int row, void *user_data) {
   Serial.println(">>> trackClickHandler CLICKED <<<");
-  Track *track = (Track *)lv_event_get_user_data(e);
+  TracklistView *view = (TracklistView *)user_data;
+  if (!view || row < 0 || row >= (int)view->rows.size())
+    return;
+  Track *track = &view->tl->tracks[view->rows[row]];
   int idx = getCurrentItemIndex();
 
   if (idx < 0 || idx >= (int)cdLibrary.size()) {
@@ -463,13 +482,24 @@ void show_tracklist_ui(int idx) {
   lv_obj_set_style_text_color(lblClose, lv_color_hex(0xff4444), 0);
 
   lv_obj_add_event_cb(
-      btnClose,
+      btnClose, [](lv_event_t *e) { close_tracklist_ui(); }, LV_EVENT_CLICKED,
+      NULL);
+
+  TracklistView *view = new TracklistView{trackList, {}, cd.releaseMbid.c_str()};
+  for (int i = 0; i < (int)trackList->tracks.size(); i++) {
+    const Track &track = trackList->tracks[i];
+    if (track.title.length() == 0 || track.title == " ")
+      continue;
+    view->rows.push_back(i);
+  }
+  lv_obj_add_event_cb(
+      tracklist_panel,
       [](lv_event_t *e) {
-        TrackList *tl = (TrackList *)lv_event_get_user_data(e);
-        close_tracklist_ui();
-        delete tl;
+        TracklistView *v = (TracklistView *)lv_event_get_user_data(e);
+        Storage.deleteTracklist(v->tl);
+        delete v;
       },
-      LV_EVENT_CLICKED, trackList);
+      LV_EVENT_DELETE, view);
 
   // Fetch All Lyrics button (Only for CDs)
   switch (currentMode) {
@@ -482,114 +512,104 @@ void show_tracklist_ui(int idx) {
     lv_label_set_text(lblFetchAll, LV_SYMBOL_DOWNLOAD);
     lv_obj_center(lblFetchAll);
 
-    char *mbidCopy = strdup(cd.releaseMbid.c_str());
     lv_obj_add_event_cb(
         btnFetchAll,
         [](lv_event_t *e) {
-          char *mbid = (char *)lv_event_get_user_data(e);
-          fetchAllLyrics(mbid);
-          free(mbid);
+          TracklistView *v = (TracklistView *)lv_event_get_user_data(e);
+          fetchAllLyrics(v->mbid.c_str());
         },
-        LV_EVENT_CLICKED, mbidCopy);
+        LV_EVENT_CLICKED, view);
   } break;
   default:
     break;
   }
 
-  lv_obj_t *container = lv_obj_create(tracklist_panel);
   int containerW = (int)(LV_HOR_RES * 0.55);
   int containerH = (int)(LV_VER_RES * 0.45);
-  lv_obj_set_size(container, containerW, containerH);
+  lv_obj_t *container = vlist_create(
+      tracklist_panel, containerW, containerH, 44,
+      // Row skeleton: [bell] N. Title ............ 3:45 icon
+      [](lv_obj_t *row, void *user_data) {
+        lv_obj_set_style_bg_color(row, lv_color_hex(0x2a2a2a), 0);
+        lv_obj_set_style_bg_opa(row, LV_OPA_COVER, 0);
+        lv_obj_set_style_radius(row, 4, 0);
+        lv_obj_set_style_border_color(row, lv_color_hex(getCurrentThemeColor()),
+                                      0);
+        lv_obj_set_style_border_width(row, 1, 0);
+
+        lv_obj_t *btn_fav = lv_btn_create(row);
+        lv_obj_set_size(btn_fav, 30, 30);
+        lv_obj_align(btn_fav, LV_ALIGN_LEFT_MID, 5, 0);
+        lv_obj_t *lbl_bell = lv_label_create(btn_fav);
+        lv_label_set_text(lbl_bell, LV_SYMBOL_BELL);
+        lv_obj_center(lbl_bell);
+        lv_obj_add_event_cb(
+            btn_fav,
+            [](lv_event_t *e) {
+              TracklistView *v = (TracklistView *)lv_event_get_user_data(e);
+              lv_obj_t *b = lv_event_get_target(e);
+              int r = vlist_get_row_index(b);
+              if (r < 0 || r >= (int)v->rows.size())
+                return;
+              Track &t = v->tl->tracks[v->rows[r]];
+              t.isFavoriteTrack = !t.isFavoriteTrack;
+
+              lv_obj_t *l = lv_obj_get_child(b, 0);
+              lv_obj_set_style_bg_color(
+                  b,
+                  t.isFavoriteTrack ? lv_color_hex(0xFFD700)
+                                    : lv_color_hex(0x555555),
+                  0);
+              lv_obj_set_style_text_color(l,
+                                          t.isFavoriteTrack
+                                              ? lv_color_hex(0x000000)
+                                              : lv_color_hex(0xCCCCCC),
+                                          0);
+              Storage.saveTracklist(v->mbid.c_str(), v->tl);
+            },
+            LV_EVENT_CLICKED, user_data);
+
+        lv_obj_t *lblLeft = lv_label_create(row);
+        lv_obj_align(lblLeft, LV_ALIGN_LEFT_MID, 50, 0);
+        lv_obj_set_width(lblLeft, (int)(LV_HOR_RES * 0.55) - 160);
+        lv_label_set_long_mode(lblLeft, LV_LABEL_LONG_DOT);
+
+        lv_obj_t *lblRight = lv_label_create(row);
+        lv_obj_align(lblRight, LV_ALIGN_RIGHT_MID, -10, 0);
+        lv_obj_set_style_text_color(lblRight,
+                                    lv_color_hex(getCurrentThemeColor()), 0);
+      },
+      // Bind
+      [](lv_obj_t *row, int r, void *user_data) {
+        TracklistView *v = (TracklistView *)user_data;
+        const Track &track = v->tl->tracks[v->rows[r]];
+
+        lv_obj_t *btn_fav = lv_obj_get_child(row, 0);
+        lv_obj_set_style_bg_color(btn_fav,
+                                  track.isFavoriteTrack
+                                      ? lv_color_hex(0xFFD700)
+                                      : lv_color_hex(0x555555),
+                                  0);
+        lv_obj_set_style_text_color(lv_obj_get_child(btn_fav, 0),
+                                    track.isFavoriteTrack
+                                        ? lv_color_hex(0x000000)
+                                        : lv_color_hex(0xCCCCCC),
+                                    0);
+
+        lv_label_set_text_fmt(
+            lv_obj_get_child(row, 1), "%d. %s", track.trackNo,
+            sanitizeText(String(track.title.c_str())).c_str());
+        lv_label_set_text_fmt(lv_obj_get_child(row, 2), "%s %s",
+                              formatDuration(track.durationMs).c_str(),
+                              getLyricsStatusIcon(track.lyrics.status.c_str()));
+      },
+      trackClickHandler, view);
   lv_obj_align(container, LV_ALIGN_BOTTOM_MID, 0, -10);
   lv_obj_set_style_bg_color(container, lv_color_hex(0x1a1a1a), 0);
   lv_obj_set_style_border_color(container, lv_color_hex(getCurrentThemeColor()),
                                 0);
   lv_obj_set_style_border_width(container, 1, 0);
-  lv_obj_set_flex_flow(container, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_scroll_dir(container, LV_DIR_VER);
-
-  for (int i = 0; i < (int)trackList->tracks.size(); i++) {
-    Track &track = trackList->tracks[i];
-    if (track.title.length() == 0 || track.title == " ")
-      continue;
-
-    const char *icon = getLyricsStatusIcon(track.lyrics.status.c_str());
-
-    lv_obj_t *btn = lv_btn_create(container);
-    lv_obj_set_width(btn, lv_pct(95));
-    lv_obj_set_height(btn, 40);
-    lv_obj_set_style_bg_color(btn, lv_color_hex(0x2a2a2a), 0);
-    lv_obj_set_style_border_color(btn, lv_color_hex(getCurrentThemeColor()), 0);
-    lv_obj_set_style_border_width(btn, 1, 0);
-
-    lv_obj_t *btn_fav = lv_btn_create(btn);
-    lv_obj_set_size(btn_fav, 30, 30);
-    lv_obj_align(btn_fav, LV_ALIGN_LEFT_MID, 5, 0);
-    lv_obj_set_style_bg_color(btn_fav,
-                              track.isFavoriteTrack ? lv_color_hex(0xFFD700)
-                                                    : lv_color_hex(0x555555),
-                              0);
-    lv_obj_t *lbl_bell = lv_label_create(btn_fav);
-    lv_label_set_text(lbl_bell, LV_SYMBOL_BELL);
-    lv_obj_center(lbl_bell);
-    lv_obj_set_style_text_color(lbl_bell,
-                                track.isFavoriteTrack ? lv_color_hex(0x000000)
-                                                      : lv_color_hex(0xCCCCCC),
-                                0);
-
-    struct TrackFavData {
-      int idx;
-      TrackList *tl;
-      String mbid;
-    };
-    TrackFavData *fd = new TrackFavData{i, trackList, cd.releaseMbid.c_str()};
-    lv_obj_add_event_cb(
-        btn_fav,
-        [](lv_event_t *e) {
-          TrackFavData *data = (TrackFavData *)lv_event_get_user_data(e);
-          Track &t = data->tl->tracks[data->idx];
-          t.isFavoriteTrack = !t.isFavoriteTrack;
-
-          lv_obj_t *b = lv_event_get_target(e);
-          lv_obj_t *l = lv_obj_get_child(b, 0);
-
-          lv_obj_set_style_bg_color(b,
-                                    t.isFavoriteTrack ? lv_color_hex(0xFFD700)
-                                                      : lv_color_hex(0x555555),
-                                    0);
-          lv_obj_set_style_text_color(l,
-                                      t.isFavoriteTrack
-                                          ? lv_color_hex(0x000000)
-                                          : lv_color_hex(0xCCCCCC),
-                                      0);
-          Storage.saveTracklist(data->mbid.c_str(), data->tl);
-        },
-        LV_EVENT_CLICKED, fd);
-    lv_obj_add_event_cb(
-        btn_fav,
-        [](lv_event_t *e) { delete (TrackFavData *)lv_event_get_user_data(e); },
-        LV_EVENT_DELETE, fd);
-
-    lv_obj_t *lblLeft = lv_label_create(btn);
-    lv_label_set_text_fmt(lblLeft, "%d. %s", track.trackNo,
-                          sanitizeText(String(track.title.c_str())).c_str());
-    lv_obj_align(lblLeft, LV_ALIGN_LEFT_MID, 50, 0);
-    lv_obj_set_width(lblLeft, containerW - 160);
-    lv_label_set_long_mode(lblLeft, LV_LABEL_LONG_DOT);
-
-    lv_obj_t *lblRight = lv_label_create(btn);
-    lv_label_set_text_fmt(lblRight, "%s %s",
-                          formatDuration(track.durationMs).c_str(), icon);
-    lv_obj_align(lblRight, LV_ALIGN_RIGHT_MID, -10, 0);
-    lv_obj_set_style_text_color(lblRight, lv_color_hex(getCurrentThemeColor()),
-                                0);
-
-    Track *trackCopy = new Track(track);
-    lv_obj_add_event_cb(btn, trackClickHandler, LV_EVENT_CLICKED, trackCopy);
-    lv_obj_add_event_cb(
-        btn, [](lv_event_t *e) { delete (Track *)lv_event_get_user_data(e); },
-        LV_EVENT_DELETE, trackCopy);
-  }
+  vlist_set_count(container, view->rows.size());
   lvgl_port_unlock();
 }
 
@@ -720,6 +740,23 @@ void setupMainUI() {
       NULL);
   // Serial.println(">> Filter Button Done");
 
+  // Cover Grid Button
+  btn_grid = lv_btn_create(scr);
+  lv_obj_set_size(btn_grid, 50, 40);
+  lv_obj_align(btn_grid, LV_ALIGN_TOP_LEFT, 250, 15);
+  lv_obj_set_style_bg_color(btn_grid, lv_color_hex(0x000000), 0);
+  lv_obj_set_style_border_color(btn_grid, lv_color_hex(0xffaa00), 0);
+  lv_obj_set_style_border_width(btn_grid, 2, 0);
+  lv_obj_set_style_radius(btn_grid, 5, 0);
+
+  lv_obj_t *grid_label = lv_label_create(btn_grid);
+  lv_label_set_text(grid_label, LV_SYMBOL_COPY);
+  lv_obj_center(grid_label);
+  lv_obj_set_style_text_color(grid_label, lv_color_hex(0xffaa00), 0);
+  lv_obj_add_event_cb(
+      btn_grid, [](lv_event_t *e) { show_cover_grid_ui(); }, LV_EVENT_CLICKED,
+      NULL);
+
   // WiFi Button
   // Serial.println(">> Creating WiFi Button...");
   btn_wifi = lv_btn_create(scr);
@@ -842,6 +879,7 @@ void setupMainUI() {
       btn_led_toggle,
       [](lv_event_t *e) {
         led_master_on = !led_master_on;
+        EventBus::notify(EVENT_LEDS);
         lv_obj_t *btn = lv_event_get_target(e);
         lv_obj_t *lbl = lv_obj_get_child(btn, 0);
         if (led_master_on) {
@@ -1231,6 +1269,8 @@ bool is_item_match(int index) {
 }
 
 void update_item_display() {
+  TRACE_SCOPE("ui.update_item_display");
+  EventBus::notify(EVENT_SELECTION);
   // --- CACHED LOAD ---
   // We no longer call ensureItemDetailsLoaded(idx) here because
   // getItemAt(idx) uses the sliding window cache which pre-loads details.
@@ -1434,14 +1474,13 @@ void update_item_display() {
   String diskPath = "/covers/" + d_coverFile;
   bool fileExists = false;
   if (d_coverFile.length() > 0) {
-    if (i2cMutex &&
-        xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(50)) == pdPASS) {
+    if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(50)) == pdPASS) {
       if (sdExpander)
         sdExpander->digitalWrite(SD_CS, LOW);
       fileExists = SD.exists(diskPath);
       if (sdExpander)
         sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     } else {
       // Fallback: If we can't get lock, assume it might exist but we can't
       // check OR better, assume it doesn't to avoid a hang.
@@ -1497,6 +1536,7 @@ void update_item_display() {
 }
 
 void btn_prev_clicked(lv_event_t *e) {
+  TRACE_SCOPE("ui.btn_prev");
   if (getItemCount() == 0)
     return;
 
@@ -1533,6 +1573,7 @@ void btn_prev_clicked(lv_event_t *e) {
 }
 
 void btn_next_clicked(lv_event_t *e) {
+  TRACE_SCOPE("ui.btn_next");
   if (getItemCount() == 0)
     return;
 
@@ -1613,9 +1654,10 @@ void btn_delete_cover_clicked(lv_event_t *e) {
         ItemView item = getItemAt(idx);
         String path = "/covers/" + item.coverFile;
 
-        // 1. Delete from SD
-        if (i2cMutex &&
-            xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
+        // 1. Delete from SD (store covers are removed when the last
+        // reference is released by the save below)
+        if (!CoverStore::isStoreFile(item.coverFile) && i2cMutex &&
+            LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
           if (sdExpander)
             sdExpander->digitalWrite(SD_CS, LOW);
           if (SD.exists(path)) {
@@ -1623,7 +1665,7 @@ void btn_delete_cover_clicked(lv_event_t *e) {
           }
           if (sdExpander)
             sdExpander->digitalWrite(SD_CS, HIGH);
-          xSemaphoreGiveRecursive(i2cMutex);
+          LOCK_GIVE(i2cMutex);
         }
 
         // 2. Update model
@@ -1684,14 +1726,7 @@ void btn_search_clicked(lv_event_t *e) {
   lvgl_port_lock(-1);
 
   if (newUrl.length() > 0) {
-    String uid = item.uniqueID;
-    if (uid.length() == 0) {
-      uid = String(millis()) + "_" + String(random(9999));
-    }
-
-    String fileName = getUidPrefix() + sanitizeFilename(uid) + ".jpg";
     setItemCoverUrl(idx, newUrl);
-    setItemCoverFile(idx, fileName);
 
     Serial.printf("Found: %s\n", newUrl.c_str());
 
@@ -1699,8 +1734,10 @@ void btn_search_clicked(lv_event_t *e) {
     lv_refr_now(NULL);
     lvgl_port_unlock();
 
-    if (AppNetworkManager::downloadCoverImage(newUrl, "/covers/" + fileName)) {
+    String fileName = AppNetworkManager::downloadCover(newUrl);
+    if (fileName.length() > 0) {
       lvgl_port_lock(-1);
+      setItemCoverFile(idx, fileName);
       lv_label_set_text_fmt(label_cover_url, "Success!\nSaved as %s",
                             fileName.c_str());
 
@@ -1716,6 +1753,7 @@ void btn_search_clicked(lv_event_t *e) {
         break;
       }
       saveLibrary();
+      CoverStore::release(fileName); // The item holds its own reference now
       update_item_display();
     } else {
       lvgl_port_lock(-1);
@@ -1755,8 +1793,10 @@ void close_search_ui() {
   }
 }
 
-static void result_click_cb(lv_event_t *e) {
-  int idx = (int)(intptr_t)lv_event_get_user_data(e);
+static void result_click_cb(int pos, void *user_data) {
+  if (pos < 0 || pos >= (int)search_matches.size())
+    return;
+  int idx = search_matches[pos];
   lvgl_port_lock(-1);
   setCurrentItemIndex(idx);
   update_item_display();
@@ -1780,60 +1820,49 @@ static void search_input_cb(lv_event_t *e) {
   lv_timer_set_repeat_count(search_timer, 1);
 }
 
-static void render_search_batch() {
-  if (!list_results)
-    return;
-
-  int end = search_display_offset + SEARCH_PAGE_SIZE;
-  if (end > (int)search_matches.size())
-    end = search_matches.size();
-
-  lv_obj_t *last_child = lv_obj_get_child(list_results, -1);
-  if (last_child) {
-    lv_obj_t *label = lv_obj_get_child(last_child, 0);
-    if (label && strcmp(lv_label_get_text(label), "Load More...") == 0) {
-      lv_obj_del(last_child);
-    }
-  }
-
-  for (int i = search_display_offset; i < end; i++) {
-    int libraryIdx = search_matches[i];
-    ItemView item = getItemAt(libraryIdx);
-    if (!item.isValid)
-      continue;
+// Virtual list rows: [icon] Artist - Title
+static void search_row_create(lv_obj_t *row, void *user_data) {
+  lv_obj_set_style_bg_color(row, lv_color_hex(0x1a1a1a), 0);
+  lv_obj_set_style_bg_color(row, lv_color_hex(0x333333), LV_STATE_PRESSED);
+  lv_obj_set_style_bg_opa(row, LV_OPA_COVER, 0);
+  lv_obj_set_style_radius(row, 4, 0);
+
+  lv_obj_t *lbl = lv_label_create(row);
+  lv_obj_set_width(lbl, lv_pct(96));
+  lv_label_set_long_mode(lbl, LV_LABEL_LONG_DOT);
+  lv_obj_set_style_text_color(lbl, lv_color_hex(0xffffff), 0);
+  lv_obj_align(lbl, LV_ALIGN_LEFT_MID, 10, 0);
+}
 
-    String labelStr = item.artistOrAuthor + " - " + item.title;
-    lv_obj_t *btn =
-        lv_list_add_btn(list_results, LV_SYMBOL_AUDIO, labelStr.c_str());
-    lv_obj_add_event_cb(btn, result_click_cb, LV_EVENT_CLICKED,
-                        (void *)(intptr_t)libraryIdx);
+static void search_row_bind(lv_obj_t *row, int pos, void *user_data) {
+  lv_obj_t *lbl = lv_obj_get_child(row, 0);
+  ItemView item = getItemAtRAM(search_matches[pos]);
+  if (!item.isValid) {
+    lv_label_set_text(lbl, "");
+    return;
   }
+  lv_label_set_text_fmt(lbl, LV_SYMBOL_AUDIO "  %s - %s",
+                        item.artistOrAuthor.c_str(), item.title.c_str());
+}
 
-  search_display_offset = end;
-
-  if (search_display_offset < (int)search_matches.size()) {
-    lv_obj_t *btn_more =
-        lv_list_add_btn(list_results, LV_SYMBOL_DOWN, "Load More...");
-    lv_obj_add_event_cb(
-        btn_more, [](lv_event_t *e) { render_search_batch(); },
-        LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(btn_more, lv_color_hex(0x333333), 0);
-  }
+static void render_search_results() {
+  if (!list_results)
+    return;
 
   if (search_matches.size() == 0) {
     const char *q = lv_textarea_get_text(ta_search);
-    lv_list_add_text(list_results, strlen(q) == 0 ? "Enter search term..."
-                                                  : "No matches found");
+    vlist_set_empty_text(list_results, strlen(q) == 0 ? "Enter search term..."
+                                                      : "No matches found");
   }
+  vlist_set_count(list_results, search_matches.size());
 }
 
 void filter_library(const char *query) {
   if (!list_results)
     return;
-  lv_obj_clean(list_results);
   int filter_mode = lv_dropdown_get_selected(dd_filter);
   MediaManager::filter(query, filter_mode, led_master_on);
-  render_search_batch();
+  render_search_results();
 }
 
 void show_search_ui() {
@@ -1873,6 +1902,7 @@ void show_search_ui() {
       btn_led_search,
       [](lv_event_t *e) {
         led_master_on = !led_master_on;
+        EventBus::notify(EVENT_LEDS);
         lv_obj_t *btn = lv_event_get_target(e);
         lv_obj_t *lbl = lv_obj_get_child(btn, 0);
         if (led_master_on) {
@@ -1973,8 +2003,8 @@ void show_search_ui() {
   lv_obj_set_style_border_width(ta_search, 1, 0);
   lv_obj_add_event_cb(ta_search, search_input_cb, LV_EVENT_VALUE_CHANGED, NULL);
 
-  list_results = lv_list_create(search_panel);
-  lv_obj_set_size(list_results, 760, 450);
+  list_results = vlist_create(search_panel, 760, 450, 44, search_row_create,
+                              search_row_bind, result_click_cb, NULL);
   lv_obj_align(list_results, LV_ALIGN_TOP_MID, 0, 115);
   lv_obj_set_style_bg_color(list_results, lv_color_hex(0x0d0d0d), 0);
   lv_obj_set_style_border_color(list_results, lv_color_hex(0x333333), 0);
@@ -2033,6 +2063,8 @@ void show_search_ui() {
   lvgl_port_unlock();
 }
 void load_and_show_cover(String filename) {
+  METRIC_SCOPE(METRIC_OP_SHOW_COVER);
+  TRACE_SCOPE("ui.load_and_show_cover");
   if (img_buffer == NULL) {
     // Try PSRAM first
     img_buffer = (uint16_t *)heap_caps_malloc(240 * 240 * 2, MALLOC_CAP_SPIRAM);
@@ -2052,12 +2084,7 @@ void load_and_show_cover(String filename) {
     img_buffer[i] = 0x3186;
   }
 
-  TJpgDec.setJpgScale(1);
-  TJpgDec.setSwapBytes(false);
-  TJpgDec.setCallback(tjpg_output);
-
-  if (i2cMutex &&
-      xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
+  if (i2cMutex && LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(1000)) == pdPASS) {
     if (sdExpander)
       sdExpander->digitalWrite(SD_CS, LOW);
 
@@ -2066,7 +2093,7 @@ void load_and_show_cover(String filename) {
       Serial.printf("Failed to open file: %s\n", filename.c_str());
       if (sdExpander)
         sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
       return;
     }
 
@@ -2077,7 +2104,7 @@ void load_and_show_cover(String filename) {
       f.close();
       if (sdExpander)
         sdExpander->digitalWrite(SD_CS, HIGH);
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
       return;
     }
 
@@ -2086,9 +2113,14 @@ void load_and_show_cover(String filename) {
 
     if (sdExpander)
       sdExpander->digitalWrite(SD_CS, HIGH);
-    xSemaphoreGiveRecursive(i2cMutex);
+    LOCK_GIVE(i2cMutex);
 
     // Get dimensions and center
+    if (jpegMutex)
+      LOCK_TAKE(jpegMutex, portMAX_DELAY);
+    TJpgDec.setJpgScale(1);
+    TJpgDec.setSwapBytes(false);
+    TJpgDec.setCallback(tjpg_output);
     uint16_t w = 0, h = 0;
     TJpgDec.getJpgSize(&w, &h, jpg_data, jpg_size);
     int off_x = (240 - w) / 2;
@@ -2099,6 +2131,8 @@ void load_and_show_cover(String filename) {
       off_y = 0;
 
     TJpgDec.drawJpg(off_x, off_y, jpg_data, jpg_size);
+    if (jpegMutex)
+      LOCK_GIVE(jpegMutex);
     free(jpg_data);
   } else {
     Serial.println(
@@ -2117,6 +2151,7 @@ void load_and_show_cover(String filename) {
 }
 
 void update_filtered_leds() {
+  EventBus::notify(EVENT_LEDS);
   if (!led_master_on) {
     FastLED.clear();
     FastLED.show();
@@ -2154,6 +2189,256 @@ void update_filtered_leds() {
     forceUpdateWLED();
 }
 
+// ==========================================
+// COVER GRID (virtualized thumbnail wall)
+// ==========================================
+// The grid is a VirtualList whose rows hold GRID_COLS cells each, so it gets
+// the same pool sizing and recycling as the search results: library row R
+// is always drawn by pool row (R % poolSize), and a scroll step only rebinds
+// the rows that wrapped around. Thumbnails come from ThumbnailCache; misses
+// are decoded by a timer, one per tick, and only once scrolling has settled
+// so a fling never waits on the SD card.
+
+#define GRID_COLS 6
+#define GRID_CELL (THUMB_SIZE + 8) // Thumbnail + gap
+#define GRID_SETTLE_MS 120 // No decoding until scroll has been idle this long
+
+static lv_obj_t *grid_panel = NULL;
+static lv_obj_t *grid_scroll = NULL;
+// One entry per pool cell, in creation order (the cell's user data)
+static std::vector<lv_obj_t *> grid_cells;
+static std::vector<lv_obj_t *> grid_imgs;
+static std::vector<lv_obj_t *> grid_labels;
+static std::vector<int> grid_cell_pos;   // Position in grid_items, -1 free
+static std::vector<bool> grid_cell_thumb; // Thumbnail shown
+static std::vector<int> grid_items;       // Library indices (filtered)
+static lv_timer_t *grid_thumb_timer = NULL;
+static unsigned long grid_last_scroll = 0;
+
+static void grid_bind_cell(int slot, int pos) {
+  lv_obj_t *cell = grid_cells[slot];
+  grid_cell_pos[slot] = pos;
+  grid_cell_thumb[slot] = false;
+
+  if (pos < 0 || pos >= (int)grid_items.size()) {
+    lv_obj_add_flag(cell, LV_OBJ_FLAG_HIDDEN);
+    return;
+  }
+  lv_obj_clear_flag(cell, LV_OBJ_FLAG_HIDDEN);
+
+  ItemView item = getItemAtRAM(grid_items[pos]);
+  const lv_img_dsc_t *thumb = ThumbnailCache::get(item.coverFile);
+  if (thumb) {
+    lv_img_set_src(grid_imgs[slot], thumb);
+    lv_obj_clear_flag(grid_imgs[slot], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(grid_labels[slot], LV_OBJ_FLAG_HIDDEN);
+    grid_cell_thumb[slot] = true;
+  } else {
+    // Placeholder until the timer decodes it (or forever if no cover)
+    lv_obj_add_flag(grid_imgs[slot], LV_OBJ_FLAG_HIDDEN);
+    lv_label_set_text(grid_labels[slot], item.title.c_str());
+    lv_obj_clear_flag(grid_labels[slot], LV_OBJ_FLAG_HIDDEN);
+  }
+}
+
+static void grid_cell_click_cb(lv_event_t *e) {
+  lv_obj_t *cell = lv_event_get_current_target(e);
+  int row = vlist_get_row_index(cell);
+  int pos = row * GRID_COLS + (int)(intptr_t)lv_event_get_user_data(e);
+  if (row < 0 || pos >= (int)grid_items.size())
+    return;
+
+  lvgl_port_lock(-1);
+  int idx = grid_items[pos];
+  setCurrentItemIndex(idx);
+  rebuildNavigationCache(idx);
+  close_cover_grid_ui();
+  update_item_display();
+  lvgl_port_unlock();
+}
+
+static void grid_row_create(lv_obj_t *row, void *) {
+  for (int c = 0; c < GRID_COLS; c++) {
+    lv_obj_t *cell = lv_obj_create(row);
+    lv_obj_remove_style_all(cell);
+    lv_obj_set_size(cell, THUMB_SIZE, THUMB_SIZE);
+    lv_obj_set_pos(cell, c * GRID_CELL, 0);
+    lv_obj_set_style_bg_color(cell, lv_color_hex(0x333333), 0);
+    lv_obj_set_style_bg_opa(cell, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(cell, 4, 0);
+    lv_obj_set_style_clip_corner(cell, true, 0);
+    lv_obj_set_style_border_color(cell, lv_color_hex(getCurrentThemeColor()),
+                                  LV_STATE_PRESSED);
+    lv_obj_set_style_border_width(cell, 2, LV_STATE_PRESSED);
+    lv_obj_add_flag(cell, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(cell, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(cell, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_set_user_data(cell, (void *)(intptr_t)grid_cells.size());
+    lv_obj_add_event_cb(cell, grid_cell_click_cb, LV_EVENT_CLICKED,
+                        (void *)(intptr_t)c);
+
+    lv_obj_t *img = lv_img_create(cell);
+    lv_obj_set_size(img, THUMB_SIZE, THUMB_SIZE);
+    lv_obj_center(img);
+    lv_obj_clear_flag(img, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_flag(img, LV_OBJ_FLAG_HIDDEN);
+
+    lv_obj_t *lbl = lv_label_create(cell);
+    lv_obj_set_width(lbl, THUMB_SIZE - 10);
+    lv_label_set_long_mode(lbl, LV_LABEL_LONG_DOT);
+    lv_obj_set_style_text_align(lbl, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_set_style_text_color(lbl, lv_color_hex(0xcccccc), 0);
+    lv_obj_center(lbl);
+
+    grid_cells.push_back(cell);
+    grid_imgs.push_back(img);
+    grid_labels.push_back(lbl);
+    grid_cell_pos.push_back(-1);
+    grid_cell_thumb.push_back(false);
+  }
+}
+
+static void grid_row_bind(lv_obj_t *row, int index, void *) {
+  for (int c = 0; c < GRID_COLS; c++) {
+    lv_obj_t *cell = lv_obj_get_child(row, c);
+    grid_bind_cell((int)(intptr_t)lv_obj_get_user_data(cell),
+                   index * GRID_COLS + c);
+  }
+}
+
+void close_cover_grid_ui() {
+  if (grid_thumb_timer) {
+    lv_timer_del(grid_thumb_timer);
+    grid_thumb_timer = NULL;
+  }
+  if (grid_panel) {
+    lv_obj_del(grid_panel);
+    grid_panel = NULL;
+    grid_scroll = NULL;
+  }
+  grid_cells.clear();
+  grid_imgs.clear();
+  grid_labels.clear();
+  grid_cell_pos.clear();
+  grid_cell_thumb.clear();
+  grid_items.clear();
+  grid_items.shrink_to_fit();
+}
+
+void show_cover_grid_ui() {
+  if (grid_panel)
+    return;
+  if (!ThumbnailCache::init()) {
+    show_info_popup("Cover Grid", "Not enough PSRAM for thumbnails.", NULL,
+                    NULL);
+    return;
+  }
+  ThumbnailCache::dropFailed();
+
+  lvgl_port_lock(-1);
+
+  // Respect the active filter, same as prev/next navigation
+  grid_items.clear();
+  int total = getItemCount();
+  for (int i = 0; i < total; i++) {
+    if (is_item_match(i))
+      grid_items.push_back(i);
+  }
+
+  grid_panel = lv_obj_create(lv_scr_act());
+  lv_obj_set_size(grid_panel, 800, 480);
+  lv_obj_center(grid_panel);
+  lv_obj_add_style(grid_panel, &style_modal_panel, 0);
+  lv_obj_set_style_bg_color(grid_panel, lv_color_hex(0x0d0d0d), 0);
+  lv_obj_clear_flag(grid_panel, LV_OBJ_FLAG_SCROLLABLE);
+
+  lv_obj_t *title = lv_label_create(grid_panel);
+  String gridTitle = " " + getModeNamePlural() + " (" +
+                     String(grid_items.size()) + ")";
+  lv_label_set_text(title, (LV_SYMBOL_COPY + gridTitle).c_str());
+  lv_obj_align(title, LV_ALIGN_TOP_LEFT, 10, 5);
+  lv_obj_set_style_text_color(title, lv_color_hex(getCurrentThemeColor()), 0);
+  lv_obj_set_style_text_font(title, &lv_font_montserrat_16, 0);
+
+  lv_obj_t *btn_close = lv_btn_create(grid_panel);
+  lv_obj_set_size(btn_close, 60, 40);
+  lv_obj_align(btn_close, LV_ALIGN_TOP_RIGHT, 0, -5);
+  lv_obj_add_style(btn_close, &style_btn_close, 0);
+  lv_obj_add_event_cb(
+      btn_close, [](lv_event_t *e) { close_cover_grid_ui(); },
+      LV_EVENT_CLICKED, NULL);
+  lv_obj_t *label_close = lv_label_create(btn_close);
+  lv_label_set_text(label_close, LV_SYMBOL_CLOSE);
+  lv_obj_center(label_close);
+  lv_obj_set_style_text_color(label_close, lv_color_hex(0xff4444), 0);
+
+  grid_scroll =
+      vlist_create(grid_panel, GRID_COLS * GRID_CELL + 12, 400, GRID_CELL,
+                   grid_row_create, grid_row_bind, NULL, NULL);
+  lv_obj_align(grid_scroll, LV_ALIGN_BOTTOM_MID, 0, 0);
+  lv_obj_set_style_bg_opa(grid_scroll, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(grid_scroll, 0, 0);
+  lv_obj_set_style_pad_all(grid_scroll, 0, 0);
+  lv_obj_set_style_bg_color(grid_scroll, lv_color_hex(getCurrentThemeColor()),
+                            LV_PART_SCROLLBAR);
+  lv_obj_add_event_cb(
+      grid_scroll, [](lv_event_t *e) { grid_last_scroll = millis(); },
+      LV_EVENT_SCROLL, NULL);
+  vlist_set_empty_text(grid_scroll, "Nothing to show");
+  vlist_set_count(grid_scroll,
+                  (grid_items.size() + GRID_COLS - 1) / GRID_COLS);
+
+  // Start on the row holding the current item
+  int cur = getCurrentItemIndex();
+  for (size_t p = 0; p < grid_items.size(); p++) {
+    if (grid_items[p] == cur) {
+      vlist_scroll_to(grid_scroll, p / GRID_COLS);
+      break;
+    }
+  }
+
+  grid_thumb_timer = lv_timer_create(
+      [](lv_timer_t *t) {
+        if (!grid_scroll || millis() - grid_last_scroll < GRID_SETTLE_MS)
+          return;
+
+        // Decode the first visible cell still showing a placeholder
+        int top = lv_obj_get_scroll_y(grid_scroll);
+        int bottom = top + lv_obj_get_height(grid_scroll);
+        for (size_t i = 0; i < grid_cells.size(); i++) {
+          int pos = grid_cell_pos[i];
+          if (pos < 0 || pos >= (int)grid_items.size() || grid_cell_thumb[i])
+            continue;
+          // Rows past the end keep their last binding while hidden
+          if (lv_obj_has_flag(lv_obj_get_parent(grid_cells[i]),
+                              LV_OBJ_FLAG_HIDDEN))
+            continue;
+          int y = (pos / GRID_COLS) * GRID_CELL;
+          if (y + GRID_CELL <= top || y >= bottom)
+            continue;
+
+          ItemView item = getItemAtRAM(grid_items[pos]);
+          if (item.coverFile.length() == 0 ||
+              ThumbnailCache::hasFailed(item.coverFile)) {
+            grid_cell_thumb[i] = true; // Nothing to load; keep the title
+            continue;
+          }
+
+          const lv_img_dsc_t *thumb = ThumbnailCache::load(item.coverFile);
+          grid_cell_thumb[i] = true;
+          if (thumb) {
+            lv_img_set_src(grid_imgs[i], thumb);
+            lv_obj_clear_flag(grid_imgs[i], LV_OBJ_FLAG_HIDDEN);
+            lv_obj_add_flag(grid_labels[i], LV_OBJ_FLAG_HIDDEN);
+          }
+          return; // One decode per tick keeps the UI responsive
+        }
+      },
+      30, NULL);
+
+  lvgl_port_unlock();
+}
+
 // ==========================================
 // WIFI CONFIGURATION UI
 // ==========================================
@@ -35,6 +35,8 @@ void show_lyrics_popup(String trackTitle, String lyricsText);
 void close_lyrics_popup();
 void show_qr_ui();
 void close_qr_ui();
+void show_cover_grid_ui();
+void close_cover_grid_ui();
 void show_led_selector_ui(lv_obj_t *target_ta);
 
 // --- Helpers ---
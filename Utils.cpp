@@ -139,45 +139,21 @@ void decodeHTMLEntities(String &str) {
   }
 }
 
-String escapeJSON(String s) {
-  String out = "";
-  out.reserve(s.length() + 10);
-  for (unsigned int i = 0; i < s.length(); i++) {
-    char c = s[i];
-    if (c == '"')
-      out += "\\\"";
-    else if (c == '\\')
-      out += "\\\\";
-    else if (c == '/')
-      out += "\\/";
-    else if (c == '\b')
-      out += "\\b";
-    else if (c == '\f')
-      out += "\\f";
-    else if (c == '\n')
-      out += "\\n";
-    else if (c == '\r')
-      out += "\\r";
-    else if (c == '\t')
-      out += "\\t";
-    else if (c == '`')
-      out += "\\`";
-    else if (c >= 0 && (unsigned char)c <= 0x1f) {
-      // Skip control chars
-    } else {
-      out += c;
+// Case-insensitive substring test; `needleLower` must already be lowercase
+bool containsIgnoreCase(const char *haystack, const char *needleLower) {
+  if (!*needleLower)
+    return true;
+  for (const char *h = haystack; *h; h++) {
+    const char *a = h;
+    const char *b = needleLower;
+    while (*a && *b && tolower((unsigned char)*a) == *b) {
+      a++;
+      b++;
     }
+    if (!*b)
+      return true;
   }
-  return out;
-}
-
-String escapeHTML(String s) {
-  s.replace("&", "&amp;");
-  s.replace("<", "&lt;");
-  s.replace(">", "&gt;");
-  s.replace("\"", "&quot;");
-  s.replace("'", "&#39;");
-  return s;
+  return false;
 }
 
 String urlEncode(String str) {
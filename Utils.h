@@ -7,8 +7,7 @@
 String sanitizeText(String text);
 String sanitizeFilename(String filename);
 void decodeHTMLEntities(String &text);
-String escapeJSON(String text);
-String escapeHTML(String text);
+bool containsIgnoreCase(const char *haystack, const char *needleLower);
 String urlEncode(String text);
 String extractJSONString(const String &json, const String &key,
                          int startPos = 0);
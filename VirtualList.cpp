@@ -0,0 +1,160 @@
+#include "VirtualList.h"
+#include <vector>
+
+struct VListState {
+  lv_coord_t rowH;
+  int poolSize;
+  int count;
+  lv_obj_t *spacer;
+  lv_obj_t *emptyLabel;
+  std::vector<lv_obj_t *> rows;
+  std::vector<int> bound; // Data index per pool slot, -1 if unbound
+  vlist_create_cb_t createCb;
+  vlist_bind_cb_t bindCb;
+  vlist_click_cb_t clickCb;
+  void *userData;
+};
+
+// Tags pool rows (their user data holds the bound index) so
+// vlist_get_row_index can walk up from a child widget.
+#define VLIST_ROW_FLAG LV_OBJ_FLAG_USER_1
+
+static VListState *vlist_state(lv_obj_t *list) {
+  return list ? (VListState *)lv_obj_get_user_data(list) : nullptr;
+}
+
+static void vlist_rebind(lv_obj_t *list, bool force) {
+  VListState *st = vlist_state(list);
+  if (!st)
+    return;
+
+  int first = lv_obj_get_scroll_y(list) / st->rowH - VLIST_MARGIN_ROWS;
+  if (first < 0)
+    first = 0;
+
+  for (int r = first; r < first + st->poolSize; r++) {
+    int slot = r % st->poolSize;
+    if (!force && st->bound[slot] == r)
+      continue;
+
+    lv_obj_t *row = st->rows[slot];
+    st->bound[slot] = r;
+    if (r >= st->count) {
+      lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+      continue;
+    }
+    lv_obj_set_pos(row, 0, r * st->rowH);
+    lv_obj_set_user_data(row, (void *)(intptr_t)r);
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+    st->bindCb(row, r, st->userData);
+  }
+}
+
+static void vlist_row_click_cb(lv_event_t *e) {
+  lv_obj_t *row = lv_event_get_current_target(e);
+  lv_obj_t *list = lv_obj_get_parent(row);
+  VListState *st = vlist_state(list);
+  if (!st || !st->clickCb)
+    return;
+  int index = (int)(intptr_t)lv_obj_get_user_data(row);
+  if (index >= 0 && index < st->count)
+    st->clickCb(index, st->userData);
+}
+
+lv_obj_t *vlist_create(lv_obj_t *parent, lv_coord_t w, lv_coord_t h,
+                       lv_coord_t row_h, vlist_create_cb_t create_cb,
+                       vlist_bind_cb_t bind_cb, vlist_click_cb_t click_cb,
+                       void *user_data) {
+  lv_obj_t *list = lv_obj_create(parent);
+  lv_obj_set_size(list, w, h);
+  lv_obj_set_scroll_dir(list, LV_DIR_VER);
+  lv_obj_set_style_pad_all(list, 4, 0);
+
+  VListState *st = new VListState();
+  st->rowH = row_h;
+  st->count = 0;
+  st->createCb = create_cb;
+  st->bindCb = bind_cb;
+  st->clickCb = click_cb;
+  st->userData = user_data;
+  st->poolSize = (h + row_h - 1) / row_h + 2 * VLIST_MARGIN_ROWS;
+  lv_obj_set_user_data(list, st);
+
+  st->spacer = lv_obj_create(list);
+  lv_obj_remove_style_all(st->spacer);
+  lv_obj_set_size(st->spacer, 1, 1);
+  lv_obj_clear_flag(st->spacer, LV_OBJ_FLAG_CLICKABLE);
+
+  st->emptyLabel = lv_label_create(list);
+  lv_label_set_text(st->emptyLabel, "");
+  lv_obj_set_style_text_color(st->emptyLabel, lv_color_hex(0x888888), 0);
+  lv_obj_align(st->emptyLabel, LV_ALIGN_TOP_MID, 0, 10);
+  lv_obj_add_flag(st->emptyLabel, LV_OBJ_FLAG_HIDDEN);
+
+  for (int i = 0; i < st->poolSize; i++) {
+    lv_obj_t *row = lv_obj_create(list);
+    lv_obj_remove_style_all(row);
+    lv_obj_set_size(row, lv_pct(100), row_h - 4);
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(row, LV_OBJ_FLAG_CLICKABLE | VLIST_ROW_FLAG);
+    lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_set_user_data(row, (void *)(intptr_t)-1);
+    create_cb(row, user_data);
+    lv_obj_add_event_cb(row, vlist_row_click_cb, LV_EVENT_CLICKED, NULL);
+    st->rows.push_back(row);
+    st->bound.push_back(-1);
+  }
+
+  lv_obj_add_event_cb(
+      list, [](lv_event_t *e) { vlist_rebind(lv_event_get_target(e), false); },
+      LV_EVENT_SCROLL, NULL);
+  lv_obj_add_event_cb(
+      list,
+      [](lv_event_t *e) {
+        lv_obj_t *l = lv_event_get_target(e);
+        delete vlist_state(l);
+        lv_obj_set_user_data(l, NULL);
+      },
+      LV_EVENT_DELETE, NULL);
+
+  return list;
+}
+
+void vlist_set_count(lv_obj_t *list, int count) {
+  VListState *st = vlist_state(list);
+  if (!st)
+    return;
+
+  st->count = count < 0 ? 0 : count;
+  lv_obj_set_pos(st->spacer, 0, st->count > 0 ? st->count * st->rowH - 1 : 0);
+  if (st->count == 0)
+    lv_obj_clear_flag(st->emptyLabel, LV_OBJ_FLAG_HIDDEN);
+  else
+    lv_obj_add_flag(st->emptyLabel, LV_OBJ_FLAG_HIDDEN);
+
+  lv_obj_scroll_to_y(list, 0, LV_ANIM_OFF);
+  vlist_rebind(list, true);
+}
+
+void vlist_refresh(lv_obj_t *list) { vlist_rebind(list, true); }
+
+void vlist_scroll_to(lv_obj_t *list, int index) {
+  VListState *st = vlist_state(list);
+  if (!st)
+    return;
+  lv_obj_update_layout(list);
+  lv_obj_scroll_to_y(list, index * st->rowH, LV_ANIM_OFF);
+  vlist_rebind(list, false);
+}
+
+void vlist_set_empty_text(lv_obj_t *list, const char *text) {
+  VListState *st = vlist_state(list);
+  if (st)
+    lv_label_set_text(st->emptyLabel, text);
+}
+
+int vlist_get_row_index(lv_obj_t *obj) {
+  while (obj && !lv_obj_has_flag(obj, VLIST_ROW_FLAG))
+    obj = lv_obj_get_parent(obj);
+  return obj ? (int)(intptr_t)lv_obj_get_user_data(obj) : -1;
+}
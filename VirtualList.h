@@ -0,0 +1,48 @@
+#ifndef VIRTUAL_LIST_H
+#define VIRTUAL_LIST_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Virtualized, object-recycling list.
+//
+// Only the rows that fit in the viewport plus VLIST_MARGIN_ROWS on each side
+// exist as LVGL objects. Data row R is always drawn by pool row
+// (R % poolSize); on scroll only the rows that wrapped around are re-bound.
+// A 1px spacer at the bottom gives the container its full scroll height.
+//
+// The caller supplies:
+//   create_cb - builds the (empty) widgets of one row, once per pool slot
+//   bind_cb   - fills a row for data index `index`
+//   click_cb  - optional, called with the data index when a row is tapped
+//
+// Widgets inside a row can find their data index with vlist_get_row_index().
+// All functions must be called with the LVGL lock held.
+
+#define VLIST_MARGIN_ROWS 2
+
+typedef void (*vlist_create_cb_t)(lv_obj_t *row, void *user_data);
+typedef void (*vlist_bind_cb_t)(lv_obj_t *row, int index, void *user_data);
+typedef void (*vlist_click_cb_t)(int index, void *user_data);
+
+lv_obj_t *vlist_create(lv_obj_t *parent, lv_coord_t w, lv_coord_t h,
+                       lv_coord_t row_h, vlist_create_cb_t create_cb,
+                       vlist_bind_cb_t bind_cb, vlist_click_cb_t click_cb,
+                       void *user_data);
+
+// Sets the number of data rows, scrolls to the top and re-binds everything.
+void vlist_set_count(lv_obj_t *list, int count);
+
+// Re-binds the visible rows (underlying data changed, count did not).
+void vlist_refresh(lv_obj_t *list);
+
+// Scrolls so that data row `index` is at the top.
+void vlist_scroll_to(lv_obj_t *list, int index);
+
+// Text shown when count is 0 (e.g. "No matches found").
+void vlist_set_empty_text(lv_obj_t *list, const char *text);
+
+// Data index bound to `obj` (a row or any descendant of one), or -1.
+int vlist_get_row_index(lv_obj_t *obj);
+
+#endif // VIRTUAL_LIST_H
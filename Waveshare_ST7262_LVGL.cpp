@@ -5,9 +5,12 @@
  */
 #include "Waveshare_ST7262_LVGL.h"
 #include "AppGlobals.h"
+#include "LockProfiler.h"
+#include "TraceRecorder.h"
 #include <Arduino.h>
 #include <ESP_IOExpander_Library.h>
 #include <ESP_Panel_Library.h>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <lvgl.h>
@@ -20,6 +23,20 @@ static TaskHandle_t lvgl_task_handle = nullptr;
 
 extern SemaphoreHandle_t i2cMutex;
 
+static lvgl_port_config_t port_cfg = LVGL_PORT_CONFIG_DEFAULT();
+
+// Frame timing (written by the LVGL task / refresh-finish ISR)
+typedef void (*port_flush_cb_t)(lv_disp_drv_t *drv, const lv_area_t *area,
+                                lv_color_t *color_map);
+static port_flush_cb_t port_flush_cb = nullptr;
+static bool port_flush_async = false; // Non-RGB: flush ends in the ISR
+static volatile int64_t flush_start_us = 0;
+static volatile uint32_t frame_flush_us = 0;
+static uint32_t frame_flush_count = 0;
+static lvgl_port_stats_t port_stats = {};
+static uint64_t render_us_total = 0;
+static uint64_t flush_us_total = 0;
+
 // Use the global expander from AppGlobals.h
 #define expander sdExpander
 
@@ -38,50 +55,67 @@ static void *get_next_frame_buffer(ESP_PanelLcd *lcd) {
 
   return next_fb;
 }
+#endif /* LVGL_PORT_ROTATION_DEGREE */
+
+/*
+ * Rotated copies are done in ROTATE_TILE x ROTATE_TILE blocks so that, for
+ * 90/270, the strided side of the transpose stays within a handful of cache
+ * lines instead of touching a new PSRAM line on every pixel.
+ *
+ * With RGB565 the even-aligned interior of each block is moved as 2x2 pixel
+ * quads: two 32-bit loads (one per source row) produce two 32-bit stores (one
+ * per destination row), halving the number of memory accesses. Odd edges fall
+ * back to the per-pixel copy.
+ */
+#define ROTATE_TILE (16)
+
+/*
+ * The kernels are also built unrotated, for lvgl_port_rotate_copy() (the
+ * /api/debug/bench/rotate check); only the flush path needs them in IRAM.
+ */
+#if LVGL_PORT_ROTATION_DEGREE != 0
+#define ROTATE_ATTR IRAM_ATTR
+#else
+#define ROTATE_ATTR
+#endif
 
-IRAM_ATTR static void rotate_copy_pixel(const lv_color_t *from, lv_color_t *to,
-                                        uint16_t x_start, uint16_t y_start,
-                                        uint16_t x_end, uint16_t y_end,
-                                        uint16_t w, uint16_t h,
-                                        uint16_t rotate) {
-  int from_index = 0;
-  int to_index = 0;
-  int to_index_const = 0;
+/* Destination index of source pixel (x, y) for a w x h source frame */
+#define ROT90_INDEX(x, y, w, h) (((w) - (x) - 1) * (h) + (y))
+#define ROT180_INDEX(x, y, w, h) ((h) * (w) - (y) * (w) - (x) - 1)
+#define ROT270_INDEX(x, y, w, h) ((x) * (h) + (h) - (y) - 1)
 
+/* Per-pixel copy of [x0, x1) x [y0, y1), walking the destination linearly */
+ROTATE_ATTR static void rotate_block_scalar(const lv_color_t *from,
+                                            lv_color_t *to, int x0, int y0,
+                                            int x1, int y1, int w, int h,
+                                            uint16_t rotate) {
   switch (rotate) {
   case 90:
-    to_index_const = (w - x_start - 1) * h;
-    for (int from_y = y_start; from_y < y_end + 1; from_y++) {
-      from_index = from_y * w + x_start;
-      to_index = to_index_const + from_y;
-      for (int from_x = x_start; from_x < x_end + 1; from_x++) {
-        *(to + to_index) = *(from + from_index);
-        from_index += 1;
-        to_index -= h;
+    for (int x = x0; x < x1; x++) {
+      const lv_color_t *src = from + y0 * w + x;
+      lv_color_t *dst = to + ROT90_INDEX(x, y0, w, h);
+      for (int y = y0; y < y1; y++) {
+        *dst++ = *src;
+        src += w;
       }
     }
     break;
   case 180:
-    to_index_const = h * w - x_start - 1;
-    for (int from_y = y_start; from_y < y_end + 1; from_y++) {
-      from_index = from_y * w + x_start;
-      to_index = to_index_const - from_y * w;
-      for (int from_x = x_start; from_x < x_end + 1; from_x++) {
-        *(to + to_index) = *(from + from_index);
-        from_index += 1;
-        to_index -= 1;
+    for (int y = y0; y < y1; y++) {
+      const lv_color_t *src = from + y * w + x0;
+      lv_color_t *dst = to + ROT180_INDEX(x0, y, w, h);
+      for (int x = x0; x < x1; x++) {
+        *dst-- = *src++;
       }
     }
     break;
   case 270:
-    to_index_const = (x_start + 1) * h - 1;
-    for (int from_y = y_start; from_y < y_end + 1; from_y++) {
-      from_index = from_y * w + x_start;
-      to_index = to_index_const - from_y;
-      for (int from_x = x_start; from_x < x_end + 1; from_x++) {
-        *(to + to_index) = *(from + from_index);
-        from_index += 1;
-        to_index += h;
+    for (int x = x0; x < x1; x++) {
+      const lv_color_t *src = from + y0 * w + x;
+      lv_color_t *dst = to + ROT270_INDEX(x, y0, w, h);
+      for (int y = y0; y < y1; y++) {
+        *dst-- = *src;
+        src += w;
       }
     }
     break;
@@ -89,7 +123,107 @@ IRAM_ATTR static void rotate_copy_pixel(const lv_color_t *from, lv_color_t *to,
     break;
   }
 }
-#endif /* LVGL_PORT_ROTATION_DEGREE */
+
+#if LV_COLOR_DEPTH == 16
+/*
+ * 2x2 quad copy of [x0, x1) x [y0, y1). All bounds, w and h must be even and
+ * both buffers 4-byte aligned, so every 32-bit access is aligned.
+ * Little-endian: the low half-word of a load is the left pixel.
+ */
+ROTATE_ATTR static void rotate_block_quad(const lv_color_t *from,
+                                          lv_color_t *to, int x0, int y0,
+                                          int x1, int y1, int w, int h,
+                                          uint16_t rotate) {
+  uint16_t *dst = (uint16_t *)to;
+
+  for (int y = y0; y < y1; y += 2) {
+    const uint32_t *row0 = (const uint32_t *)(from + y * w + x0);
+    const uint32_t *row1 = (const uint32_t *)(from + (y + 1) * w + x0);
+
+    for (int x = x0; x < x1; x += 2) {
+      uint32_t a = *row0++; /* (x, y)   | (x+1, y)   << 16 */
+      uint32_t b = *row1++; /* (x, y+1) | (x+1, y+1) << 16 */
+
+      switch (rotate) {
+      case 90:
+        *(uint32_t *)(dst + ROT90_INDEX(x, y, w, h)) =
+            (a & 0xFFFF) | (b << 16);
+        *(uint32_t *)(dst + ROT90_INDEX(x + 1, y, w, h)) =
+            (a >> 16) | (b & 0xFFFF0000);
+        break;
+      case 180:
+        *(uint32_t *)(dst + ROT180_INDEX(x + 1, y, w, h)) =
+            (a >> 16) | (a << 16);
+        *(uint32_t *)(dst + ROT180_INDEX(x + 1, y + 1, w, h)) =
+            (b >> 16) | (b << 16);
+        break;
+      case 270:
+        *(uint32_t *)(dst + ROT270_INDEX(x, y + 1, w, h)) =
+            (b & 0xFFFF) | (a << 16);
+        *(uint32_t *)(dst + ROT270_INDEX(x + 1, y + 1, w, h)) =
+            (b >> 16) | (a & 0xFFFF0000);
+        break;
+      default:
+        break;
+      }
+    }
+  }
+}
+#endif /* LV_COLOR_DEPTH == 16 */
+
+ROTATE_ATTR static void rotate_copy_pixel(const lv_color_t *from,
+                                          lv_color_t *to, uint16_t x_start,
+                                          uint16_t y_start, uint16_t x_end,
+                                          uint16_t y_end, uint16_t w,
+                                          uint16_t h, uint16_t rotate) {
+  if (rotate != 90 && rotate != 180 && rotate != 270) {
+    return;
+  }
+
+#if LV_COLOR_DEPTH == 16
+  const bool quad_ok = ((w | h) & 1) == 0 &&
+                       (((uintptr_t)from | (uintptr_t)to) & 3) == 0;
+#else
+  const bool quad_ok = false;
+#endif
+
+  for (int ty = y_start; ty <= y_end; ty += ROTATE_TILE) {
+    int ty1 = (ty + ROTATE_TILE <= y_end + 1) ? ty + ROTATE_TILE : y_end + 1;
+
+    for (int tx = x_start; tx <= x_end; tx += ROTATE_TILE) {
+      int tx1 = (tx + ROTATE_TILE <= x_end + 1) ? tx + ROTATE_TILE : x_end + 1;
+
+      /* Even-aligned interior of the tile */
+      int ex0 = (tx + 1) & ~1, ex1 = tx1 & ~1;
+      int ey0 = (ty + 1) & ~1, ey1 = ty1 & ~1;
+
+      if (!quad_ok || ex0 >= ex1 || ey0 >= ey1) {
+        rotate_block_scalar(from, to, tx, ty, tx1, ty1, w, h, rotate);
+        continue;
+      }
+
+#if LV_COLOR_DEPTH == 16
+      rotate_block_quad(from, to, ex0, ey0, ex1, ey1, w, h, rotate);
+#endif
+      /* Odd edges: top/bottom rows span the tile, left/right columns don't */
+      if (ty < ey0)
+        rotate_block_scalar(from, to, tx, ty, tx1, ey0, w, h, rotate);
+      if (ey1 < ty1)
+        rotate_block_scalar(from, to, tx, ey1, tx1, ty1, w, h, rotate);
+      if (tx < ex0)
+        rotate_block_scalar(from, to, tx, ey0, ex0, ey1, w, h, rotate);
+      if (ex1 < tx1)
+        rotate_block_scalar(from, to, ex1, ey0, tx1, ey1, w, h, rotate);
+    }
+  }
+}
+
+void lvgl_port_rotate_copy(const lv_color_t *from, lv_color_t *to,
+                           uint16_t x_start, uint16_t y_start, uint16_t x_end,
+                           uint16_t y_end, uint16_t w, uint16_t h,
+                           uint16_t rotate) {
+  rotate_copy_pixel(from, to, x_start, y_start, x_end, y_end, w, h, rotate);
+}
 
 #if LVGL_PORT_AVOID_TEAR
 #if LVGL_PORT_DIRECT_MODE
@@ -291,6 +425,20 @@ static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area,
 
   lv_disp_flush_ready(drv);
 }
+
+/**
+ * @brief Flush for LVGL_PORT_BUF_PARTIAL: copy the rendered area into the
+ * single RGB frame buffer, no VSYNC wait
+ */
+static void flush_callback_partial(lv_disp_drv_t *drv, const lv_area_t *area,
+                                   lv_color_t *color_map) {
+  ESP_PanelLcd *lcd = (ESP_PanelLcd *)drv->user_data;
+
+  lcd->drawBitmap(area->x1, area->y1, area->x2 - area->x1 + 1,
+                  area->y2 - area->y1 + 1, (const uint8_t *)color_map);
+
+  lv_disp_flush_ready(drv);
+}
 #endif /* LVGL_PORT_ROTATION_DEGREE */
 
 #elif LVGL_PORT_FULL_REFRESH && LVGL_PORT_DISP_BUFFER_NUM == 2
@@ -454,6 +602,50 @@ void rounder_callback(lv_disp_drv_t *drv, lv_area_t *area) {
   }
 }
 
+/**
+ * @brief Times every flush; the actual flush is `port_flush_cb`
+ */
+static void flush_timed_callback(lv_disp_drv_t *drv, const lv_area_t *area,
+                                 lv_color_t *color_map) {
+  TRACE_SCOPE("lvgl.flush");
+  frame_flush_count++;
+  flush_start_us = esp_timer_get_time();
+  port_flush_cb(drv, area, color_map);
+  if (!port_flush_async) {
+    frame_flush_us += (uint32_t)(esp_timer_get_time() - flush_start_us);
+  }
+}
+
+/**
+ * @brief Wraps LVGL's refresh timer to measure a whole frame (render + flush)
+ */
+static void refr_timer_callback(lv_timer_t *timer) {
+  frame_flush_us = 0;
+  frame_flush_count = 0;
+  int64_t start_us = esp_timer_get_time();
+
+  _lv_disp_refr_timer(timer);
+
+  if (frame_flush_count == 0) {
+    return; // Nothing was invalidated
+  }
+  uint32_t total_us = (uint32_t)(esp_timer_get_time() - start_us);
+  uint32_t flush_us = frame_flush_us;
+  uint32_t render_us = (total_us > flush_us) ? (total_us - flush_us) : 0;
+
+  port_stats.frames++;
+  port_stats.render_us_last = render_us;
+  port_stats.flush_us_last = flush_us;
+  if (render_us > port_stats.render_us_max) {
+    port_stats.render_us_max = render_us;
+  }
+  if (flush_us > port_stats.flush_us_max) {
+    port_stats.flush_us_max = flush_us;
+  }
+  render_us_total += render_us;
+  flush_us_total += flush_us;
+}
+
 static lv_disp_t *display_init(ESP_PanelLcd *lcd) {
   ESP_PANEL_CHECK_FALSE_RET(lcd != nullptr, nullptr, "Invalid LCD device");
   ESP_PANEL_CHECK_FALSE_RET(lcd->getHandle() != nullptr, nullptr,
@@ -500,9 +692,31 @@ static lv_disp_t *display_init(ESP_PanelLcd *lcd) {
 
 #elif LVGL_PORT_DISP_BUFFER_NUM >= 2
 
-  for (int i = 0;
-       (i < LVGL_PORT_DISP_BUFFER_NUM) && (i < LVGL_PORT_BUFFER_NUM_MAX); i++) {
-    buf[i] = lcd->getRgbBufferByIndex(i);
+#if LVGL_PORT_RUNTIME_BUFFERING
+  if (port_cfg.mode == LVGL_PORT_BUF_PARTIAL) {
+    // LVGL renders into small draw buffers, the RGB bus owns one frame buffer
+    buffer_size = LVGL_PORT_DISP_WIDTH * port_cfg.draw_buf_lines;
+    uint32_t caps = port_cfg.draw_buf_psram ? MALLOC_CAP_SPIRAM
+                                            : LVGL_PORT_BUFFER_MALLOC_CAPS;
+    for (int i = 0; i < port_cfg.draw_buf_num; i++) {
+      buf[i] = heap_caps_malloc(buffer_size * sizeof(lv_color_t), caps);
+      if (!buf[i] && caps != MALLOC_CAP_SPIRAM) {
+        ESP_LOGW(TAG, "No SRAM for draw buffer %d, using PSRAM", i);
+        buf[i] =
+            heap_caps_malloc(buffer_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+      }
+      assert(buf[i]);
+      ESP_LOGD(TAG, "Buffer[%d] address: %p, size: %d", i, buf[i],
+               buffer_size * sizeof(lv_color_t));
+    }
+  } else
+#endif
+  {
+    for (int i = 0;
+         (i < LVGL_PORT_DISP_BUFFER_NUM) && (i < LVGL_PORT_BUFFER_NUM_MAX);
+         i++) {
+      buf[i] = lcd->getRgbBufferByIndex(i);
+    }
   }
 
 #endif
@@ -513,7 +727,14 @@ static lv_disp_t *display_init(ESP_PanelLcd *lcd) {
 
   ESP_LOGD(TAG, "Register display driver to LVGL");
   lv_disp_drv_init(&disp_drv);
-  disp_drv.flush_cb = flush_callback;
+  port_flush_cb = flush_callback;
+#if LVGL_PORT_RUNTIME_BUFFERING
+  if (port_cfg.mode == LVGL_PORT_BUF_PARTIAL) {
+    port_flush_cb = flush_callback_partial;
+  }
+#endif
+  port_flush_async = lcd->getBus()->getType() != ESP_PANEL_BUS_TYPE_RGB;
+  disp_drv.flush_cb = flush_timed_callback;
 #if LVGL_PORT_ROTATION_90 || LVGL_PORT_ROTATION_270
   disp_drv.hor_res = LVGL_PORT_DISP_HEIGHT;
   disp_drv.ver_res = LVGL_PORT_DISP_WIDTH;
@@ -524,6 +745,12 @@ static lv_disp_t *display_init(ESP_PanelLcd *lcd) {
 #if LVGL_PORT_AVOID_TEAR // Only available when the tearing effect is enabled
 #if LVGL_PORT_FULL_REFRESH
   disp_drv.full_refresh = 1;
+#elif LVGL_PORT_RUNTIME_BUFFERING
+  if (port_cfg.mode == LVGL_PORT_BUF_FULL) {
+    disp_drv.full_refresh = 1;
+  } else if (port_cfg.mode == LVGL_PORT_BUF_DIRECT) {
+    disp_drv.direct_mode = 1;
+  }
 #elif LVGL_PORT_DIRECT_MODE
   disp_drv.direct_mode = 1;
 #endif
@@ -550,7 +777,7 @@ static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
   /* Read data from touch controller - thread-safe! */
   if (i2cMutex) {
     // Shorter timeout (30ms) is better for responsiveness
-    if (xSemaphoreTakeRecursive(i2cMutex, pdMS_TO_TICKS(30)) == pdPASS) {
+    if (LOCK_TAKE(i2cMutex, pdMS_TO_TICKS(30)) == pdPASS) {
       if (tp->readPoints(&point, 1) > 0) {
         // FILTER: Only update if change is significant or it's a new press
         int dx = abs((int)point.x - (int)last_point.x);
@@ -564,7 +791,7 @@ static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
       } else {
         last_pressed = false;
       }
-      xSemaphoreGiveRecursive(i2cMutex);
+      LOCK_GIVE(i2cMutex);
     }
   } else {
     if (tp->readPoints(&point, 1) > 0) {
@@ -620,6 +847,7 @@ static void lvgl_port_task(void *arg) {
   uint32_t task_delay_ms = LVGL_PORT_TASK_MAX_DELAY_MS;
   while (1) {
     if (lvgl_port_lock(-1)) {
+      TRACE_SCOPE("lvgl.timer_handler");
       task_delay_ms = lv_timer_handler();
       lvgl_port_unlock();
     }
@@ -635,6 +863,8 @@ static void lvgl_port_task(void *arg) {
 IRAM_ATTR bool onRefreshFinishCallback(void *user_data) {
   lv_disp_drv_t *drv = (lv_disp_drv_t *)user_data;
 
+  frame_flush_us += (uint32_t)(esp_timer_get_time() - flush_start_us);
+
   lv_disp_flush_ready(drv);
 
   return false;
@@ -664,6 +894,7 @@ bool lvgl_port_init(ESP_PanelLcd *lcd, ESP_PanelTouch *tp) {
                            "Initialize LVGL display driver failed");
   // Record the initial rotation of the display
   lv_disp_set_rotation(disp, LV_DISP_ROT_NONE);
+  lv_timer_set_cb(disp->refr_timer, refr_timer_callback);
 
   // For non-RGB LCD, need to notify LVGL that the buffer is ready when the
   // refresh is finished
@@ -694,6 +925,7 @@ bool lvgl_port_init(ESP_PanelLcd *lcd, ESP_PanelTouch *tp) {
   ESP_LOGD(TAG, "Create mutex for LVGL");
   lvgl_mux = xSemaphoreCreateRecursiveMutex();
   ESP_PANEL_CHECK_NULL_RET(lvgl_mux, false, "Create LVGL mutex failed");
+  LockProfiler::track(lvgl_mux, METRIC_LOCK_LVGL);
 
   ESP_LOGD(TAG, "Create LVGL task");
   BaseType_t core_id =
@@ -711,22 +943,77 @@ bool lvgl_port_init(ESP_PanelLcd *lcd, ESP_PanelTouch *tp) {
   return true;
 }
 
-bool lvgl_port_lock(int timeout_ms) {
+bool lvgl_port_lock_at(int timeout_ms, const char *file, int line) {
   ESP_PANEL_CHECK_NULL_RET(lvgl_mux, false, "LVGL mutex is not initialized");
 
   const TickType_t timeout_ticks =
       (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
-  return (xSemaphoreTakeRecursive(lvgl_mux, timeout_ticks) == pdTRUE);
+  return (LockProfiler::take(lvgl_mux, timeout_ticks, file, line) == pdTRUE);
 }
 
 bool lvgl_port_unlock(void) {
   ESP_PANEL_CHECK_NULL_RET(lvgl_mux, false, "LVGL mutex is not initialized");
 
-  xSemaphoreGiveRecursive(lvgl_mux);
+  LockProfiler::give(lvgl_mux);
 
   return true;
 }
 
+void lvgl_port_set_config(const lvgl_port_config_t *config) {
+  const lvgl_port_config_t defaults = LVGL_PORT_CONFIG_DEFAULT();
+  if (config == nullptr) {
+    port_cfg = defaults;
+    return;
+  }
+  port_cfg = *config;
+
+  if (port_cfg.mode > LVGL_PORT_BUF_PARTIAL) {
+    port_cfg.mode = defaults.mode;
+  }
+  if (port_cfg.draw_buf_num < 1 ||
+      port_cfg.draw_buf_num > LVGL_PORT_BUFFER_NUM_MAX) {
+    port_cfg.draw_buf_num = defaults.draw_buf_num;
+  }
+  if (port_cfg.draw_buf_lines < 1 ||
+      port_cfg.draw_buf_lines > LVGL_PORT_DISP_HEIGHT) {
+    port_cfg.draw_buf_lines = defaults.draw_buf_lines;
+  }
+  // The RGB driver needs the frame to be a whole number of bounce buffers
+  if (port_cfg.bounce_buf_lines > LVGL_PORT_DISP_HEIGHT ||
+      (port_cfg.bounce_buf_lines > 0 &&
+       LVGL_PORT_DISP_HEIGHT % port_cfg.bounce_buf_lines != 0)) {
+    port_cfg.bounce_buf_lines = defaults.bounce_buf_lines;
+  }
+#if !LVGL_PORT_RUNTIME_BUFFERING
+  ESP_LOGW(TAG, "Runtime buffering not available in this configuration");
+#endif
+}
+
+void lvgl_port_get_config(lvgl_port_config_t *config) {
+  if (config != nullptr) {
+    *config = port_cfg;
+  }
+}
+
+void lvgl_port_get_stats(lvgl_port_stats_t *stats) {
+  if (stats == nullptr) {
+    return;
+  }
+  *stats = port_stats;
+  if (stats->frames > 0) {
+    stats->render_us_avg = (uint32_t)(render_us_total / stats->frames);
+    stats->flush_us_avg = (uint32_t)(flush_us_total / stats->frames);
+  }
+}
+
+void lvgl_port_reset_stats(void) {
+  lvgl_port_lock(-1);
+  port_stats = {};
+  render_us_total = 0;
+  flush_us_total = 0;
+  lvgl_port_unlock();
+}
+
 void lcd_init(void) {
   pinMode(GPIO_INPUT_IO_4, OUTPUT);
   /**
@@ -765,8 +1052,15 @@ void lcd_init(void) {
   // the LVGL configuration
   ESP_PanelBus_RGB *rgb_bus =
       static_cast<ESP_PanelBus_RGB *>(panel->getLcd()->getBus());
+#if LVGL_PORT_RUNTIME_BUFFERING
+  rgb_bus->configRgbFrameBufferNumber(
+      (port_cfg.mode == LVGL_PORT_BUF_PARTIAL) ? 1 : LVGL_PORT_DISP_BUFFER_NUM);
+  rgb_bus->configRgbBounceBufferSize(port_cfg.bounce_buf_lines *
+                                     LVGL_PORT_DISP_WIDTH);
+#else
   rgb_bus->configRgbFrameBufferNumber(LVGL_PORT_DISP_BUFFER_NUM);
   rgb_bus->configRgbBounceBufferSize(LVGL_PORT_RGB_BOUNCE_BUFFER_SIZE);
+#endif
 #endif
   panel->begin();
 
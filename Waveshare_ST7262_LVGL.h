@@ -156,6 +156,68 @@
 #endif
 #endif /* LVGL_PORT_AVOID_TEARING_MODE */
 
+/**
+ * Runtime buffering selection.
+ *
+ * With the shipped configuration (avoid tearing mode 3, no rotation) the
+ * buffering strategy can be chosen at boot from settings instead of being
+ * fixed at compile time. Other compile-time configurations ignore the runtime
+ * config and behave as described above.
+ *
+ *      - DIRECT:  LCD double-buffer & LVGL direct-mode (same as mode 3)
+ *      - FULL:    LCD double-buffer & LVGL full-refresh (same as mode 1)
+ *      - PARTIAL: Avoid tearing off. LVGL renders into `draw_buf_num` buffers
+ *                 of `draw_buf_lines` lines (SRAM or PSRAM) that are copied
+ *                 into a single RGB frame buffer
+ *
+ * `bounce_buf_lines` sets the RGB bounce buffer height (0 disables it). The
+ * frame height must be a multiple of it.
+ *
+ */
+#if LVGL_PORT_AVOID_TEAR && LVGL_PORT_DIRECT_MODE &&                           \
+    (LVGL_PORT_ROTATION_DEGREE == 0)
+#define LVGL_PORT_RUNTIME_BUFFERING (1)
+#else
+#define LVGL_PORT_RUNTIME_BUFFERING (0)
+#endif
+
+typedef enum {
+  LVGL_PORT_BUF_DIRECT = 0,
+  LVGL_PORT_BUF_FULL = 1,
+  LVGL_PORT_BUF_PARTIAL = 2,
+} lvgl_port_buf_mode_t;
+
+typedef struct {
+  uint8_t mode;              // lvgl_port_buf_mode_t
+  uint8_t draw_buf_num;      // PARTIAL only: 1 or 2
+  uint16_t draw_buf_lines;   // PARTIAL only
+  bool draw_buf_psram;       // PARTIAL only
+  uint16_t bounce_buf_lines; // 0 = no bounce buffer
+} lvgl_port_config_t;
+
+#define LVGL_PORT_CONFIG_DEFAULT()                                             \
+  {                                                                            \
+    .mode = LVGL_PORT_BUF_DIRECT, .draw_buf_num = LVGL_PORT_BUFFER_NUM,        \
+    .draw_buf_lines = LVGL_PORT_BUFFER_SIZE / LVGL_PORT_DISP_WIDTH,            \
+    .draw_buf_psram = false, .bounce_buf_lines = 10,                           \
+  }
+
+/**
+ * Per-frame timings, measured around LVGL's refresh timer. `render` is the
+ * time spent drawing, `flush` the time spent in the flush callback (copy,
+ * frame buffer switch and VSYNC wait) or, for non-RGB panels, until the
+ * refresh-finish callback.
+ */
+typedef struct {
+  uint32_t frames;
+  uint32_t render_us_last;
+  uint32_t render_us_avg;
+  uint32_t render_us_max;
+  uint32_t flush_us_last;
+  uint32_t flush_us_avg;
+  uint32_t flush_us_max;
+} lvgl_port_stats_t;
+
 // *INDENT-OFF*
 
 #ifdef __cplusplus
@@ -185,7 +247,10 @@ bool lvgl_port_init(ESP_PanelLcd *lcd, ESP_PanelTouch *tp);
  *
  * @return ture if success, otherwise false
  */
-bool lvgl_port_lock(int timeout_ms);
+bool lvgl_port_lock_at(int timeout_ms, const char *file, int line);
+// The caller's file and line go to the lock profiler (LockProfiler.h)
+#define lvgl_port_lock(timeout_ms)                                             \
+  lvgl_port_lock_at((timeout_ms), __FILE__, __LINE__)
 
 /**
  * @brief Unlock the LVGL mutex. This function should be called after using LVGL
@@ -196,6 +261,33 @@ bool lvgl_port_lock(int timeout_ms);
  */
 bool lvgl_port_unlock(void);
 
+/**
+ * @brief Set the buffering strategy. Must be called before `lcd_init()`;
+ * invalid values are replaced by their defaults.
+ */
+void lvgl_port_set_config(const lvgl_port_config_t *config);
+
+/**
+ * @brief Get the buffering strategy in use (after validation).
+ */
+void lvgl_port_get_config(lvgl_port_config_t *config);
+
+/**
+ * @brief Get / reset the frame timing statistics.
+ */
+void lvgl_port_get_stats(lvgl_port_stats_t *stats);
+void lvgl_port_reset_stats(void);
+
+/**
+ * @brief Copy the area (x_start, y_start)-(x_end, y_end), inclusive, of a
+ * w x h frame into `to` rotated by 90, 180 or 270 degrees: the kernel of the
+ * rotated flush, exposed for RotateBench (DEBUG_BENCHES builds).
+ */
+void lvgl_port_rotate_copy(const lv_color_t *from, lv_color_t *to,
+                           uint16_t x_start, uint16_t y_start, uint16_t x_end,
+                           uint16_t y_end, uint16_t w, uint16_t h,
+                           uint16_t rotate);
+
 void lcd_init(void);
 
 void toggle_backlight(int &isOn);
@@ -0,0 +1,1835 @@
+// Generated by embed_web_assets.py from web/. Edit those files and re-run
+// the script instead of changing this one.
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+  const char *path; // Route it is served at
+  const char *contentType;
+  const uint8_t *gzip;
+  size_t gzipLen;
+  const char *etag;
+  bool immutable; // URL is versioned: cache for good
+};
+
+// common.css: 1587 bytes, 735 gzipped
+static const uint8_t web_common_css[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x54,
+    0xc1, 0x72, 0x9b, 0x30, 0x10, 0xbd, 0xf3, 0x15, 0x9a, 0xf1, 0x74, 0x12,
+    0x77, 0x90, 0x07, 0xb0, 0x9d, 0xb8, 0x70, 0x6a, 0x0f, 0x9d, 0xe6, 0xd0,
+    0x4b, 0x33, 0xfd, 0x80, 0x05, 0x04, 0x68, 0x82, 0x25, 0x46, 0x12, 0xb1,
+    0x9d, 0x4c, 0xfe, 0xbd, 0xbb, 0x02, 0x1b, 0x3b, 0x71, 0x5b, 0x71, 0x00,
+    0x2d, 0x2b, 0xed, 0xbe, 0xf7, 0x76, 0x37, 0x35, 0x5a, 0x3b, 0xf6, 0x1a,
+    0x70, 0x9e, 0xd7, 0x29, 0x9b, 0x45, 0x7e, 0x65, 0xb8, 0x2d, 0xc0, 0x94,
+    0x68, 0x88, 0xfd, 0x22, 0x03, 0x14, 0x85, 0x50, 0xce, 0xfb, 0x54, 0xd5,
+    0x66, 0x43, 0x26, 0x27, 0xf6, 0x64, 0xa8, 0xfc, 0x22, 0x83, 0xed, 0x73,
+    0xdc, 0x6f, 0xfc, 0xa2, 0xbd, 0x30, 0xc6, 0xff, 0x5f, 0xe1, 0xca, 0x82,
+    0xb7, 0xe0, 0x33, 0x7b, 0x65, 0x5b, 0x30, 0xb5, 0x54, 0x29, 0x8b, 0x32,
+    0xd6, 0x41, 0x59, 0x4a, 0x55, 0xfb, 0xef, 0x5c, 0xef, 0xb9, 0x95, 0x2f,
+    0x7e, 0x9b, 0x6b, 0x53, 0x0a, 0xc3, 0xd1, 0x94, 0x31, 0xbe, 0x13, 0xf9,
+    0x93, 0x74, 0xbc, 0xd2, 0xca, 0x71, 0xbb, 0xc5, 0x6c, 0x1b, 0xef, 0x03,
+    0xca, 0x49, 0x68, 0x25, 0x58, 0x51, 0x66, 0xec, 0x2d, 0xc8, 0x75, 0x79,
+    0x40, 0x18, 0x39, 0x14, 0x4f, 0xb5, 0xd1, 0xbd, 0xc2, 0xdc, 0x9f, 0xc1,
+    0xdc, 0x12, 0xac, 0x79, 0x16, 0x14, 0xba, 0xd5, 0xe6, 0x68, 0xa1, 0xac,
+    0xd1, 0xe6, 0x2f, 0xac, 0x60, 0x2b, 0xdb, 0x43, 0xca, 0x38, 0x74, 0x5d,
+    0x2b, 0xb8, 0x3d, 0x58, 0x27, 0xb6, 0x21, 0xfb, 0xd6, 0x4a, 0xf5, 0xf4,
+    0x13, 0x8a, 0x47, 0xbf, 0xff, 0x8e, 0x9e, 0x21, 0xbb, 0x79, 0x50, 0x4e,
+    0x98, 0x1b, 0xfc, 0x78, 0x14, 0xb5, 0x16, 0xec, 0xf7, 0x03, 0x7e, 0xff,
+    0xd2, 0xb9, 0x76, 0x3a, 0x64, 0x3f, 0x44, 0xfb, 0x2c, 0x9c, 0x2c, 0x20,
+    0x64, 0x5f, 0x0d, 0xe6, 0x15, 0x32, 0x0b, 0xca, 0x72, 0x2b, 0x8c, 0x44,
+    0x62, 0x4e, 0x38, 0x93, 0xa8, 0xdb, 0x67, 0xc1, 0x16, 0xf6, 0x7c, 0x27,
+    0x4b, 0xd7, 0xa4, 0xec, 0x2e, 0x1a, 0x2d, 0x23, 0x27, 0x0c, 0x7a, 0xa7,
+    0xb3, 0x00, 0xc3, 0x0b, 0xde, 0x08, 0x59, 0x37, 0xc8, 0x6f, 0xbc, 0x58,
+    0x13, 0x77, 0x4d, 0x8c, 0xe4, 0x0d, 0x2c, 0xc8, 0x17, 0x81, 0x77, 0x6d,
+    0xf0, 0xe4, 0x60, 0xd8, 0x8d, 0x9e, 0x1b, 0x94, 0x8e, 0xb5, 0xc2, 0x61,
+    0x9e, 0xdc, 0x76, 0x50, 0xf8, 0x98, 0x3c, 0x26, 0xbf, 0x21, 0x02, 0x52,
+    0xea, 0x9c, 0xde, 0x8e, 0x89, 0xb0, 0x0b, 0x5a, 0x06, 0x7d, 0xe7, 0x44,
+    0xe6, 0x82, 0xc4, 0xbf, 0xca, 0x26, 0xfd, 0x40, 0xee, 0x06, 0x81, 0x30,
+    0xb5, 0x6e, 0xcf, 0xac, 0x6e, 0x65, 0xc9, 0x66, 0x49, 0x92, 0x7c, 0x00,
+    0x3a, 0xea, 0x68, 0xa0, 0x94, 0xbd, 0x45, 0xef, 0xbb, 0x09, 0xeb, 0x65,
+    0x26, 0x81, 0x57, 0xbf, 0x81, 0x52, 0xef, 0x88, 0x84, 0x15, 0x5e, 0x4b,
+    0x76, 0x66, 0xea, 0x1c, 0x6e, 0xa3, 0xd0, 0x3f, 0x8b, 0xf5, 0x9c, 0x68,
+    0x90, 0xaa, 0xeb, 0x51, 0x0d, 0x2b, 0x5a, 0x51, 0xe0, 0x9b, 0xc4, 0x04,
+    0x23, 0x00, 0xb3, 0x1d, 0x29, 0x8d, 0xa3, 0xe8, 0x53, 0x76, 0x91, 0xfa,
+    0x2c, 0x06, 0x7a, 0xae, 0xa6, 0xbd, 0x5c, 0x2e, 0x4f, 0xe5, 0xb1, 0x6b,
+    0xa4, 0x13, 0x67, 0x20, 0xe2, 0x15, 0xa5, 0x76, 0x46, 0xf9, 0x00, 0xe0,
+    0x3d, 0xaa, 0x84, 0x8c, 0xba, 0x77, 0x24, 0x5a, 0xca, 0x94, 0x56, 0x78,
+    0x87, 0x33, 0x28, 0xbf, 0x74, 0x52, 0xa3, 0xa8, 0xd0, 0xb6, 0x2c, 0x5a,
+    0x24, 0xf6, 0x03, 0xf4, 0x78, 0x4d, 0x27, 0x47, 0x48, 0x69, 0xa5, 0x8b,
+    0xde, 0x1e, 0x81, 0x0d, 0x3b, 0x14, 0x7c, 0x0c, 0x76, 0x5d, 0xa9, 0x4b,
+    0xd6, 0xe8, 0x49, 0x26, 0xd2, 0x92, 0xf5, 0x3a, 0x8c, 0x97, 0x77, 0x48,
+    0x5c, 0xec, 0x45, 0xcd, 0x7b, 0x8c, 0xaa, 0xfe, 0xc5, 0xd3, 0xe5, 0xed,
+    0x47, 0x56, 0x66, 0x7e, 0x20, 0x1c, 0xa9, 0x1b, 0xe0, 0xfd, 0x8f, 0xa2,
+    0x8b, 0xaa, 0xbc, 0x9f, 0xce, 0xbf, 0x23, 0xad, 0xe8, 0x8d, 0xa5, 0x10,
+    0x9d, 0x96, 0xd4, 0x5b, 0x7f, 0xa3, 0xed, 0x98, 0x7b, 0x0a, 0x85, 0x93,
+    0xcf, 0x02, 0x59, 0xf1, 0x7e, 0x95, 0x36, 0x48, 0xa2, 0x2d, 0xa0, 0x15,
+    0xb7, 0xd1, 0xe2, 0xcb, 0x06, 0x51, 0x6a, 0x2a, 0x7a, 0x87, 0xfd, 0x8c,
+    0xfb, 0x09, 0x73, 0x5a, 0x4a, 0x0b, 0x79, 0x2b, 0xb0, 0xa4, 0xcf, 0x3d,
+    0xd6, 0xd8, 0x00, 0x63, 0x02, 0x4a, 0x3b, 0x8e, 0xf1, 0xf4, 0x6e, 0x18,
+    0x26, 0x8b, 0xdc, 0x29, 0xec, 0xdd, 0x42, 0xab, 0x12, 0xcc, 0x81, 0x54,
+    0x38, 0xaf, 0x26, 0x2a, 0x99, 0x63, 0xeb, 0xd0, 0xec, 0x3b, 0x9d, 0x28,
+    0x41, 0xd5, 0xc2, 0xbc, 0x73, 0x1f, 0x48, 0xc5, 0x41, 0x38, 0xff, 0x78,
+    0x88, 0xa6, 0x0c, 0x89, 0x4c, 0x45, 0x8c, 0xf1, 0x65, 0x8d, 0xb0, 0x89,
+    0x7c, 0xa4, 0xe2, 0xd8, 0xb0, 0x4e, 0x77, 0x29, 0x5b, 0xfa, 0x6e, 0x3d,
+    0x4b, 0xfd, 0x3e, 0x3b, 0x9f, 0x04, 0x5e, 0x84, 0xe9, 0x3e, 0xec, 0x05,
+    0x76, 0x65, 0xe0, 0x0d, 0x51, 0x4a, 0x44, 0x65, 0x60, 0x60, 0xd8, 0x6b,
+    0x39, 0xcd, 0x63, 0xac, 0x08, 0xba, 0xe7, 0x34, 0x7c, 0xc7, 0x22, 0x9d,
+    0x7a, 0x85, 0x86, 0x38, 0x86, 0xf9, 0x03, 0x5e, 0x5f, 0xdf, 0x03, 0x33,
+    0x06, 0x00, 0x00,
+};
+
+// app.js: 845 bytes, 498 gzipped
+static const uint8_t web_app_js[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x53,
+    0xc1, 0x8e, 0xd3, 0x30, 0x10, 0xbd, 0xf7, 0x2b, 0x66, 0x59, 0x69, 0xed,
+    0x88, 0x2a, 0xe1, 0x4c, 0xe9, 0xae, 0x76, 0x0b, 0x87, 0x4a, 0x2b, 0x14,
+    0x11, 0x38, 0x21, 0x84, 0x5c, 0x67, 0x92, 0x98, 0x3a, 0x76, 0xb0, 0x9d,
+    0x86, 0x88, 0xdd, 0x7f, 0xdf, 0xb1, 0x29, 0xdd, 0x82, 0x84, 0xb8, 0x59,
+    0x33, 0x6f, 0xde, 0x7b, 0xf3, 0x6c, 0x17, 0x05, 0x54, 0x9d, 0x70, 0x58,
+    0xc3, 0x6e, 0x06, 0x3c, 0xa0, 0x9b, 0x61, 0x10, 0x2d, 0xe6, 0xf0, 0xb1,
+    0x43, 0x28, 0xb7, 0xef, 0x41, 0xda, 0x1e, 0x3d, 0x34, 0xce, 0xf6, 0x70,
+    0x33, 0x28, 0xb3, 0x06, 0xee, 0xb0, 0xc7, 0x7e, 0x87, 0x34, 0x93, 0x81,
+    0x75, 0xbf, 0x5a, 0xc2, 0x2c, 0x8a, 0x02, 0x50, 0x38, 0xad, 0xd0, 0xc1,
+    0x41, 0x79, 0x15, 0x56, 0x10, 0x88, 0xe2, 0xb6, 0xdc, 0x7a, 0x90, 0x1d,
+    0xca, 0x3d, 0xa8, 0xb0, 0x4c, 0xa5, 0xc8, 0xef, 0xc1, 0x1a, 0x3d, 0x43,
+    0x8d, 0x52, 0xd5, 0x08, 0x53, 0x27, 0x02, 0x04, 0x0b, 0xbe, 0xb3, 0x53,
+    0xbe, 0x90, 0xd6, 0xf8, 0x90, 0xb4, 0x49, 0xac, 0x19, 0x8d, 0x0c, 0xca,
+    0x1a, 0xe0, 0x19, 0xfc, 0x3c, 0xb6, 0x06, 0x6a, 0x18, 0x9c, 0xe0, 0xd3,
+    0x87, 0xfb, 0x8a, 0x24, 0x65, 0x57, 0x0a, 0x27, 0x7a, 0xcf, 0xb5, 0x95,
+    0x22, 0x62, 0x73, 0x9f, 0xaa, 0x59, 0xde, 0x62, 0xe0, 0x8c, 0x4c, 0xb3,
+    0x6c, 0xb5, 0x50, 0x0d, 0xf0, 0x21, 0x83, 0x88, 0xd1, 0x55, 0xb0, 0x2e,
+    0x2e, 0xe9, 0x31, 0x6c, 0x03, 0xf6, 0x9c, 0x4d, 0xb8, 0xfb, 0x1a, 0x71,
+    0x4b, 0x18, 0x08, 0xea, 0x30, 0x8c, 0xce, 0xfc, 0x09, 0x6d, 0xff, 0x86,
+    0x66, 0xf0, 0xf0, 0x00, 0x8c, 0xad, 0x16, 0x8f, 0x19, 0xa7, 0x99, 0x93,
+    0x4f, 0x5f, 0x26, 0xa7, 0xff, 0xd3, 0xa9, 0xad, 0x1c, 0x7b, 0x34, 0x21,
+    0x12, 0xbf, 0xd3, 0x18, 0x8f, 0x77, 0xf3, 0xb6, 0x3e, 0xda, 0xcd, 0x0f,
+    0x42, 0x8f, 0x48, 0xb4, 0xa7, 0x95, 0x1c, 0x6a, 0x2b, 0xea, 0xa8, 0xf4,
+    0x18, 0x93, 0xae, 0x28, 0x29, 0x9f, 0xd2, 0xbc, 0xd4, 0xb6, 0x55, 0x06,
+    0x2c, 0x5d, 0x9d, 0x16, 0x33, 0x8c, 0x26, 0x28, 0x0d, 0x22, 0xc5, 0xa7,
+    0x3c, 0xec, 0x8d, 0x9d, 0xcc, 0xb3, 0x39, 0x87, 0xdf, 0x47, 0xe5, 0xb0,
+    0x54, 0xe6, 0x2c, 0x4e, 0xd4, 0x94, 0xe7, 0x3f, 0xfd, 0x24, 0xfa, 0xdf,
+    0x01, 0xa2, 0xce, 0x08, 0x9e, 0xfb, 0x30, 0x6b, 0xcc, 0x6b, 0xe5, 0x87,
+    0x28, 0xb9, 0x4e, 0x62, 0x37, 0xc0, 0x8c, 0x35, 0xc8, 0xe0, 0x35, 0xb0,
+    0x46, 0xe3, 0x0f, 0x76, 0xca, 0xf1, 0xe2, 0x82, 0xfa, 0x47, 0xdf, 0xf7,
+    0x62, 0x87, 0x9a, 0x2e, 0xbf, 0x49, 0xde, 0xe5, 0xe8, 0x1c, 0x09, 0x41,
+    0x6f, 0xe9, 0x11, 0xf0, 0xcd, 0xdb, 0xe2, 0xce, 0xda, 0x7d, 0xb6, 0x04,
+    0x8f, 0x08, 0x85, 0x18, 0x54, 0x41, 0x06, 0x1b, 0xd5, 0x3e, 0xfb, 0x8f,
+    0x19, 0x6c, 0x52, 0x2d, 0xf9, 0x3f, 0x0a, 0x34, 0x18, 0x64, 0xc7, 0xd9,
+    0xd9, 0x04, 0x25, 0x48, 0xfc, 0x86, 0x3b, 0x58, 0x5f, 0x83, 0xcb, 0xbf,
+    0x79, 0x4b, 0x0b, 0xa7, 0xec, 0x4e, 0x54, 0xe8, 0x25, 0xf7, 0x67, 0x24,
+    0x55, 0x70, 0xca, 0xb4, 0x54, 0xa2, 0xa8, 0x69, 0x2d, 0x89, 0xbc, 0xf8,
+    0x7c, 0xf5, 0xe6, 0xfa, 0x05, 0xfb, 0x52, 0xb4, 0x4b, 0x90, 0x91, 0x88,
+    0x5d, 0x5d, 0x32, 0x78, 0x09, 0x32, 0x97, 0xf4, 0x63, 0x36, 0xe4, 0xf9,
+    0x36, 0xf0, 0x57, 0x19, 0x55, 0xd8, 0x8a, 0x25, 0xf2, 0x27, 0xe3, 0x29,
+    0xb6, 0x80, 0x4d, 0x03, 0x00, 0x00,
+};
+
+// index.html: 4249 bytes, 1608 gzipped
+static const uint8_t web_index_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58,
+    0x5b, 0x53, 0xdb, 0x38, 0x14, 0x7e, 0xcf, 0xaf, 0x38, 0x35, 0xb3, 0x6b,
+    0x7b, 0x4b, 0x9c, 0x6b, 0x29, 0x8d, 0xe3, 0x30, 0xc3, 0xe5, 0x81, 0xdd,
+    0xb6, 0x74, 0x08, 0x4c, 0x67, 0x67, 0xfa, 0x22, 0xdb, 0x4a, 0xa2, 0xe2,
+    0x48, 0xae, 0x24, 0x87, 0x66, 0x69, 0xff, 0xfb, 0x1e, 0xc9, 0x0e, 0x71,
+    0x52, 0x28, 0x64, 0xbb, 0x0f, 0x40, 0x72, 0x7c, 0x74, 0xee, 0xe7, 0xfb,
+    0x64, 0x86, 0x2f, 0x4e, 0x2f, 0x4e, 0xae, 0xfe, 0xfe, 0x70, 0x06, 0x33,
+    0x3d, 0xcf, 0x46, 0x8d, 0xe1, 0xea, 0x0f, 0x25, 0x29, 0xfe, 0x99, 0x53,
+    0x4d, 0x80, 0x93, 0x39, 0x8d, 0x9c, 0x05, 0xa3, 0xb7, 0xb9, 0x90, 0xda,
+    0x81, 0x44, 0x70, 0x4d, 0xb9, 0x8e, 0x9c, 0x5b, 0x96, 0xea, 0x59, 0x94,
+    0xd2, 0x05, 0x4b, 0x68, 0xd3, 0x7e, 0xd9, 0x07, 0xc6, 0x99, 0x66, 0x24,
+    0x6b, 0xaa, 0x84, 0x64, 0x34, 0xea, 0x38, 0x68, 0x44, 0x33, 0x9d, 0xd1,
+    0xd1, 0x29, 0x9b, 0x32, 0x4d, 0x32, 0x78, 0xcb, 0x62, 0x49, 0x24, 0x23,
+    0x1c, 0x9a, 0x70, 0x4a, 0xd4, 0x2c, 0x16, 0x44, 0xa6, 0xc3, 0x56, 0xa9,
+    0xd4, 0x18, 0x66, 0x8c, 0xdf, 0x80, 0xa4, 0x59, 0xe4, 0x28, 0xbd, 0xcc,
+    0xa8, 0x9a, 0x51, 0x8a, 0x2e, 0x67, 0x92, 0x4e, 0x22, 0xa7, 0xa5, 0x34,
+    0xd1, 0x2c, 0x69, 0x25, 0x62, 0x3e, 0x17, 0x3c, 0x48, 0x94, 0x3a, 0x5a,
+    0x44, 0xed, 0xfe, 0x61, 0xda, 0x6b, 0xc7, 0x7d, 0xe3, 0x49, 0x25, 0x92,
+    0xe5, 0x1a, 0x94, 0x4c, 0xd6, 0xca, 0x24, 0xcf, 0x83, 0xcf, 0x46, 0xf1,
+    0xf0, 0xf0, 0xf0, 0x55, 0xfa, 0xe6, 0xd5, 0x81, 0x33, 0x1a, 0xb6, 0x4a,
+    0x45, 0x73, 0xc2, 0x38, 0x19, 0x35, 0x02, 0xa3, 0xdc, 0x9c, 0x4a, 0x96,
+    0xc2, 0x1d, 0xa4, 0x4c, 0xe5, 0x19, 0x59, 0x0e, 0xc0, 0x7c, 0x0f, 0xed,
+    0xef, 0xa6, 0xa6, 0x73, 0x94, 0x69, 0xda, 0x4c, 0x44, 0x56, 0xcc, 0xb9,
+    0x1a, 0x40, 0x67, 0x22, 0xcd, 0x0f, 0x3e, 0x27, 0x39, 0x7e, 0x7b, 0x95,
+    0x7f, 0x0d, 0x61, 0x4e, 0xe4, 0x94, 0xf1, 0x66, 0x2c, 0xb4, 0x16, 0xf3,
+    0x01, 0x74, 0xdb, 0x46, 0xf8, 0xbd, 0xb2, 0x9e, 0x60, 0x9e, 0x68, 0x3d,
+    0x26, 0xc9, 0xcd, 0x54, 0x8a, 0x82, 0xa7, 0x03, 0xd8, 0xeb, 0x74, 0x3a,
+    0x21, 0xe4, 0x24, 0x4d, 0x19, 0x9f, 0xae, 0x8c, 0xc4, 0x42, 0xa6, 0x54,
+    0x36, 0x25, 0x49, 0x59, 0x61, 0xfc, 0x74, 0xd7, 0x42, 0xfc, 0x96, 0x7f,
+    0x05, 0x25, 0x32, 0x8c, 0x73, 0xaf, 0xdb, 0xed, 0x86, 0xa0, 0xe9, 0x57,
+    0xdd, 0x24, 0x19, 0x9b, 0xf2, 0x01, 0x24, 0xd8, 0x14, 0x2a, 0xd7, 0x0e,
+    0x17, 0x58, 0xed, 0x3b, 0x98, 0x60, 0xb7, 0x9a, 0x8a, 0xfd, 0x43, 0x31,
+    0x9e, 0xbe, 0x31, 0x65, 0x05, 0xb7, 0x94, 0x4d, 0x67, 0x7a, 0x00, 0x87,
+    0xed, 0x76, 0x88, 0x0d, 0xcd, 0x04, 0xda, 0x5e, 0x10, 0xe9, 0x35, 0x9b,
+    0x24, 0x31, 0x76, 0xfc, 0x70, 0x5d, 0x86, 0x38, 0x13, 0xc9, 0xcd, 0xda,
+    0x6c, 0x46, 0x62, 0xba, 0x65, 0xb8, 0x8c, 0xb1, 0x32, 0xb3, 0x77, 0x70,
+    0x70, 0x50, 0x05, 0xa6, 0x25, 0xe1, 0x6a, 0x22, 0x24, 0xd6, 0xa2, 0xc8,
+    0x73, 0x2a, 0x13, 0xa2, 0x68, 0x08, 0x19, 0xd5, 0x18, 0x67, 0x53, 0xe5,
+    0x24, 0x29, 0xd3, 0x2e, 0xab, 0x84, 0x5d, 0x29, 0x9b, 0x31, 0x6c, 0x55,
+    0xd3, 0x17, 0x8b, 0x74, 0x69, 0x66, 0xb1, 0x33, 0x5a, 0x0f, 0x4d, 0x6d,
+    0x64, 0x50, 0xde, 0x18, 0xa6, 0x6c, 0x01, 0x49, 0x46, 0x94, 0x8a, 0x1c,
+    0x53, 0x60, 0x67, 0x53, 0x74, 0xdf, 0xd6, 0x87, 0xe4, 0xa5, 0xfe, 0x10,
+    0xe3, 0xe0, 0x1b, 0x72, 0xac, 0x9b, 0x03, 0x2c, 0x45, 0x83, 0xd8, 0x25,
+    0xed, 0x8c, 0xda, 0x18, 0x19, 0xea, 0x3c, 0xa0, 0x69, 0x4b, 0xe1, 0x8c,
+    0xce, 0x71, 0x3a, 0xd4, 0x4a, 0xa9, 0x85, 0x6e, 0xfe, 0x8b, 0xb3, 0xb9,
+    0x48, 0xa9, 0x33, 0x0a, 0x82, 0xe0, 0x29, 0x6f, 0xef, 0x50, 0x71, 0xcb,
+    0x59, 0xcd, 0xa7, 0x31, 0xf5, 0x59, 0xc4, 0x0e, 0xd8, 0x62, 0x46, 0xce,
+    0xaa, 0x8b, 0x5c, 0x70, 0x7a, 0x3f, 0xa0, 0x5a, 0xdc, 0x8f, 0x6c, 0x6d,
+    0x80, 0x56, 0xf3, 0x53, 0xf6, 0x71, 0x0f, 0xf7, 0x25, 0xdc, 0x68, 0x72,
+    0x0f, 0xf5, 0x9d, 0x8d, 0x04, 0xb7, 0x7c, 0xec, 0xb4, 0x30, 0xed, 0xda,
+    0xc2, 0xac, 0xe3, 0x31, 0x7d, 0x8a, 0x0b, 0x5c, 0x1f, 0x0e, 0x82, 0x27,
+    0x19, 0x4b, 0x6e, 0x22, 0x07, 0xc7, 0x0f, 0x37, 0x19, 0x17, 0xde, 0xa2,
+    0x80, 0xdb, 0x8a, 0xa5, 0xb8, 0x55, 0xd4, 0x75, 0x46, 0xbf, 0xef, 0x75,
+    0xba, 0x87, 0xdd, 0x3e, 0xae, 0xd0, 0x25, 0x9d, 0x0b, 0x8d, 0x55, 0x29,
+    0x8f, 0xae, 0x6d, 0x54, 0xe5, 0x8b, 0x35, 0x6f, 0x2a, 0x8a, 0xb8, 0x95,
+    0x12, 0xb9, 0x74, 0x1e, 0xb7, 0x8c, 0xa0, 0xc5, 0xd7, 0x76, 0x5f, 0x87,
+    0x30, 0x46, 0x01, 0xa7, 0xf2, 0x97, 0x0d, 0x1b, 0x54, 0x5b, 0x19, 0xee,
+    0xf7, 0xfb, 0x21, 0x9c, 0x88, 0x05, 0x95, 0xea, 0x97, 0xed, 0x1a, 0x30,
+    0x29, 0xf2, 0x95, 0xe5, 0xce, 0x1b, 0x5c, 0xe6, 0x63, 0x2b, 0xaa, 0x59,
+    0xfe, 0x71, 0x46, 0xea, 0xfb, 0xb2, 0xea, 0x61, 0x85, 0x3a, 0xab, 0x1d,
+    0xee, 0xf5, 0x10, 0x9a, 0x3a, 0xce, 0x83, 0x81, 0xa5, 0x84, 0x4f, 0xa9,
+    0xac, 0x45, 0xc5, 0x26, 0x1e, 0x86, 0x3a, 0x61, 0x72, 0xee, 0xb9, 0x97,
+    0x34, 0x16, 0x42, 0x43, 0x49, 0x0a, 0x47, 0xae, 0xef, 0x23, 0x52, 0x6c,
+    0x47, 0x2d, 0x29, 0xce, 0xb3, 0xd4, 0x2e, 0x6e, 0x3d, 0x42, 0xbd, 0x2e,
+    0x24, 0x87, 0x09, 0xc9, 0x10, 0x1a, 0x9c, 0x51, 0x75, 0x7c, 0xbc, 0x54,
+    0x38, 0x40, 0x3f, 0x26, 0xf1, 0xf3, 0xe8, 0x37, 0xe0, 0xb1, 0x43, 0x7a,
+    0xa4, 0x4b, 0xec, 0x40, 0xcd, 0x7a, 0x2b, 0xbd, 0x55, 0x7a, 0xed, 0xf6,
+    0x64, 0x62, 0xc6, 0x7b, 0x0b, 0xb0, 0xcb, 0xa1, 0xac, 0xcf, 0xfc, 0x81,
+    0x9d, 0xc9, 0x53, 0x46, 0xa6, 0x5c, 0x28, 0xa4, 0x13, 0x6c, 0xd9, 0xac,
+    0xf7, 0xec, 0x76, 0xc9, 0x82, 0x5f, 0x61, 0xae, 0xca, 0xf3, 0x31, 0xb3,
+    0x82, 0xc3, 0x35, 0x92, 0x23, 0x58, 0xc9, 0x8f, 0xa9, 0xad, 0x28, 0x69,
+    0x52, 0xf0, 0xc4, 0x14, 0x0b, 0xd6, 0x87, 0xe1, 0xae, 0x81, 0x25, 0x7e,
+    0xb1, 0xaa, 0xb1, 0x63, 0x4c, 0x29, 0x2d, 0x24, 0x99, 0x52, 0x28, 0x8c,
+    0x49, 0x6d, 0xf4, 0x8e, 0xe0, 0x6a, 0xc6, 0x14, 0xa6, 0xb4, 0x04, 0x4d,
+    0x6e, 0x28, 0x10, 0x98, 0xd0, 0x5b, 0x28, 0xc3, 0x52, 0x81, 0x83, 0x9d,
+    0x28, 0x6b, 0x1d, 0x36, 0x50, 0xa2, 0x34, 0xe4, 0x8c, 0x43, 0x04, 0x1f,
+    0xce, 0xdf, 0xc3, 0xb7, 0x6f, 0x90, 0x4b, 0x31, 0xcf, 0xb5, 0xe7, 0x9c,
+    0x19, 0x08, 0x80, 0x8f, 0x34, 0x36, 0x0f, 0x06, 0x8e, 0x1f, 0xa2, 0x67,
+    0xf0, 0x5e, 0xa0, 0xee, 0xfa, 0xf8, 0x84, 0xea, 0x64, 0xe6, 0xb9, 0xc8,
+    0xac, 0xac, 0x65, 0x3d, 0xb7, 0x30, 0xd4, 0x23, 0x54, 0x89, 0x5c, 0x78,
+    0x09, 0x94, 0x27, 0x08, 0x50, 0xd7, 0x97, 0xe7, 0x27, 0x68, 0x11, 0x41,
+    0x87, 0x6b, 0xcf, 0x9c, 0xde, 0x87, 0x3b, 0xbc, 0x4c, 0xcc, 0x04, 0xb2,
+    0x9e, 0xfb, 0xe1, 0x62, 0x7c, 0xe5, 0x7e, 0xf7, 0x1b, 0x81, 0x9e, 0x51,
+    0xee, 0x49, 0x88, 0x46, 0x65, 0x86, 0xd2, 0x12, 0x4c, 0xa1, 0x20, 0x8a,
+    0x22, 0xe8, 0xb7, 0x3b, 0x3e, 0xe8, 0x19, 0xee, 0x3a, 0x70, 0xcc, 0xe3,
+    0x4c, 0x4a, 0x21, 0x3d, 0xe7, 0x9a, 0x93, 0x02, 0xad, 0x48, 0xec, 0x4e,
+    0x0a, 0xde, 0x47, 0x29, 0xf8, 0xd4, 0x44, 0xea, 0x9b, 0x48, 0xab, 0x51,
+    0x92, 0x81, 0xc1, 0x34, 0x0f, 0x05, 0xf7, 0x2e, 0x8c, 0xa0, 0xf4, 0x82,
+    0x97, 0x12, 0x89, 0x69, 0x5e, 0x9d, 0x8d, 0xaf, 0xe0, 0xf2, 0x6c, 0x7c,
+    0xfd, 0xf6, 0x6a, 0x3c, 0xf8, 0xc4, 0x3f, 0x71, 0x07, 0x23, 0x37, 0x5a,
+    0xd5, 0x29, 0x9c, 0x57, 0x4c, 0x91, 0x9a, 0x33, 0xd5, 0x09, 0xeb, 0x7f,
+    0x00, 0x46, 0x8f, 0xfa, 0x46, 0xab, 0x51, 0xbb, 0x45, 0xd4, 0xc6, 0x92,
+    0x8b, 0x66, 0x2e, 0x19, 0xd2, 0xc6, 0x6a, 0xe4, 0xea, 0x10, 0xd7, 0x6f,
+    0xd7, 0x08, 0xbe, 0x04, 0xbd, 0xf5, 0xc0, 0xf6, 0x7a, 0xbd, 0xfb, 0xbb,
+    0x40, 0xf9, 0xd0, 0xde, 0x1f, 0x36, 0x07, 0xf8, 0x71, 0xb8, 0x9e, 0x4c,
+    0x26, 0x9b, 0xa3, 0xdb, 0x7f, 0xe0, 0x46, 0x52, 0xc3, 0xfc, 0xe7, 0x73,
+    0xb3, 0x33, 0x7a, 0x4f, 0x16, 0x6c, 0x6a, 0x57, 0xb8, 0x1a, 0xff, 0x9d,
+    0xc1, 0x5f, 0xd2, 0x9c, 0x12, 0xed, 0xbd, 0xde, 0x37, 0x14, 0xe0, 0xd7,
+    0x39, 0xe0, 0x39, 0x88, 0xef, 0xde, 0x57, 0x73, 0x9b, 0x8f, 0x6a, 0x97,
+    0xa7, 0xd2, 0x98, 0x01, 0xc2, 0xd7, 0x6f, 0x0e, 0x70, 0xb7, 0x6b, 0x37,
+    0x85, 0x6d, 0x94, 0x7d, 0x82, 0x00, 0x76, 0x72, 0xf6, 0x04, 0x51, 0x3c,
+    0xc9, 0x62, 0xbb, 0x3a, 0x43, 0xb6, 0x3b, 0xb6, 0x47, 0x77, 0xf0, 0x55,
+    0xd2, 0xcf, 0x6e, 0x9e, 0x7e, 0x4a, 0x53, 0x4f, 0x12, 0xd2, 0x6e, 0xbe,
+    0x1e, 0x26, 0xae, 0xa7, 0x7c, 0xcd, 0x09, 0x2f, 0x48, 0xb6, 0x73, 0x05,
+    0x3b, 0x98, 0xd7, 0x3b, 0x7b, 0x74, 0x97, 0xc4, 0xa8, 0xd9, 0x7f, 0xb5,
+    0xab, 0xb3, 0x83, 0x43, 0x6c, 0x97, 0x85, 0x0e, 0xf5, 0x28, 0x23, 0xdf,
+    0x03, 0x7f, 0x0d, 0x56, 0x4b, 0x1c, 0x74, 0xfd, 0x0a, 0x21, 0xa3, 0x91,
+    0xc4, 0x77, 0x18, 0xc1, 0x3d, 0xbf, 0x92, 0xa4, 0xd1, 0xe8, 0xae, 0x91,
+    0x8a, 0xa4, 0x98, 0x23, 0x08, 0x04, 0x53, 0xaa, 0xcf, 0x32, 0x6a, 0x3e,
+    0x1e, 0x2f, 0xcf, 0x53, 0xcf, 0xb5, 0xf7, 0x56, 0x73, 0x18, 0xf7, 0xfc,
+    0xa4, 0x7c, 0x59, 0x43, 0xa4, 0x4f, 0x83, 0x24, 0x3d, 0x31, 0x4f, 0x10,
+    0xc2, 0xd2, 0x00, 0x69, 0xf6, 0xc6, 0x7e, 0x0b, 0x1f, 0xb7, 0x63, 0xae,
+    0xa4, 0x0f, 0x99, 0x29, 0xa4, 0xc4, 0xcf, 0xe6, 0x1e, 0x8a, 0x48, 0x0d,
+    0x6d, 0x38, 0x02, 0xe7, 0xe4, 0xd4, 0x01, 0x44, 0xc7, 0xe3, 0x8b, 0x8b,
+    0xbf, 0x1c, 0x03, 0xa1, 0x61, 0xa3, 0xd5, 0xc2, 0x57, 0xbd, 0x05, 0x12,
+    0x54, 0x9e, 0x22, 0x12, 0x20, 0x04, 0x30, 0x44, 0x05, 0xb0, 0xa1, 0x01,
+    0xe1, 0x69, 0xed, 0x3d, 0x08, 0xf0, 0xbe, 0x6a, 0x08, 0x68, 0x8a, 0xf7,
+    0x02, 0x65, 0xf9, 0xe6, 0x96, 0xf1, 0x54, 0xdc, 0x06, 0x67, 0x0b, 0x74,
+    0x33, 0x16, 0x85, 0x4c, 0xa8, 0xe1, 0xc0, 0x92, 0xb6, 0x28, 0xd2, 0x43,
+    0xc9, 0x08, 0xeb, 0xa7, 0x55, 0xd5, 0xa8, 0x91, 0x60, 0xd5, 0xc2, 0x06,
+    0x55, 0x01, 0xb6, 0xc3, 0x6a, 0xbc, 0x65, 0x78, 0x95, 0xc0, 0xd5, 0xf4,
+    0xdc, 0xcc, 0xbe, 0x44, 0x2c, 0xdd, 0x7d, 0xa0, 0x25, 0x19, 0x94, 0x06,
+    0x53, 0xb4, 0xf7, 0xe7, 0xf8, 0xe2, 0x7d, 0x90, 0x13, 0xa9, 0xa8, 0x47,
+    0x03, 0x8c, 0x97, 0xf8, 0xe1, 0xff, 0x56, 0xde, 0xef, 0x8f, 0xc5, 0x83,
+    0x69, 0xab, 0xe7, 0x05, 0x83, 0x4a, 0x99, 0x71, 0xf1, 0x58, 0x44, 0x68,
+    0xc9, 0x66, 0x9d, 0x05, 0x76, 0x3a, 0x83, 0x0a, 0x93, 0x6d, 0x54, 0x71,
+    0xa1, 0x96, 0xd8, 0x21, 0xd7, 0xbe, 0xc5, 0xb9, 0xd8, 0x24, 0xd7, 0xbc,
+    0x0a, 0xb8, 0x56, 0x7b, 0x3b, 0x83, 0x8a, 0x7e, 0x5f, 0x82, 0x0b, 0x9e,
+    0xe1, 0xf2, 0x77, 0x44, 0xcf, 0x02, 0xdb, 0x23, 0x2f, 0x0d, 0x56, 0x1d,
+    0x82, 0x3f, 0x70, 0xc4, 0xdb, 0xbe, 0xd1, 0xfa, 0xcd, 0x47, 0xad, 0x06,
+    0x3e, 0xfb, 0x52, 0xd0, 0x02, 0x09, 0x19, 0xdd, 0xc0, 0xa7, 0xa2, 0xdb,
+    0xee, 0x76, 0xc1, 0xb5, 0x65, 0xa8, 0xe4, 0xc6, 0x60, 0xf9, 0xd1, 0x06,
+    0xe0, 0xfa, 0x65, 0x55, 0x36, 0x38, 0xb4, 0x55, 0xbd, 0xed, 0xb5, 0xca,
+    0xff, 0x40, 0xfc, 0x0b, 0x56, 0x1f, 0x20, 0x00, 0x99, 0x10, 0x00, 0x00,
+};
+
+// browse.html: 15038 bytes, 4855 gzipped
+static const uint8_t web_browse_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x5b,
+    0xfd, 0x72, 0xdb, 0x38, 0x92, 0xff, 0xdf, 0x4f, 0x81, 0x68, 0xf6, 0x42,
+    0xe9, 0x22, 0xc9, 0x92, 0x3f, 0x12, 0x5b, 0xb4, 0x94, 0x4a, 0x6c, 0xcf,
+    0xac, 0xf7, 0xbc, 0x89, 0x2b, 0x4e, 0xee, 0x6a, 0x6b, 0x6b, 0xeb, 0x06,
+    0x22, 0x41, 0x09, 0x13, 0x8a, 0x64, 0xf8, 0x61, 0x59, 0x9b, 0xf5, 0x2b,
+    0xdc, 0x2b, 0xdc, 0x23, 0xdc, 0xab, 0xdd, 0x23, 0x5c, 0x77, 0x03, 0x20,
+    0x41, 0x4a, 0xb2, 0xec, 0xcc, 0x56, 0xdd, 0xa4, 0x6a, 0x2c, 0x81, 0x40,
+    0xa3, 0xd1, 0x1f, 0xbf, 0xfe, 0x01, 0xa0, 0xce, 0x5e, 0x5c, 0x7c, 0x3c,
+    0xff, 0xfc, 0x97, 0x9b, 0x4b, 0x36, 0xcf, 0x17, 0xe1, 0x64, 0xef, 0xcc,
+    0xfc, 0x11, 0xdc, 0x87, 0x3f, 0x0b, 0x91, 0x73, 0x16, 0xf1, 0x85, 0x18,
+    0xb7, 0xee, 0xa4, 0x58, 0x26, 0x71, 0x9a, 0xb7, 0x98, 0x17, 0x47, 0xb9,
+    0x88, 0xf2, 0x71, 0x6b, 0x29, 0xfd, 0x7c, 0x3e, 0xf6, 0xc5, 0x9d, 0xf4,
+    0x44, 0x8f, 0xbe, 0x74, 0x99, 0x8c, 0x64, 0x2e, 0x79, 0xd8, 0xcb, 0x3c,
+    0x1e, 0x8a, 0xf1, 0xb0, 0x65, 0x84, 0x78, 0x73, 0x9e, 0x66, 0x02, 0x06,
+    0x7d, 0xf9, 0xfc, 0x73, 0xef, 0x04, 0x9b, 0x73, 0x99, 0x87, 0x62, 0xf2,
+    0x49, 0x2c, 0xe2, 0x5c, 0xb0, 0x73, 0x90, 0x99, 0xc6, 0xe1, 0xd9, 0xbe,
+    0x6a, 0xdd, 0x3b, 0xcb, 0xbc, 0x54, 0x26, 0x39, 0xcb, 0x52, 0x6f, 0xdc,
+    0xda, 0xcf, 0x72, 0x9e, 0x4b, 0x6f, 0x9f, 0x27, 0x49, 0xff, 0xb7, 0xec,
+    0xed, 0xdd, 0xf8, 0xe4, 0xe4, 0xe4, 0xd8, 0x3f, 0x3d, 0x7e, 0xdd, 0x9a,
+    0x9c, 0xed, 0xab, 0x8e, 0x38, 0x22, 0x5f, 0xe1, 0xc8, 0x7f, 0x65, 0xdf,
+    0xd9, 0x34, 0xbe, 0xef, 0x65, 0xf2, 0xef, 0x32, 0x9a, 0x8d, 0xe0, 0x73,
+    0xea, 0x8b, 0xb4, 0x07, 0x4d, 0x2e, 0x7b, 0xd8, 0x9b, 0xc6, 0xfe, 0x0a,
+    0x3b, 0x70, 0xef, 0xeb, 0x2c, 0x8d, 0x8b, 0xc8, 0x1f, 0xb1, 0x9f, 0x06,
+    0x83, 0x81, 0x0b, 0x8b, 0x0a, 0xe3, 0x14, 0xbe, 0x04, 0x41, 0xe0, 0xb2,
+    0x00, 0xb4, 0xe9, 0x05, 0x7c, 0x21, 0xc3, 0xd5, 0x88, 0x65, 0x3c, 0xca,
+    0x7a, 0x99, 0x48, 0x25, 0x3c, 0x48, 0xb8, 0xef, 0x93, 0xd4, 0x83, 0x41,
+    0x72, 0x5f, 0x7e, 0x05, 0xe1, 0x79, 0x1e, 0x2f, 0x46, 0xec, 0x84, 0x5a,
+    0x17, 0xfc, 0x5e, 0x59, 0x63, 0xc4, 0x5e, 0x0f, 0x74, 0x4b, 0x3a, 0x93,
+    0xd1, 0x88, 0x0d, 0x18, 0x2f, 0xf2, 0x18, 0xf5, 0xe8, 0x7b, 0x7e, 0x53,
+    0x8d, 0xe1, 0x70, 0xe8, 0x6a, 0x6d, 0x47, 0x6c, 0x98, 0xdc, 0xb3, 0x2c,
+    0x0e, 0xa5, 0xcf, 0x7e, 0x3a, 0x3c, 0x3c, 0xb4, 0x26, 0x1e, 0x1e, 0x57,
+    0x02, 0xcb, 0x79, 0x87, 0x34, 0x8b, 0x5e, 0x69, 0xca, 0x7d, 0x59, 0x64,
+    0xa0, 0x0c, 0xb6, 0xf9, 0x32, 0x4b, 0x42, 0x0e, 0xab, 0x08, 0x42, 0x01,
+    0x5f, 0x79, 0x28, 0x67, 0x51, 0x4f, 0xe6, 0x62, 0x01, 0x1d, 0x3c, 0x70,
+    0xa2, 0x48, 0x5d, 0xf6, 0x5b, 0x91, 0xe5, 0x32, 0x58, 0xf5, 0xb4, 0x5f,
+    0x61, 0xc5, 0x09, 0x07, 0x87, 0x4e, 0x45, 0xbe, 0x14, 0x22, 0x72, 0xd9,
+    0x8c, 0x27, 0x66, 0x0a, 0x52, 0xbc, 0x27, 0xa3, 0x20, 0x06, 0xed, 0x51,
+    0x24, 0x3c, 0x00, 0x6d, 0x40, 0x15, 0xbd, 0xe0, 0x41, 0x65, 0x94, 0x54,
+    0xce, 0xe6, 0xb9, 0x19, 0x18, 0xdf, 0x89, 0x34, 0x08, 0xe3, 0xe5, 0x88,
+    0xcd, 0xa5, 0xef, 0xa3, 0x54, 0x12, 0x35, 0xe2, 0x5e, 0x2e, 0xef, 0x44,
+    0xd3, 0x14, 0x07, 0x07, 0x07, 0xc6, 0x48, 0xf3, 0x43, 0x78, 0x58, 0xda,
+    0x4f, 0xbb, 0x06, 0x7c, 0x2b, 0x40, 0xf2, 0x6b, 0x94, 0x6c, 0x1c, 0x37,
+    0x18, 0x04, 0xc1, 0xc9, 0x89, 0xcb, 0x96, 0x73, 0x58, 0x5e, 0x8f, 0x96,
+    0x30, 0x62, 0x51, 0xbc, 0x4c, 0x79, 0xb2, 0x69, 0xfa, 0x5c, 0xdc, 0xe7,
+    0xbd, 0xaa, 0x59, 0x84, 0xa1, 0x4c, 0x32, 0x99, 0x99, 0x69, 0x13, 0x6b,
+    0xd6, 0x23, 0xf0, 0xc5, 0x80, 0x59, 0x31, 0x72, 0x82, 0xf3, 0xd8, 0x8a,
+    0x1c, 0xa1, 0x22, 0xff, 0x84, 0x89, 0xa7, 0x79, 0xd4, 0x43, 0x23, 0xe0,
+    0xec, 0x4f, 0xf1, 0x1c, 0x79, 0x86, 0xfc, 0x8c, 0x9d, 0x7a, 0xd9, 0x3c,
+    0x95, 0xd1, 0x57, 0x32, 0x93, 0x11, 0x86, 0x7e, 0xaa, 0x62, 0x07, 0x5c,
+    0xc1, 0x86, 0xd4, 0xbf, 0x91, 0x00, 0xca, 0x74, 0x95, 0x29, 0x07, 0x55,
+    0x24, 0x46, 0x71, 0x24, 0xd6, 0x62, 0x8b, 0x2c, 0x4f, 0x16, 0x58, 0x0a,
+    0xe5, 0xe6, 0x69, 0x1c, 0xfa, 0x20, 0xa1, 0x48, 0x33, 0x14, 0x91, 0xc4,
+    0x52, 0x69, 0x48, 0xab, 0xcd, 0x53, 0x48, 0xa1, 0x20, 0x4e, 0x21, 0x52,
+    0x8b, 0x24, 0x11, 0xa9, 0xc7, 0x33, 0xb1, 0xc1, 0x80, 0x5a, 0x67, 0xe1,
+    0xcb, 0xfc, 0x29, 0x5a, 0xa3, 0xce, 0x6b, 0x99, 0xfb, 0xff, 0xaa, 0xf5,
+    0x68, 0x8e, 0x7e, 0x6d, 0x06, 0x73, 0x10, 0x9c, 0x9e, 0xaa, 0x78, 0x96,
+    0x51, 0x52, 0xe0, 0xd2, 0x74, 0xae, 0x0c, 0x07, 0x83, 0x7f, 0xb1, 0x33,
+    0xfb, 0x60, 0x43, 0x66, 0x2b, 0x9c, 0x59, 0x4f, 0x8e, 0x0d, 0x38, 0x71,
+    0x74, 0x74, 0x54, 0x1a, 0x83, 0x62, 0x71, 0x33, 0x22, 0xac, 0x25, 0x50,
+    0x5c, 0xe4, 0xa1, 0x8c, 0x84, 0xb1, 0x99, 0x56, 0x73, 0x14, 0xc4, 0x5e,
+    0x91, 0x11, 0x96, 0x92, 0x8c, 0x66, 0x9a, 0xc1, 0xb2, 0x03, 0x19, 0xe6,
+    0xb4, 0x5c, 0xb3, 0x84, 0x61, 0x53, 0x59, 0xa5, 0xab, 0x1a, 0x5a, 0x53,
+    0x69, 0xd4, 0xd4, 0xbb, 0xae, 0x29, 0xe9, 0x35, 0x57, 0x3e, 0x3a, 0x32,
+    0x56, 0x5e, 0xc4, 0x3e, 0x0f, 0xad, 0xc4, 0x50, 0xea, 0x26, 0x71, 0x06,
+    0x05, 0x27, 0x8e, 0x46, 0x81, 0xbc, 0x17, 0xe0, 0xcb, 0x3c, 0x4e, 0x46,
+    0x10, 0x14, 0xa1, 0x08, 0x72, 0xfc, 0xab, 0x4c, 0xad, 0x2c, 0xad, 0x05,
+    0xaa, 0x2f, 0x96, 0x96, 0xe9, 0x6c, 0xca, 0xdb, 0x83, 0x2e, 0xfd, 0xeb,
+    0x9f, 0x76, 0x5c, 0xf6, 0x77, 0x40, 0x38, 0x1f, 0xb0, 0x6d, 0x48, 0x89,
+    0x60, 0x56, 0xa7, 0x5d, 0x51, 0x95, 0x16, 0xbb, 0xb2, 0x98, 0x84, 0xee,
+    0xad, 0x46, 0x25, 0xc4, 0x93, 0xc2, 0x06, 0x55, 0xeb, 0x51, 0xa1, 0xc0,
+    0xbe, 0x29, 0xb9, 0x69, 0x19, 0x42, 0xfe, 0xba, 0x65, 0x86, 0x8d, 0x0a,
+    0x73, 0x5c, 0x2b, 0x30, 0x28, 0xa8, 0x2c, 0x31, 0x21, 0x9f, 0x0a, 0xdb,
+    0x5e, 0xd3, 0x30, 0xf6, 0xbe, 0x36, 0x03, 0xec, 0xb8, 0x82, 0xd0, 0x26,
+    0xac, 0xa9, 0x78, 0x7c, 0xd8, 0x83, 0x12, 0xab, 0x2a, 0xeb, 0xd9, 0xbe,
+    0x66, 0x05, 0x58, 0x44, 0x91, 0x23, 0x0c, 0x27, 0xd7, 0x72, 0x9a, 0xf2,
+    0x74, 0xc5, 0x54, 0x15, 0x87, 0x0e, 0x43, 0x68, 0x57, 0x61, 0x9e, 0xaf,
+    0x12, 0x60, 0x0d, 0x98, 0x49, 0x2d, 0x26, 0xfd, 0x71, 0x2b, 0x13, 0x3c,
+    0xf5, 0xe6, 0x2d, 0x06, 0xba, 0x78, 0x62, 0x0e, 0x79, 0x27, 0xd2, 0x71,
+    0xeb, 0x96, 0x1a, 0xfb, 0xfd, 0x7e, 0x8b, 0xc5, 0xd1, 0x57, 0xb1, 0x2a,
+    0x92, 0x71, 0x4b, 0x85, 0x55, 0xbb, 0x83, 0x1c, 0xc1, 0x97, 0x77, 0x8c,
+    0x66, 0x1f, 0xb7, 0xcc, 0x32, 0x14, 0x1c, 0x22, 0xf2, 0x0d, 0x07, 0xeb,
+    0x09, 0xa3, 0x4c, 0x49, 0x68, 0x88, 0x00, 0x3c, 0x22, 0x14, 0x46, 0x49,
+    0x99, 0x08, 0x85, 0x97, 0x93, 0x26, 0x6a, 0x82, 0x5f, 0x44, 0x94, 0x0a,
+    0x20, 0x33, 0x21, 0xcf, 0x32, 0xd3, 0x86, 0x5a, 0x00, 0x51, 0x89, 0x66,
+    0xa2, 0xae, 0x46, 0x9c, 0x60, 0x88, 0xb1, 0x3b, 0x1e, 0x16, 0xf0, 0xa4,
+    0x35, 0x79, 0x17, 0x86, 0x8c, 0xc6, 0x67, 0x67, 0xfb, 0xea, 0x19, 0x5a,
+    0x47, 0x4d, 0xb1, 0x69, 0xae, 0x0b, 0xe1, 0x71, 0xff, 0xf7, 0x4c, 0xa6,
+    0x04, 0xd8, 0xb3, 0xd5, 0x7b, 0xbd, 0x1e, 0xb4, 0x26, 0xaf, 0x07, 0xd5,
+    0xf3, 0xc6, 0xe3, 0x37, 0xf0, 0xf8, 0xcd, 0xf6, 0xc7, 0x27, 0xf0, 0xf8,
+    0x64, 0xb0, 0x5d, 0xfa, 0x29, 0x3c, 0x3f, 0xdd, 0x3e, 0x7c, 0x00, 0x8f,
+    0x0f, 0x20, 0x55, 0xb6, 0x76, 0x18, 0x52, 0x87, 0xe1, 0xf6, 0x0e, 0x07,
+    0xd4, 0xe1, 0x60, 0xb0, 0xd9, 0x9c, 0x2a, 0x90, 0x37, 0x86, 0x81, 0x5d,
+    0x15, 0xed, 0xa2, 0x78, 0x62, 0xb1, 0xb3, 0x6d, 0xb0, 0xf4, 0x63, 0x48,
+    0xd4, 0x6a, 0x04, 0xb8, 0x37, 0x17, 0xde, 0x57, 0x80, 0x80, 0x96, 0xe5,
+    0xee, 0x9f, 0xf9, 0xdd, 0x46, 0xe7, 0x9a, 0x35, 0xa8, 0xd4, 0x55, 0x79,
+    0xaa, 0x33, 0x77, 0xa0, 0x82, 0x34, 0xe1, 0xd1, 0xe4, 0xe5, 0x4f, 0xa7,
+    0x6f, 0x30, 0xf1, 0x41, 0x4a, 0x9c, 0xc2, 0xd2, 0x32, 0xf6, 0x31, 0x0a,
+    0x57, 0x60, 0x0f, 0x7c, 0x08, 0x76, 0x21, 0x73, 0xe0, 0x07, 0x48, 0x0e,
+    0x9d, 0x22, 0x38, 0x75, 0x28, 0xb3, 0x1c, 0xf9, 0x30, 0xb6, 0x96, 0x8d,
+    0x8b, 0x18, 0x62, 0x7c, 0xd2, 0xec, 0x8a, 0xb5, 0xaa, 0x47, 0xe8, 0x54,
+    0x86, 0xa4, 0xfa, 0xa6, 0x06, 0xda, 0x4d, 0x06, 0xbe, 0x50, 0xbb, 0xf9,
+    0xc1, 0xe4, 0x12, 0x6b, 0xf3, 0x05, 0xf0, 0x79, 0x19, 0x82, 0xaf, 0xa0,
+    0xa1, 0x6e, 0x0c, 0xc5, 0x71, 0x5a, 0xd5, 0x24, 0xd2, 0x6f, 0x19, 0x07,
+    0x4e, 0x3e, 0x23, 0xb3, 0x37, 0xea, 0xeb, 0x61, 0x65, 0x47, 0xa2, 0xfd,
+    0x65, 0x5f, 0xb5, 0x20, 0xfc, 0xd4, 0xe3, 0x69, 0x4e, 0x0b, 0x7b, 0x47,
+    0x7f, 0xb7, 0x0d, 0x37, 0xbd, 0xcc, 0x5c, 0x94, 0x9c, 0xdb, 0x3a, 0xcf,
+    0x28, 0xf3, 0xcb, 0xbe, 0x7f, 0x01, 0x0c, 0xda, 0xd6, 0x75, 0x05, 0xcf,
+    0xaa, 0x9e, 0x5f, 0x22, 0xf9, 0xad, 0x10, 0xec, 0xea, 0x62, 0x5b, 0xf7,
+    0x82, 0x3a, 0x5c, 0x5d, 0x54, 0x43, 0xae, 0x2f, 0x2f, 0xd8, 0x15, 0x16,
+    0x13, 0x46, 0xce, 0x35, 0x11, 0x60, 0xa1, 0x2c, 0xc4, 0x9f, 0x1b, 0x03,
+    0x69, 0x94, 0xf9, 0x6a, 0x34, 0xe8, 0xc3, 0x96, 0xa6, 0xed, 0xc5, 0x8b,
+    0x05, 0x87, 0x1d, 0x47, 0xc2, 0x53, 0x9e, 0x0b, 0xbf, 0xcb, 0x44, 0x7f,
+    0xd6, 0xef, 0x02, 0x5d, 0xe8, 0x0e, 0x87, 0xdd, 0xe1, 0x41, 0x47, 0x87,
+    0x42, 0x15, 0x09, 0xdb, 0x50, 0xd2, 0x64, 0x82, 0x9d, 0x25, 0x59, 0x9e,
+    0x8a, 0x1c, 0x70, 0xb8, 0xf4, 0x5c, 0xa9, 0x7c, 0x28, 0x7c, 0xd2, 0xb4,
+    0x55, 0x83, 0x6e, 0xa3, 0x30, 0x72, 0xfd, 0xa1, 0x6b, 0xa7, 0x94, 0x22,
+    0x2c, 0xd6, 0x4a, 0x20, 0x3d, 0x50, 0xec, 0xb4, 0x00, 0x24, 0x8e, 0x30,
+    0xfe, 0x43, 0xe9, 0x7d, 0x1d, 0xb7, 0xe2, 0x44, 0x44, 0x60, 0x86, 0x5b,
+    0x4a, 0xe7, 0x98, 0xf2, 0x40, 0x4d, 0xa0, 0x3a, 0x96, 0x53, 0xd4, 0x65,
+    0x63, 0xe2, 0xd9, 0x29, 0xab, 0x79, 0x87, 0x2e, 0x55, 0x58, 0x98, 0x75,
+    0xfe, 0x12, 0x0d, 0x58, 0x4f, 0x5a, 0x9b, 0xe6, 0x11, 0xcb, 0xd3, 0x24,
+    0xcf, 0x70, 0x3c, 0x9b, 0xad, 0x2b, 0xb2, 0xde, 0x9a, 0xfc, 0xef, 0x7f,
+    0xff, 0xd7, 0xff, 0xb0, 0xdb, 0xcb, 0xeb, 0xcb, 0xf3, 0xcf, 0x0c, 0x34,
+    0x86, 0x08, 0x57, 0x2a, 0x56, 0xc9, 0xd6, 0x8c, 0x4e, 0x2f, 0x06, 0x58,
+    0x9f, 0xbc, 0x87, 0x22, 0x06, 0x1f, 0xb6, 0x45, 0xc5, 0x54, 0x3d, 0xae,
+    0x82, 0xe2, 0x03, 0xd4, 0xca, 0x6c, 0x5b, 0xef, 0x08, 0x1f, 0xb6, 0x1e,
+    0x85, 0xbd, 0x0d, 0xa8, 0x67, 0xea, 0x61, 0x6b, 0xf2, 0x08, 0x3a, 0x91,
+    0xfc, 0x00, 0xc1, 0x69, 0x1d, 0x88, 0x0c, 0x0e, 0xb5, 0x26, 0x25, 0xf0,
+    0xec, 0x0e, 0xb0, 0xf5, 0x32, 0x8c, 0xf4, 0x8b, 0x6a, 0xf0, 0xa6, 0x48,
+    0xc8, 0xf8, 0x9d, 0x40, 0x04, 0xb1, 0xa0, 0x50, 0xc7, 0x55, 0x85, 0xd5,
+    0x07, 0x4d, 0xac, 0xae, 0x6f, 0x4e, 0x6a, 0x7b, 0x93, 0x4d, 0x24, 0x7f,
+    0x8d, 0xe3, 0xd7, 0x28, 0xbe, 0xf1, 0x7e, 0x6b, 0x72, 0xfb, 0xee, 0xdf,
+    0x2f, 0xd9, 0xf9, 0x1f, 0xdf, 0x7d, 0xf8, 0xe5, 0xf2, 0xd6, 0xf2, 0x73,
+    0x53, 0x65, 0x1f, 0x58, 0xf0, 0x02, 0x4c, 0xdc, 0x9f, 0x89, 0xfc, 0x32,
+    0x14, 0xf8, 0xf1, 0xfd, 0xea, 0xca, 0x6f, 0x3b, 0x15, 0x86, 0x3a, 0x9d,
+    0x3e, 0x2d, 0xa6, 0xaf, 0x4d, 0x33, 0x76, 0x50, 0x2f, 0xe7, 0x19, 0x4b,
+    0xb4, 0x98, 0x7b, 0x6d, 0x17, 0xf3, 0x7b, 0xd6, 0x77, 0xfe, 0xee, 0xc3,
+    0xf9, 0xe5, 0xf5, 0x7a, 0x04, 0xab, 0xfa, 0xd0, 0xac, 0x1d, 0x31, 0xf8,
+    0xae, 0x4a, 0xc4, 0x3a, 0xa5, 0x56, 0x8c, 0x5a, 0x13, 0x6a, 0x8b, 0x4f,
+    0xdb, 0x74, 0xba, 0xee, 0xb0, 0x81, 0x6b, 0x18, 0xf4, 0x29, 0xfc, 0xe7,
+    0xd6, 0x08, 0xfb, 0x86, 0xd8, 0x6d, 0x9e, 0x3f, 0xe8, 0xe6, 0x06, 0xff,
+    0x6b, 0xb2, 0x67, 0x63, 0xce, 0x43, 0x8c, 0xb6, 0x0d, 0x24, 0x79, 0x33,
+    0x9d, 0xa6, 0x9d, 0x1d, 0xe9, 0x60, 0xa6, 0x51, 0x2b, 0x3a, 0x85, 0x45,
+    0x54, 0xac, 0xfa, 0xb0, 0x0c, 0xe1, 0xf9, 0x81, 0x99, 0xbf, 0x8c, 0x3f,
+    0x0a, 0x47, 0x2b, 0xdc, 0x21, 0x65, 0x6e, 0x2f, 0xcf, 0xbf, 0x7c, 0xba,
+    0x64, 0xd7, 0x1f, 0x7f, 0xb9, 0xfa, 0xa0, 0xcb, 0x62, 0xd2, 0x18, 0x87,
+    0xe4, 0xba, 0x89, 0x95, 0x97, 0xa8, 0x00, 0xbb, 0xb9, 0xfa, 0x00, 0xbb,
+    0x16, 0x3a, 0x55, 0x93, 0x51, 0x01, 0x59, 0x97, 0x34, 0xaa, 0x6a, 0x02,
+    0xe5, 0x78, 0x09, 0xab, 0x51, 0x49, 0x9c, 0xa0, 0xa7, 0x6a, 0x24, 0x1a,
+    0x04, 0x34, 0x32, 0x9a, 0x7c, 0x52, 0x8b, 0x37, 0x9d, 0xde, 0x78, 0x7a,
+    0xc4, 0x06, 0x6e, 0x93, 0x0b, 0x6d, 0xa6, 0x42, 0x56, 0x44, 0xd6, 0xed,
+    0x8b, 0x9b, 0x86, 0x75, 0x43, 0x5a, 0xab, 0xc3, 0xa2, 0x63, 0xb6, 0x95,
+    0xe4, 0x75, 0x4d, 0xef, 0xfd, 0x78, 0x19, 0x8d, 0x5b, 0x32, 0x68, 0x8b,
+    0x3b, 0xcc, 0x29, 0x68, 0x19, 0x8f, 0xc7, 0x0e, 0x99, 0xc1, 0xe9, 0x64,
+    0x37, 0x88, 0x0b, 0x08, 0x46, 0xb4, 0xf5, 0xdc, 0x84, 0x1f, 0x37, 0x6b,
+    0x24, 0x6a, 0x7d, 0xa5, 0x3f, 0x5a, 0x34, 0x8e, 0x9f, 0x50, 0x34, 0xac,
+    0x25, 0xbe, 0x36, 0x36, 0xa8, 0x8e, 0x09, 0xaa, 0x53, 0x82, 0xd6, 0xe4,
+    0xcb, 0x87, 0xeb, 0x8f, 0xe7, 0xff, 0xb6, 0x25, 0xfd, 0xcc, 0xe9, 0xe6,
+    0x64, 0x6f, 0x09, 0x69, 0x12, 0x2f, 0xfb, 0xa0, 0x4d, 0x9a, 0xc6, 0x29,
+    0x1b, 0xb3, 0xa0, 0x88, 0x3c, 0xcc, 0xbd, 0xf6, 0x22, 0x9b, 0x75, 0x59,
+    0x91, 0x86, 0x5d, 0x86, 0x56, 0xec, 0x22, 0x3c, 0x00, 0x11, 0xc0, 0x5e,
+    0x1d, 0xd8, 0xd3, 0xf1, 0x50, 0xa4, 0x79, 0xdb, 0xf9, 0xd3, 0x2d, 0xbb,
+    0xc4, 0xa6, 0x11, 0x73, 0xd8, 0x2b, 0x06, 0x43, 0x60, 0xf3, 0x0a, 0xe5,
+    0xbd, 0x48, 0x23, 0x16, 0xf0, 0x10, 0x8f, 0x2b, 0x1e, 0xdc, 0xbd, 0xfd,
+    0x7d, 0x76, 0xc3, 0x67, 0xc2, 0x67, 0xc8, 0x10, 0x47, 0x60, 0x4d, 0xc1,
+    0xf6, 0x79, 0x22, 0xf7, 0x29, 0x07, 0x01, 0x95, 0x66, 0x82, 0xf1, 0x9c,
+    0x71, 0x96, 0xcb, 0x05, 0xcc, 0x93, 0xcf, 0x05, 0x8b, 0x60, 0x5d, 0xd4,
+    0x6f, 0x39, 0x17, 0x11, 0xb5, 0x88, 0xc8, 0x67, 0x71, 0x80, 0xa2, 0xf0,
+    0x1b, 0x0a, 0x62, 0xb0, 0x84, 0x38, 0x0c, 0x33, 0x06, 0x96, 0x89, 0x19,
+    0x1e, 0x0e, 0xf7, 0xd9, 0xaf, 0x99, 0xf8, 0xf6, 0x2b, 0xf3, 0xd3, 0x38,
+    0xc9, 0x18, 0x18, 0x65, 0x29, 0xd2, 0x0c, 0x23, 0x3b, 0x2b, 0xc0, 0x2e,
+    0x99, 0xf0, 0x41, 0x05, 0x60, 0x47, 0xa9, 0x14, 0x59, 0x7f, 0x0f, 0xa2,
+    0x1d, 0x64, 0x90, 0xa0, 0x31, 0xdb, 0x0a, 0xb2, 0xf8, 0xdc, 0xe9, 0xb8,
+    0xba, 0x37, 0x92, 0xd9, 0xcb, 0xf0, 0xb1, 0xfe, 0xd8, 0x03, 0xfb, 0x87,
+    0x02, 0x0a, 0x2a, 0x2d, 0x6f, 0xcc, 0xfe, 0xfa, 0xb7, 0xae, 0x5a, 0xd0,
+    0x98, 0x45, 0x45, 0x88, 0xf6, 0x8c, 0x39, 0x46, 0x0b, 0x1a, 0x1b, 0x6d,
+    0xd4, 0x65, 0xa0, 0x35, 0x7c, 0x19, 0xe0, 0x07, 0xdc, 0x8d, 0x7e, 0x06,
+    0x3b, 0xa4, 0x65, 0xef, 0x54, 0xdc, 0xa9, 0x87, 0x22, 0x89, 0xbd, 0x39,
+    0x7c, 0x74, 0x1c, 0x77, 0xcf, 0x78, 0x89, 0xd6, 0xb3, 0x6a, 0x83, 0x47,
+    0xb4, 0x8a, 0xdf, 0x1e, 0xd3, 0x4e, 0x89, 0x87, 0x72, 0x41, 0xbb, 0x9e,
+    0x7e, 0x9e, 0xca, 0x45, 0xbb, 0x5c, 0xdc, 0xec, 0xb1, 0x91, 0xd6, 0x8e,
+    0xd5, 0x0c, 0x37, 0xe3, 0xfc, 0xdd, 0xe3, 0xd4, 0xe6, 0xb1, 0x1a, 0x88,
+    0xd6, 0xc9, 0xf4, 0x4a, 0x64, 0xc0, 0xda, 0xdf, 0x3a, 0xf0, 0xf5, 0x15,
+    0x7c, 0x7f, 0xf9, 0x6d, 0x8c, 0x71, 0x24, 0x22, 0xa4, 0x2b, 0x5f, 0x3e,
+    0x5d, 0x9d, 0xc7, 0x8b, 0x04, 0xc2, 0x20, 0xca, 0xa1, 0x8b, 0xea, 0x3a,
+    0x2b, 0xbb, 0x12, 0x89, 0xde, 0xd6, 0x7d, 0xa6, 0xbb, 0xfb, 0x18, 0xab,
+    0x38, 0xdd, 0x0a, 0xa6, 0x4b, 0xf0, 0x02, 0xe0, 0x0a, 0x9e, 0xfa, 0x10,
+    0xa5, 0x2b, 0x94, 0xd2, 0x5e, 0xb1, 0x33, 0x76, 0x3c, 0xe8, 0xb0, 0xb7,
+    0x0c, 0xf7, 0x8f, 0x6c, 0xc4, 0x86, 0xa7, 0x58, 0xde, 0xf5, 0x14, 0x3e,
+    0xe9, 0x4d, 0x73, 0xac, 0xe8, 0x5c, 0x0a, 0x25, 0x3e, 0xbe, 0x54, 0xa0,
+    0x2e, 0xb0, 0x4e, 0x62, 0x3d, 0xc2, 0x2f, 0x75, 0x05, 0xca, 0x33, 0x1e,
+    0xc2, 0x62, 0x75, 0x6a, 0x64, 0xee, 0xde, 0x43, 0xe5, 0xc2, 0x34, 0x5e,
+    0xb6, 0x3d, 0xbf, 0x72, 0x21, 0x96, 0x1c, 0xcb, 0xa4, 0x5e, 0x2a, 0x80,
+    0x84, 0xeb, 0xa9, 0xda, 0x0e, 0x3c, 0xc5, 0x00, 0x83, 0x3f, 0x7d, 0xda,
+    0x26, 0x7d, 0xe0, 0x0b, 0x81, 0xa6, 0xf4, 0x7c, 0x47, 0xb5, 0xca, 0x08,
+    0x72, 0xf9, 0x8f, 0x9f, 0xff, 0x7c, 0x0d, 0xad, 0xbf, 0x5a, 0xdb, 0x29,
+    0x47, 0x9f, 0x9b, 0x3b, 0x93, 0xb3, 0xf9, 0xe1, 0xe4, 0x0f, 0xdf, 0x45,
+    0xe6, 0xc1, 0xb4, 0x7d, 0xda, 0xf7, 0x74, 0x1e, 0xa0, 0x68, 0x1c, 0x4e,
+    0xce, 0x92, 0xaa, 0x5d, 0x6d, 0x68, 0xf0, 0x41, 0x52, 0xab, 0xd6, 0x5a,
+    0x58, 0x79, 0x50, 0xec, 0x54, 0x30, 0x69, 0x3d, 0x42, 0x72, 0xe2, 0x94,
+    0xb8, 0xe9, 0x28, 0xb4, 0xcd, 0xa0, 0x58, 0xdd, 0x40, 0x6e, 0xf2, 0x19,
+    0x27, 0x84, 0x01, 0x2f, 0x60, 0xbf, 0xf6, 0x1f, 0xbe, 0xc3, 0x7c, 0xd2,
+    0x7f, 0xe8, 0x38, 0x93, 0xcb, 0x8b, 0xab, 0xcf, 0xeb, 0x64, 0xc8, 0x9e,
+    0x33, 0x7e, 0x8a, 0x58, 0xb5, 0x73, 0xb7, 0x05, 0xff, 0xf2, 0xb1, 0x09,
+    0x85, 0xbf, 0x96, 0xee, 0x80, 0x6f, 0x75, 0x87, 0x00, 0xd8, 0xe0, 0x76,
+    0x19, 0x43, 0x07, 0x6c, 0x50, 0xb3, 0x28, 0x84, 0xac, 0x4a, 0xec, 0x3e,
+    0x20, 0xee, 0x25, 0xf7, 0xe6, 0x60, 0x2b, 0x36, 0x9e, 0xa8, 0x8e, 0x1c,
+    0xf0, 0x37, 0xf2, 0xcf, 0xe7, 0x32, 0xf4, 0xdb, 0xda, 0xab, 0x9d, 0x0e,
+    0x06, 0x4e, 0x29, 0x1a, 0x53, 0xbf, 0x9d, 0x8a, 0x4c, 0xe4, 0xe8, 0x6f,
+    0x8c, 0x27, 0xf3, 0x05, 0x41, 0xe0, 0xd5, 0x2b, 0xd7, 0x46, 0x0a, 0xd7,
+    0x82, 0x10, 0x77, 0xb3, 0x2a, 0x0f, 0x7b, 0x02, 0x10, 0x84, 0xa1, 0x20,
+    0x83, 0x2a, 0xff, 0xf8, 0x07, 0x7b, 0x81, 0x42, 0x3a, 0x1a, 0x88, 0x4b,
+    0xf0, 0xc2, 0x14, 0x80, 0x49, 0xba, 0x2c, 0x90, 0x29, 0xa1, 0x1e, 0x75,
+    0x73, 0x2d, 0x38, 0xca, 0x53, 0xcc, 0xce, 0x00, 0xb7, 0x67, 0x6d, 0xa7,
+    0x82, 0xe8, 0xb7, 0xa1, 0x5c, 0xc8, 0x7c, 0x7c, 0x3c, 0xc0, 0x44, 0x30,
+    0x80, 0xf3, 0x8a, 0xb5, 0x49, 0xd5, 0xb7, 0x10, 0xde, 0xaa, 0x48, 0x6d,
+    0xcb, 0x45, 0xa5, 0x0c, 0x54, 0x08, 0xa7, 0xd3, 0xd9, 0xeb, 0x03, 0x7c,
+    0x47, 0xed, 0x14, 0x4d, 0xf6, 0x9d, 0xd4, 0x4e, 0xfb, 0x78, 0xb7, 0x56,
+    0xc0, 0x2a, 0xc7, 0xec, 0x68, 0x70, 0xda, 0x01, 0x7c, 0x07, 0xd3, 0x31,
+    0x07, 0x5a, 0x43, 0xe1, 0x94, 0xd5, 0x24, 0xed, 0xff, 0x96, 0x29, 0xdf,
+    0x3e, 0x18, 0x21, 0x7e, 0x25, 0x04, 0xd6, 0xf6, 0x82, 0x16, 0x57, 0x2d,
+    0x1a, 0x2a, 0xc5, 0x3b, 0x16, 0x72, 0xe4, 0x37, 0x54, 0x61, 0x82, 0x34,
+    0x5e, 0x30, 0xba, 0x05, 0x8c, 0x54, 0x29, 0x52, 0xe7, 0x86, 0xcb, 0xb8,
+    0x08, 0x7d, 0x96, 0x7d, 0x15, 0x4b, 0x2a, 0x2c, 0xea, 0x31, 0x0b, 0x84,
+    0xf0, 0xc9, 0x3b, 0x64, 0x2a, 0xf4, 0x8e, 0x42, 0x61, 0xbf, 0x0f, 0x7f,
+    0xdd, 0x12, 0x89, 0xfd, 0x3e, 0x7d, 0x02, 0x9d, 0x58, 0xe9, 0x06, 0xea,
+    0x82, 0xda, 0xc0, 0x9f, 0xe6, 0x62, 0xf6, 0x20, 0x1a, 0x37, 0xc4, 0xce,
+    0x77, 0x1d, 0x51, 0x49, 0x91, 0x61, 0x53, 0xc7, 0xdd, 0x1e, 0x4d, 0xb8,
+    0xfc, 0x32, 0x46, 0xfc, 0xbe, 0x72, 0x20, 0x5a, 0xc4, 0xe3, 0xe8, 0x34,
+    0x51, 0x33, 0xc9, 0x98, 0x4c, 0xc2, 0x5e, 0xbe, 0x64, 0x02, 0x3f, 0x6b,
+    0x2d, 0x00, 0x94, 0x44, 0x8e, 0x25, 0x06, 0xf8, 0x51, 0x1b, 0x1c, 0x89,
+    0xc1, 0x8b, 0x51, 0x89, 0xce, 0xef, 0x68, 0xfb, 0x06, 0x32, 0xe2, 0x61,
+    0xb8, 0xd2, 0x8f, 0x1b, 0x02, 0x29, 0x2f, 0xea, 0x25, 0xcc, 0xa5, 0xd2,
+    0x48, 0xde, 0x41, 0x05, 0xed, 0x64, 0x52, 0x0f, 0xb4, 0x0c, 0x52, 0x1c,
+    0xf4, 0x51, 0x85, 0x14, 0x21, 0xf4, 0x3d, 0xf2, 0x24, 0x90, 0x74, 0x1e,
+    0x4a, 0x88, 0x95, 0x4f, 0x98, 0xb5, 0x9d, 0x3e, 0x24, 0x34, 0xe0, 0xb2,
+    0xa6, 0x26, 0x2a, 0xe4, 0x89, 0x12, 0x41, 0x7c, 0x1d, 0x0d, 0x00, 0xad,
+    0x49, 0x5f, 0x9a, 0x98, 0xb2, 0x4b, 0x77, 0x04, 0x0e, 0x76, 0x89, 0x80,
+    0x70, 0x0d, 0xc6, 0x13, 0x30, 0x06, 0xea, 0x1d, 0x31, 0x04, 0xa7, 0x4b,
+    0xf3, 0x75, 0x28, 0x26, 0xce, 0x2b, 0x07, 0x8f, 0x18, 0x58, 0x38, 0x5c,
+    0x31, 0x1f, 0xc0, 0x02, 0x0f, 0xb9, 0xda, 0xd9, 0x5c, 0x06, 0x39, 0xae,
+    0x4a, 0x85, 0x8d, 0xf4, 0x33, 0x86, 0x7c, 0xb1, 0x03, 0x54, 0xc2, 0x67,
+    0x45, 0x92, 0x01, 0xe3, 0x21, 0x3a, 0x01, 0x81, 0x82, 0xa2, 0x50, 0x0b,
+    0x88, 0x24, 0xe5, 0x3b, 0x08, 0x36, 0x55, 0x00, 0xa0, 0x05, 0xb9, 0x08,
+    0x93, 0x19, 0x44, 0x40, 0x4f, 0xd1, 0x0d, 0xe8, 0x04, 0x19, 0x28, 0xb8,
+    0xdf, 0xaf, 0xec, 0x92, 0x80, 0x66, 0x6d, 0x03, 0x02, 0x76, 0xee, 0xaa,
+    0xe0, 0x82, 0x4f, 0x65, 0x05, 0x50, 0x87, 0x5a, 0xdb, 0xf2, 0xb9, 0x9e,
+    0xb0, 0x2a, 0x80, 0xb3, 0xb7, 0x99, 0x8c, 0x3c, 0x55, 0xb9, 0x30, 0x1c,
+    0x5f, 0x41, 0x92, 0x92, 0x5c, 0x95, 0xa3, 0xf8, 0xa9, 0x63, 0x65, 0xa2,
+    0x49, 0xae, 0x8e, 0x9d, 0x58, 0x7b, 0xb5, 0xc4, 0x42, 0x85, 0xb4, 0x96,
+    0x95, 0x22, 0x26, 0xde, 0xb3, 0x55, 0xe4, 0x99, 0xa8, 0x50, 0x71, 0x64,
+    0xf2, 0x16, 0xdd, 0x63, 0xa7, 0x0e, 0x0d, 0x79, 0xe1, 0xf7, 0xb5, 0x9a,
+    0xfd, 0x50, 0x44, 0xb3, 0x7c, 0x5e, 0x97, 0xa8, 0x11, 0x66, 0xbb, 0xc0,
+    0x6a, 0x78, 0x99, 0x47, 0x95, 0xc6, 0x5e, 0x1f, 0x82, 0x07, 0xa3, 0x5d,
+    0xb9, 0xd5, 0xe9, 0x98, 0xf4, 0x02, 0x1d, 0x74, 0xf2, 0xa9, 0xd3, 0xd0,
+    0x7b, 0x1c, 0x73, 0x0f, 0xe5, 0x01, 0x57, 0xe8, 0xc1, 0xdf, 0x4e, 0x13,
+    0xd9, 0xef, 0xab, 0xe0, 0xa7, 0x7e, 0x13, 0xd5, 0x8d, 0x06, 0xf5, 0x7a,
+    0x2a, 0x15, 0x2b, 0xad, 0x94, 0x57, 0x0a, 0x46, 0xc2, 0x40, 0x4e, 0x97,
+    0x49, 0x6b, 0xca, 0x48, 0x1d, 0x6d, 0x59, 0xb3, 0x82, 0x8e, 0x05, 0xcd,
+    0x4a, 0x6a, 0x4b, 0x36, 0x01, 0x92, 0xd7, 0x51, 0xfd, 0xff, 0x2a, 0xff,
+    0x06, 0x43, 0x0b, 0xb7, 0x02, 0x77, 0x82, 0x6a, 0xf4, 0x01, 0x0e, 0x81,
+    0xdc, 0x50, 0x62, 0x8d, 0xf5, 0x6a, 0x00, 0x52, 0x94, 0xeb, 0x00, 0x4c,
+    0x86, 0x0c, 0xe7, 0x5d, 0x36, 0xa5, 0x34, 0xe6, 0x38, 0xb4, 0xc7, 0xa6,
+    0x6a, 0xa9, 0x0f, 0x7b, 0x98, 0xa8, 0xa6, 0xd4, 0x41, 0xca, 0x76, 0x34,
+    0x86, 0xe8, 0x9c, 0x57, 0x69, 0x0c, 0x61, 0x6e, 0x6e, 0x58, 0xa8, 0xd8,
+    0x42, 0xfc, 0xa7, 0x72, 0x36, 0x83, 0xec, 0xe0, 0x14, 0xc1, 0x48, 0xdc,
+    0xa1, 0x1c, 0x03, 0x00, 0x20, 0x7a, 0xe6, 0x44, 0x5c, 0x21, 0xf2, 0xf1,
+    0x0b, 0xe4, 0x67, 0x88, 0x5b, 0xa1, 0x92, 0xc3, 0xa3, 0x30, 0x12, 0xc2,
+    0xf0, 0x08, 0x90, 0x2f, 0xb0, 0x63, 0x11, 0xf1, 0x3b, 0x2e, 0x43, 0x3e,
+    0x0d, 0x05, 0xb1, 0x42, 0x94, 0x69, 0xe8, 0x2f, 0xc0, 0xd4, 0x15, 0x6e,
+    0x7a, 0x80, 0x34, 0xb6, 0xb1, 0xbd, 0x0b, 0x4c, 0x0d, 0xb2, 0x5f, 0xd9,
+    0x4b, 0xe7, 0x3c, 0x25, 0xfc, 0x6d, 0x5c, 0xa4, 0x9e, 0xa8, 0x08, 0x94,
+    0x40, 0x5f, 0x47, 0x90, 0x83, 0xd6, 0x53, 0x9d, 0x1e, 0x6a, 0x11, 0x48,
+    0xa0, 0x20, 0x7a, 0xd6, 0x01, 0x43, 0x57, 0x05, 0x40, 0x0c, 0x9c, 0x50,
+    0xf5, 0x8a, 0x23, 0x3c, 0x3f, 0x04, 0x89, 0x06, 0x0c, 0xbd, 0x10, 0x68,
+    0x74, 0x4d, 0x33, 0xd2, 0xb8, 0xe3, 0xee, 0xd0, 0xfe, 0xf5, 0x80, 0xd4,
+    0xc7, 0x1d, 0x11, 0x89, 0x35, 0x3b, 0xae, 0xdf, 0x2b, 0xf7, 0xb8, 0x14,
+    0xfb, 0x50, 0x83, 0x02, 0x22, 0xc8, 0xb0, 0xd6, 0x9d, 0x89, 0xae, 0xac,
+    0x06, 0x9c, 0xe9, 0xc9, 0x3b, 0x00, 0xac, 0x64, 0x4a, 0x7c, 0x99, 0x2c,
+    0x33, 0xbd, 0x08, 0x92, 0x15, 0x3f, 0x42, 0x60, 0xd5, 0xfd, 0x0a, 0xc8,
+    0x60, 0xb1, 0xda, 0x0f, 0x40, 0xdf, 0x19, 0x7e, 0xc1, 0xcd, 0xec, 0xb9,
+    0xbe, 0xab, 0xa4, 0x26, 0xd0, 0xa8, 0x56, 0x04, 0x63, 0x55, 0xfe, 0x28,
+    0x70, 0x11, 0x19, 0xa0, 0x73, 0x20, 0x67, 0x6d, 0xbd, 0x18, 0x2f, 0x50,
+    0x2a, 0xec, 0x95, 0x13, 0x13, 0xb5, 0x45, 0xa2, 0xa4, 0x5f, 0xf1, 0x41,
+    0xec, 0x83, 0x5e, 0x78, 0x2d, 0x2a, 0x88, 0x36, 0x03, 0x2c, 0x9a, 0xf7,
+    0x7e, 0xb0, 0x38, 0x6f, 0xdd, 0x04, 0x5a, 0xf7, 0x00, 0x68, 0xce, 0x9a,
+    0x9e, 0x28, 0x50, 0x3d, 0xba, 0xc6, 0x6e, 0x3b, 0xc5, 0x20, 0x3d, 0xda,
+    0x28, 0x04, 0x1f, 0x68, 0x11, 0x66, 0x81, 0x1a, 0xfa, 0x30, 0x71, 0xe8,
+    0xde, 0xe3, 0x25, 0xc3, 0x03, 0xcc, 0xaa, 0x86, 0x10, 0x7b, 0x96, 0xb4,
+    0x75, 0xd0, 0x8c, 0x97, 0x52, 0x1b, 0xba, 0xab, 0xb3, 0x6e, 0xca, 0x43,
+    0xc4, 0x02, 0xc8, 0x51, 0xfa, 0xac, 0xde, 0x94, 0x52, 0x04, 0x50, 0xbb,
+    0x1d, 0x29, 0x88, 0x85, 0x52, 0x0a, 0x4a, 0x3d, 0x0d, 0x50, 0x0a, 0x14,
+    0x11, 0x7f, 0x70, 0x83, 0x62, 0x40, 0xfa, 0xf1, 0x23, 0x49, 0xe9, 0x9b,
+    0x8d, 0x1e, 0x0a, 0xf6, 0x77, 0x75, 0x27, 0x27, 0x59, 0x23, 0xcc, 0x96,
+    0x64, 0xd7, 0xb8, 0xd2, 0x1d, 0xd6, 0x40, 0xd5, 0xb6, 0x6b, 0xe4, 0xcc,
+    0xde, 0xc5, 0xaa, 0x81, 0xd4, 0xb4, 0x6b, 0x1c, 0x5e, 0xc5, 0xd4, 0x87,
+    0x61, 0xcb, 0xae, 0x51, 0xe6, 0x46, 0xa6, 0x3e, 0xd2, 0xb4, 0xee, 0x1a,
+    0x6d, 0xae, 0x44, 0xea, 0xa3, 0x55, 0x2b, 0x78, 0x32, 0x03, 0xfa, 0x5d,
+    0xfb, 0xde, 0xff, 0x2d, 0x96, 0x51, 0xdb, 0xe9, 0x3a, 0x48, 0xb8, 0xcb,
+    0x27, 0xe2, 0x7e, 0xd7, 0x3c, 0xfa, 0x86, 0xa0, 0x3e, 0x8d, 0x6e, 0xdc,
+    0x35, 0x96, 0xee, 0x0b, 0xea, 0x23, 0xa9, 0x69, 0xd7, 0xb8, 0xc0, 0xde,
+    0x2a, 0xab, 0x71, 0x81, 0x3e, 0xf8, 0xdf, 0x35, 0x74, 0xe3, 0xb1, 0x37,
+    0x66, 0x3a, 0xbd, 0x62, 0x00, 0xb9, 0xbc, 0x46, 0x71, 0x0d, 0x32, 0x05,
+    0x8f, 0x61, 0x5c, 0xc3, 0xe4, 0x2a, 0xf4, 0x03, 0xac, 0xaf, 0x01, 0xe0,
+    0xb5, 0x3a, 0x11, 0x1d, 0xb3, 0x04, 0x88, 0x0c, 0x30, 0x3c, 0xcc, 0x48,
+    0xbc, 0xa3, 0x71, 0x9b, 0x0d, 0x9a, 0x06, 0xe3, 0x7d, 0xd9, 0xa0, 0x2c,
+    0xa2, 0x97, 0x17, 0x7a, 0x53, 0x0a, 0x90, 0x8f, 0x47, 0x79, 0xb3, 0x94,
+    0x36, 0xab, 0x54, 0xf4, 0x60, 0x46, 0x73, 0x37, 0xf5, 0x1f, 0x54, 0xd6,
+    0xcc, 0xfe, 0xaf, 0xca, 0xf4, 0xb5, 0x2b, 0xac, 0x12, 0xb6, 0xa5, 0xbf,
+    0x73, 0x45, 0x55, 0x46, 0x6a, 0xfe, 0x05, 0x63, 0x80, 0x84, 0x13, 0xf3,
+    0x21, 0xd2, 0x51, 0x1e, 0xe7, 0xdd, 0x40, 0x09, 0x02, 0xc6, 0x81, 0x28,
+    0x43, 0x78, 0x71, 0x7e, 0xa1, 0xb0, 0xc2, 0xa9, 0x31, 0x9d, 0x4d, 0xfa,
+    0x9a, 0x73, 0x44, 0xd0, 0x13, 0xca, 0x0f, 0xf4, 0xe8, 0xa9, 0xe5, 0xbe,
+    0xf5, 0x7c, 0xe2, 0x9c, 0xd2, 0xef, 0x32, 0xc7, 0x5a, 0x01, 0x94, 0x58,
+    0x47, 0xbd, 0xbd, 0x79, 0x32, 0x18, 0x74, 0xd5, 0x49, 0xfe, 0x18, 0x2a,
+    0xa4, 0xb3, 0x6e, 0x31, 0x58, 0x7f, 0xa6, 0xb6, 0x6f, 0x6a, 0x87, 0x06,
+    0xa5, 0x40, 0x4f, 0x57, 0xd9, 0x07, 0xf8, 0xa0, 0x1f, 0x8a, 0x6b, 0xe1,
+    0x7f, 0x49, 0x7c, 0x28, 0x36, 0x6d, 0x50, 0x20, 0xb3, 0x08, 0x41, 0xf8,
+    0x1c, 0xaf, 0x93, 0x8d, 0x44, 0x88, 0x66, 0x81, 0x02, 0x64, 0xa2, 0x1a,
+    0x25, 0x6e, 0x76, 0xf5, 0x8f, 0x39, 0xe2, 0x89, 0xe8, 0xab, 0x38, 0x2d,
+    0x1d, 0x63, 0xd5, 0x13, 0x5f, 0x69, 0xd4, 0x87, 0xc8, 0x87, 0x1a, 0x80,
+    0x09, 0xdf, 0x5f, 0xf0, 0xa4, 0x1d, 0xe1, 0xf8, 0xf2, 0x9c, 0x2b, 0x52,
+    0xa7, 0x0f, 0x8f, 0xec, 0x90, 0x16, 0x22, 0xcb, 0x60, 0x77, 0x0c, 0xde,
+    0x28, 0xcf, 0x7d, 0x85, 0xd9, 0x94, 0x40, 0x62, 0xf1, 0x9c, 0xd3, 0xf6,
+    0x91, 0x3e, 0xf5, 0xf1, 0x32, 0x00, 0xf4, 0x82, 0x34, 0x43, 0xff, 0x16,
+    0x64, 0x69, 0xe2, 0xd7, 0x4d, 0xeb, 0xeb, 0xfe, 0xe4, 0x04, 0xc3, 0x34,
+    0x73, 0xa0, 0x90, 0xc6, 0x1f, 0x53, 0x4f, 0x13, 0xb4, 0xf7, 0x29, 0x54,
+    0x39, 0x8f, 0x67, 0x39, 0x6e, 0xcb, 0x22, 0x11, 0xb6, 0x51, 0xf2, 0x7f,
+    0x7a, 0xea, 0x0b, 0xba, 0x62, 0x0a, 0x74, 0x3e, 0xd2, 0x4a, 0x22, 0x55,
+    0x12, 0xd6, 0x86, 0xf4, 0x9f, 0xa6, 0x1f, 0x51, 0x27, 0x46, 0xec, 0x97,
+    0x66, 0x50, 0x58, 0x11, 0x03, 0xb2, 0x84, 0xf1, 0xac, 0xed, 0xbc, 0x3f,
+    0x87, 0x72, 0x9a, 0x17, 0x89, 0x3a, 0xe9, 0x06, 0x53, 0xa9, 0x5d, 0x27,
+    0xc4, 0xe8, 0x27, 0xc1, 0xc3, 0x1e, 0x92, 0x5e, 0x8a, 0x56, 0x1d, 0x1b,
+    0x0c, 0x18, 0x91, 0x3a, 0xb2, 0xc6, 0x92, 0x1d, 0x48, 0x11, 0xfa, 0x8a,
+    0xda, 0x56, 0xa1, 0x63, 0x1f, 0xf0, 0x5a, 0x49, 0xbe, 0x16, 0x5c, 0x68,
+    0x30, 0x24, 0x85, 0x06, 0xca, 0x9a, 0x22, 0xc0, 0x40, 0x1b, 0xa4, 0xae,
+    0x63, 0x9f, 0x39, 0xec, 0x86, 0xf5, 0x3e, 0x23, 0x11, 0x6a, 0x90, 0xa1,
+    0x12, 0xca, 0x30, 0x80, 0xda, 0x8e, 0x53, 0x13, 0xa8, 0x2e, 0xfb, 0xbe,
+    0x10, 0xf9, 0x3c, 0x86, 0x7d, 0xb5, 0x73, 0xf3, 0xf1, 0xf6, 0x33, 0x34,
+    0xe0, 0xdb, 0x5a, 0x22, 0xcd, 0x46, 0xec, 0xbb, 0xa3, 0xb9, 0x4e, 0xef,
+    0x33, 0xf8, 0xc8, 0x81, 0x1e, 0xb8, 0xf5, 0x96, 0x1e, 0x61, 0xe0, 0xfe,
+    0x7d, 0x6f, 0xb9, 0x5c, 0xf6, 0xf0, 0x06, 0xa3, 0x57, 0xa4, 0xa1, 0x3a,
+    0x41, 0xf2, 0x1d, 0x00, 0x50, 0x7c, 0xcd, 0x0b, 0xfb, 0x92, 0x79, 0xc6,
+    0xa0, 0x82, 0x5e, 0xed, 0x4b, 0xd4, 0x86, 0x60, 0x05, 0x3f, 0x34, 0x8e,
+    0x3f, 0x8c, 0xef, 0x88, 0x5e, 0x03, 0xa4, 0x69, 0xaf, 0xd0, 0xd7, 0x11,
+    0x79, 0x0f, 0x21, 0xa6, 0x8b, 0x07, 0xbe, 0x84, 0x35, 0x4f, 0x36, 0xc7,
+    0x7a, 0xf6, 0x50, 0x45, 0xc0, 0xcd, 0x42, 0xdd, 0x71, 0x1d, 0xcb, 0xa7,
+    0xd5, 0x8d, 0x33, 0xb8, 0xe1, 0x8e, 0xa7, 0xcf, 0x84, 0x09, 0x86, 0x43,
+    0xf2, 0x9d, 0x23, 0x6a, 0x24, 0xca, 0xa5, 0x79, 0xf8, 0xce, 0x41, 0x75,
+    0x06, 0xa5, 0xa6, 0x9a, 0xed, 0x1c, 0x35, 0xab, 0xdf, 0x01, 0xe0, 0xa0,
+    0xd5, 0xce, 0x41, 0x36, 0x75, 0x52, 0x13, 0xed, 0xae, 0xc3, 0x35, 0x7a,
+    0xa0, 0x26, 0x2a, 0x9e, 0x60, 0xbc, 0x26, 0xdf, 0x52, 0x23, 0x43, 0xf9,
+    0x03, 0x81, 0x8f, 0x03, 0x09, 0xaa, 0x9e, 0xc5, 0x9d, 0xd4, 0xb8, 0x68,
+    0xe7, 0xb0, 0x1a, 0x6d, 0x42, 0xc2, 0xf3, 0x4e, 0xe1, 0x2f, 0x3d, 0xc5,
+    0xf2, 0xf8, 0x52, 0x9a, 0xd2, 0x49, 0xe7, 0x37, 0xe4, 0xe3, 0x6d, 0x67,
+    0xac, 0x79, 0x87, 0xfa, 0x28, 0x97, 0x6e, 0xeb, 0xc4, 0x55, 0xa7, 0x1d,
+    0x17, 0x27, 0xd4, 0x07, 0x1d, 0xa6, 0xee, 0x3d, 0xd8, 0xab, 0x3d, 0x75,
+    0x7f, 0x81, 0xdf, 0x02, 0x7a, 0x68, 0x4c, 0xbc, 0x4d, 0x46, 0x81, 0x5b,
+    0x12, 0xec, 0x68, 0x4c, 0xaa, 0x52, 0x55, 0x52, 0x9b, 0xb6, 0xd6, 0xb6,
+    0xb1, 0x53, 0x4f, 0x0d, 0x25, 0xeb, 0x6c, 0x3d, 0x51, 0xc6, 0x14, 0x46,
+    0x2b, 0x3f, 0x6d, 0xf3, 0x52, 0x96, 0x4f, 0xb3, 0x21, 0xcc, 0xdd, 0x6a,
+    0xb7, 0x00, 0x5f, 0xb9, 0x5b, 0xee, 0x01, 0xd4, 0xc6, 0x53, 0x53, 0x7b,
+    0xf8, 0xb2, 0x72, 0x6d, 0x5a, 0x8a, 0xc7, 0x9d, 0x50, 0xb9, 0x2b, 0xfa,
+    0x8e, 0xa7, 0x34, 0xd2, 0x77, 0x2d, 0xb2, 0x0c, 0x2d, 0x53, 0xcf, 0x2d,
+    0x39, 0x30, 0x82, 0xbc, 0xbb, 0x5e, 0xb9, 0xe5, 0x13, 0xea, 0x76, 0x79,
+    0x34, 0xc3, 0x1e, 0x7e, 0x94, 0x0d, 0xd3, 0x6b, 0x20, 0xb5, 0xd3, 0x58,
+    0xf3, 0x26, 0x60, 0xb3, 0xb2, 0x58, 0x17, 0x8f, 0x1d, 0x64, 0xcf, 0xf6,
+    0x35, 0xe4, 0x23, 0xc7, 0xc5, 0x80, 0xa2, 0xc7, 0x83, 0xea, 0x06, 0x11,
+    0x2d, 0xf8, 0xb3, 0x7a, 0x27, 0xfb, 0x07, 0xef, 0x12, 0xe9, 0xc2, 0xed,
+    0xa9, 0x22, 0x9a, 0xd7, 0x8a, 0x9a, 0xe1, 0xf3, 0xbb, 0xa7, 0x0a, 0xf8,
+    0xb9, 0x0e, 0x31, 0x74, 0xbf, 0x68, 0xad, 0x01, 0xcf, 0x60, 0x6d, 0x85,
+    0xe0, 0x7b, 0x29, 0xbc, 0x43, 0x07, 0x0d, 0x26, 0x65, 0xe9, 0x20, 0x59,
+    0xc9, 0xa4, 0xcc, 0x7d, 0x3c, 0xc5, 0xaa, 0x29, 0x54, 0xac, 0x5b, 0xd7,
+    0x8c, 0xb5, 0xf9, 0x5e, 0xa9, 0x9b, 0x43, 0xf5, 0x0e, 0xa6, 0xca, 0xbf,
+    0x72, 0x7a, 0x64, 0x2c, 0x74, 0x3a, 0x68, 0xab, 0x41, 0x2e, 0xd5, 0x6a,
+    0x50, 0x6d, 0xb3, 0x3c, 0x5f, 0x1d, 0x10, 0xe0, 0x1b, 0xd9, 0xe5, 0x10,
+    0xd5, 0x5c, 0x87, 0x9b, 0xfa, 0x95, 0x55, 0xd9, 0x17, 0xca, 0x70, 0x17,
+    0x63, 0x94, 0x2f, 0xd4, 0xdd, 0xad, 0xe1, 0x89, 0x2f, 0x6e, 0xae, 0x3e,
+    0x3c, 0x4a, 0x0d, 0xde, 0x26, 0x32, 0xda, 0x66, 0x0c, 0x1a, 0x4b, 0xd0,
+    0xa5, 0x8a, 0xfc, 0x36, 0xe8, 0xf2, 0x08, 0xe1, 0xd4, 0xec, 0xf6, 0x89,
+    0x96, 0xcd, 0xd4, 0xcc, 0x55, 0x12, 0x15, 0xf8, 0xbd, 0x54, 0x7c, 0x2b,
+    0x64, 0x2a, 0x6e, 0x24, 0xde, 0x1a, 0xed, 0x59, 0x3f, 0xd3, 0xb2, 0xde,
+    0x30, 0x8d, 0xe2, 0x5e, 0x92, 0xc2, 0x76, 0xac, 0x7c, 0xa7, 0xc3, 0x7a,
+    0xab, 0x86, 0x1d, 0xd9, 0xbf, 0x69, 0xa2, 0x96, 0x2d, 0xbf, 0x89, 0x52,
+    0x0f, 0xab, 0x37, 0x76, 0x0e, 0x8d, 0xb4, 0xf5, 0x57, 0x54, 0x6a, 0x2f,
+    0x59, 0xad, 0xfd, 0x92, 0xa3, 0xf9, 0xa3, 0x2a, 0x7a, 0x37, 0xfe, 0x91,
+    0x9f, 0x82, 0x00, 0xad, 0x04, 0xa1, 0xf4, 0x0e, 0xa1, 0xfa, 0x01, 0x07,
+    0x69, 0xf0, 0x81, 0xdf, 0x49, 0x75, 0x15, 0x4a, 0x97, 0xba, 0x1b, 0x5f,
+    0x9e, 0x63, 0xb3, 0x14, 0x71, 0x0b, 0xff, 0xdf, 0x03, 0xf8, 0x4c, 0xf0,
+    0xc6, 0x03, 0x7f, 0x61, 0x51, 0x2c, 0x22, 0xa0, 0x6b, 0xa9, 0x48, 0x04,
+    0xcf, 0xdb, 0x6f, 0x60, 0x0b, 0x1b, 0xe0, 0xf9, 0x63, 0xf5, 0xfb, 0xab,
+    0x4d, 0x2f, 0xd5, 0xc1, 0x96, 0x9b, 0x66, 0xeb, 0xcf, 0x53, 0x11, 0x8c,
+    0x9d, 0x7d, 0xeb, 0xc5, 0x33, 0x6b, 0x81, 0x87, 0xf6, 0x0b, 0xd1, 0x46,
+    0xd8, 0xcb, 0x9f, 0x86, 0x07, 0x6f, 0x4e, 0x5f, 0x9f, 0xb8, 0xec, 0x82,
+    0x67, 0xf3, 0x69, 0xcc, 0x53, 0xff, 0x91, 0x57, 0xe1, 0x9a, 0x13, 0x65,
+    0x1e, 0x8f, 0x9e, 0x39, 0xd9, 0xc9, 0xc1, 0xd1, 0x1b, 0x97, 0xdd, 0x7a,
+    0xb8, 0xc1, 0x48, 0x9f, 0x31, 0xd5, 0x34, 0x8d, 0x97, 0x99, 0x78, 0xfe,
+    0x64, 0x43, 0x17, 0xf7, 0x38, 0x30, 0xf4, 0x19, 0x73, 0x85, 0x32, 0xfa,
+    0xfa, 0xdc, 0x99, 0xe8, 0x05, 0xbe, 0x73, 0xfc, 0x0d, 0x48, 0xf6, 0x9c,
+    0x55, 0x71, 0xef, 0x6b, 0x91, 0x3c, 0x77, 0xae, 0xe1, 0xe9, 0x00, 0x56,
+    0x45, 0x43, 0x9f, 0x31, 0xd7, 0x82, 0x47, 0x05, 0x54, 0xa9, 0xe7, 0x5a,
+    0x70, 0x08, 0xeb, 0xfa, 0x33, 0x0d, 0x7d, 0xce, 0xc2, 0x88, 0xec, 0x67,
+    0xcf, 0x9d, 0xec, 0xf5, 0x09, 0xb8, 0x8b, 0x36, 0x79, 0xd9, 0xd6, 0xf7,
+    0xa6, 0xf6, 0xf5, 0x4f, 0x4f, 0xf6, 0xd5, 0xcf, 0x54, 0xff, 0x0f, 0xf4,
+    0xa7, 0xaa, 0x6b, 0xbe, 0x3a, 0x00, 0x00,
+};
+
+// scan.html: 10538 bytes, 3409 gzipped
+static const uint8_t web_scan_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5a,
+    0xeb, 0x72, 0xdb, 0xc6, 0x15, 0xfe, 0xcf, 0xa7, 0x58, 0xd3, 0xa9, 0x01,
+    0xd6, 0x24, 0x78, 0x91, 0x6c, 0xcb, 0xa4, 0x48, 0x4f, 0x2d, 0xcb, 0x89,
+    0x1b, 0xf9, 0x52, 0x4b, 0x9e, 0x69, 0x27, 0xce, 0x34, 0x4b, 0x60, 0x49,
+    0xc2, 0x02, 0x01, 0x04, 0x58, 0x48, 0x62, 0x14, 0xfd, 0xec, 0x5b, 0xf4,
+    0xe9, 0xfa, 0x24, 0xfd, 0xce, 0x59, 0x00, 0x04, 0x6f, 0xb6, 0xd4, 0x51,
+    0x66, 0xaa, 0x1f, 0xa2, 0xb0, 0xd8, 0x3d, 0xf7, 0xfd, 0xce, 0xb7, 0x4b,
+    0x1d, 0x3e, 0x78, 0xf5, 0xfe, 0xe8, 0xec, 0x1f, 0x1f, 0x8e, 0xc5, 0x4c,
+    0xcf, 0x83, 0x51, 0xed, 0xb0, 0xf8, 0x50, 0xd2, 0xc3, 0xc7, 0x5c, 0x69,
+    0x29, 0x42, 0x39, 0x57, 0xc3, 0xfa, 0x85, 0xaf, 0x2e, 0xe3, 0x28, 0xd1,
+    0x75, 0xe1, 0x46, 0xa1, 0x56, 0xa1, 0x1e, 0xd6, 0x2f, 0x7d, 0x4f, 0xcf,
+    0x86, 0x9e, 0xba, 0xf0, 0x5d, 0xd5, 0xe2, 0x87, 0xa6, 0xf0, 0x43, 0x5f,
+    0xfb, 0x32, 0x68, 0xa5, 0xae, 0x0c, 0xd4, 0xb0, 0xdb, 0x14, 0x73, 0x79,
+    0xe5, 0xcf, 0xb3, 0x79, 0x31, 0x50, 0x2f, 0xa4, 0xba, 0x33, 0x99, 0xa4,
+    0x0a, 0x52, 0x3e, 0x9d, 0xbd, 0x6e, 0x1d, 0xd0, 0xb0, 0xf6, 0x75, 0xa0,
+    0x46, 0xa7, 0xae, 0x0c, 0x43, 0x95, 0x1c, 0xb6, 0xcd, 0x63, 0xed, 0x30,
+    0x75, 0x13, 0x3f, 0xd6, 0x22, 0x4d, 0xdc, 0x61, 0xbd, 0x9d, 0x6a, 0xa9,
+    0x7d, 0xb7, 0x2d, 0xe3, 0xd8, 0xf9, 0x92, 0xbe, 0xb8, 0x18, 0x1e, 0x1c,
+    0x1c, 0x3c, 0xf1, 0x9e, 0x3f, 0x79, 0x5a, 0x1f, 0x1d, 0xb6, 0xcd, 0x44,
+    0x5a, 0xa1, 0x17, 0xb4, 0xb2, 0x9f, 0x44, 0x91, 0x16, 0xd7, 0xa2, 0xd5,
+    0x1a, 0x4f, 0xfb, 0xe2, 0x61, 0x87, 0x7f, 0x06, 0x78, 0x74, 0x65, 0xe2,
+    0x61, 0xa0, 0xcb, 0x3f, 0x34, 0x20, 0x5d, 0x17, 0x0e, 0xf1, 0x9c, 0xc9,
+    0xe4, 0xe0, 0x80, 0x86, 0xb4, 0xba, 0xa2, 0x81, 0x09, 0xff, 0xd0, 0x40,
+    0x9a, 0x8d, 0xf1, 0xfc, 0x94, 0x7f, 0xe8, 0x59, 0x25, 0x09, 0xbf, 0xdf,
+    0xc7, 0xcf, 0x40, 0xdc, 0xd4, 0xfe, 0x0c, 0x4d, 0x73, 0x99, 0x4c, 0xfd,
+    0xb0, 0x2f, 0xa0, 0x25, 0x96, 0x9e, 0xe7, 0x87, 0x53, 0xfe, 0x7b, 0x1c,
+    0x5d, 0xb5, 0x52, 0xff, 0x37, 0x7e, 0x1c, 0x47, 0x89, 0xa7, 0x92, 0x16,
+    0x86, 0x20, 0xe4, 0x52, 0x8d, 0xcf, 0x7d, 0xdd, 0x9a, 0x20, 0xa0, 0xad,
+    0x74, 0x0e, 0x6b, 0x67, 0x3c, 0x47, 0x86, 0x14, 0x42, 0x5f, 0xa6, 0xca,
+    0x23, 0xc9, 0xe3, 0xc8, 0x5b, 0x40, 0xf8, 0x58, 0xba, 0xe7, 0xd3, 0x24,
+    0xca, 0x42, 0xd8, 0x7e, 0x21, 0x13, 0x9b, 0xdc, 0x6a, 0x0c, 0x90, 0x8d,
+    0x20, 0x4a, 0x8a, 0x11, 0xb2, 0x1a, 0x63, 0x2c, 0x70, 0x22, 0xe7, 0x7e,
+    0xb0, 0xe8, 0x8b, 0x16, 0x82, 0x15, 0xa8, 0x56, 0xba, 0x48, 0xb5, 0x9a,
+    0x37, 0xc5, 0xcb, 0xc0, 0x0f, 0xcf, 0xdf, 0x4a, 0xf7, 0x94, 0x9f, 0x5f,
+    0x63, 0x66, 0x53, 0x58, 0x6f, 0x90, 0xd1, 0xc4, 0x6a, 0x8a, 0x8f, 0xd1,
+    0x38, 0xd2, 0x51, 0x53, 0xa4, 0x32, 0x4c, 0x5b, 0xa9, 0x4a, 0x7c, 0xb8,
+    0xee, 0xf9, 0x69, 0x1c, 0x48, 0x08, 0x9a, 0x04, 0x0a, 0x46, 0xd3, 0xef,
+    0x96, 0xe7, 0x27, 0xca, 0xd5, 0x7e, 0x04, 0x5f, 0xa1, 0x3f, 0x9b, 0x87,
+    0x03, 0x01, 0x83, 0xa7, 0x61, 0xcb, 0x87, 0xcc, 0x14, 0x83, 0x8a, 0x04,
+    0x0e, 0xc4, 0x97, 0x2c, 0xd5, 0xfe, 0x64, 0xd1, 0xca, 0x4b, 0x66, 0xf9,
+    0x62, 0xee, 0x87, 0xad, 0x99, 0xf2, 0xa7, 0x33, 0x8c, 0x75, 0x3b, 0x9d,
+    0x8b, 0x59, 0x25, 0x62, 0xbd, 0x4e, 0x7c, 0x45, 0x7e, 0x3b, 0xb4, 0x4a,
+    0xfa, 0x28, 0x06, 0x78, 0xcf, 0xe5, 0xc5, 0x73, 0xff, 0x34, 0xa0, 0x9a,
+    0x6a, 0xe5, 0x03, 0xfb, 0x9d, 0x7c, 0xf6, 0xac, 0x8b, 0x59, 0x26, 0x92,
+    0xfe, 0x6f, 0x0a, 0x52, 0xf6, 0x69, 0x9c, 0x07, 0x2e, 0x73, 0x45, 0x4f,
+    0x29, 0xfd, 0x26, 0x47, 0x48, 0x80, 0xd6, 0xd1, 0xbc, 0x2f, 0x0e, 0x68,
+    0x16, 0x85, 0xad, 0xc5, 0x0e, 0x2c, 0x2d, 0xbc, 0xa9, 0xc5, 0x0e, 0x72,
+    0xce, 0x55, 0x08, 0xc9, 0x2b, 0x61, 0xc6, 0x78, 0x11, 0x65, 0xa3, 0xac,
+    0xbb, 0xbf, 0x4b, 0xcc, 0x9a, 0xba, 0xfd, 0xc2, 0x37, 0x3f, 0x8c, 0x33,
+    0xdd, 0xa2, 0x7c, 0xc6, 0x90, 0x1e, 0x47, 0xa9, 0x6f, 0xc2, 0x99, 0xa8,
+    0x00, 0x15, 0x7e, 0xa1, 0x36, 0x56, 0x16, 0x51, 0xe1, 0x85, 0x4d, 0xd6,
+    0x25, 0x13, 0x25, 0xd7, 0x43, 0xb3, 0x59, 0x25, 0x54, 0xed, 0x8d, 0x41,
+    0x5e, 0x78, 0x98, 0x16, 0x5f, 0x89, 0x34, 0x0a, 0x7c, 0x4f, 0x3c, 0xdc,
+    0xdb, 0xdb, 0x2b, 0xeb, 0xe7, 0x72, 0x86, 0xd4, 0x55, 0x92, 0xd0, 0x7d,
+    0x5a, 0x86, 0x2f, 0x77, 0x91, 0x07, 0xf2, 0xf2, 0x4d, 0xa4, 0xe7, 0x67,
+    0xc8, 0x73, 0xb7, 0x47, 0x83, 0x51, 0xa6, 0x51, 0x54, 0x98, 0x13, 0x46,
+    0xa1, 0xaa, 0x14, 0xcc, 0x38, 0x88, 0xdc, 0xf3, 0xb5, 0x6a, 0xf4, 0xc3,
+    0x19, 0xca, 0x4a, 0x97, 0x9e, 0xc0, 0xfe, 0xed, 0xd1, 0xaf, 0x38, 0x58,
+    0x9d, 0x10, 0xa8, 0x09, 0x16, 0x27, 0xca, 0x18, 0x75, 0xa1, 0x12, 0xc0,
+    0x81, 0x0c, 0xd6, 0x0a, 0xca, 0xc4, 0x6a, 0x45, 0xef, 0x3c, 0x0a, 0xa3,
+    0x34, 0x96, 0xae, 0x2a, 0x35, 0xf7, 0x27, 0x91, 0x9b, 0xa5, 0xcb, 0x48,
+    0x9a, 0x67, 0xda, 0x68, 0xc6, 0xc7, 0x95, 0x8c, 0x1b, 0x84, 0x68, 0xf0,
+    0x76, 0xcc, 0x90, 0x90, 0xf0, 0xdb, 0x71, 0x2f, 0x97, 0xe4, 0x82, 0x1e,
+    0x32, 0xfa, 0x14, 0x69, 0x30, 0xa1, 0xfa, 0x56, 0xb8, 0x57, 0xca, 0xf7,
+    0xd9, 0x72, 0xfd, 0x5a, 0x02, 0xdc, 0x2c, 0x49, 0x49, 0x45, 0x1c, 0xf9,
+    0x45, 0xf8, 0x8c, 0x95, 0x7d, 0xe4, 0x42, 0x8e, 0x03, 0xe5, 0xc1, 0xdc,
+    0x08, 0xde, 0xfb, 0x1a, 0xa1, 0xe8, 0x38, 0x4f, 0xb6, 0xd9, 0x6b, 0x8a,
+    0x1a, 0xa5, 0x89, 0xe0, 0x66, 0x81, 0x2e, 0xe1, 0x6c, 0xad, 0x02, 0xd7,
+    0xb6, 0xe9, 0x56, 0x7b, 0x76, 0x16, 0xe1, 0xb6, 0x54, 0x97, 0xe5, 0x62,
+    0x42, 0xb2, 0xab, 0x4e, 0x61, 0x18, 0x21, 0x57, 0xba, 0xb4, 0x4b, 0x47,
+    0x71, 0xb1, 0xa1, 0xb6, 0x97, 0x90, 0xdc, 0xbe, 0x6f, 0x79, 0xb2, 0xa7,
+    0xdc, 0x28, 0x91, 0x66, 0xcf, 0x19, 0xc5, 0xd5, 0xe0, 0xef, 0x99, 0xbd,
+    0x86, 0x9e, 0x62, 0x5a, 0xc9, 0x61, 0x3b, 0x6f, 0x88, 0x84, 0xc5, 0xf8,
+    0xf0, 0xfc, 0x0b, 0xe1, 0x06, 0x32, 0x4d, 0x87, 0xf5, 0x12, 0xa4, 0xa8,
+    0x85, 0x01, 0x84, 0x7c, 0x6f, 0x58, 0xa7, 0xc9, 0x88, 0x51, 0x7d, 0xf4,
+    0x17, 0xcf, 0xc3, 0xd2, 0x2e, 0xde, 0xc4, 0xc5, 0xfc, 0x02, 0x53, 0xea,
+    0x3c, 0xb3, 0x7c, 0x42, 0xff, 0x8a, 0x73, 0xc1, 0x34, 0x6e, 0x72, 0x40,
+    0xa3, 0x18, 0xc1, 0xf8, 0x24, 0x4a, 0xe6, 0x66, 0x01, 0xda, 0xe3, 0x6b,
+    0x3c, 0xd4, 0x57, 0xad, 0xa8, 0xc0, 0x09, 0xb7, 0xd2, 0x62, 0xf3, 0xd0,
+    0x92, 0xb1, 0x4c, 0xdc, 0xc8, 0x83, 0xc2, 0x44, 0xfd, 0x9a, 0x01, 0xb8,
+    0x3d, 0x21, 0x33, 0x1d, 0xb9, 0xd1, 0x1c, 0x6d, 0x41, 0xa3, 0xb3, 0x47,
+    0x93, 0x09, 0xde, 0x45, 0x97, 0x10, 0xf3, 0x84, 0x34, 0x16, 0x8b, 0xc9,
+    0x6d, 0xa3, 0x3d, 0x2f, 0x79, 0xbd, 0x88, 0x15, 0x9b, 0x3c, 0xf7, 0xb5,
+    0x31, 0x3f, 0x88, 0xa2, 0x73, 0xd2, 0x78, 0xc2, 0x9f, 0x87, 0x6d, 0x33,
+    0x91, 0x16, 0x92, 0xc1, 0x4b, 0x01, 0x15, 0x4b, 0xc3, 0xa8, 0x15, 0x27,
+    0x28, 0xd3, 0xba, 0xe0, 0xd8, 0x0e, 0xeb, 0x9b, 0xd9, 0xcc, 0x6b, 0x8a,
+    0x47, 0xd6, 0xcb, 0x20, 0x2f, 0x3f, 0xf3, 0x92, 0x4b, 0x90, 0xe3, 0xbe,
+    0x57, 0x48, 0xab, 0x54, 0x42, 0x51, 0x08, 0xa6, 0x04, 0x1e, 0x72, 0x1f,
+    0xdf, 0xc0, 0xec, 0xb5, 0x1a, 0xef, 0x3e, 0x29, 0xcb, 0x49, 0x27, 0x68,
+    0x82, 0xe4, 0x46, 0x5f, 0x64, 0x71, 0xac, 0x12, 0x17, 0xfd, 0x78, 0x00,
+    0xfc, 0xd1, 0x10, 0xda, 0x22, 0x28, 0x31, 0x1b, 0x97, 0x2d, 0x78, 0x27,
+    0x2f, 0xfc, 0x29, 0x57, 0x13, 0xd2, 0xbd, 0x97, 0x3b, 0x9c, 0x5b, 0x54,
+    0xd6, 0xf7, 0x34, 0xf1, 0xd1, 0xcf, 0xe9, 0x37, 0xfa, 0x34, 0x82, 0x2f,
+    0xb5, 0x6a, 0x99, 0xee, 0x99, 0x12, 0xee, 0xc7, 0x4a, 0x6a, 0xfb, 0x59,
+    0x53, 0x74, 0x27, 0x09, 0x8a, 0x74, 0x2a, 0xc9, 0xf9, 0xc2, 0xbf, 0x3c,
+    0x01, 0x51, 0xe8, 0x06, 0xbe, 0x7b, 0x4e, 0x71, 0x77, 0x59, 0x9b, 0x33,
+    0x4b, 0xd4, 0x64, 0x68, 0xb5, 0xad, 0x32, 0x9a, 0x1b, 0x55, 0xbc, 0x84,
+    0x18, 0x23, 0xec, 0xd1, 0xc3, 0x6e, 0xef, 0xd9, 0xf3, 0xa7, 0x20, 0x39,
+    0xaf, 0x64, 0x3a, 0x1b, 0x47, 0xd8, 0x98, 0x95, 0xbc, 0x7d, 0x4b, 0x11,
+    0x95, 0xdf, 0x1d, 0x95, 0x1d, 0xf4, 0xf6, 0x9f, 0x0d, 0x44, 0x49, 0xeb,
+    0x6e, 0xad, 0x6a, 0x4c, 0x25, 0xa9, 0xee, 0xae, 0x0c, 0x8c, 0xee, 0x25,
+    0x2f, 0xbd, 0x83, 0x2e, 0x42, 0x96, 0xbb, 0x6a, 0x62, 0xde, 0x77, 0x14,
+    0xa1, 0x05, 0xa5, 0x77, 0xf1, 0x0a, 0xd0, 0x98, 0xc5, 0x77, 0xd5, 0xd5,
+    0x7d, 0x0e, 0xe8, 0x7f, 0xc9, 0x4b, 0xef, 0xa0, 0x6b, 0x2e, 0xc3, 0x4c,
+    0x06, 0x77, 0x8e, 0x60, 0x17, 0x7e, 0xbd, 0xe5, 0xa5, 0x77, 0x71, 0x0c,
+    0x7c, 0x38, 0x4a, 0xd2, 0xbb, 0x2a, 0x7b, 0x7a, 0x80, 0x74, 0x1d, 0xf3,
+    0xd2, 0x2a, 0x7a, 0x18, 0xd4, 0xa8, 0x80, 0x87, 0x01, 0x1b, 0xec, 0xd4,
+    0x52, 0x7e, 0x49, 0x99, 0x26, 0xfe, 0x15, 0x78, 0x32, 0xe1, 0x41, 0x67,
+    0x40, 0xec, 0x00, 0x1f, 0xa6, 0x33, 0x73, 0x63, 0xce, 0x39, 0x01, 0xff,
+    0x5d, 0x69, 0x4b, 0xdc, 0x8c, 0x7f, 0x6b, 0xf9, 0xa1, 0xa7, 0xae, 0xfa,
+    0xcf, 0xf1, 0x33, 0x28, 0xb6, 0x29, 0x37, 0x83, 0x2a, 0x99, 0xcd, 0x61,
+    0x64, 0x9d, 0xca, 0xe6, 0xc3, 0xf5, 0xd5, 0xcd, 0x5e, 0x55, 0x41, 0x87,
+    0x8b, 0xc2, 0xe9, 0x3d, 0xf2, 0x79, 0xb5, 0x57, 0x76, 0x97, 0x43, 0xfd,
+    0x35, 0x94, 0xdb, 0x04, 0x31, 0xe3, 0xd1, 0x73, 0x38, 0xb1, 0xe4, 0xbe,
+    0x7b, 0x4b, 0xf8, 0xeb, 0x15, 0xfa, 0x73, 0xac, 0xcb, 0xcf, 0x31, 0x15,
+    0x68, 0xed, 0xd4, 0x47, 0xa7, 0xc7, 0x47, 0x9f, 0x3e, 0x1e, 0x8b, 0x93,
+    0xf7, 0xdf, 0xbf, 0x79, 0x07, 0x98, 0xea, 0x71, 0x57, 0x5a, 0x5d, 0x87,
+    0xe3, 0xd4, 0x60, 0x99, 0x38, 0x42, 0xc8, 0xfa, 0xe8, 0x98, 0x0c, 0x10,
+    0x1f, 0xde, 0xbc, 0x13, 0x3a, 0xe2, 0xb3, 0x9f, 0x1f, 0x66, 0xca, 0x74,
+    0x2b, 0xc3, 0xe0, 0x4c, 0x5b, 0x88, 0x81, 0xee, 0x97, 0xf0, 0xc6, 0x34,
+    0x86, 0x98, 0x32, 0x85, 0x78, 0xba, 0x6a, 0x16, 0x05, 0xf0, 0x70, 0x58,
+    0x87, 0x80, 0x32, 0x77, 0x95, 0xfc, 0x14, 0x01, 0x62, 0xe2, 0x90, 0x9f,
+    0x9f, 0x08, 0x84, 0x71, 0x6e, 0xaa, 0xc6, 0xb2, 0xd7, 0xeb, 0x6d, 0x89,
+    0x15, 0x6d, 0xc1, 0x0a, 0xba, 0xaf, 0xc6, 0x97, 0x90, 0x7c, 0x33, 0x90,
+    0x15, 0xef, 0x88, 0xfa, 0x17, 0xd4, 0x95, 0xb3, 0x5e, 0x47, 0x75, 0x9f,
+    0xab, 0x85, 0x17, 0x5d, 0x86, 0xe8, 0xa8, 0x13, 0x5b, 0x5d, 0x60, 0x8d,
+    0x83, 0x91, 0xe1, 0x70, 0x68, 0x71, 0x18, 0xac, 0x46, 0xfa, 0xc1, 0x6e,
+    0xd4, 0xb9, 0x81, 0x32, 0x5d, 0xdc, 0xb2, 0x31, 0xcc, 0x8c, 0x6f, 0x78,
+    0xba, 0x5a, 0x8a, 0x9c, 0xac, 0x32, 0x75, 0x9d, 0xc2, 0x53, 0x36, 0x6a,
+    0xd3, 0xa9, 0x2a, 0x29, 0x1c, 0x23, 0xba, 0x83, 0x9c, 0xfe, 0x15, 0xec,
+    0xaf, 0xe2, 0xe2, 0xd3, 0x22, 0x06, 0xcb, 0x66, 0xb6, 0xec, 0x65, 0xf5,
+    0xd1, 0xa7, 0x77, 0x27, 0xef, 0x8f, 0x7e, 0xdc, 0xb9, 0xf1, 0x8a, 0x03,
+    0x35, 0x7a, 0x1e, 0x28, 0x9d, 0x76, 0x67, 0xa7, 0x10, 0x2a, 0x86, 0xd8,
+    0xc0, 0x83, 0xda, 0x24, 0x0b, 0xf9, 0x00, 0x28, 0xe2, 0x24, 0x72, 0x55,
+    0x9a, 0xfe, 0x2d, 0x53, 0x99, 0xb2, 0x29, 0x96, 0xa0, 0xd4, 0xbe, 0x77,
+    0xd5, 0x24, 0x8e, 0xde, 0x14, 0x63, 0x1d, 0x36, 0xc4, 0x75, 0x0d, 0xc1,
+    0xc4, 0x98, 0x18, 0x0d, 0x05, 0xcf, 0x70, 0x02, 0x15, 0x4e, 0xf5, 0x8c,
+    0xde, 0x60, 0x02, 0xce, 0x42, 0xe8, 0x0c, 0x67, 0x30, 0x13, 0xb2, 0x2d,
+    0x43, 0x25, 0xac, 0x01, 0x2d, 0x75, 0x4a, 0xfa, 0x3a, 0x14, 0x13, 0xc0,
+    0x91, 0x1a, 0xd4, 0x3c, 0x44, 0x7d, 0x4e, 0x69, 0x99, 0x2a, 0x7d, 0x1c,
+    0x28, 0xfa, 0xf3, 0xe5, 0xe2, 0x8d, 0x67, 0x5b, 0x39, 0xcb, 0xb1, 0x1a,
+    0xce, 0x85, 0x0c, 0x32, 0x32, 0xd3, 0xb2, 0x06, 0xb5, 0x44, 0xe9, 0x2c,
+    0x09, 0x07, 0xb5, 0x9b, 0x1a, 0x18, 0xa0, 0xa0, 0x09, 0x22, 0xb7, 0xe1,
+    0x27, 0x18, 0xf4, 0xf3, 0x60, 0x53, 0xff, 0x07, 0xe3, 0x0f, 0x32, 0x25,
+    0x2c, 0xf1, 0x58, 0xb0, 0xdd, 0x8f, 0x45, 0xb7, 0x81, 0x5f, 0xe8, 0xb3,
+    0xf8, 0x5d, 0xf5, 0x80, 0x06, 0x1d, 0xc7, 0x81, 0x22, 0x12, 0x4f, 0x78,
+    0xf1, 0x0a, 0x58, 0x30, 0x14, 0xa5, 0x95, 0x2e, 0x78, 0x94, 0x56, 0xb9,
+    0xa1, 0xb6, 0x85, 0xb8, 0x5a, 0x8d, 0x41, 0x2d, 0x9f, 0xe8, 0x70, 0x91,
+    0x38, 0x26, 0xc3, 0x2f, 0x99, 0x81, 0x90, 0x05, 0xab, 0x60, 0x80, 0x48,
+    0xac, 0x4e, 0x37, 0x9b, 0xa4, 0x32, 0x1d, 0x28, 0xb0, 0x31, 0x29, 0x2f,
+    0xb6, 0xf5, 0x59, 0xa5, 0x66, 0x76, 0xf9, 0x87, 0xb3, 0xb7, 0x27, 0xf4,
+    0x8e, 0x00, 0xcc, 0xdc, 0xbb, 0x30, 0x3e, 0x1f, 0x8e, 0x47, 0xe4, 0xa7,
+    0x4a, 0x5d, 0x9b, 0x02, 0xc6, 0x9e, 0xa3, 0x46, 0x46, 0x70, 0xd4, 0x54,
+    0x06, 0xc7, 0x35, 0x75, 0x62, 0xe2, 0x2c, 0xa1, 0x67, 0xe7, 0x32, 0x1b,
+    0x26, 0x08, 0x57, 0xb3, 0x04, 0x32, 0x43, 0x75, 0x29, 0xfe, 0xfe, 0xf6,
+    0xe4, 0x07, 0xad, 0xe3, 0x8f, 0x60, 0x9d, 0x2a, 0xd5, 0x36, 0xde, 0xe3,
+    0x9d, 0x13, 0x61, 0x8d, 0x6d, 0x7d, 0x7f, 0x7c, 0x66, 0x35, 0x11, 0x50,
+    0x19, 0xfb, 0x6d, 0x43, 0x22, 0x5f, 0xe4, 0x09, 0x1c, 0xb2, 0xee, 0x90,
+    0xfe, 0xfc, 0xf4, 0xf1, 0xcd, 0x11, 0x58, 0x2a, 0x76, 0x01, 0x62, 0x57,
+    0x9a, 0xf2, 0x08, 0xd8, 0xb2, 0x6b, 0x12, 0x40, 0xa6, 0x81, 0x13, 0x5d,
+    0x92, 0xa9, 0x42, 0x5b, 0x18, 0x44, 0x92, 0xcb, 0x27, 0xaf, 0x57, 0x3b,
+    0x2f, 0x47, 0x7a, 0x49, 0x97, 0x49, 0x38, 0xf1, 0x61, 0x77, 0x83, 0x78,
+    0x3e, 0xa7, 0x17, 0xe4, 0x00, 0xcd, 0xfe, 0xeb, 0xe9, 0xfb, 0x77, 0x88,
+    0x61, 0x92, 0x2a, 0x9e, 0x08, 0x6f, 0xa1, 0x20, 0x55, 0x67, 0x7c, 0xbd,
+    0x42, 0xcb, 0x81, 0x83, 0x13, 0x3f, 0x99, 0xdb, 0xbf, 0xbc, 0xca, 0x62,
+    0x6c, 0x7b, 0xe4, 0x18, 0xd4, 0x12, 0xbb, 0x19, 0xbf, 0x13, 0xf1, 0xdd,
+    0x35, 0x19, 0x76, 0xd3, 0xff, 0x1c, 0x7e, 0x77, 0xed, 0x39, 0xcc, 0xef,
+    0x6f, 0x3e, 0x87, 0xe3, 0x85, 0xa0, 0x47, 0x89, 0x13, 0x6b, 0xaa, 0xf1,
+    0xfc, 0x39, 0xc4, 0xe9, 0x00, 0x25, 0x19, 0x2f, 0x84, 0x0c, 0x17, 0x97,
+    0x72, 0xf1, 0xe2, 0x97, 0x46, 0x61, 0xc3, 0x55, 0x6f, 0x77, 0x0c, 0x7b,
+    0x7f, 0x7c, 0x08, 0x79, 0x0e, 0x3c, 0x71, 0xd5, 0x90, 0x62, 0x69, 0x2d,
+    0x43, 0xda, 0xdb, 0x16, 0xd1, 0x6b, 0xf1, 0x2b, 0xed, 0xfe, 0xb2, 0x12,
+    0x9a, 0xb0, 0xbf, 0xc9, 0x9b, 0x0d, 0x44, 0x36, 0x55, 0xfa, 0xcc, 0x9f,
+    0x2b, 0x00, 0xad, 0x5d, 0x5d, 0xb1, 0x03, 0x36, 0x1e, 0x77, 0x2b, 0xc0,
+    0x81, 0x23, 0x58, 0x53, 0xec, 0x75, 0x3a, 0xf4, 0x47, 0xae, 0x9b, 0x59,
+    0xc6, 0x9a, 0xf2, 0x8d, 0x9a, 0x06, 0x58, 0xd3, 0x34, 0xeb, 0x7e, 0x95,
+    0xa7, 0x54, 0xeb, 0x8d, 0x0a, 0xa4, 0x08, 0x05, 0x44, 0xa2, 0x6a, 0xda,
+    0xb9, 0xa7, 0x8e, 0x10, 0x82, 0xdd, 0xfb, 0x49, 0xb4, 0xc4, 0x21, 0xce,
+    0x11, 0xe1, 0x66, 0x0f, 0x46, 0xaf, 0x3e, 0xf7, 0x81, 0xd3, 0x9e, 0xf0,
+    0x8a, 0xf2, 0xc2, 0x51, 0x14, 0x53, 0x47, 0xe5, 0x06, 0xbc, 0x17, 0xcf,
+    0x00, 0x8b, 0xa5, 0x17, 0x1b, 0x29, 0x9c, 0x25, 0x45, 0x0e, 0xef, 0x4f,
+    0x59, 0xb1, 0x29, 0x37, 0xd3, 0x28, 0xb6, 0xe6, 0xb1, 0x4a, 0xad, 0x4c,
+    0x78, 0x70, 0x7c, 0xc5, 0x71, 0x4b, 0x69, 0x50, 0x8d, 0x73, 0x43, 0x1c,
+    0x8b, 0x90, 0xdc, 0x63, 0xb2, 0x09, 0x1b, 0xf2, 0x6c, 0xdf, 0xd4, 0xda,
+    0x6d, 0xf1, 0x16, 0x67, 0x71, 0xbf, 0x45, 0x6b, 0x85, 0xb9, 0x3a, 0x12,
+    0xf4, 0x5a, 0xb8, 0xb3, 0x8c, 0x2e, 0x24, 0x40, 0x8b, 0xf4, 0x4c, 0x99,
+    0x0e, 0x89, 0x1d, 0xe5, 0x71, 0x1f, 0x6e, 0xd2, 0x8d, 0x1a, 0x9e, 0x39,
+    0xac, 0xa9, 0x90, 0x24, 0xc6, 0xec, 0x52, 0x81, 0xfe, 0xcb, 0x7b, 0x9b,
+    0x82, 0xbb, 0xd1, 0x47, 0x5f, 0x92, 0x94, 0xff, 0xfb, 0x3e, 0x4a, 0x8e,
+    0x17, 0x8d, 0xd4, 0x49, 0x51, 0xa1, 0xca, 0x66, 0x5b, 0x4d, 0xb3, 0x2c,
+    0xb9, 0x42, 0xe3, 0x8e, 0xfd, 0xb5, 0x55, 0x19, 0x61, 0x1d, 0xa5, 0x83,
+    0xdf, 0x6e, 0xbe, 0x13, 0x2f, 0x87, 0xcc, 0x4f, 0x1f, 0x4f, 0x4e, 0x15,
+    0x9c, 0x98, 0x7d, 0x90, 0x89, 0x9c, 0xa7, 0x94, 0xc4, 0x09, 0x60, 0x37,
+    0xe6, 0x5e, 0x65, 0x01, 0xf9, 0x00, 0x67, 0x04, 0x72, 0x2b, 0xc3, 0xb9,
+    0xd7, 0x29, 0xde, 0x19, 0xc5, 0x5f, 0x90, 0x44, 0xdb, 0x6a, 0x5a, 0x0d,
+    0x9a, 0xa7, 0x28, 0x27, 0x55, 0xa4, 0xfd, 0x27, 0xbb, 0x88, 0xc9, 0xd7,
+    0x73, 0xa5, 0x67, 0x91, 0xd7, 0xb7, 0x3e, 0xbc, 0x3f, 0x25, 0x38, 0xa6,
+    0xfb, 0xa1, 0xfe, 0xc4, 0xbb, 0x69, 0xd4, 0x1c, 0xd4, 0x44, 0x68, 0xa3,
+    0xc8, 0x47, 0x02, 0x15, 0x7f, 0x2e, 0x5e, 0xe0, 0xe3, 0x4b, 0xca, 0xa5,
+    0x8e, 0xd3, 0xbe, 0x43, 0xac, 0xcc, 0x6e, 0x98, 0x49, 0x9a, 0x26, 0x5d,
+    0xa3, 0x88, 0x70, 0x6c, 0x65, 0x17, 0xb8, 0xae, 0x6d, 0xbe, 0x6e, 0x6c,
+    0x14, 0x92, 0x02, 0x74, 0x0d, 0x9a, 0x47, 0x9f, 0x0e, 0xb0, 0xf9, 0x58,
+    0xc2, 0xa6, 0xb2, 0xce, 0xbd, 0xa2, 0x73, 0xa8, 0xe0, 0xdb, 0xf4, 0x43,
+    0x05, 0xb7, 0x65, 0x1e, 0xe5, 0xcc, 0x1d, 0xa4, 0xa3, 0x7c, 0xbf, 0x93,
+    0x6f, 0x4c, 0x6c, 0xaf, 0xda, 0x67, 0x2d, 0x03, 0x33, 0x16, 0xed, 0x77,
+    0x2c, 0xbe, 0x05, 0x64, 0x7a, 0xce, 0xad, 0x41, 0x93, 0x4a, 0x9e, 0xea,
+    0x2a, 0x8b, 0x99, 0xaa, 0xac, 0x00, 0x26, 0x3a, 0x18, 0x28, 0xb7, 0xad,
+    0x82, 0xa6, 0x30, 0x12, 0xe9, 0xf3, 0x4b, 0x64, 0xae, 0x3c, 0x19, 0x02,
+    0x37, 0x4c, 0x2d, 0xb1, 0x17, 0xd6, 0xde, 0xbb, 0xad, 0x1b, 0x00, 0x2f,
+    0xec, 0xa5, 0x14, 0xa6, 0x0c, 0x2c, 0xa6, 0xb1, 0x8e, 0xfb, 0x6c, 0xea,
+    0x36, 0x6b, 0xd6, 0x94, 0x4c, 0xf6, 0xf7, 0xeb, 0xb7, 0x31, 0xf0, 0x5d,
+    0xa4, 0xc5, 0x6b, 0x62, 0x2e, 0x5b, 0xa9, 0x9d, 0x0a, 0x08, 0x02, 0xa9,
+    0x06, 0x5d, 0xc6, 0x25, 0x65, 0x2a, 0xf5, 0x96, 0x85, 0xb6, 0x2c, 0x0f,
+    0x36, 0x8a, 0x2c, 0x05, 0x7c, 0x9b, 0xb2, 0x59, 0xc1, 0x04, 0xae, 0xf7,
+    0x3e, 0xe3, 0x01, 0x4a, 0x0d, 0xe8, 0x20, 0xa7, 0x8a, 0x2f, 0xf9, 0x57,
+    0x0c, 0x11, 0xb4, 0xab, 0x26, 0x7e, 0x28, 0x83, 0x60, 0x61, 0x63, 0x1b,
+    0xc1, 0x94, 0x1d, 0xa0, 0xb9, 0x06, 0x1f, 0x15, 0x0c, 0x2d, 0x10, 0xdd,
+    0xa0, 0x23, 0x70, 0x39, 0x51, 0x39, 0x79, 0x11, 0x76, 0xaf, 0xd3, 0xc3,
+    0x42, 0xd4, 0x04, 0x44, 0x40, 0x5b, 0x1c, 0x05, 0x81, 0x50, 0xd8, 0x65,
+    0x38, 0xda, 0x29, 0x91, 0xe1, 0xdc, 0x1b, 0xa0, 0x45, 0x51, 0x97, 0x41,
+    0x72, 0x52, 0x12, 0x02, 0x84, 0x0f, 0x14, 0x63, 0x7f, 0x48, 0x8e, 0xf0,
+    0xe9, 0xc2, 0x87, 0xcc, 0x00, 0xc1, 0xf0, 0x16, 0x62, 0xac, 0xa8, 0x18,
+    0xcd, 0x75, 0xa9, 0x56, 0x9e, 0xb3, 0xc4, 0xfa, 0xbc, 0xd7, 0x52, 0x31,
+    0x5e, 0xe5, 0x4d, 0x36, 0x67, 0xa5, 0x45, 0x01, 0x3e, 0x40, 0x01, 0xc2,
+    0x1e, 0xda, 0x26, 0x74, 0x31, 0xb1, 0x32, 0x95, 0x22, 0xc3, 0x68, 0x2c,
+    0x6e, 0xb6, 0x12, 0xd6, 0x75, 0xba, 0x7a, 0xbb, 0xda, 0xbd, 0x97, 0x5d,
+    0x56, 0x5b, 0xee, 0xb2, 0x95, 0x3d, 0x86, 0xa0, 0x97, 0xce, 0xaf, 0x4f,
+    0xa1, 0x09, 0x05, 0xed, 0xdd, 0xcd, 0x7a, 0x77, 0x92, 0xde, 0xb6, 0x89,
+    0xd8, 0x0b, 0x88, 0x61, 0x4a, 0x4b, 0xf9, 0xbb, 0xd3, 0x29, 0xe1, 0x2b,
+    0x67, 0x84, 0x2a, 0x1c, 0xe4, 0xd9, 0xd8, 0x41, 0x32, 0xb6, 0x39, 0xc5,
+    0xa4, 0xe2, 0x80, 0x49, 0xc5, 0x32, 0x61, 0xeb, 0x62, 0xcd, 0xc1, 0x43,
+    0xdc, 0x22, 0x8f, 0xe2, 0x9e, 0xf3, 0xf8, 0x3f, 0x22, 0x50, 0xc5, 0x97,
+    0xcd, 0xca, 0x64, 0x86, 0xb7, 0x8b, 0xdf, 0xdd, 0x35, 0x74, 0xdd, 0x27,
+    0x25, 0x21, 0xab, 0xd0, 0xb1, 0xb2, 0x8e, 0x36, 0xb4, 0x6f, 0x4d, 0x5a,
+    0x67, 0xd7, 0xb1, 0xee, 0x8f, 0xdb, 0x25, 0xe6, 0x3e, 0xa7, 0x3e, 0xfa,
+    0xcf, 0xbf, 0xff, 0x25, 0x70, 0xc4, 0x53, 0x5e, 0x1e, 0xc1, 0x55, 0x20,
+    0x5e, 0x46, 0x98, 0x44, 0x95, 0x1b, 0x28, 0xe7, 0xe3, 0x9b, 0x65, 0xb2,
+    0xbf, 0xab, 0x65, 0xde, 0x0a, 0xf8, 0xbf, 0x09, 0xfb, 0x95, 0x2e, 0xb8,
+    0xaa, 0xb8, 0x5b, 0x46, 0x30, 0xfd, 0x6a, 0x04, 0xf3, 0x45, 0xf7, 0x0e,
+    0x37, 0x4c, 0x09, 0xf3, 0x8e, 0xac, 0xae, 0x62, 0xfa, 0xfe, 0xca, 0x02,
+    0x99, 0xb2, 0x3e, 0x9a, 0x6f, 0x29, 0xc3, 0x08, 0xb4, 0x3a, 0x9c, 0x82,
+    0x52, 0xcb, 0x0b, 0xe9, 0x07, 0xc4, 0x72, 0x89, 0xc2, 0x29, 0xf7, 0x9c,
+    0x81, 0x39, 0xf0, 0xc7, 0x89, 0x4c, 0x16, 0x16, 0x38, 0x97, 0x75, 0x24,
+    0x43, 0x57, 0x05, 0x01, 0xb3, 0x0f, 0x56, 0xbc, 0x0a, 0x5d, 0x79, 0x00,
+    0xee, 0x31, 0xc8, 0xc5, 0xf8, 0x5a, 0xa4, 0xcc, 0x8c, 0x32, 0xec, 0x37,
+    0xbb, 0xb9, 0x78, 0xf1, 0x65, 0x1f, 0xc8, 0x38, 0x56, 0x73, 0x23, 0xa9,
+    0x6e, 0x2a, 0x2e, 0x79, 0x45, 0x3d, 0x92, 0x2e, 0x2a, 0x5f, 0xa9, 0x89,
+    0x44, 0x44, 0xec, 0xfc, 0x1e, 0x46, 0x73, 0x6b, 0xbd, 0x2d, 0xcd, 0x77,
+    0x74, 0xe2, 0xcf, 0x6d, 0x73, 0xb7, 0xf1, 0x40, 0x93, 0x91, 0x05, 0xe3,
+    0x27, 0x59, 0xdc, 0x59, 0x21, 0x0d, 0x2f, 0x9c, 0x14, 0x68, 0xa1, 0xed,
+    0xf6, 0x4f, 0x9f, 0xc3, 0xe6, 0xcf, 0x8f, 0xdb, 0x0d, 0x30, 0xc3, 0xd8,
+    0x4e, 0x87, 0xa3, 0x34, 0x97, 0xd0, 0x40, 0x87, 0x0e, 0xb4, 0x4a, 0xcc,
+    0x98, 0xe9, 0xbf, 0xa3, 0x8e, 0x11, 0x5c, 0x25, 0xef, 0xc8, 0x67, 0x67,
+    0x55, 0x49, 0xc2, 0x2a, 0x76, 0x1a, 0x6c, 0xbe, 0x11, 0xb5, 0x72, 0xef,
+    0xd0, 0xcb, 0xbf, 0x36, 0xd9, 0xb4, 0x06, 0x2b, 0x3f, 0x7f, 0x54, 0x4e,
+    0x3f, 0x04, 0xfa, 0x86, 0x59, 0x18, 0x62, 0x92, 0xdf, 0xfa, 0x0f, 0x2d,
+    0xfe, 0x5f, 0x05, 0xcb, 0xbc, 0xaa, 0x1c, 0x40, 0xad, 0x0d, 0xc3, 0xc5,
+    0x88, 0x0e, 0x2b, 0xdb, 0x88, 0x47, 0xa7, 0x7a, 0xa0, 0x34, 0xc5, 0xb4,
+    0xed, 0xec, 0xb9, 0x3a, 0xed, 0xe6, 0x56, 0x47, 0x31, 0xb0, 0xeb, 0x63,
+    0xca, 0xf1, 0x09, 0xc8, 0xbf, 0x82, 0x71, 0xb6, 0x95, 0xdf, 0x53, 0xa3,
+    0x19, 0xae, 0x96, 0x03, 0x5d, 0x5b, 0xd3, 0x95, 0xb5, 0xd9, 0x30, 0xe6,
+    0xd2, 0x5a, 0x3c, 0x7a, 0x24, 0x1e, 0x28, 0x27, 0x9d, 0xf9, 0x13, 0xfd,
+    0xa3, 0x5a, 0x30, 0x90, 0x6c, 0x56, 0x8d, 0xb8, 0x4d, 0x19, 0x52, 0xbc,
+    0xc8, 0x67, 0xb6, 0xc6, 0xe6, 0xb3, 0x0a, 0xff, 0x65, 0x99, 0xea, 0xa4,
+    0xe3, 0x12, 0x95, 0x34, 0x1c, 0x73, 0x51, 0xb1, 0x5a, 0xc4, 0x7c, 0x06,
+    0xdb, 0x71, 0x32, 0x2b, 0xbf, 0x42, 0x4a, 0x79, 0xb4, 0x5c, 0x94, 0x5f,
+    0xd3, 0x9a, 0xb5, 0x64, 0x8d, 0x6d, 0x99, 0x38, 0x88, 0xdf, 0x7f, 0x5f,
+    0x19, 0x2d, 0x03, 0x44, 0x2f, 0x28, 0x57, 0x77, 0x38, 0xd5, 0xd2, 0xe3,
+    0xa0, 0x46, 0x9d, 0xff, 0x88, 0xee, 0xf2, 0xa6, 0xc5, 0x61, 0xcc, 0x9d,
+    0x4c, 0x99, 0xe4, 0xee, 0x96, 0x95, 0x7f, 0xbb, 0x0f, 0x59, 0x74, 0x88,
+    0x3b, 0x32, 0xdf, 0x07, 0x11, 0x50, 0xd0, 0x7d, 0x1e, 0xed, 0x79, 0x88,
+    0x70, 0xe6, 0x10, 0xff, 0x4e, 0xce, 0xbf, 0x76, 0xd2, 0x2e, 0xbe, 0xfb,
+    0xdf, 0x14, 0x64, 0xbe, 0x72, 0x29, 0x44, 0x91, 0xa5, 0x27, 0x72, 0x0c,
+    0xc2, 0x0d, 0xe0, 0x10, 0x61, 0x36, 0x1f, 0x23, 0xa7, 0xb7, 0xf2, 0xb5,
+    0xf2, 0x05, 0x0c, 0x89, 0xa5, 0x2b, 0x5e, 0x81, 0xbe, 0x1c, 0x4b, 0x54,
+    0xd1, 0x76, 0xf1, 0xa9, 0xb0, 0x89, 0xed, 0xd2, 0x15, 0x05, 0x95, 0x6b,
+    0x03, 0x7a, 0xaa, 0x37, 0xff, 0x34, 0xbf, 0x7c, 0x1e, 0x10, 0x07, 0xce,
+    0xbf, 0xd7, 0x15, 0x38, 0x48, 0xa7, 0x82, 0x38, 0x9a, 0xe0, 0xef, 0x88,
+    0x5f, 0x10, 0xfd, 0x72, 0x9c, 0x47, 0x7c, 0x1d, 0xe9, 0x38, 0x7d, 0xbe,
+    0xfb, 0x20, 0xfa, 0x9c, 0xc5, 0x42, 0x6a, 0xfa, 0xb2, 0x44, 0xa1, 0x54,
+    0x85, 0x9d, 0xff, 0x4b, 0xc2, 0x07, 0x9f, 0x28, 0x02, 0xca, 0xd4, 0x40,
+    0xe8, 0x0e, 0xa6, 0x70, 0x6f, 0x05, 0x5a, 0xde, 0x48, 0xf1, 0x75, 0xde,
+    0xd2, 0x82, 0x41, 0xad, 0xf2, 0x5f, 0x84, 0xed, 0xfc, 0x7f, 0x3d, 0xda,
+    0xe6, 0x5f, 0x22, 0xff, 0x0b, 0xad, 0x84, 0x4c, 0x70, 0x2a, 0x29, 0x00,
+    0x00,
+};
+
+// link.html: 5609 bytes, 2131 gzipped
+static const uint8_t web_link_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x58,
+    0xdb, 0x52, 0xe3, 0x48, 0x12, 0x7d, 0xf7, 0x57, 0xd4, 0x9a, 0xdd, 0x96,
+    0xbd, 0x83, 0xe4, 0x0b, 0x97, 0x06, 0x1b, 0x33, 0x31, 0x0d, 0xcc, 0x0c,
+    0xbb, 0x34, 0xdd, 0xd1, 0x0d, 0x11, 0xbb, 0x4f, 0x33, 0x65, 0xa9, 0x64,
+    0x57, 0xa3, 0xdb, 0x94, 0x4a, 0x06, 0x9a, 0x21, 0x62, 0xbf, 0x65, 0x3f,
+    0x6d, 0xbf, 0x64, 0x4f, 0x56, 0x49, 0xb6, 0x6c, 0x63, 0x08, 0xfb, 0x01,
+    0xe3, 0x54, 0x5e, 0x4f, 0x66, 0x65, 0x66, 0xe9, 0xe4, 0x2f, 0xe7, 0x9f,
+    0xce, 0x6e, 0xfe, 0xfd, 0xf9, 0x82, 0x4d, 0x75, 0x1c, 0x9d, 0x36, 0x4e,
+    0xaa, 0x2f, 0xc1, 0x03, 0x7c, 0xc5, 0x42, 0x73, 0x96, 0xf0, 0x58, 0x8c,
+    0x9a, 0x33, 0x29, 0xee, 0xb3, 0x54, 0xe9, 0x26, 0xf3, 0xd3, 0x44, 0x8b,
+    0x44, 0x8f, 0x9a, 0xf7, 0x32, 0xd0, 0xd3, 0x51, 0x20, 0x66, 0xd2, 0x17,
+    0xae, 0xf9, 0xb1, 0xcb, 0x64, 0x22, 0xb5, 0xe4, 0x91, 0x9b, 0xfb, 0x3c,
+    0x12, 0xa3, 0xde, 0x2e, 0x8b, 0xf9, 0x83, 0x8c, 0x8b, 0xb8, 0x22, 0x34,
+    0x2b, 0xad, 0xfe, 0x94, 0xab, 0x5c, 0x40, 0xcb, 0xed, 0xcd, 0xcf, 0xee,
+    0x11, 0x91, 0xb5, 0xd4, 0x91, 0x38, 0x3d, 0x4b, 0x67, 0x42, 0xb1, 0x9f,
+    0x94, 0x3e, 0xe9, 0x58, 0x42, 0xe3, 0x24, 0xf7, 0x95, 0xcc, 0x34, 0xcb,
+    0x95, 0x3f, 0x6a, 0x76, 0x72, 0xcd, 0xb5, 0xf4, 0x3b, 0x3c, 0xcb, 0xbc,
+    0x6f, 0xf9, 0x8f, 0xb3, 0xd1, 0xd1, 0xd1, 0xd1, 0x41, 0x70, 0x7c, 0x70,
+    0xd8, 0x3c, 0x3d, 0xe9, 0x58, 0x46, 0x92, 0xd0, 0x8f, 0x24, 0x39, 0x50,
+    0x69, 0xaa, 0xd9, 0x13, 0x73, 0xdd, 0xf1, 0x64, 0xc0, 0x76, 0xba, 0xe6,
+    0x33, 0xc4, 0x4f, 0x9f, 0xab, 0x00, 0x84, 0x9e, 0xf9, 0x10, 0x81, 0xfb,
+    0x3e, 0x42, 0x32, 0x3c, 0x61, 0x78, 0x74, 0x44, 0x24, 0x2d, 0x1e, 0x88,
+    0x10, 0x9a, 0x0f, 0x11, 0xf2, 0x62, 0x8c, 0xdf, 0x87, 0xe6, 0x43, 0xbf,
+    0x85, 0x52, 0xe6, 0xf9, 0x3e, 0x3e, 0x43, 0xf6, 0xdc, 0xf8, 0x3b, 0x2c,
+    0xc5, 0x5c, 0x4d, 0x64, 0x32, 0x60, 0xb0, 0x92, 0xf1, 0x20, 0x90, 0xc9,
+    0xc4, 0xfc, 0x3f, 0x4e, 0x1f, 0xdc, 0x5c, 0x7e, 0x37, 0x3f, 0xc7, 0xa9,
+    0x0a, 0x84, 0x72, 0x41, 0x82, 0x92, 0x7b, 0x31, 0xbe, 0x93, 0xda, 0x0d,
+    0x01, 0xa9, 0x9b, 0xc7, 0xf0, 0x76, 0x6a, 0x78, 0x78, 0x42, 0x20, 0x4a,
+    0x9e, 0x8b, 0x80, 0x34, 0x8f, 0xd3, 0xe0, 0x11, 0xca, 0xc7, 0xdc, 0xbf,
+    0x9b, 0xa8, 0xb4, 0x48, 0xe0, 0xfb, 0x8c, 0xab, 0x16, 0x85, 0xd5, 0x1e,
+    0x22, 0x1f, 0x51, 0xaa, 0x2a, 0x0a, 0x79, 0x0d, 0x9a, 0x51, 0x18, 0xf2,
+    0x58, 0x46, 0x8f, 0x03, 0x96, 0xf3, 0x24, 0x77, 0x73, 0xa1, 0x24, 0xc2,
+    0x08, 0x64, 0x9e, 0x45, 0x1c, 0xc4, 0x30, 0x12, 0x70, 0x80, 0xfe, 0xba,
+    0x81, 0x54, 0xc2, 0xd7, 0x32, 0x85, 0xdf, 0xd0, 0x55, 0xc4, 0xc9, 0x90,
+    0xc1, 0xf8, 0x24, 0x71, 0xa5, 0x16, 0x71, 0x0e, 0x22, 0xa0, 0x11, 0x6a,
+    0xc8, 0xbe, 0x15, 0xb9, 0x96, 0xe1, 0xa3, 0x5b, 0x16, 0xc0, 0xe2, 0x41,
+    0x2c, 0x13, 0x77, 0x2a, 0xe4, 0x64, 0x0a, 0x5a, 0xaf, 0xdb, 0x9d, 0x4d,
+    0x6b, 0xd1, 0xf7, 0xbb, 0xd9, 0x03, 0xc5, 0xe0, 0x91, 0x14, 0x97, 0x09,
+    0x92, 0xfb, 0xc4, 0x4c, 0xb1, 0x18, 0xde, 0xbf, 0x0d, 0xa9, 0x42, 0xdc,
+    0x92, 0xb0, 0xdf, 0x2d, 0xb9, 0xa7, 0x3d, 0x70, 0x59, 0x54, 0xe4, 0x77,
+    0x01, 0x2d, 0xfb, 0x44, 0x37, 0x84, 0xfb, 0xd2, 0xd0, 0x21, 0xa5, 0xd2,
+    0xe2, 0x0d, 0x30, 0xb5, 0x4e, 0xe3, 0x01, 0x3b, 0x22, 0x2e, 0x82, 0xc0,
+    0x35, 0x01, 0x2c, 0x3c, 0x5c, 0xc2, 0xc8, 0x26, 0xbb, 0x6d, 0xbc, 0x42,
+    0x52, 0x4d, 0x99, 0xc1, 0xdc, 0x12, 0x0f, 0xe8, 0x15, 0x8c, 0xd6, 0x83,
+    0xde, 0xfe, 0x26, 0xdd, 0x2b, 0x3e, 0xec, 0x97, 0x21, 0xc8, 0x24, 0x2b,
+    0xf4, 0x6a, 0xac, 0xeb, 0x29, 0xa4, 0x52, 0x6c, 0x0f, 0xcb, 0xaa, 0x00,
+    0x5b, 0xf6, 0xc0, 0xf2, 0x34, 0x92, 0x01, 0xdb, 0xd9, 0xdb, 0xdb, 0x9b,
+    0x3b, 0x7e, 0x3f, 0x45, 0x2e, 0x6a, 0xa8, 0xf6, 0x0e, 0xe7, 0x78, 0x94,
+    0xee, 0x19, 0x42, 0x59, 0x5b, 0x8a, 0x07, 0xb2, 0x40, 0xe2, 0x7a, 0x7d,
+    0x22, 0xa6, 0x85, 0x8e, 0x80, 0xfb, 0x80, 0x25, 0x69, 0x22, 0xd6, 0xdc,
+    0xed, 0xd7, 0xdd, 0x1d, 0x84, 0xa9, 0x5f, 0xe4, 0x54, 0x6a, 0x56, 0xd1,
+    0x26, 0xd8, 0xc6, 0x05, 0x84, 0x93, 0xb7, 0x83, 0x9b, 0x8b, 0x94, 0x8a,
+    0x76, 0xcc, 0xf9, 0xab, 0x62, 0xb5, 0xfe, 0xbc, 0x15, 0xd3, 0x52, 0xd2,
+    0xdf, 0x2f, 0xe4, 0x57, 0xa2, 0xf4, 0x0b, 0x95, 0x93, 0x89, 0x2c, 0x95,
+    0x36, 0x2d, 0x95, 0x97, 0x03, 0x94, 0x3c, 0x1f, 0x47, 0x22, 0x80, 0xbb,
+    0x69, 0xc6, 0x7d, 0xa9, 0x51, 0xfd, 0x5d, 0xef, 0xc0, 0xa4, 0x5f, 0x89,
+    0xbc, 0x88, 0xf4, 0xfc, 0xe0, 0xba, 0x3a, 0xcd, 0x06, 0x6c, 0xcf, 0x40,
+    0xb2, 0x52, 0xc1, 0x2f, 0x1a, 0xdd, 0x98, 0xce, 0x97, 0xea, 0xe4, 0x85,
+    0x14, 0xf7, 0xfb, 0xfd, 0xb2, 0x0a, 0x01, 0x54, 0xfe, 0x26, 0xf0, 0x1b,
+    0xab, 0x18, 0xad, 0x28, 0x55, 0x1b, 0xa4, 0xf1, 0x6c, 0x55, 0xd4, 0x92,
+    0x20, 0x87, 0xba, 0xb8, 0xcb, 0x57, 0xa2, 0xb7, 0xf5, 0xfb, 0x52, 0x00,
+    0xcf, 0x0d, 0xfe, 0xf2, 0x31, 0x31, 0xcc, 0x81, 0xf0, 0x53, 0xc5, 0x6d,
+    0x1b, 0xb1, 0x99, 0x7d, 0x6e, 0xa0, 0x25, 0xdb, 0x4e, 0x7c, 0xd2, 0x29,
+    0x27, 0x0a, 0xb5, 0x32, 0x7c, 0x05, 0x72, 0xc6, 0xfc, 0x88, 0xe7, 0xf9,
+    0xa8, 0x39, 0xef, 0x0b, 0x34, 0x03, 0x70, 0xee, 0x65, 0x30, 0x6a, 0x12,
+    0x33, 0xb0, 0x6f, 0x9e, 0xde, 0x66, 0x01, 0xd7, 0xc2, 0x8e, 0x83, 0x69,
+    0x0f, 0x0c, 0x59, 0x25, 0x56, 0x1d, 0xdc, 0xe6, 0xe9, 0x05, 0x79, 0xc7,
+    0x6e, 0x13, 0xf9, 0x47, 0x21, 0xd8, 0xe5, 0x39, 0x9a, 0x67, 0xc0, 0x64,
+    0xcc, 0x27, 0x82, 0xdd, 0x7e, 0xb9, 0x3a, 0xe9, 0x64, 0xa5, 0x39, 0xd2,
+    0x6b, 0xd3, 0xdd, 0x64, 0xc6, 0xab, 0x51, 0xb3, 0x6a, 0x86, 0xe4, 0x2e,
+    0xcd, 0x0f, 0xb0, 0x81, 0x39, 0x4c, 0x55, 0x6c, 0xb8, 0x09, 0x9d, 0x9f,
+    0xf1, 0x83, 0x1c, 0xb3, 0xa7, 0x59, 0x3f, 0x66, 0x10, 0xa3, 0x70, 0x9b,
+    0x86, 0x43, 0x03, 0x37, 0xa1, 0x7f, 0x93, 0x41, 0x93, 0x41, 0x91, 0x2f,
+    0xa6, 0x69, 0x04, 0xfc, 0x31, 0xd3, 0x2a, 0x67, 0x9a, 0x4c, 0x89, 0x3f,
+    0x0a, 0xf4, 0xd7, 0x80, 0xf1, 0x42, 0xa7, 0x7e, 0x1a, 0x67, 0x91, 0xd0,
+    0xd0, 0x91, 0x86, 0xe1, 0xdc, 0x8d, 0x1a, 0xd6, 0x16, 0xea, 0xcd, 0x06,
+    0x0b, 0x15, 0xad, 0x98, 0x9a, 0x6a, 0x9d, 0xe5, 0x83, 0x4e, 0x47, 0x3c,
+    0x70, 0xd2, 0x8d, 0x36, 0x1b, 0x77, 0x4c, 0xf4, 0xde, 0xb7, 0x6c, 0xf2,
+    0xaa, 0x79, 0xca, 0x86, 0x3d, 0xc7, 0xd6, 0x0a, 0x10, 0x8d, 0x65, 0x69,
+    0xa7, 0xfc, 0x7f, 0x09, 0x7f, 0xcb, 0x4c, 0xb9, 0x24, 0x84, 0xe8, 0xdb,
+    0xe2, 0x55, 0xcb, 0x65, 0x92, 0xba, 0x99, 0xc2, 0xf9, 0x9b, 0x87, 0xb6,
+    0x5e, 0x58, 0x65, 0x89, 0x1a, 0xca, 0x6a, 0xb3, 0x2b, 0x8f, 0x9c, 0x7d,
+    0x68, 0x8e, 0x9d, 0xa9, 0x89, 0xbd, 0x8d, 0x40, 0x55, 0x75, 0xbd, 0x63,
+    0x46, 0xf4, 0x5a, 0xb7, 0x5e, 0x69, 0x75, 0xbd, 0x83, 0x79, 0x65, 0x6b,
+    0x85, 0x99, 0x48, 0x61, 0x0c, 0x58, 0x91, 0x65, 0x42, 0xf9, 0x18, 0xb5,
+    0x43, 0x06, 0x6c, 0xa0, 0xd4, 0xcd, 0xa9, 0x4b, 0x98, 0x8e, 0x64, 0x3c,
+    0xb8, 0xe6, 0x33, 0x39, 0x31, 0x85, 0x8d, 0x1a, 0xdc, 0x2b, 0x03, 0x5e,
+    0xa9, 0x20, 0x36, 0x51, 0x12, 0xa3, 0x9a, 0xfe, 0x62, 0x04, 0x03, 0x65,
+    0xa0, 0xe6, 0xda, 0x61, 0x8a, 0x66, 0xa1, 0x44, 0x26, 0xb8, 0x6e, 0xbd,
+    0xdf, 0x65, 0xbd, 0x90, 0x4e, 0xde, 0x84, 0x53, 0xf0, 0x55, 0x7c, 0x65,
+    0x12, 0xd2, 0xc4, 0x8f, 0xa4, 0x7f, 0x87, 0xb2, 0x4b, 0x7d, 0x63, 0xcd,
+    0x9b, 0x2a, 0x11, 0x8e, 0x9c, 0x8e, 0x33, 0x47, 0xb3, 0x1e, 0xe0, 0xde,
+    0x52, 0x8f, 0x2a, 0x95, 0xbd, 0xdb, 0xe9, 0xf5, 0xdf, 0x1f, 0x1f, 0x62,
+    0x7f, 0x39, 0xe7, 0xf9, 0x74, 0x9c, 0xa2, 0x19, 0xd5, 0xf2, 0xf6, 0x96,
+    0x21, 0xac, 0x68, 0xc9, 0x96, 0xc6, 0x8e, 0xfa, 0xfb, 0xef, 0x87, 0xec,
+    0x2b, 0x04, 0x71, 0x80, 0xb7, 0x30, 0x35, 0x56, 0xe9, 0x7d, 0x2e, 0xb6,
+    0x37, 0x86, 0x65, 0xed, 0x83, 0x11, 0xdd, 0xc2, 0x16, 0x1d, 0xe3, 0x6d,
+    0x2d, 0x99, 0x95, 0xce, 0xac, 0xa2, 0xf9, 0x36, 0x51, 0x61, 0x1c, 0x14,
+    0xd9, 0xb6, 0xb6, 0x7a, 0xc7, 0x98, 0x69, 0x1f, 0x8c, 0xe8, 0x16, 0xb6,
+    0x62, 0x9e, 0x14, 0x3c, 0xda, 0x1a, 0xc1, 0x1e, 0xe2, 0xfa, 0x68, 0x44,
+    0xb7, 0x09, 0xcc, 0xcc, 0x97, 0x7c, 0x5b, 0x63, 0x87, 0x47, 0x48, 0xd7,
+    0x85, 0x11, 0xad, 0x77, 0x0f, 0xdb, 0x35, 0x6a, 0xcd, 0xc3, 0xf4, 0xda,
+    0x14, 0x27, 0x75, 0xae, 0x3f, 0x4b, 0x73, 0x69, 0x26, 0x49, 0x28, 0x1f,
+    0xb0, 0x02, 0x53, 0x3f, 0xe8, 0x0e, 0x23, 0x11, 0x6a, 0x7c, 0xd9, 0x95,
+    0xc3, 0x6c, 0x1c, 0xe5, 0xce, 0x69, 0xfe, 0xaf, 0x8d, 0x62, 0xb3, 0x65,
+    0x7c, 0x77, 0x65, 0x12, 0x88, 0x87, 0xc1, 0x31, 0x3e, 0xc3, 0x7a, 0xa3,
+    0x1f, 0xd6, 0x77, 0xdb, 0xb2, 0x8d, 0xac, 0x6e, 0xb6, 0x25, 0xb9, 0xb9,
+    0x7c, 0xd8, 0xeb, 0x26, 0xe8, 0xde, 0x50, 0x05, 0x6d, 0xf6, 0x85, 0xe5,
+    0xfd, 0xa0, 0xb7, 0x20, 0x0d, 0x56, 0xba, 0xdc, 0x7a, 0x13, 0xb3, 0x11,
+    0x1d, 0x23, 0x88, 0xc5, 0x2a, 0xbc, 0xb7, 0x68, 0x7f, 0xfd, 0xca, 0x7e,
+    0xd9, 0xeb, 0xca, 0x2b, 0x4a, 0xad, 0xb5, 0x76, 0x9b, 0xa7, 0x5f, 0x2f,
+    0xce, 0x6e, 0xbf, 0x5c, 0xb0, 0xab, 0x4f, 0xbf, 0x5c, 0x5e, 0xa3, 0x4d,
+    0xf5, 0xcd, 0xa8, 0x5c, 0x96, 0xc3, 0x4d, 0x69, 0xb8, 0x48, 0x1c, 0x75,
+    0xc8, 0x6a, 0x76, 0x7e, 0xbe, 0xbc, 0x66, 0x3a, 0x35, 0x17, 0x3b, 0x99,
+    0x14, 0xc2, 0xce, 0xcc, 0xfa, 0x00, 0xca, 0xd0, 0xdd, 0xef, 0x11, 0x8d,
+    0x1d, 0x0e, 0x19, 0x65, 0x6a, 0x69, 0x08, 0x41, 0xc1, 0x3c, 0x77, 0xb5,
+    0xfc, 0x54, 0x00, 0x99, 0x65, 0xa9, 0xbc, 0x1a, 0x51, 0x13, 0xc6, 0x95,
+    0xa8, 0x8e, 0x25, 0x6d, 0x41, 0xeb, 0x58, 0xd1, 0x11, 0xac, 0x75, 0xf7,
+    0x65, 0x7c, 0xa9, 0x93, 0xaf, 0x03, 0x59, 0x8b, 0x8e, 0x6e, 0x02, 0xd5,
+    0xe2, 0x6b, 0xb2, 0xde, 0x44, 0x75, 0xdf, 0x89, 0xc7, 0x20, 0xbd, 0x4f,
+    0x46, 0x4d, 0x19, 0xb6, 0xc4, 0x0c, 0x32, 0x1e, 0x28, 0xa3, 0xd1, 0xc8,
+    0x31, 0x30, 0x38, 0xed, 0xfc, 0x73, 0xab, 0xdd, 0x34, 0x93, 0xd2, 0xec,
+    0xc1, 0x2f, 0x1c, 0x0c, 0xcb, 0xf1, 0x46, 0xa4, 0xcb, 0xa5, 0x68, 0x92,
+    0x35, 0x4f, 0x5d, 0xb7, 0x8a, 0xd4, 0x38, 0xb5, 0x1e, 0x54, 0x7d, 0xdb,
+    0x1d, 0x03, 0xdd, 0x61, 0xb9, 0xd7, 0x56, 0x6b, 0x6d, 0x2d, 0xc4, 0xc3,
+    0x0a, 0x83, 0xc5, 0x30, 0x5b, 0xcc, 0x32, 0x8c, 0xee, 0xeb, 0xab, 0x4f,
+    0x67, 0xff, 0xdc, 0x78, 0xf0, 0xaa, 0xbb, 0x32, 0x66, 0x1e, 0x8b, 0xf8,
+    0x58, 0x44, 0x6c, 0xc4, 0x9c, 0xc5, 0xb8, 0x77, 0x86, 0x8d, 0x00, 0x18,
+    0xc4, 0x04, 0x12, 0x56, 0x9c, 0x8b, 0x48, 0xd0, 0xbf, 0x1f, 0x1e, 0x2f,
+    0x83, 0x96, 0x53, 0xed, 0x45, 0x4e, 0xdb, 0x4b, 0x13, 0xbb, 0x29, 0x40,
+    0x38, 0x2c, 0x12, 0x73, 0x89, 0x6c, 0x89, 0x36, 0x7b, 0x6a, 0x08, 0x2f,
+    0x53, 0x06, 0xe2, 0x73, 0x11, 0x72, 0xec, 0x5c, 0xad, 0xf6, 0xb0, 0x81,
+    0x95, 0x91, 0x61, 0x81, 0x01, 0xef, 0x46, 0xd5, 0x78, 0x0c, 0xad, 0x33,
+    0x1e, 0x15, 0xc2, 0xd3, 0x4a, 0xc6, 0x95, 0x98, 0x46, 0x45, 0xbc, 0x22,
+    0x36, 0xdf, 0xc3, 0x5e, 0x14, 0xc6, 0xd6, 0xf7, 0x9a, 0xb0, 0x5d, 0x0a,
+    0x9d, 0x92, 0x79, 0xac, 0x93, 0xd7, 0x98, 0x6d, 0xb8, 0xc4, 0x8c, 0x1a,
+    0x82, 0xb7, 0x5e, 0x24, 0x92, 0x89, 0x9e, 0xb2, 0x13, 0x76, 0xc0, 0xfe,
+    0xfc, 0x93, 0xfc, 0x5c, 0x50, 0x7a, 0x6d, 0x98, 0xd6, 0x85, 0x4a, 0x86,
+    0x0d, 0x68, 0xf5, 0x24, 0xcd, 0xc8, 0x1b, 0x24, 0x8c, 0x90, 0x3e, 0x47,
+    0x1d, 0x46, 0xa9, 0xd9, 0x72, 0x3d, 0xcf, 0x73, 0x86, 0x64, 0xd7, 0x9b,
+    0xdf, 0x54, 0x46, 0x4c, 0xab, 0x02, 0x0b, 0x09, 0x5c, 0xf3, 0x4c, 0xb1,
+    0x79, 0x65, 0x07, 0x23, 0x51, 0xaa, 0x1c, 0xc7, 0x3a, 0x1b, 0xca, 0x84,
+    0x47, 0xb7, 0x06, 0x52, 0xa7, 0xc3, 0x33, 0xd9, 0xc9, 0x85, 0xf6, 0x69,
+    0x6a, 0xfd, 0x08, 0xd7, 0x46, 0x0e, 0xfb, 0x81, 0x89, 0xc4, 0x4f, 0x03,
+    0x71, 0xfb, 0xe5, 0xf2, 0x0c, 0xbb, 0x1f, 0x04, 0x13, 0x4d, 0x5e, 0xc3,
+    0xfd, 0xb9, 0xe8, 0x0f, 0x90, 0x7d, 0x87, 0x63, 0xbd, 0x81, 0x1b, 0x11,
+    0xb5, 0xf1, 0xc4, 0x79, 0x87, 0x53, 0xbf, 0x89, 0x07, 0xc7, 0xbf, 0x44,
+    0xef, 0x61, 0xaa, 0xe0, 0x4b, 0x22, 0xee, 0xd9, 0xbf, 0x3e, 0x5e, 0xfd,
+    0x8a, 0xd5, 0xf4, 0x0b, 0xf6, 0x4f, 0x91, 0x9b, 0xf4, 0xe3, 0x99, 0x97,
+    0x66, 0x22, 0x69, 0x39, 0xbf, 0x5c, 0xdc, 0x38, 0xbb, 0x73, 0xe7, 0x77,
+    0x4d, 0xb0, 0x15, 0x83, 0x41, 0xa5, 0x5e, 0x4e, 0x54, 0x4d, 0xab, 0xf0,
+    0x99, 0x82, 0x5d, 0xc3, 0x2c, 0xc4, 0x50, 0xdb, 0x04, 0xda, 0x18, 0x23,
+    0xed, 0xce, 0xa1, 0xac, 0xb1, 0x16, 0xd9, 0xa1, 0xd7, 0x48, 0xb8, 0xe9,
+    0xe2, 0xf0, 0x63, 0x2f, 0x45, 0xa2, 0x9e, 0x18, 0xcd, 0xbc, 0xe8, 0xab,
+    0xc6, 0x1d, 0x06, 0xbb, 0xb3, 0x12, 0x31, 0x60, 0xbc, 0xc4, 0x8c, 0x68,
+    0x39, 0xf7, 0x62, 0xfc, 0x1b, 0x82, 0x47, 0xce, 0xd9, 0x7c, 0x2e, 0x2a,
+    0x41, 0x6e, 0x22, 0xaa, 0x2a, 0xc3, 0x74, 0x83, 0x5e, 0x57, 0xdd, 0xef,
+    0x76, 0xc9, 0x7d, 0xf2, 0xc8, 0x6c, 0xc8, 0xd7, 0x3c, 0x16, 0xe4, 0x4d,
+    0x79, 0xed, 0x2c, 0xaf, 0x7d, 0x65, 0x32, 0x71, 0xf4, 0x38, 0x1e, 0xfe,
+    0xe3, 0xeb, 0xa7, 0x6b, 0x2f, 0xa3, 0x97, 0x63, 0x46, 0x1b, 0x58, 0x81,
+    0x72, 0x2e, 0x6e, 0xcc, 0x8b, 0x1d, 0xa3, 0xca, 0x20, 0xf1, 0xeb, 0xcd,
+    0xc7, 0x2b, 0x70, 0xff, 0x8e, 0xf9, 0x50, 0xbe, 0x33, 0xb3, 0x87, 0x37,
+    0x30, 0xdd, 0x1f, 0x4b, 0xf3, 0xe9, 0x5f, 0x9f, 0x44, 0xee, 0xb7, 0x48,
+    0xab, 0x67, 0x6e, 0x4a, 0xed, 0x67, 0xb3, 0xbf, 0x9e, 0x64, 0xf5, 0x27,
+    0x5c, 0x69, 0x99, 0x6b, 0x7a, 0x94, 0x9d, 0xce, 0x27, 0x86, 0x53, 0x9b,
+    0x2d, 0x68, 0xa4, 0x4e, 0x5d, 0xe0, 0x51, 0x70, 0xd5, 0x7e, 0x66, 0xff,
+    0xfb, 0xcf, 0x7f, 0x59, 0x8d, 0x3a, 0x11, 0x89, 0x12, 0x56, 0xcb, 0xef,
+    0xaf, 0x74, 0x8e, 0xda, 0xf1, 0x26, 0x18, 0x10, 0xf8, 0x33, 0x13, 0x48,
+    0xda, 0x2b, 0x18, 0x99, 0xd5, 0xc3, 0xb1, 0x59, 0xad, 0x97, 0xc0, 0x2a,
+    0x36, 0x50, 0xd5, 0x78, 0xb6, 0x35, 0x94, 0x8b, 0x84, 0x52, 0x43, 0x3f,
+    0x29, 0x4b, 0x67, 0x69, 0x12, 0xca, 0x49, 0xab, 0xed, 0xe9, 0x29, 0x8a,
+    0xcf, 0x0f, 0x27, 0x6c, 0x74, 0x0a, 0x83, 0xab, 0x4d, 0x8f, 0x6a, 0x1b,
+    0x0f, 0xbd, 0x18, 0xd5, 0x6d, 0x7c, 0x40, 0xd1, 0xaf, 0x76, 0x42, 0xfb,
+    0xaa, 0x68, 0xf4, 0x26, 0xdf, 0x6a, 0xdc, 0xe5, 0x7d, 0x16, 0xb1, 0x53,
+    0xc3, 0x3e, 0xb3, 0x5b, 0xc6, 0xbc, 0x8e, 0x1b, 0x6f, 0x76, 0x9b, 0x97,
+    0xc5, 0x9e, 0x4d, 0x3d, 0x98, 0xfb, 0xdd, 0x67, 0x99, 0x50, 0xc4, 0xb5,
+    0x57, 0xa0, 0x9d, 0xf2, 0xa6, 0xdd, 0xb1, 0x6f, 0x74, 0xff, 0x0f, 0x13,
+    0x9d, 0x7b, 0x26, 0xe9, 0x15, 0x00, 0x00,
+};
+
+// led-select.html: 6621 bytes, 2618 gzipped
+static const uint8_t web_led_select_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x59,
+    0x6b, 0x6f, 0xdb, 0x38, 0x16, 0xfd, 0x9e, 0x5f, 0xc1, 0xba, 0xd8, 0x4a,
+    0x9a, 0x5a, 0x8a, 0x9c, 0x47, 0x9b, 0x91, 0xe3, 0x74, 0xdb, 0x34, 0x83,
+    0xcd, 0xa2, 0x9d, 0x16, 0x4d, 0x3a, 0xc0, 0xa2, 0x28, 0x16, 0xb4, 0x44,
+    0xd9, 0x6c, 0x65, 0x49, 0x2b, 0xd2, 0x49, 0x3c, 0x1e, 0xff, 0xf7, 0x3d,
+    0x97, 0x94, 0x6c, 0xc9, 0x76, 0x3b, 0x1d, 0x60, 0x3f, 0x2c, 0x0c, 0xd8,
+    0x22, 0xc5, 0xfb, 0x3a, 0xf7, 0xc9, 0xe4, 0xfc, 0xd1, 0xeb, 0x77, 0x97,
+    0xb7, 0xff, 0x7a, 0x7f, 0xc5, 0xa6, 0x7a, 0x96, 0x5d, 0x1c, 0x9c, 0x37,
+    0x3f, 0x82, 0x27, 0xf8, 0x99, 0x09, 0xcd, 0x59, 0xce, 0x67, 0x62, 0xd4,
+    0xbb, 0x93, 0xe2, 0xbe, 0x2c, 0x2a, 0xdd, 0x63, 0x71, 0x91, 0x6b, 0x91,
+    0xeb, 0x51, 0xef, 0x5e, 0x26, 0x7a, 0x3a, 0x4a, 0xc4, 0x9d, 0x8c, 0x85,
+    0x6f, 0x16, 0x7d, 0x99, 0x4b, 0x2d, 0x79, 0xe6, 0xab, 0x98, 0x67, 0x62,
+    0x34, 0xe8, 0xcf, 0xf8, 0x83, 0x9c, 0xcd, 0x67, 0xeb, 0xf5, 0x5c, 0x89,
+    0xca, 0x2c, 0xf8, 0x18, 0xeb, 0xbc, 0xe8, 0x35, 0x42, 0xe2, 0x29, 0xaf,
+    0x94, 0x00, 0xd3, 0x8f, 0xb7, 0xbf, 0xf8, 0x67, 0xb4, 0xad, 0xa5, 0xce,
+    0xc4, 0xc5, 0x9b, 0xab, 0xd7, 0xec, 0x46, 0x64, 0x22, 0xd6, 0x45, 0x75,
+    0x7e, 0x68, 0xf7, 0x0e, 0xce, 0x55, 0x5c, 0xc9, 0x52, 0x33, 0x55, 0xc5,
+    0xa3, 0xde, 0xa1, 0xd2, 0x5c, 0xcb, 0xf8, 0x90, 0x97, 0x65, 0xf0, 0x45,
+    0xbd, 0xb8, 0x1b, 0x9d, 0x9d, 0x9d, 0x9d, 0x26, 0x3f, 0x9f, 0x3e, 0xeb,
+    0x5d, 0x9c, 0x1f, 0xda, 0x83, 0x44, 0xa1, 0x17, 0x44, 0xf9, 0xd3, 0x72,
+    0xc6, 0xab, 0x89, 0xcc, 0xa3, 0x70, 0x58, 0xf2, 0x24, 0x91, 0xf9, 0x04,
+    0x4f, 0xe3, 0xe2, 0xc1, 0x57, 0xf2, 0x77, 0x5a, 0x8c, 0x8b, 0x2a, 0x81,
+    0x86, 0xd8, 0x59, 0x1d, 0x8c, 0x8b, 0x64, 0xb1, 0x4c, 0x61, 0xac, 0x9f,
+    0xf2, 0x99, 0xcc, 0x16, 0x91, 0x0f, 0x11, 0x99, 0xf0, 0xd5, 0x42, 0x69,
+    0x31, 0xeb, 0xbf, 0xca, 0x64, 0xfe, 0xf5, 0x2d, 0x8f, 0x6f, 0xcc, 0xf2,
+    0x17, 0x9c, 0xeb, 0x3b, 0x37, 0x62, 0x52, 0x08, 0xf6, 0xf1, 0xda, 0xe9,
+    0x7f, 0x28, 0xc6, 0x85, 0x2e, 0xfa, 0x2f, 0x2b, 0xa0, 0xd1, 0x57, 0x3c,
+    0x57, 0x3e, 0x2c, 0x97, 0xe9, 0x70, 0xcc, 0xe3, 0xaf, 0x93, 0xaa, 0x98,
+    0xe7, 0x49, 0xf4, 0x38, 0xe4, 0xf4, 0x19, 0xc6, 0x45, 0x56, 0x54, 0xd1,
+    0xe3, 0x34, 0x4d, 0x1b, 0x9d, 0x20, 0x5f, 0xeb, 0x62, 0x16, 0x9d, 0x85,
+    0x25, 0xf4, 0x08, 0xc8, 0x19, 0xa2, 0x5a, 0x96, 0x85, 0x02, 0xb8, 0x45,
+    0x1e, 0x29, 0x98, 0xfb, 0x75, 0x31, 0xd4, 0x45, 0x49, 0xca, 0x6f, 0x18,
+    0x42, 0x21, 0xc1, 0x2b, 0x7f, 0x52, 0xf1, 0x44, 0xc2, 0x41, 0xee, 0xe0,
+    0xf8, 0x34, 0x11, 0x93, 0xfe, 0xe3, 0x01, 0xa7, 0x4f, 0xff, 0x71, 0x98,
+    0xd2, 0xc7, 0x5b, 0x5b, 0x3e, 0x38, 0x2d, 0x1f, 0x86, 0x6b, 0x8b, 0x8d,
+    0xc4, 0xa3, 0xf2, 0x81, 0xa9, 0x22, 0x93, 0x09, 0x7b, 0x1c, 0x86, 0x69,
+    0x7a, 0x76, 0x66, 0xc1, 0x99, 0xf2, 0xa4, 0xb8, 0x8f, 0x42, 0x76, 0x82,
+    0xd7, 0x03, 0x3a, 0x53, 0x4d, 0xc6, 0xdc, 0x0d, 0xfb, 0x47, 0xa7, 0xa7,
+    0xfd, 0xc1, 0xf1, 0xb3, 0x7e, 0x18, 0x1c, 0x79, 0xc3, 0xdf, 0x7d, 0x99,
+    0x27, 0xe2, 0x21, 0x1a, 0x84, 0x21, 0x94, 0x8e, 0x13, 0x2c, 0xd3, 0xa2,
+    0xc6, 0xbb, 0xe1, 0x4f, 0xc4, 0x2b, 0x7a, 0x67, 0x3c, 0x69, 0xd1, 0x05,
+    0xf4, 0x22, 0x3a, 0x82, 0xa9, 0x43, 0xb3, 0xbc, 0x17, 0x72, 0x32, 0xd5,
+    0xd1, 0xf3, 0x30, 0x6c, 0x90, 0xa9, 0x35, 0xe9, 0x72, 0x3a, 0xa9, 0x19,
+    0xf1, 0x4a, 0x4b, 0xa5, 0x5b, 0x9c, 0x06, 0x78, 0xd3, 0x50, 0x72, 0xce,
+    0x87, 0x45, 0xc9, 0x63, 0xa9, 0x17, 0x51, 0x18, 0xfc, 0x0c, 0xb5, 0x78,
+    0x4c, 0x10, 0xaa, 0x65, 0x22, 0x55, 0x99, 0xf1, 0x45, 0x94, 0x66, 0xe2,
+    0x61, 0x38, 0xe1, 0x65, 0x74, 0x46, 0xf2, 0xb1, 0xf0, 0xef, 0x2b, 0xac,
+    0xe8, 0xab, 0x11, 0x48, 0x38, 0x0f, 0xac, 0x27, 0xc6, 0x3a, 0x5f, 0xae,
+    0xd1, 0x0b, 0x09, 0x8c, 0x67, 0x6b, 0x08, 0xa3, 0xbc, 0xc8, 0x45, 0x03,
+    0x27, 0xb9, 0x60, 0xae, 0x2c, 0xd3, 0x96, 0x51, 0xcf, 0x60, 0x54, 0x4b,
+    0xd3, 0x63, 0xd2, 0x74, 0x5e, 0x29, 0xa8, 0x5a, 0x16, 0x12, 0x59, 0x55,
+    0x0d, 0x75, 0x85, 0x58, 0xb1, 0x6e, 0xe6, 0x59, 0xc6, 0x00, 0xac, 0x32,
+    0x6a, 0x45, 0x83, 0xe1, 0x0c, 0xba, 0x98, 0x2c, 0x33, 0x71, 0x31, 0xd4,
+    0xe2, 0x41, 0xfb, 0x3c, 0x93, 0x93, 0x3c, 0x8a, 0x05, 0xd1, 0x5a, 0xfd,
+    0xfc, 0xb2, 0x92, 0x50, 0x7c, 0xb1, 0xec, 0x44, 0x9a, 0x45, 0x70, 0x8d,
+    0x67, 0xb8, 0x6a, 0x1f, 0x8d, 0x08, 0x94, 0x3b, 0xb1, 0x45, 0x91, 0x24,
+    0xcf, 0x9f, 0x5b, 0x75, 0xd2, 0xa2, 0x9a, 0x45, 0x26, 0x83, 0x5d, 0x80,
+    0x78, 0xe6, 0xd5, 0x82, 0x94, 0x40, 0x25, 0x48, 0xb6, 0x45, 0x1d, 0x1f,
+    0x1f, 0xb7, 0x22, 0x7a, 0xd5, 0x3d, 0xb9, 0x4f, 0xd2, 0xc9, 0xc9, 0xc9,
+    0x77, 0xc5, 0x24, 0x3c, 0x9f, 0x20, 0xfa, 0xdb, 0x24, 0x69, 0x7a, 0x42,
+    0x54, 0xdb, 0x62, 0xec, 0xc9, 0x7d, 0x32, 0x92, 0xe4, 0x98, 0xf4, 0xfa,
+    0x96, 0x18, 0x85, 0xb4, 0x89, 0xa7, 0x94, 0xf5, 0x4b, 0x0b, 0x30, 0x42,
+    0xf8, 0x6f, 0x9b, 0x34, 0x39, 0x22, 0x1f, 0xb7, 0xb8, 0xd9, 0x7c, 0x6a,
+    0xdc, 0xde, 0x4a, 0x19, 0x92, 0xb1, 0x1b, 0x00, 0xad, 0xfc, 0x6e, 0xf9,
+    0x9e, 0x72, 0x6f, 0x37, 0xc0, 0x36, 0x9a, 0x44, 0x69, 0x11, 0xcf, 0xd5,
+    0xb2, 0x98, 0x6b, 0x4a, 0xeb, 0x4e, 0x70, 0x75, 0xd2, 0x02, 0x44, 0x93,
+    0x4a, 0x26, 0xeb, 0x80, 0xa6, 0xc5, 0x90, 0xbe, 0x7c, 0x54, 0x25, 0xec,
+    0x68, 0x41, 0xe7, 0xe7, 0xb3, 0x5c, 0x45, 0x95, 0x28, 0x05, 0xd7, 0x2e,
+    0x9f, 0xeb, 0xc2, 0x4f, 0x65, 0x96, 0xf5, 0x11, 0x51, 0x28, 0xd0, 0xee,
+    0x29, 0x64, 0xf7, 0x07, 0x69, 0xe5, 0x79, 0x26, 0x13, 0x28, 0xa4, 0x3b,
+    0x25, 0x02, 0x67, 0xfc, 0x0d, 0x2e, 0x10, 0x98, 0x89, 0x64, 0xc9, 0x55,
+    0x89, 0xa2, 0x0c, 0x3b, 0x11, 0xab, 0x08, 0xce, 0x5d, 0xb3, 0xbf, 0x01,
+    0xcf, 0x2e, 0x8e, 0x9d, 0x54, 0x34, 0x01, 0xed, 0x4b, 0xe8, 0xae, 0xea,
+    0xb0, 0x1e, 0x7e, 0x99, 0xa3, 0xe0, 0xa5, 0x0b, 0xbf, 0xee, 0x3b, 0xcd,
+    0x76, 0x0b, 0xcb, 0xc1, 0xbe, 0xda, 0xf1, 0x27, 0x79, 0x35, 0x38, 0x55,
+    0x43, 0xdb, 0x8d, 0x4c, 0x77, 0xb1, 0x00, 0x83, 0xc1, 0xf8, 0xab, 0xd4,
+    0xbe, 0xe6, 0xa5, 0x3f, 0x05, 0xab, 0x8c, 0xd8, 0xd5, 0x78, 0x1b, 0x0e,
+    0x25, 0xaf, 0x20, 0xdd, 0x42, 0x10, 0x58, 0x4a, 0x60, 0xf1, 0xdd, 0x54,
+    0xdb, 0xeb, 0xb5, 0x6e, 0x59, 0x0d, 0xbf, 0x51, 0x54, 0x9f, 0x79, 0x56,
+    0x52, 0x13, 0xd2, 0x7b, 0xe2, 0xf7, 0xa8, 0x39, 0x32, 0x2d, 0xee, 0x28,
+    0x4b, 0xf6, 0xc9, 0xda, 0x26, 0x1b, 0x04, 0xe1, 0x29, 0x91, 0xa5, 0x45,
+    0xa1, 0xdb, 0x7d, 0x25, 0x95, 0x0f, 0x22, 0x19, 0xd6, 0xf5, 0x35, 0x1c,
+    0x66, 0x22, 0xd5, 0xf8, 0xa9, 0x0c, 0xa4, 0xff, 0xb3, 0x46, 0x43, 0xc1,
+    0xfe, 0x27, 0x5d, 0xc6, 0xff, 0x6e, 0x9b, 0xd9, 0xa9, 0xdc, 0x75, 0xea,
+    0xc4, 0x50, 0x4d, 0x2f, 0x77, 0xaa, 0xe2, 0xb0, 0x5d, 0xaf, 0xbf, 0x9d,
+    0xc6, 0x3b, 0x15, 0x7b, 0xa7, 0x97, 0xd4, 0x9a, 0xee, 0x94, 0x73, 0x53,
+    0x9c, 0x57, 0x07, 0x7f, 0x9f, 0x89, 0x44, 0x72, 0x77, 0x93, 0x2b, 0x78,
+    0x59, 0x3e, 0x78, 0x4b, 0x9b, 0x9d, 0x7f, 0x2d, 0x21, 0x4f, 0x4e, 0x3b,
+    0x09, 0x79, 0x4a, 0xad, 0x8e, 0x72, 0xae, 0xa5, 0x18, 0xd9, 0xbc, 0x3a,
+    0xc0, 0x80, 0x63, 0xe7, 0x9a, 0xf3, 0xc3, 0x7a, 0x62, 0xa3, 0xa1, 0x05,
+    0x3f, 0x89, 0xbc, 0x63, 0x71, 0xc6, 0x95, 0x1a, 0xf5, 0xec, 0xf4, 0xd0,
+    0xeb, 0x6e, 0xd6, 0xdd, 0x19, 0x23, 0x52, 0x77, 0xd3, 0xb4, 0xe5, 0x1e,
+    0x93, 0xc9, 0xa8, 0x67, 0x1f, 0x31, 0x43, 0xe1, 0xc4, 0xf6, 0x31, 0xdb,
+    0x74, 0xed, 0xb9, 0xfa, 0xb9, 0x39, 0x68, 0xbe, 0x3b, 0xb2, 0xea, 0x96,
+    0x4b, 0x1a, 0x8c, 0xe7, 0x88, 0xad, 0xbc, 0x79, 0x81, 0x9a, 0xcd, 0x3a,
+    0xed, 0xa1, 0xc7, 0x8a, 0x3c, 0xce, 0x30, 0xdc, 0x8c, 0x7a, 0x36, 0xb7,
+    0x3e, 0x50, 0x45, 0x77, 0xbd, 0xde, 0x85, 0x79, 0x38, 0x3f, 0xb4, 0xf4,
+    0x7f, 0x89, 0x51, 0x9c, 0x21, 0x54, 0x5f, 0x66, 0x19, 0x71, 0xb9, 0xa4,
+    0xe7, 0x16, 0x97, 0x5a, 0x57, 0x99, 0x97, 0x73, 0xcd, 0xf4, 0xa2, 0xc4,
+    0x98, 0x4b, 0xf1, 0xd3, 0x6b, 0xf8, 0x6e, 0xaa, 0xb1, 0x35, 0xd5, 0xae,
+    0x7b, 0x0c, 0x5e, 0x8c, 0xc5, 0xb4, 0xc8, 0x80, 0xeb, 0xa8, 0xf7, 0xcf,
+    0xf9, 0xac, 0x64, 0xba, 0x60, 0x34, 0xa9, 0x3e, 0x66, 0x45, 0xc5, 0x2a,
+    0xd2, 0x95, 0xb9, 0x22, 0x98, 0x04, 0x6c, 0x10, 0xd2, 0xce, 0x20, 0xf4,
+    0x8f, 0x42, 0x8f, 0x94, 0xfa, 0x2a, 0x16, 0xf3, 0x12, 0x3e, 0xe1, 0x79,
+    0x92, 0x89, 0x1b, 0xc3, 0xce, 0x15, 0x77, 0x08, 0x54, 0xaf, 0xb7, 0xd1,
+    0xa7, 0x85, 0x1d, 0xc5, 0x8d, 0x95, 0x6d, 0x9e, 0xf6, 0xc1, 0x6b, 0xb3,
+    0x78, 0xdb, 0xbf, 0x94, 0x0c, 0xb5, 0x77, 0x4d, 0x88, 0xd0, 0xb9, 0x4e,
+    0xbd, 0xdc, 0x8c, 0x45, 0xcf, 0x7b, 0x17, 0x37, 0x57, 0x6f, 0xae, 0x2e,
+    0x6f, 0xaf, 0x5e, 0xb7, 0x9c, 0x4d, 0x32, 0x6b, 0x2e, 0x61, 0xd7, 0xb5,
+    0xfb, 0xb1, 0xaf, 0x67, 0x89, 0xb6, 0x0b, 0xf9, 0x1d, 0xf9, 0x6e, 0x2d,
+    0x9f, 0x12, 0xe5, 0x08, 0xb2, 0x5e, 0xfe, 0x76, 0xc5, 0x9e, 0xb0, 0xcb,
+    0x37, 0xef, 0x6e, 0xae, 0x76, 0x7d, 0xd1, 0x0c, 0xec, 0x70, 0xa4, 0xd2,
+    0x2c, 0x4e, 0xae, 0x13, 0x36, 0x62, 0x25, 0xdd, 0x0d, 0xae, 0x51, 0x68,
+    0x72, 0x71, 0xcf, 0x3e, 0x7e, 0x78, 0x63, 0x81, 0x7b, 0xcf, 0x2b, 0x3e,
+    0x53, 0x6e, 0x56, 0xc4, 0xd4, 0x83, 0xf2, 0xba, 0x77, 0x7a, 0xc1, 0x44,
+    0x68, 0xd7, 0x89, 0x13, 0x07, 0xd9, 0x73, 0x90, 0x09, 0x38, 0xb6, 0xd0,
+    0x3c, 0x83, 0x77, 0x14, 0x38, 0x85, 0x76, 0xab, 0xa9, 0xdc, 0xd8, 0x21,
+    0x96, 0x37, 0xa0, 0xc0, 0x61, 0x2b, 0x93, 0x80, 0xc6, 0x7e, 0x82, 0xf6,
+    0x3b, 0x83, 0x63, 0x88, 0xdd, 0x55, 0x26, 0xe8, 0xf1, 0xd5, 0xe2, 0x3a,
+    0x71, 0x1d, 0x7a, 0xef, 0xac, 0x4f, 0x1b, 0x88, 0xae, 0xb2, 0xef, 0x11,
+    0x98, 0x23, 0x44, 0x91, 0xce, 0x73, 0x93, 0x0a, 0x2c, 0xae, 0x90, 0xf6,
+    0x02, 0x2a, 0xb9, 0xd2, 0x63, 0xcb, 0x9a, 0x53, 0x26, 0x3a, 0x62, 0xed,
+    0x99, 0x9a, 0x91, 0xeb, 0x00, 0x1d, 0xc7, 0xd8, 0x93, 0x04, 0x06, 0xf8,
+    0x5f, 0x71, 0x29, 0xc3, 0x71, 0x07, 0x1b, 0x0e, 0x7b, 0xca, 0xdc, 0xc6,
+    0xa2, 0x60, 0xca, 0x15, 0x71, 0x7d, 0xc1, 0x9c, 0xb5, 0x95, 0x0e, 0x8b,
+    0x98, 0xd3, 0x50, 0x53, 0x80, 0x5f, 0xda, 0x4e, 0x0a, 0x7a, 0x69, 0x37,
+    0x6b, 0x9f, 0x61, 0xc3, 0xf5, 0xd8, 0xe8, 0x02, 0x90, 0x4d, 0x26, 0x68,
+    0x14, 0x12, 0x34, 0x95, 0xd0, 0xf3, 0x2a, 0x27, 0xed, 0x86, 0x07, 0xab,
+    0x8d, 0x09, 0x68, 0x83, 0x88, 0x7e, 0x97, 0xd4, 0x27, 0x40, 0x02, 0x99,
+    0xe7, 0xa2, 0xfa, 0xc7, 0xed, 0xdb, 0x37, 0xa4, 0x94, 0x03, 0x5b, 0x11,
+    0xf6, 0x2e, 0x41, 0x2d, 0x0d, 0xea, 0xf8, 0x39, 0xdf, 0x38, 0x02, 0xcb,
+    0xa7, 0x4f, 0x3d, 0x83, 0x74, 0x80, 0x3b, 0x15, 0x58, 0x5d, 0x4e, 0x65,
+    0x96, 0xb8, 0x6d, 0x5c, 0x20, 0x7a, 0x5e, 0x26, 0x58, 0x5e, 0x12, 0x7c,
+    0xe4, 0x9e, 0x96, 0xf4, 0xb5, 0x7e, 0x10, 0x2f, 0xd3, 0x1d, 0xeb, 0xbd,
+    0xb5, 0xe9, 0x41, 0x82, 0x07, 0x6d, 0x2c, 0x61, 0x22, 0x53, 0x62, 0xf3,
+    0x02, 0x5d, 0xc1, 0xd8, 0x67, 0xb2, 0x2f, 0xd0, 0x98, 0xc4, 0x84, 0xb6,
+    0xd0, 0xbe, 0x41, 0x39, 0x0b, 0x6a, 0x09, 0xce, 0x1a, 0xc3, 0x5d, 0x7d,
+    0xca, 0x4a, 0xd0, 0xa5, 0x78, 0x4b, 0xb5, 0xce, 0x21, 0xb6, 0x6c, 0x02,
+    0x64, 0x0b, 0xf7, 0xb5, 0x1a, 0x94, 0x90, 0x43, 0xd6, 0xa2, 0xb7, 0x6f,
+    0x4c, 0xc1, 0x02, 0xf5, 0x9e, 0x40, 0xfd, 0x14, 0x04, 0xc1, 0xcb, 0xaa,
+    0xe2, 0x0b, 0x77, 0x8d, 0xa7, 0x17, 0xa0, 0xae, 0x28, 0xd7, 0xfb, 0x0c,
+    0x2b, 0x1b, 0xc7, 0x0c, 0xd9, 0x46, 0xbf, 0x36, 0xff, 0x4d, 0x3d, 0x6c,
+    0xb1, 0x0f, 0xcc, 0xae, 0xfb, 0x03, 0xe4, 0x32, 0xc7, 0x98, 0xa1, 0xed,
+    0x8d, 0x1c, 0x6b, 0x77, 0x13, 0xbf, 0xd0, 0x0f, 0xea, 0x75, 0x33, 0xea,
+    0x47, 0xa2, 0x80, 0xfc, 0xf7, 0x68, 0xc7, 0x81, 0x96, 0xdb, 0xda, 0x4b,
+    0x5d, 0x1c, 0xf0, 0x66, 0xbf, 0xa6, 0x6d, 0x47, 0x80, 0xd4, 0xb6, 0x0f,
+    0x42, 0x7e, 0xa3, 0x26, 0x6a, 0x89, 0xa6, 0x4a, 0x40, 0xbb, 0x01, 0x26,
+    0x09, 0x89, 0xe4, 0xf2, 0x1d, 0x2f, 0x98, 0xf1, 0xd2, 0x55, 0x14, 0xfb,
+    0xeb, 0x62, 0xa3, 0x02, 0x8d, 0x9a, 0xe6, 0x7a, 0x14, 0x8a, 0xa4, 0xa4,
+    0xa1, 0x44, 0x1f, 0xce, 0x27, 0x7a, 0xca, 0x1e, 0x8d, 0x46, 0xec, 0x88,
+    0xfd, 0xf1, 0x07, 0x93, 0x48, 0xc5, 0x5f, 0xed, 0xbb, 0x4f, 0xe1, 0x67,
+    0x6f, 0x7b, 0x6b, 0xf0, 0x19, 0xc6, 0xd4, 0x39, 0x94, 0x72, 0x44, 0xe0,
+    0x16, 0x28, 0x6f, 0xb9, 0x9e, 0x06, 0x68, 0xfb, 0x2e, 0xbc, 0x6a, 0x28,
+    0x3c, 0x83, 0x52, 0xf3, 0x02, 0xc3, 0x40, 0xfb, 0x05, 0xf0, 0x32, 0xaa,
+    0x48, 0x76, 0x01, 0x3c, 0xd9, 0x93, 0x27, 0x5d, 0x44, 0xbd, 0xdd, 0xf0,
+    0xde, 0x8b, 0x52, 0xad, 0x8f, 0xae, 0xe6, 0xa2, 0x03, 0x59, 0xa7, 0xe9,
+    0xae, 0x11, 0xb3, 0xfd, 0x0c, 0x55, 0xb8, 0x2a, 0x66, 0x25, 0xd0, 0xba,
+    0xa2, 0xb1, 0xaa, 0xdd, 0xe5, 0xfa, 0x75, 0x83, 0x8b, 0x9c, 0x1a, 0x29,
+    0xf3, 0xce, 0xdb, 0x78, 0xc0, 0xae, 0x3b, 0xa2, 0xba, 0x1d, 0xb0, 0xc9,
+    0x63, 0x41, 0x81, 0x6c, 0xb0, 0xb5, 0x52, 0x9c, 0x06, 0xbb, 0xa6, 0xdc,
+    0xde, 0x71, 0x2a, 0xb5, 0xa2, 0xc9, 0x57, 0x2c, 0xe7, 0xa2, 0x76, 0x93,
+    0x15, 0xfd, 0x08, 0x5b, 0x1b, 0x22, 0xda, 0xc1, 0x06, 0xaa, 0x53, 0x9c,
+    0xcd, 0x13, 0xa1, 0x8c, 0xab, 0x1b, 0x61, 0x6b, 0xf5, 0x88, 0xc4, 0xdb,
+    0x62, 0x5a, 0x97, 0xb1, 0x95, 0xad, 0x1a, 0xeb, 0x18, 0x9f, 0xcf, 0xda,
+    0xed, 0x88, 0x08, 0x6b, 0xb1, 0xd6, 0xe7, 0x78, 0xef, 0x91, 0x57, 0xe8,
+    0x5c, 0xe3, 0x21, 0x7a, 0xee, 0xf8, 0x68, 0x79, 0xd0, 0xf1, 0x12, 0xd1,
+    0x7c, 0x23, 0x9a, 0xd7, 0xcd, 0xe0, 0x3f, 0x73, 0x51, 0x2d, 0x9a, 0x3f,
+    0x83, 0xb9, 0x8e, 0x19, 0xf8, 0x73, 0x3d, 0xf5, 0x63, 0x53, 0x36, 0x4d,
+    0x03, 0x20, 0x31, 0x4f, 0xd9, 0xc0, 0xc3, 0x97, 0xe3, 0x21, 0x9e, 0xd1,
+    0x48, 0x8b, 0x2c, 0x83, 0x96, 0xc5, 0x6f, 0xc4, 0x6d, 0x39, 0x46, 0x9f,
+    0xfc, 0x8a, 0x3e, 0x60, 0xa7, 0x62, 0xa7, 0xcf, 0xc6, 0x62, 0xca, 0xef,
+    0x24, 0x26, 0x5b, 0xe6, 0xa8, 0x19, 0x66, 0x88, 0xa9, 0xb3, 0xa2, 0x72,
+    0xb8, 0x17, 0x05, 0xf3, 0xa1, 0x90, 0xad, 0x95, 0xbb, 0x95, 0x33, 0x84,
+    0x00, 0x72, 0x71, 0x9e, 0x65, 0xad, 0xbe, 0xb6, 0x56, 0x9d, 0x00, 0xa3,
+    0x8a, 0x42, 0xe7, 0x70, 0x83, 0x75, 0xdb, 0x64, 0x9b, 0xca, 0xd9, 0x70,
+    0x51, 0x42, 0x37, 0x07, 0x6d, 0xfb, 0x69, 0xb5, 0x44, 0x4a, 0x55, 0x53,
+    0xed, 0x82, 0x14, 0xe1, 0xb7, 0x2e, 0xf4, 0x5e, 0xf0, 0x05, 0x17, 0x3b,
+    0xd7, 0xe9, 0x9b, 0xbe, 0x2a, 0x34, 0x82, 0xc8, 0x39, 0xe4, 0xa5, 0x3c,
+    0xa4, 0x4b, 0x22, 0x0c, 0x87, 0x7d, 0xcb, 0x99, 0xd0, 0xd3, 0x22, 0x81,
+    0x79, 0xef, 0xdf, 0xdd, 0xdc, 0x62, 0xc3, 0x0e, 0xc2, 0x2a, 0x62, 0x4b,
+    0xa7, 0x2e, 0xc4, 0xfe, 0x2d, 0x66, 0x3e, 0x07, 0x27, 0xe8, 0x0f, 0x7b,
+    0xd2, 0x8e, 0x11, 0x87, 0x98, 0xdf, 0xef, 0xef, 0x7d, 0xba, 0x2e, 0xf9,
+    0xf3, 0x0a, 0xd9, 0x1e, 0x17, 0x09, 0xca, 0xff, 0x0a, 0x80, 0x61, 0xb4,
+    0xa6, 0xb3, 0xc6, 0xd6, 0x11, 0x74, 0xab, 0xcd, 0x78, 0x42, 0x6a, 0x8e,
+    0xc8, 0x09, 0xf4, 0xb0, 0xf2, 0x70, 0x15, 0xe1, 0xa4, 0x90, 0x20, 0x53,
+    0xc8, 0x90, 0x22, 0x13, 0x81, 0xa8, 0x2a, 0xf2, 0xdc, 0x7b, 0x4b, 0xc2,
+    0xcc, 0x32, 0x82, 0x52, 0x82, 0xaa, 0xcb, 0x8a, 0x32, 0x28, 0xec, 0x26,
+    0x88, 0x9d, 0x9e, 0x7e, 0x08, 0x0a, 0xdc, 0x73, 0x81, 0x1c, 0x87, 0x86,
+    0x06, 0x3d, 0xce, 0x7c, 0x3c, 0xfd, 0x3f, 0x00, 0x64, 0x7b, 0xe1, 0x13,
+    0x8c, 0x92, 0x84, 0x8e, 0x19, 0xe6, 0x10, 0x9d, 0xbb, 0x78, 0xe9, 0xa9,
+    0xc8, 0xdd, 0x8a, 0x74, 0xaf, 0x4c, 0x9f, 0x44, 0xcd, 0xb5, 0x7b, 0xdd,
+    0x70, 0x98, 0xa9, 0x09, 0x20, 0x58, 0xd2, 0xa0, 0x1e, 0x99, 0xc9, 0xc7,
+    0xb7, 0x02, 0xa0, 0x3a, 0x71, 0x8a, 0x2c, 0x3f, 0x9b, 0x90, 0xf7, 0x32,
+    0xc7, 0x65, 0x32, 0x28, 0x30, 0x5c, 0x20, 0xe4, 0x58, 0x67, 0x19, 0xe0,
+    0xc6, 0xab, 0xdf, 0x0a, 0xa5, 0x38, 0x92, 0x1f, 0x4c, 0xfb, 0xcc, 0xf9,
+    0x89, 0x60, 0xd2, 0xd5, 0xc2, 0x34, 0x6c, 0x92, 0x35, 0x8e, 0xeb, 0x4e,
+    0xf6, 0xaa, 0x2a, 0x78, 0x12, 0x73, 0xa5, 0x2f, 0x51, 0xb2, 0x72, 0x91,
+    0xb9, 0x24, 0xf8, 0xdf, 0xb1, 0x5d, 0x80, 0x0a, 0x27, 0xb7, 0xf9, 0xd9,
+    0xcd, 0x38, 0x2b, 0x94, 0x30, 0xdd, 0x93, 0x99, 0x78, 0x60, 0xa6, 0xcc,
+    0xad, 0x03, 0x22, 0x2b, 0x26, 0xae, 0xf3, 0xea, 0x92, 0x5d, 0x55, 0x95,
+    0x09, 0x03, 0xea, 0xb2, 0xb8, 0x9c, 0xc3, 0x93, 0x8e, 0x99, 0x55, 0xc9,
+    0xff, 0xc9, 0x23, 0x12, 0x50, 0xeb, 0xde, 0xf0, 0x3b, 0x58, 0x79, 0xed,
+    0x00, 0xab, 0x69, 0xae, 0x4c, 0x40, 0x31, 0x42, 0xd5, 0x86, 0xd4, 0xc1,
+    0x7b, 0x04, 0x89, 0x54, 0x22, 0xe0, 0xe8, 0xf5, 0x9f, 0x32, 0x18, 0x01,
+    0x9f, 0xa6, 0x72, 0xe2, 0x7a, 0x7d, 0xd6, 0x8e, 0x07, 0xf3, 0xa7, 0x96,
+    0x17, 0xa9, 0x14, 0x19, 0x9c, 0x62, 0xee, 0x7c, 0x7d, 0x7b, 0xa3, 0xeb,
+    0xc3, 0xce, 0xeb, 0x3c, 0x91, 0xb1, 0x50, 0x6d, 0x0f, 0x7a, 0x1d, 0x6f,
+    0x7d, 0x51, 0x34, 0x03, 0x60, 0xf0, 0xa8, 0x9d, 0xe8, 0x7e, 0x8a, 0x53,
+    0xe0, 0x99, 0x7c, 0xae, 0x1d, 0x67, 0x6a, 0x23, 0xa6, 0x43, 0x12, 0x52,
+    0xb7, 0x4e, 0x02, 0xe1, 0x9b, 0xb3, 0xb2, 0x51, 0x00, 0xd5, 0xab, 0x3b,
+    0x2d, 0x39, 0xd7, 0x39, 0xca, 0x11, 0xc6, 0xf2, 0xeb, 0xd7, 0xce, 0xb0,
+    0x29, 0xee, 0xc0, 0xcb, 0xba, 0x4a, 0xd2, 0x91, 0x5a, 0x06, 0x5a, 0x70,
+    0xab, 0x6c, 0x1a, 0x6e, 0x44, 0xdf, 0xfe, 0x2f, 0x02, 0xb2, 0x83, 0x6c,
+    0x91, 0xf5, 0xeb, 0xd6, 0xf1, 0x1f, 0x53, 0xe6, 0x07, 0x08, 0x2d, 0x80,
+    0xfb, 0x28, 0xed, 0x1b, 0x84, 0x5a, 0xeb, 0x4e, 0x02, 0xc4, 0xa8, 0xa0,
+    0x9b, 0x91, 0x71, 0x7b, 0xd2, 0x31, 0x83, 0x14, 0xe8, 0x36, 0xbe, 0x68,
+    0xf7, 0xf4, 0x03, 0xaa, 0xd8, 0xad, 0x7f, 0x72, 0x1c, 0xd6, 0xb7, 0xff,
+    0x43, 0xfb, 0x5f, 0x9c, 0xff, 0x02, 0xc2, 0xb9, 0x7f, 0xe0, 0xdd, 0x19,
+    0x00, 0x00,
+};
+
+// backup.html: 4031 bytes, 1606 gzipped
+static const uint8_t web_backup_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x57,
+    0xcd, 0x72, 0xdb, 0x36, 0x10, 0xbe, 0xe7, 0x29, 0xb6, 0xcc, 0x34, 0x92,
+    0xa7, 0xa1, 0x24, 0x4a, 0xb6, 0x63, 0x53, 0xa6, 0x32, 0xb1, 0x22, 0x77,
+    0xdc, 0x38, 0x96, 0xc7, 0x3f, 0xd3, 0xf6, 0xd4, 0x81, 0x48, 0x50, 0x42,
+    0x4c, 0x01, 0x0c, 0x00, 0xea, 0x27, 0x9d, 0x5e, 0xdb, 0x63, 0xef, 0x3d,
+    0xf5, 0x01, 0xfa, 0x00, 0x7d, 0x9e, 0xbc, 0x40, 0x5f, 0xa1, 0x0b, 0x90,
+    0xb4, 0x69, 0x49, 0x4e, 0xa2, 0xce, 0xd4, 0x07, 0x4b, 0x02, 0x89, 0xdd,
+    0xfd, 0xf6, 0xc3, 0x7e, 0xbb, 0x38, 0xfa, 0xea, 0xf5, 0xb0, 0x7f, 0xfd,
+    0xe3, 0xc5, 0x00, 0x26, 0x7a, 0x9a, 0xf4, 0x9e, 0x1c, 0x95, 0x1f, 0x94,
+    0x44, 0xf8, 0x31, 0xa5, 0x9a, 0x40, 0x38, 0x21, 0x52, 0x51, 0x1d, 0x38,
+    0x37, 0xd7, 0x27, 0xee, 0x81, 0x83, 0xcb, 0x9a, 0xe9, 0x84, 0xf6, 0x8e,
+    0x49, 0x78, 0x9b, 0xa5, 0xf0, 0x0c, 0x2e, 0xa9, 0xd2, 0x42, 0xd2, 0xa3,
+    0x66, 0xbe, 0x5e, 0x6c, 0xe3, 0x64, 0x4a, 0x03, 0x67, 0xc6, 0xe8, 0x3c,
+    0x15, 0x52, 0x3b, 0x10, 0x0a, 0xae, 0x29, 0x47, 0x33, 0x73, 0x16, 0xe9,
+    0x49, 0x10, 0xd1, 0x19, 0x0b, 0xa9, 0x6b, 0x7f, 0x3c, 0x07, 0xc6, 0x99,
+    0x66, 0x24, 0x71, 0x55, 0x48, 0x12, 0x1a, 0x78, 0xc6, 0x89, 0x0a, 0x25,
+    0x4b, 0x35, 0x28, 0x19, 0x06, 0x4e, 0x53, 0x69, 0xa2, 0x59, 0xd8, 0x24,
+    0x69, 0xda, 0x78, 0xa7, 0x5e, 0xce, 0x82, 0x83, 0x83, 0x83, 0xbd, 0xe8,
+    0x70, 0x6f, 0xdf, 0xe9, 0x1d, 0x35, 0xf3, 0x17, 0x71, 0x47, 0xb3, 0x88,
+    0x7a, 0x24, 0xa2, 0x25, 0x28, 0xbd, 0x44, 0x4b, 0x4e, 0x8c, 0x5e, 0xdd,
+    0x98, 0x4c, 0x59, 0xb2, 0xf4, 0x15, 0xe1, 0xca, 0x55, 0x54, 0xb2, 0xb8,
+    0x0b, 0x23, 0x0c, 0x7e, 0x2c, 0x45, 0xc6, 0x23, 0xff, 0x69, 0xab, 0xd5,
+    0xea, 0x62, 0x78, 0x89, 0x90, 0xfe, 0xd3, 0x38, 0xc6, 0x87, 0x29, 0x89,
+    0x22, 0xc6, 0xc7, 0x7e, 0xbb, 0x95, 0x2e, 0xba, 0x30, 0x25, 0x8b, 0x3c,
+    0x4c, 0x7f, 0xbf, 0x55, 0x2c, 0xc8, 0x31, 0xe3, 0x7e, 0x0b, 0x48, 0xa6,
+    0x45, 0xd7, 0xc4, 0x3a, 0xf1, 0x4a, 0x7f, 0x85, 0x99, 0x56, 0x2b, 0x8e,
+    0x0f, 0x30, 0x57, 0xeb, 0x39, 0x9a, 0x78, 0xf8, 0x7e, 0xda, 0x7b, 0x4b,
+    0x38, 0x19, 0x53, 0x58, 0x8a, 0x4c, 0x42, 0xc2, 0x46, 0x92, 0xc8, 0x25,
+    0x44, 0x44, 0x93, 0x11, 0x51, 0x14, 0xea, 0x47, 0xa1, 0x88, 0x28, 0xb0,
+    0x28, 0x70, 0xf0, 0xd9, 0x09, 0x4b, 0xa8, 0xc1, 0x69, 0xd6, 0x7a, 0x3b,
+    0x8d, 0xa3, 0x66, 0x8a, 0x16, 0x22, 0x36, 0x2b, 0x5d, 0x56, 0xa1, 0x78,
+    0x9e, 0xb7, 0x1a, 0xfe, 0x48, 0xc8, 0x88, 0x4a, 0xdf, 0x4b, 0x17, 0xa0,
+    0x44, 0xc2, 0x22, 0x78, 0xda, 0xe9, 0x74, 0xca, 0x65, 0x57, 0x92, 0x88,
+    0x65, 0xca, 0xf7, 0x2a, 0xc0, 0xdc, 0x91, 0xd0, 0x5a, 0x4c, 0xf3, 0xed,
+    0x16, 0x5d, 0xbb, 0xf7, 0xf1, 0xaf, 0xdf, 0xfe, 0xf9, 0xfb, 0x77, 0x18,
+    0x2c, 0x0c, 0x97, 0x70, 0x96, 0x07, 0x8c, 0x60, 0xda, 0x06, 0xcc, 0x0a,
+    0xf6, 0x30, 0x0c, 0x9d, 0xde, 0x6b, 0x31, 0xe7, 0x89, 0x20, 0x11, 0x90,
+    0x24, 0xb1, 0xc0, 0x80, 0x28, 0x20, 0xa0, 0x30, 0xae, 0x84, 0x02, 0x92,
+    0x28, 0x78, 0x02, 0x31, 0x22, 0x83, 0xfa, 0x19, 0xe3, 0xd4, 0x8d, 0x68,
+    0xc2, 0xa6, 0x4c, 0xd3, 0x08, 0xbe, 0xbb, 0x1a, 0x9e, 0x97, 0x28, 0x89,
+    0xcd, 0x01, 0x5d, 0xe4, 0x27, 0x28, 0x2a, 0x6c, 0xda, 0xac, 0x98, 0x00,
+    0x7e, 0x1a, 0xd9, 0xf4, 0xe6, 0xd6, 0x30, 0x45, 0xa3, 0x0c, 0x03, 0xe7,
+    0x65, 0x38, 0x65, 0x1a, 0xbc, 0x36, 0x42, 0x6f, 0xef, 0xd9, 0x5c, 0x3c,
+    0x60, 0xdd, 0x50, 0x74, 0x47, 0xbc, 0x3d, 0x04, 0x45, 0xae, 0xb8, 0xe0,
+    0x74, 0x35, 0x43, 0x76, 0xbf, 0x3d, 0x4d, 0x73, 0xca, 0xc6, 0x13, 0xed,
+    0x8f, 0x44, 0x12, 0xe1, 0xee, 0x4c, 0x2a, 0xdc, 0x9e, 0x0a, 0x86, 0xa7,
+    0x5b, 0x62, 0xba, 0x06, 0x3f, 0x5c, 0x0c, 0x2f, 0xaf, 0xe1, 0xe4, 0xe6,
+    0xec, 0x0c, 0x8e, 0x5f, 0xf5, 0xdf, 0xdc, 0x5c, 0x1c, 0x35, 0xf3, 0xb8,
+    0x90, 0x42, 0x62, 0x4e, 0x29, 0x52, 0xf7, 0x3f, 0x11, 0x78, 0x47, 0xd6,
+    0xaf, 0x86, 0xac, 0xd3, 0xa9, 0x25, 0x2b, 0x3f, 0x82, 0x8f, 0x70, 0x15,
+    0xc7, 0x84, 0xb4, 0x5a, 0x4e, 0xef, 0xe3, 0x1f, 0x7f, 0x9a, 0x2d, 0xdf,
+    0x13, 0xc9, 0x8d, 0x63, 0x78, 0x15, 0x45, 0xaa, 0x39, 0x9c, 0x51, 0x39,
+    0x97, 0x48, 0x8a, 0x02, 0xfc, 0x37, 0x55, 0x10, 0x4b, 0x31, 0x05, 0x3d,
+    0xa1, 0x90, 0xe7, 0xdd, 0xf2, 0x57, 0x30, 0x15, 0x0b, 0x39, 0xb5, 0x64,
+    0xb1, 0x69, 0x4e, 0x16, 0x6a, 0xc0, 0x44, 0xe0, 0xef, 0x8b, 0xe1, 0xd5,
+    0xb5, 0x03, 0x94, 0x87, 0x7a, 0x99, 0xa2, 0xdf, 0x69, 0x96, 0x68, 0x96,
+    0x12, 0xa9, 0x9b, 0x66, 0x87, 0x6b, 0x4e, 0x86, 0x89, 0x9a, 0xf1, 0x34,
+    0xd3, 0x90, 0xbf, 0x62, 0xac, 0x3a, 0x85, 0x7c, 0xd8, 0xe7, 0x40, 0xc2,
+    0x90, 0xa6, 0xa8, 0x1c, 0x05, 0xd1, 0x20, 0x38, 0x6a, 0x12, 0x1f, 0x1b,
+    0x79, 0x21, 0x12, 0x46, 0x41, 0x24, 0xc2, 0x6c, 0x8a, 0xda, 0xd2, 0x18,
+    0x53, 0x3d, 0x48, 0xa8, 0xf9, 0x7a, 0xbc, 0x3c, 0x8d, 0xea, 0xb5, 0x91,
+    0xe6, 0x97, 0xb5, 0x1d, 0xcc, 0x55, 0x23, 0x62, 0x8a, 0x8c, 0x12, 0x1a,
+    0x05, 0x5f, 0xe9, 0x09, 0x53, 0x0d, 0xe3, 0x43, 0x35, 0x12, 0xca, 0xc7,
+    0x7a, 0x62, 0x1e, 0xdb, 0xac, 0x34, 0x44, 0x4a, 0x42, 0xa6, 0x97, 0xc1,
+    0xda, 0x2b, 0x2f, 0x3d, 0xbf, 0xd5, 0xd8, 0xbb, 0x7f, 0x31, 0x67, 0x7d,
+    0xc3, 0x7b, 0xb5, 0xe2, 0x20, 0xd4, 0xfc, 0x1a, 0x17, 0xda, 0xc5, 0xc3,
+    0x2f, 0xe6, 0x34, 0xaa, 0x75, 0x9d, 0x32, 0xef, 0x0f, 0x4b, 0xcc, 0xb3,
+    0xa7, 0x2a, 0x17, 0x17, 0xaf, 0xd5, 0xfa, 0xfa, 0x9e, 0xfa, 0xbc, 0x20,
+    0xab, 0x27, 0xa3, 0xdd, 0x6e, 0x6f, 0x3a, 0x0b, 0xbb, 0xbb, 0xbb, 0x9b,
+    0x8e, 0xaa, 0xa9, 0x06, 0xb9, 0x92, 0x58, 0x95, 0x8d, 0xb0, 0xc4, 0x1c,
+    0x4b, 0x93, 0xc9, 0x8c, 0x03, 0x33, 0x92, 0x64, 0xf8, 0xe0, 0x72, 0x70,
+    0x75, 0x3d, 0xbc, 0x1c, 0xc0, 0xc9, 0xe5, 0xf0, 0x6d, 0x71, 0x68, 0xb1,
+    0xda, 0x8a, 0x8c, 0x7d, 0x61, 0x39, 0xc5, 0xf1, 0xae, 0x0d, 0xa5, 0xaa,
+    0xa3, 0xff, 0xb9, 0x9c, 0x2a, 0xb9, 0xeb, 0x42, 0xc1, 0x8a, 0x65, 0xc0,
+    0x9c, 0x15, 0x7b, 0x72, 0x1e, 0x16, 0x52, 0x98, 0x10, 0xa5, 0x02, 0x87,
+    0x0b, 0x37, 0x95, 0x98, 0xff, 0xd5, 0x6c, 0x6b, 0x91, 0xfa, 0xb0, 0x5b,
+    0x29, 0xa6, 0x7c, 0x65, 0xb5, 0xa2, 0x0a, 0x84, 0xf9, 0xc3, 0x7b, 0xf5,
+    0xeb, 0x94, 0xd6, 0x34, 0x5d, 0x98, 0xb0, 0xd8, 0x98, 0xfb, 0x21, 0xb5,
+    0xe5, 0xfe, 0x00, 0xad, 0x45, 0xa3, 0xd8, 0x07, 0x8a, 0x96, 0x77, 0xd7,
+    0xe5, 0x14, 0x72, 0xb2, 0xad, 0x11, 0x2d, 0xb1, 0x15, 0x19, 0x18, 0x3e,
+    0x64, 0x69, 0x4a, 0x65, 0x88, 0xaa, 0xdf, 0x85, 0x84, 0x6a, 0x34, 0xea,
+    0x2a, 0x83, 0xd7, 0x14, 0xa1, 0x67, 0x23, 0x38, 0x27, 0x33, 0x36, 0xc6,
+    0xee, 0x27, 0x38, 0xd6, 0x70, 0xe7, 0xa1, 0x72, 0x20, 0x47, 0x69, 0x42,
+    0x96, 0x3e, 0x8c, 0x25, 0xc3, 0x4c, 0x99, 0xff, 0x2e, 0x56, 0x2a, 0xae,
+    0x69, 0xea, 0x62, 0x6c, 0xd9, 0x94, 0x2b, 0x1f, 0x24, 0x4d, 0x29, 0xd1,
+    0xf5, 0x17, 0xcf, 0xc1, 0x8b, 0x25, 0x56, 0xc3, 0x98, 0x18, 0xf0, 0x25,
+    0xbe, 0x42, 0x34, 0xb1, 0xa6, 0x12, 0x16, 0xde, 0xa2, 0xb6, 0x8a, 0xd0,
+    0x7a, 0x6b, 0x4c, 0x24, 0x8d, 0x83, 0x5a, 0xb3, 0xe6, 0x3c, 0xe8, 0xa5,
+    0x05, 0xc0, 0x8e, 0xc1, 0x52, 0x1e, 0x89, 0xd2, 0xd8, 0xb3, 0xa7, 0x5e,
+    0xfb, 0xc5, 0xe1, 0x3e, 0x8a, 0xea, 0x6b, 0xa2, 0x26, 0x23, 0x41, 0x64,
+    0x74, 0x27, 0x7e, 0x9f, 0x77, 0x84, 0xbd, 0x9f, 0x6f, 0xe9, 0xec, 0xa0,
+    0xbd, 0xfb, 0xa2, 0x0b, 0x57, 0xb8, 0x91, 0x53, 0xb9, 0x85, 0xab, 0x91,
+    0x14, 0x73, 0x45, 0xb7, 0x77, 0x86, 0xda, 0x7c, 0x6c, 0xb7, 0x6e, 0xe1,
+    0x2b, 0x61, 0xfc, 0x76, 0x5b, 0x4f, 0xb6, 0x92, 0xfa, 0x02, 0xf5, 0x57,
+    0x6d, 0x83, 0xca, 0xaa, 0xf2, 0xb6, 0xbe, 0xbc, 0x43, 0x6c, 0x7c, 0x65,
+    0x93, 0xf8, 0x62, 0x5f, 0x53, 0xc2, 0x33, 0x92, 0x6c, 0x9d, 0x41, 0x0f,
+    0x71, 0xbd, 0xb5, 0x5b, 0xb7, 0x01, 0x46, 0xa5, 0x14, 0x52, 0x6d, 0xeb,
+    0x6c, 0xff, 0x00, 0xe9, 0x1a, 0xd8, 0xad, 0x15, 0x5f, 0x85, 0x6a, 0x54,
+    0xc4, 0xc3, 0x8e, 0x59, 0x02, 0x2b, 0xf5, 0xce, 0x7e, 0x2a, 0x14, 0x33,
+    0xfe, 0xfd, 0x98, 0x2d, 0x50, 0x81, 0x8c, 0x1e, 0xb4, 0xba, 0x09, 0x8d,
+    0x35, 0x7e, 0x54, 0xc4, 0x7a, 0x92, 0x2b, 0x97, 0xfd, 0xbe, 0x3a, 0x4f,
+    0x7e, 0x70, 0x19, 0x8f, 0xe8, 0xc2, 0x3f, 0xc4, 0xbf, 0x6e, 0x59, 0xa6,
+    0x56, 0x08, 0xad, 0x80, 0xb8, 0xb6, 0xa1, 0x96, 0x32, 0xf2, 0x2e, 0x53,
+    0x9a, 0xc5, 0x4b, 0xb7, 0x18, 0x91, 0xcb, 0x65, 0xe7, 0xd3, 0x63, 0x42,
+    0x09, 0xba, 0x63, 0x30, 0x6f, 0x98, 0x06, 0x36, 0xcf, 0x0d, 0xeb, 0x22,
+    0x96, 0x23, 0x3a, 0x44, 0x10, 0xf7, 0x93, 0x6e, 0xa7, 0x32, 0xfc, 0x6d,
+    0x1c, 0x6d, 0xbb, 0x15, 0x69, 0xc5, 0xf9, 0xe1, 0x6a, 0xd0, 0xbf, 0xc1,
+    0x06, 0x72, 0x36, 0xfc, 0xf6, 0xf4, 0xfc, 0x91, 0x51, 0x03, 0x47, 0xf6,
+    0xee, 0x3d, 0x71, 0x46, 0x21, 0x71, 0x58, 0x32, 0x01, 0xc0, 0xc5, 0xe9,
+    0x39, 0x68, 0x61, 0x2f, 0x08, 0x8c, 0x67, 0x34, 0x1f, 0x28, 0xaa, 0x8d,
+    0x2b, 0x45, 0x75, 0x9f, 0x23, 0x9a, 0xbc, 0x75, 0xa5, 0x86, 0x29, 0xcc,
+    0x67, 0x48, 0x27, 0xd8, 0x33, 0xa8, 0xc4, 0x19, 0xe3, 0xf4, 0xfc, 0x8e,
+    0xbb, 0x0a, 0x3f, 0xd5, 0x8e, 0x55, 0xc4, 0x6b, 0x3b, 0x2e, 0xb4, 0xba,
+    0xab, 0x8d, 0x75, 0x73, 0x5f, 0xad, 0xa8, 0xfb, 0x7a, 0xf7, 0x5a, 0x4f,
+    0x64, 0x05, 0xdd, 0x01, 0xbe, 0x20, 0x32, 0x8d, 0xb5, 0x4f, 0x73, 0xd6,
+    0xcd, 0xd0, 0x72, 0x4b, 0x97, 0x66, 0x84, 0xc5, 0x19, 0x29, 0xae, 0xd3,
+    0x99, 0x99, 0x57, 0x70, 0x25, 0x08, 0x82, 0x9a, 0x4d, 0x43, 0x6d, 0x47,
+    0x5d, 0xd4, 0x77, 0x1c, 0x7b, 0xa9, 0x88, 0x71, 0xa0, 0x51, 0x1b, 0x0a,
+    0x23, 0x7f, 0xe3, 0x33, 0x48, 0x37, 0x0c, 0xb9, 0x95, 0x19, 0xb7, 0xda,
+    0x93, 0xd7, 0x41, 0xad, 0x75, 0xe4, 0x95, 0xf9, 0xb6, 0x02, 0x71, 0xbf,
+    0xcc, 0xc1, 0x7d, 0x33, 0xbb, 0xef, 0x65, 0x4e, 0xef, 0xe6, 0xfc, 0x6c,
+    0xd8, 0x7f, 0xf3, 0x68, 0xe1, 0x95, 0x97, 0x36, 0x24, 0x5d, 0x69, 0x78,
+    0x0f, 0x01, 0xd4, 0x5e, 0x22, 0xb1, 0x41, 0x0d, 0xbe, 0x31, 0xc3, 0x22,
+    0x5e, 0x75, 0x6e, 0x2e, 0x4f, 0xfb, 0x02, 0x87, 0x49, 0x8e, 0x89, 0xaa,
+    0x23, 0xc3, 0x3b, 0xdd, 0x27, 0x8f, 0xce, 0x79, 0xf9, 0x0d, 0xa1, 0xb6,
+    0x63, 0x05, 0xc3, 0xd8, 0xc2, 0x9b, 0x22, 0x6b, 0xe6, 0xab, 0xc5, 0x25,
+    0xc1, 0x18, 0x7e, 0xff, 0x09, 0x13, 0xf9, 0xdc, 0x8a, 0x26, 0x48, 0x68,
+    0x4a, 0xff, 0xce, 0x48, 0xbe, 0xfe, 0xd0, 0x88, 0xb9, 0x84, 0xf4, 0x05,
+    0x8f, 0xd9, 0xb8, 0xbe, 0xd3, 0xc0, 0x79, 0x98, 0xd7, 0xc3, 0x78, 0x0c,
+    0x41, 0x0f, 0x7e, 0x86, 0x47, 0xed, 0x17, 0x17, 0x39, 0x74, 0x60, 0x92,
+    0xd6, 0xcf, 0x2b, 0x1d, 0xbd, 0xe0, 0xce, 0x46, 0x71, 0x9d, 0x31, 0xcf,
+    0xbb, 0xf0, 0x0b, 0x02, 0x95, 0xf4, 0x7d, 0xc6, 0x24, 0xbd, 0x60, 0xbc,
+    0x8e, 0xbf, 0xaa, 0x57, 0x5c, 0x73, 0xb7, 0xb5, 0x57, 0x5d, 0x7b, 0x4f,
+    0xff, 0x17, 0x15, 0x17, 0xcc, 0x9b, 0xbf, 0x0f, 0x00, 0x00,
+};
+
+// manual.html: 3471 bytes, 1434 gzipped
+static const uint8_t web_manual_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x57,
+    0x5b, 0x6f, 0xe2, 0x46, 0x14, 0x7e, 0xe7, 0x57, 0x9c, 0x12, 0x69, 0x43,
+    0xd4, 0x18, 0x63, 0x60, 0xb3, 0x2c, 0x37, 0xb5, 0x09, 0x64, 0xb5, 0x55,
+    0xf6, 0xa2, 0x25, 0xab, 0x55, 0x9f, 0xaa, 0xb1, 0x3d, 0x36, 0xd3, 0x8c,
+    0x67, 0xac, 0xf1, 0x18, 0x42, 0xab, 0xfc, 0x85, 0xf6, 0xa1, 0x52, 0x5f,
+    0xfb, 0xba, 0xaf, 0x7d, 0x6a, 0xff, 0x55, 0xfb, 0x13, 0x7a, 0x66, 0x6c,
+    0x83, 0x49, 0x58, 0x55, 0x3c, 0x80, 0xf1, 0x99, 0x73, 0xfd, 0xce, 0x6d,
+    0x18, 0x7f, 0x35, 0x7b, 0x77, 0x75, 0xfb, 0xfd, 0xfb, 0x39, 0x2c, 0x75,
+    0xc2, 0xa7, 0x8d, 0x71, 0xf5, 0xa0, 0x24, 0xc4, 0x47, 0x42, 0x35, 0x81,
+    0x60, 0x49, 0x54, 0x46, 0xf5, 0xa4, 0xf9, 0xf1, 0xf6, 0xda, 0x19, 0x34,
+    0x91, 0xac, 0x99, 0xe6, 0x74, 0x3a, 0x63, 0x31, 0xd3, 0x84, 0xc3, 0x0d,
+    0xf3, 0x15, 0x51, 0x8c, 0x08, 0x78, 0x43, 0x44, 0x4e, 0xf8, 0xd8, 0x2d,
+    0xce, 0x4b, 0x71, 0x41, 0x12, 0x3a, 0x69, 0xae, 0x18, 0x5d, 0xa7, 0x52,
+    0xe9, 0x26, 0x04, 0x52, 0x68, 0x2a, 0x50, 0xdd, 0x9a, 0x85, 0x7a, 0x39,
+    0x09, 0xe9, 0x8a, 0x05, 0xd4, 0xb1, 0x2f, 0xe7, 0xc0, 0x04, 0xd3, 0x8c,
+    0x70, 0x27, 0x0b, 0x08, 0xa7, 0x13, 0xcf, 0x18, 0xcb, 0xf4, 0xc6, 0x28,
+    0x1b, 0x2a, 0x29, 0x35, 0xfc, 0x0c, 0x8e, 0xe3, 0xc7, 0x43, 0x38, 0xe9,
+    0x74, 0x3a, 0x23, 0xfc, 0xad, 0xe9, 0xbd, 0xc6, 0xb7, 0x30, 0x0c, 0xcd,
+    0x1b, 0x09, 0x02, 0xd4, 0x6c, 0x4f, 0xa3, 0x68, 0x30, 0x30, 0xa4, 0x80,
+    0xa8, 0x10, 0x09, 0x9e, 0xe7, 0x8d, 0xe0, 0xa1, 0xe1, 0xcb, 0x70, 0x83,
+    0x3a, 0x22, 0x74, 0xc1, 0x89, 0x48, 0xc2, 0xf8, 0x66, 0x08, 0x19, 0x11,
+    0x99, 0x93, 0x51, 0xc5, 0xa2, 0x11, 0x70, 0x26, 0xa8, 0xb3, 0xa4, 0x2c,
+    0x5e, 0xa2, 0x16, 0xaf, 0x7d, 0x31, 0x82, 0x84, 0xdc, 0x17, 0xbe, 0x0d,
+    0x61, 0xd0, 0xe9, 0xa4, 0xf7, 0x86, 0xa2, 0x62, 0x26, 0x86, 0xd0, 0x01,
+    0x92, 0x6b, 0x39, 0x82, 0x94, 0x84, 0x21, 0x13, 0xe8, 0x53, 0xd7, 0x1e,
+    0xfb, 0x24, 0xb8, 0x8b, 0x95, 0xcc, 0x05, 0x9a, 0x5d, 0x11, 0xd5, 0x32,
+    0xfe, 0x9e, 0x8d, 0x30, 0x6a, 0x2e, 0x55, 0x45, 0x31, 0x5e, 0x9f, 0x19,
+    0x7f, 0x96, 0xde, 0x39, 0x2c, 0xbb, 0xe8, 0xd1, 0xde, 0x71, 0x11, 0x06,
+    0x32, 0xf8, 0x52, 0x85, 0x54, 0x39, 0xbe, 0xd4, 0x5a, 0x26, 0xe8, 0x50,
+    0x7a, 0x0f, 0x99, 0xe4, 0x2c, 0x84, 0x93, 0x5e, 0xaf, 0xb7, 0xb5, 0xbc,
+    0x3b, 0xb7, 0x0e, 0xa0, 0xd6, 0xde, 0x4e, 0xe3, 0x49, 0x14, 0x45, 0x95,
+    0xcf, 0x8e, 0x96, 0x29, 0xba, 0xf9, 0xbc, 0xe0, 0x6a, 0xfb, 0x5a, 0x20,
+    0x5f, 0xc8, 0xb2, 0x94, 0x13, 0xc4, 0x81, 0x09, 0x1b, 0xbd, 0xcf, 0x65,
+    0x70, 0x57, 0x8b, 0x6a, 0x80, 0x46, 0xbd, 0xe7, 0x87, 0x23, 0xdb, 0x3a,
+    0x5a, 0x19, 0xb3, 0x59, 0x31, 0xd1, 0x39, 0x21, 0x0d, 0xa4, 0x22, 0x9a,
+    0x49, 0x44, 0x4a, 0x48, 0x41, 0xb7, 0xc1, 0x28, 0x12, 0xb2, 0x3c, 0x1b,
+    0x82, 0x55, 0x69, 0x13, 0xb1, 0x2e, 0xf1, 0xf6, 0x25, 0x0f, 0x77, 0xf0,
+    0x96, 0x5e, 0x06, 0x32, 0xa4, 0xe8, 0x65, 0xdd, 0xf6, 0x49, 0xb7, 0xdb,
+    0xad, 0xc3, 0x8e, 0x0e, 0x5e, 0x58, 0xff, 0xf6, 0x0d, 0xf4, 0xb7, 0x06,
+    0xaa, 0x4c, 0x27, 0x52, 0xc8, 0x2c, 0x25, 0x01, 0x1d, 0xd5, 0xd0, 0x19,
+    0x0c, 0x8c, 0xcf, 0x0f, 0x8d, 0x9c, 0xa3, 0x99, 0x0a, 0x51, 0x4e, 0x23,
+    0x5d, 0x25, 0xf4, 0xa1, 0xc1, 0x19, 0x1e, 0x95, 0x10, 0x56, 0x58, 0x0f,
+    0x8a, 0xa3, 0x4c, 0x2b, 0x29, 0xe2, 0xc7, 0x70, 0x3f, 0x34, 0xbe, 0x49,
+    0x68, 0xc8, 0x08, 0xa4, 0x8a, 0x09, 0x2c, 0xda, 0xc7, 0xc5, 0x6b, 0x99,
+    0xb6, 0xc5, 0x5b, 0x96, 0x72, 0xad, 0x78, 0x3b, 0xb5, 0xca, 0x2d, 0x15,
+    0x96, 0x95, 0xbb, 0x07, 0xf4, 0x1e, 0x28, 0x96, 0x6f, 0x0b, 0x4a, 0x67,
+    0x57, 0x5d, 0xf8, 0xe9, 0x9d, 0xc3, 0x13, 0x47, 0x0b, 0x0d, 0x05, 0x64,
+    0x7b, 0x34, 0xac, 0x0c, 0x21, 0x9d, 0xd2, 0xf3, 0x5d, 0x79, 0x14, 0x49,
+    0xdc, 0x25, 0xc4, 0x4a, 0xee, 0xd5, 0x64, 0x10, 0x04, 0x8f, 0x7c, 0xa2,
+    0x94, 0x3e, 0xaa, 0x8d, 0x87, 0xc6, 0x43, 0x63, 0xec, 0x96, 0x2d, 0x3d,
+    0x76, 0xcb, 0x31, 0x63, 0x82, 0xc3, 0x47, 0xc8, 0x56, 0x60, 0x8f, 0x26,
+    0xcd, 0xca, 0x6c, 0xc4, 0x29, 0xe2, 0xfc, 0x63, 0x9e, 0x69, 0x16, 0x6d,
+    0x9c, 0x72, 0x74, 0x0c, 0x6d, 0x12, 0x1d, 0x9f, 0xea, 0x35, 0xa5, 0x62,
+    0x04, 0x84, 0xb3, 0x58, 0x38, 0x4c, 0xd3, 0x24, 0x1b, 0x1a, 0x0c, 0xa9,
+    0x1a, 0x99, 0xc1, 0xb1, 0xf4, 0xbe, 0x38, 0xa2, 0x60, 0xd5, 0x6d, 0x7b,
+    0x68, 0xde, 0x33, 0xc6, 0x73, 0xcc, 0xa8, 0x80, 0x80, 0x93, 0x2c, 0x9b,
+    0x34, 0x4d, 0x53, 0x54, 0xe1, 0x37, 0x41, 0x8a, 0x80, 0xb3, 0xe0, 0xce,
+    0xcc, 0x2a, 0x11, 0xca, 0x75, 0xdb, 0x92, 0x5b, 0x67, 0xcd, 0xe9, 0xbf,
+    0x7f, 0xfc, 0xfe, 0xf9, 0x9f, 0xbf, 0x7f, 0x85, 0xf7, 0x86, 0x30, 0x76,
+    0x0b, 0x1d, 0x26, 0x22, 0x8c, 0xc1, 0x98, 0xee, 0x4e, 0xbd, 0x36, 0xbc,
+    0xa2, 0x5a, 0x63, 0x36, 0x60, 0xa1, 0x89, 0xd2, 0x34, 0x44, 0x7b, 0x5d,
+    0x3c, 0x4b, 0xa7, 0xe3, 0x22, 0x19, 0xd3, 0xf7, 0x72, 0x4d, 0x15, 0xbc,
+    0x13, 0x43, 0x83, 0x88, 0xa5, 0xc0, 0x95, 0x14, 0x82, 0x06, 0x1a, 0xb4,
+    0x84, 0x8f, 0x8b, 0x4b, 0xe7, 0x0a, 0x52, 0xc3, 0xd3, 0x1e, 0xbb, 0xe9,
+    0x9e, 0xe4, 0x27, 0x76, 0xcd, 0x0e, 0x48, 0x65, 0x29, 0x0d, 0x58, 0xc4,
+    0x70, 0x76, 0xf2, 0x8d, 0x51, 0x71, 0xfa, 0x66, 0xf3, 0xc3, 0xfc, 0x1e,
+    0x21, 0xc3, 0x54, 0x9d, 0x02, 0x8b, 0x20, 0xcf, 0x8c, 0x3f, 0x21, 0x8d,
+    0x48, 0xce, 0x75, 0xa9, 0x15, 0x9d, 0xea, 0xb6, 0x61, 0x66, 0xc7, 0x30,
+    0xbc, 0x36, 0xe8, 0x45, 0x88, 0x6e, 0xe9, 0x6c, 0x6e, 0x96, 0x01, 0x67,
+    0x5b, 0xc3, 0x0b, 0x4a, 0x54, 0xb0, 0xac, 0x99, 0xbe, 0x95, 0x29, 0xdc,
+    0x60, 0xb7, 0x8c, 0x5d, 0xe4, 0xda, 0x63, 0xfd, 0x36, 0x0c, 0xa1, 0xf5,
+    0xf5, 0x59, 0x8d, 0xf7, 0x2d, 0x5d, 0xc3, 0x5c, 0x68, 0xb5, 0x71, 0x17,
+    0x01, 0x11, 0x4f, 0x25, 0x6e, 0x15, 0x16, 0x0f, 0x67, 0x99, 0x86, 0xd6,
+    0x0d, 0x7e, 0xd7, 0x45, 0xed, 0x51, 0x06, 0xcf, 0xe0, 0x66, 0xa3, 0x58,
+    0x90, 0x3d, 0x95, 0xfd, 0x40, 0x30, 0x41, 0x49, 0x4d, 0x62, 0xb1, 0xcc,
+    0x23, 0xac, 0x9e, 0xa7, 0x9c, 0xd7, 0x8c, 0x63, 0x8c, 0x35, 0xce, 0x57,
+    0x54, 0x28, 0xea, 0xce, 0x68, 0x40, 0xc2, 0x03, 0xec, 0x8b, 0x8d, 0x08,
+    0x6a, 0xcc, 0x1f, 0x68, 0xa4, 0x68, 0xb6, 0x84, 0xc5, 0xec, 0x29, 0xeb,
+    0x7c, 0x43, 0xf7, 0x90, 0x89, 0x63, 0x4e, 0xe1, 0x66, 0x5e, 0x71, 0xba,
+    0x16, 0x4c, 0x84, 0xb5, 0xd7, 0x86, 0x4f, 0xd4, 0x87, 0x6b, 0x4a, 0x74,
+    0x8e, 0xca, 0x4a, 0xa8, 0x97, 0x3d, 0xac, 0xaa, 0xdf, 0xfe, 0x44, 0x0b,
+    0x89, 0xd4, 0x14, 0x5a, 0xae, 0xaf, 0xe4, 0x3a, 0xa3, 0x67, 0x78, 0xdc,
+    0x9b, 0x62, 0xee, 0xaf, 0x73, 0xce, 0xed, 0xf2, 0x54, 0x92, 0x57, 0xa9,
+    0xb3, 0x22, 0x7f, 0x81, 0x81, 0x53, 0x60, 0x29, 0xb5, 0x5c, 0xdc, 0x9b,
+    0x62, 0x2b, 0x71, 0x89, 0xb9, 0x32, 0xdd, 0x6a, 0x88, 0x02, 0x13, 0x5f,
+    0x97, 0xfa, 0xe5, 0x33, 0x56, 0xcd, 0x8a, 0xaa, 0x0c, 0x85, 0x70, 0xee,
+    0xdf, 0x6d, 0x85, 0xca, 0x06, 0xc1, 0x8a, 0x5d, 0x4b, 0x75, 0xb7, 0xab,
+    0x91, 0x7e, 0x1b, 0xbe, 0x0d, 0x57, 0x44, 0x04, 0xdb, 0x42, 0x7e, 0x5c,
+    0x1b, 0x45, 0x6a, 0xea, 0x29, 0xd8, 0x18, 0x6e, 0xe0, 0x96, 0x0e, 0x91,
+    0x92, 0x09, 0xdc, 0x7c, 0xb8, 0xc2, 0x5e, 0x6c, 0x1f, 0xc8, 0x0a, 0x59,
+    0x49, 0x85, 0x2d, 0x5c, 0x97, 0x7f, 0x43, 0x62, 0xec, 0x66, 0x62, 0x20,
+    0xcc, 0x0e, 0x88, 0x5c, 0x62, 0x49, 0xe4, 0x69, 0x5d, 0xc0, 0x42, 0xf4,
+    0xdd, 0xe2, 0xdd, 0x5b, 0x98, 0xdf, 0x9b, 0xcb, 0x86, 0xfb, 0x3a, 0x31,
+    0x8f, 0x03, 0xb2, 0x0b, 0x8d, 0xdb, 0x29, 0xae, 0xa7, 0x6b, 0x46, 0x34,
+    0xf1, 0x49, 0x86, 0x68, 0xe1, 0x11, 0x7a, 0xcd, 0x04, 0x8c, 0x0d, 0x7a,
+    0x53, 0x37, 0xf4, 0xdd, 0xb1, 0x6b, 0x7f, 0xe2, 0x3a, 0xe1, 0xa1, 0x6d,
+    0xc7, 0x5a, 0x42, 0xcd, 0xd4, 0x2a, 0x87, 0xc7, 0x6e, 0x70, 0x94, 0x63,
+    0xac, 0xbe, 0x77, 0xfb, 0x9d, 0xda, 0x92, 0xb2, 0x94, 0x2f, 0xed, 0xf3,
+    0x62, 0x4d, 0x1b, 0x76, 0x3b, 0xc6, 0x7a, 0x95, 0x36, 0xbb, 0x58, 0xed,
+    0xb0, 0xab, 0xc6, 0x5c, 0x39, 0x5c, 0x8b, 0xe1, 0x6f, 0x77, 0x5d, 0xc6,
+    0x7e, 0xa2, 0xa8, 0xb9, 0xbf, 0xbb, 0xa9, 0xec, 0xae, 0x07, 0x76, 0xa5,
+    0x5a, 0x25, 0x5a, 0xe1, 0xa5, 0x27, 0x92, 0x0a, 0xa9, 0x79, 0x9a, 0x52,
+    0x15, 0x60, 0xe0, 0x78, 0xfb, 0xc1, 0x79, 0x85, 0xbe, 0x99, 0xe9, 0x6a,
+    0x97, 0x88, 0x67, 0x3d, 0x78, 0x4b, 0x56, 0x2c, 0xb6, 0x9b, 0xdc, 0x96,
+    0xc8, 0xc1, 0x31, 0x0d, 0xb1, 0x62, 0xb8, 0xbb, 0xcd, 0x37, 0x6e, 0xb5,
+    0x04, 0x69, 0x9a, 0x9a, 0xad, 0x92, 0x27, 0x02, 0x37, 0xb1, 0xa2, 0x29,
+    0x96, 0x7a, 0xeb, 0xc5, 0x39, 0x78, 0x91, 0xc2, 0xdb, 0x42, 0x4c, 0xd2,
+    0xf2, 0xb2, 0xd2, 0xdc, 0xcd, 0xdf, 0xed, 0xa8, 0xc5, 0xfb, 0x87, 0xb5,
+    0xd6, 0x5e, 0x2a, 0x1a, 0x4d, 0x4e, 0xdd, 0xd3, 0x2d, 0x9a, 0xf5, 0x00,
+    0x7b, 0x26, 0x96, 0xed, 0xba, 0x2b, 0x95, 0x3d, 0x3b, 0xf1, 0xba, 0x2f,
+    0x5e, 0x5e, 0xe0, 0xc5, 0x6f, 0x46, 0xb2, 0xa5, 0x2f, 0x71, 0x83, 0xd6,
+    0x66, 0xf3, 0xff, 0x19, 0x32, 0x6d, 0x72, 0xa4, 0xb1, 0x41, 0xb7, 0xff,
+    0x62, 0x54, 0xb5, 0xdf, 0x11, 0xa6, 0x8a, 0xd6, 0x3e, 0xde, 0x18, 0x5e,
+    0x62, 0x2f, 0xad, 0xe8, 0x11, 0xb6, 0x4c, 0x77, 0x1f, 0x6b, 0xa9, 0xdf,
+    0xef, 0x8f, 0xca, 0xf9, 0x70, 0x4c, 0x54, 0xb6, 0x21, 0x8f, 0xb5, 0xe5,
+    0xbd, 0xc4, 0x7b, 0x41, 0xd1, 0xcb, 0x47, 0xd8, 0x4a, 0xec, 0x98, 0x3a,
+    0x1a, 0x41, 0x0f, 0xe3, 0x2a, 0x26, 0xdc, 0x31, 0x81, 0x51, 0xa5, 0xa4,
+    0xca, 0x8e, 0x35, 0x76, 0x31, 0xc0, 0x74, 0xcd, 0xad, 0xe8, 0xd3, 0x1b,
+    0x42, 0xf5, 0x28, 0xaf, 0x3e, 0x6e, 0xf1, 0xbf, 0xeb, 0x3f, 0xd8, 0xe8,
+    0xd6, 0xbc, 0x8f, 0x0d, 0x00, 0x00,
+};
+
+// errors.html: 5490 bytes, 2089 gzipped
+static const uint8_t web_errors_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x58,
+    0xdd, 0x6e, 0xe3, 0xb8, 0x15, 0xbe, 0xcf, 0x53, 0x70, 0x9d, 0xe9, 0xca,
+    0x46, 0x23, 0x5b, 0x76, 0x32, 0x19, 0xaf, 0x6c, 0x79, 0x91, 0xc9, 0x24,
+    0x3b, 0xc1, 0xe6, 0x67, 0xe0, 0x78, 0xb0, 0x18, 0x2c, 0x16, 0x58, 0x5a,
+    0xa2, 0x2c, 0x6e, 0x64, 0x49, 0x20, 0xe9, 0x24, 0xae, 0xd7, 0x77, 0xed,
+    0x4d, 0x6f, 0x8a, 0xa2, 0x05, 0x7a, 0x53, 0xa0, 0xaf, 0xd1, 0xe7, 0xe9,
+    0x0b, 0xb4, 0x8f, 0xd0, 0x73, 0x48, 0x49, 0x96, 0x7f, 0x12, 0xd4, 0xbd,
+    0x48, 0xc4, 0x9f, 0xc3, 0xef, 0x1c, 0x9e, 0x7f, 0xba, 0xff, 0xd5, 0x87,
+    0xbb, 0xf3, 0xd1, 0x97, 0x4f, 0x17, 0x24, 0x52, 0xd3, 0x78, 0x70, 0xd0,
+    0x2f, 0x3e, 0x8c, 0x06, 0xf0, 0x99, 0x32, 0x45, 0x89, 0x1f, 0x51, 0x21,
+    0x99, 0xf2, 0x6a, 0x9f, 0x47, 0x97, 0x76, 0xb7, 0x56, 0x2c, 0x27, 0x74,
+    0xca, 0xbc, 0xda, 0x23, 0x67, 0x4f, 0x59, 0x2a, 0x54, 0x8d, 0xf8, 0x69,
+    0xa2, 0x58, 0x02, 0x64, 0x4f, 0x3c, 0x50, 0x91, 0x17, 0xb0, 0x47, 0xee,
+    0x33, 0x5b, 0x4f, 0x8e, 0x08, 0x4f, 0xb8, 0xe2, 0x34, 0xb6, 0xa5, 0x4f,
+    0x63, 0xe6, 0xb5, 0x11, 0x44, 0x71, 0x15, 0xb3, 0xc1, 0x85, 0x10, 0xa9,
+    0x20, 0x1f, 0xa8, 0x8c, 0xc6, 0x29, 0x15, 0x41, 0xbf, 0x65, 0x96, 0x0f,
+    0xfa, 0x52, 0xcd, 0xf1, 0xeb, 0x8a, 0x34, 0x55, 0x0b, 0xdb, 0x1e, 0x4f,
+    0xdc, 0x43, 0xc7, 0x71, 0x7a, 0xb6, 0xad, 0xd8, 0xb3, 0x72, 0x0f, 0x83,
+    0x20, 0x80, 0x31, 0xf5, 0x7d, 0x60, 0x89, 0x3b, 0x61, 0xd8, 0xed, 0xc2,
+    0x82, 0x0f, 0x18, 0xee, 0x61, 0xbb, 0xdd, 0x86, 0xf1, 0x13, 0x15, 0x89,
+    0x7b, 0x88, 0x1b, 0xfa, 0x1c, 0x43, 0x4e, 0x38, 0x77, 0x9c, 0x93, 0x93,
+    0xde, 0xf2, 0x60, 0x9c, 0x06, 0xf3, 0xc5, 0x94, 0x8a, 0x09, 0x4f, 0x5c,
+    0xa7, 0x97, 0xd1, 0x20, 0xe0, 0xc9, 0xc4, 0xed, 0x38, 0xd9, 0x73, 0x6f,
+    0x4c, 0xfd, 0x87, 0x89, 0x48, 0x67, 0x49, 0xe0, 0x3e, 0x52, 0x51, 0x47,
+    0xee, 0x8d, 0x9e, 0x9f, 0xc6, 0x70, 0xde, 0xcc, 0x51, 0x86, 0x46, 0x2f,
+    0x84, 0x1b, 0xdb, 0x21, 0x9d, 0xf2, 0x78, 0xee, 0x4a, 0x9a, 0x48, 0x5b,
+    0x32, 0xc1, 0x43, 0x80, 0x8e, 0xda, 0x8b, 0x2a, 0xb5, 0x91, 0xb2, 0xd1,
+    0x2b, 0x98, 0x11, 0x87, 0x20, 0x1b, 0xe2, 0x00, 0x69, 0x13, 0xd5, 0x46,
+    0x79, 0xc2, 0x04, 0xc8, 0xf2, 0x6c, 0xd4, 0xe5, 0xb6, 0x3b, 0x0e, 0x8a,
+    0x51, 0xd2, 0xd3, 0x99, 0x4a, 0x91, 0x56, 0x2a, 0xaa, 0xe4, 0x22, 0xe0,
+    0x32, 0x8b, 0xe9, 0xdc, 0x9d, 0x08, 0x1e, 0xf4, 0xf0, 0x1f, 0x88, 0x33,
+    0x85, 0x15, 0xc5, 0x6c, 0xe0, 0x3a, 0x9b, 0x26, 0xd2, 0x15, 0x2c, 0x63,
+    0x54, 0xd5, 0xf1, 0x9c, 0x1d, 0x72, 0x75, 0x34, 0xe5, 0x09, 0xa0, 0xd7,
+    0x35, 0xec, 0x51, 0x3b, 0x14, 0x8d, 0x46, 0x6f, 0x42, 0x33, 0xb7, 0xfd,
+    0xb6, 0xe4, 0x62, 0x8f, 0x53, 0xa5, 0xd2, 0xa9, 0x7b, 0x8c, 0x8c, 0x73,
+    0x56, 0x5a, 0x9b, 0x8b, 0x2d, 0x65, 0xe0, 0x6a, 0x63, 0x43, 0x61, 0xa9,
+    0x08, 0x98, 0xb0, 0x05, 0x0d, 0xf8, 0x4c, 0xba, 0xdd, 0x72, 0xc5, 0x6d,
+    0xc3, 0x35, 0x65, 0x1a, 0xf3, 0x80, 0x1c, 0x1e, 0x1f, 0x1f, 0xaf, 0x01,
+    0x93, 0xe8, 0x78, 0x51, 0xd1, 0x48, 0xdb, 0x68, 0x44, 0xeb, 0x54, 0xf2,
+    0xdf, 0x31, 0xb7, 0x7d, 0x02, 0x30, 0x46, 0x8d, 0x87, 0x5d, 0x30, 0xee,
+    0xda, 0xd9, 0xe6, 0x23, 0x8d, 0x67, 0x6c, 0xb1, 0xa2, 0xee, 0x20, 0x53,
+    0x3d, 0x7d, 0x62, 0x7c, 0x12, 0x29, 0x77, 0x9c, 0xc6, 0x41, 0x6f, 0x97,
+    0x15, 0xaa, 0x38, 0x4d, 0xf4, 0x91, 0x02, 0xac, 0x4a, 0x8c, 0xeb, 0x1b,
+    0xa4, 0xda, 0x7f, 0x76, 0xd1, 0xea, 0x8d, 0x46, 0x61, 0x4b, 0x91, 0xc6,
+    0x72, 0xb1, 0xae, 0x53, 0xad, 0xa2, 0xc2, 0x6a, 0x61, 0xcc, 0x9e, 0x8d,
+    0xf2, 0x71, 0x95, 0xc6, 0x7c, 0x92, 0xd8, 0x1c, 0x0c, 0x28, 0x5d, 0x14,
+    0x8f, 0x09, 0xf4, 0xcc, 0x19, 0x1c, 0x4b, 0xb6, 0x15, 0x5f, 0xdc, 0x20,
+    0x57, 0x0a, 0x86, 0x43, 0xae, 0xe6, 0x24, 0x4d, 0x58, 0x69, 0x11, 0xad,
+    0xc9, 0x1d, 0x66, 0x41, 0x63, 0xfb, 0x33, 0x21, 0xe1, 0x6c, 0x96, 0x72,
+    0xcd, 0x6b, 0x4b, 0x61, 0x05, 0x73, 0x37, 0x4a, 0x1f, 0xc1, 0x25, 0xd3,
+    0x8c, 0xfa, 0x5c, 0xcd, 0x5d, 0xa7, 0xd9, 0x2d, 0xb7, 0x9a, 0x01, 0x4d,
+    0x26, 0xb0, 0xb7, 0x25, 0xde, 0x4a, 0x0f, 0x7a, 0x64, 0x2b, 0x3a, 0x8e,
+    0xd9, 0x4b, 0xee, 0xb3, 0xed, 0x31, 0xc8, 0x30, 0x8c, 0xd3, 0x27, 0x37,
+    0xe2, 0x41, 0xc0, 0x92, 0x17, 0x3d, 0xc8, 0xc0, 0xe6, 0x81, 0xe2, 0x38,
+    0xbf, 0x29, 0xa0, 0x40, 0x2b, 0x31, 0xcd, 0x24, 0x73, 0x8b, 0x01, 0xd2,
+    0x46, 0x55, 0xfe, 0x87, 0x9d, 0x4e, 0x67, 0xa5, 0xa5, 0x0e, 0xf0, 0xc4,
+    0x38, 0xb6, 0xb5, 0x0d, 0xdc, 0x98, 0x85, 0xaa, 0xea, 0x7d, 0x9d, 0x75,
+    0xef, 0xd3, 0x94, 0x4a, 0x40, 0x94, 0x87, 0xa9, 0x98, 0xba, 0xb3, 0x2c,
+    0x63, 0xc2, 0xa7, 0x86, 0x49, 0xb0, 0x58, 0x03, 0xcd, 0xe5, 0x51, 0x69,
+    0xb6, 0xc3, 0xfd, 0xc7, 0x34, 0x98, 0xb0, 0x32, 0x84, 0x79, 0x12, 0x43,
+    0xe8, 0xdb, 0xe3, 0x38, 0xf5, 0x1f, 0x4a, 0xc9, 0xc0, 0xef, 0x49, 0x77,
+    0xcb, 0x7a, 0x27, 0x85, 0x7f, 0x1b, 0xf1, 0xda, 0xbb, 0xdc, 0xbd, 0xc0,
+    0x6f, 0xf2, 0x24, 0x4c, 0xd7, 0x6e, 0xee, 0x38, 0xdd, 0x6e, 0x18, 0x16,
+    0x17, 0x0a, 0xc3, 0x70, 0x45, 0x8b, 0xae, 0xbe, 0x6d, 0x25, 0x13, 0x00,
+    0x15, 0x4f, 0x2b, 0xe9, 0xb5, 0x71, 0x5f, 0xb4, 0xfe, 0x2e, 0x0e, 0x21,
+    0x55, 0x34, 0x5e, 0x13, 0x07, 0x93, 0xf0, 0x96, 0x38, 0x90, 0xc4, 0xd4,
+    0x7c, 0x51, 0x31, 0x49, 0x1e, 0x10, 0xa5, 0x5e, 0x9c, 0x95, 0x49, 0x4e,
+    0x4f, 0x4f, 0xe1, 0x48, 0xbf, 0x95, 0x57, 0x89, 0x7e, 0x2b, 0x2f, 0x58,
+    0x98, 0xd4, 0xe1, 0x13, 0xf0, 0x47, 0xe2, 0xc7, 0x54, 0x4a, 0xaf, 0x56,
+    0xe6, 0x57, 0xac, 0x39, 0x51, 0x7b, 0xf0, 0x9f, 0x7f, 0xfc, 0xe5, 0x8f,
+    0x64, 0xab, 0xea, 0xc0, 0xc6, 0xda, 0x29, 0x9d, 0x69, 0x6b, 0xdb, 0x6b,
+    0xda, 0x7b, 0x6b, 0x83, 0x7e, 0x74, 0x3c, 0xb8, 0x14, 0x8c, 0x91, 0x8f,
+    0x8c, 0x66, 0x70, 0xfa, 0x78, 0x50, 0x25, 0xd4, 0x29, 0xa2, 0x46, 0x78,
+    0xe0, 0xd5, 0x42, 0x20, 0x42, 0x9a, 0xda, 0xc0, 0xee, 0xb7, 0x80, 0x64,
+    0x60, 0xfe, 0xbf, 0x86, 0x7b, 0xc3, 0x13, 0xf2, 0x3f, 0x61, 0x43, 0x52,
+    0xdf, 0x13, 0xfa, 0x73, 0xa6, 0xf8, 0x94, 0xbd, 0x86, 0x39, 0xd3, 0x14,
+    0x7b, 0x40, 0x1a, 0x4d, 0x9e, 0x83, 0x59, 0xd5, 0x6b, 0xb8, 0xda, 0x3b,
+    0x34, 0xd5, 0x16, 0xf6, 0x36, 0x8b, 0x22, 0x8d, 0xa2, 0xfe, 0x4d, 0xce,
+    0x21, 0x69, 0xe2, 0xc7, 0xdc, 0x7f, 0xf0, 0x6a, 0x82, 0x81, 0x4a, 0x65,
+    0x54, 0x6f, 0xd4, 0xc0, 0x92, 0x7f, 0xfd, 0x3d, 0x19, 0x9a, 0x79, 0xbf,
+    0x65, 0x08, 0x77, 0x9c, 0xf0, 0x63, 0x46, 0x85, 0x16, 0x53, 0xc2, 0xa9,
+    0x82, 0x87, 0x49, 0x62, 0x08, 0xf2, 0xb7, 0x3f, 0xff, 0xfb, 0x9f, 0x7f,
+    0x22, 0xe7, 0x48, 0x65, 0xfc, 0x42, 0x56, 0xc0, 0x62, 0x3a, 0x66, 0xf1,
+    0xa0, 0xcf, 0x93, 0x6c, 0xa6, 0x88, 0x9a, 0x67, 0xd0, 0xf1, 0xf8, 0x11,
+    0xf3, 0x1f, 0xc6, 0xe9, 0xb3, 0xb9, 0x18, 0x96, 0xd8, 0x5c, 0x86, 0xda,
+    0x80, 0x9c, 0x61, 0xc1, 0xcd, 0x45, 0x24, 0xf5, 0xb7, 0xb2, 0xd1, 0x6f,
+    0x19, 0x84, 0x5d, 0xd7, 0xac, 0x64, 0x49, 0xdd, 0x0f, 0xe1, 0x60, 0xd0,
+    0x57, 0xda, 0x93, 0xfb, 0x4a, 0xe0, 0x52, 0x34, 0x18, 0x69, 0x83, 0xc1,
+    0x00, 0x27, 0xd7, 0xec, 0x91, 0xc5, 0xe5, 0xec, 0x1c, 0x2a, 0xfe, 0x24,
+    0x15, 0xf3, 0x72, 0xe1, 0x86, 0x49, 0x49, 0x27, 0x2b, 0xf2, 0x73, 0xec,
+    0xc8, 0x9e, 0x95, 0x9e, 0x83, 0x00, 0x00, 0x89, 0x43, 0x03, 0x8f, 0x81,
+    0xb2, 0xb2, 0xcc, 0xc8, 0x08, 0x01, 0xdb, 0x3a, 0x80, 0xe0, 0xab, 0x85,
+    0x29, 0xa5, 0xce, 0x88, 0x0e, 0x34, 0xaf, 0xb6, 0x1d, 0x9d, 0x79, 0xa9,
+    0xc3, 0x6c, 0xd7, 0xd9, 0x08, 0xd0, 0x8d, 0x6c, 0x5a, 0x1b, 0x5c, 0x53,
+    0xa9, 0xc8, 0x2c, 0x0b, 0x40, 0xf0, 0xc0, 0x25, 0x7d, 0x99, 0xd1, 0x44,
+    0xcb, 0x00, 0xfa, 0x50, 0x9f, 0xf5, 0xb2, 0xf6, 0x0e, 0x5c, 0x07, 0x19,
+    0xb2, 0x15, 0x7f, 0xe9, 0x0b, 0x9e, 0xa9, 0xc1, 0x01, 0x78, 0x06, 0x20,
+    0xc4, 0xa8, 0x06, 0xe9, 0xfd, 0x68, 0x5d, 0xdd, 0x5e, 0xde, 0x59, 0x47,
+    0xd6, 0x0f, 0x67, 0xc3, 0x5b, 0xf8, 0x5c, 0x0c, 0x87, 0x77, 0x43, 0xf8,
+    0x5e, 0x9e, 0x8d, 0xce, 0xae, 0xad, 0x9f, 0x7a, 0x39, 0xb5, 0x6f, 0xd4,
+    0xc4, 0x19, 0x9e, 0xb8, 0xbd, 0x18, 0xfd, 0x70, 0x37, 0xfc, 0x1e, 0xa8,
+    0xee, 0x47, 0x77, 0xc3, 0xb3, 0xef, 0x2e, 0x60, 0x74, 0xf6, 0xe9, 0x0a,
+    0xfe, 0x7f, 0x3a, 0x1b, 0xde, 0x5f, 0xdd, 0x7e, 0x07, 0xa3, 0x9b, 0x8b,
+    0x9b, 0xbb, 0xe1, 0x17, 0x18, 0x7c, 0x3c, 0x1b, 0x7e, 0x00, 0x6c, 0xa4,
+    0xb9, 0xff, 0x72, 0x3f, 0xba, 0xb8, 0x41, 0xd0, 0x98, 0x29, 0x52, 0x31,
+    0xfa, 0x15, 0x2a, 0x01, 0x1c, 0xdd, 0x4b, 0x66, 0x71, 0xdc, 0x3b, 0xa0,
+    0x72, 0x9e, 0xf8, 0x24, 0x9c, 0x25, 0xbe, 0xe2, 0xe0, 0x84, 0x71, 0x4a,
+    0x83, 0xc2, 0xf5, 0x16, 0xb9, 0x3c, 0x70, 0xca, 0xa3, 0x4f, 0x94, 0x2b,
+    0x12, 0x32, 0xe5, 0x47, 0x75, 0xab, 0x45, 0x33, 0xde, 0xd2, 0x66, 0x90,
+    0x56, 0xa3, 0x90, 0x1a, 0x94, 0x41, 0x73, 0x32, 0x38, 0xd0, 0xfc, 0x45,
+    0xa6, 0x49, 0x1d, 0x36, 0x83, 0xd4, 0x9f, 0x4d, 0x41, 0xf1, 0xcd, 0x09,
+    0x53, 0x17, 0x31, 0xc3, 0xe1, 0xfb, 0xf9, 0x55, 0x50, 0xb7, 0x8a, 0x44,
+    0x63, 0x35, 0x9a, 0x68, 0xa3, 0xf3, 0xbc, 0x19, 0xaf, 0x23, 0x4e, 0xb3,
+    0xd8, 0x6c, 0xb5, 0x9d, 0xce, 0x09, 0x10, 0xa4, 0x97, 0xfc, 0x99, 0x05,
+    0xf5, 0x76, 0xe3, 0xb7, 0xd6, 0xf7, 0xef, 0xad, 0x57, 0x50, 0xf3, 0x14,
+    0xb3, 0x13, 0x14, 0xf6, 0x2e, 0xff, 0x5f, 0x5c, 0x93, 0x66, 0x36, 0x60,
+    0x6f, 0xa8, 0x8a, 0x9a, 0xd0, 0x01, 0xa4, 0xc2, 0x30, 0x30, 0x44, 0xad,
+    0x53, 0x07, 0xe0, 0xa6, 0xaf, 0xa1, 0xad, 0x92, 0xcb, 0x06, 0xa2, 0x86,
+    0x31, 0x9a, 0x6d, 0xc6, 0x2c, 0x99, 0xa8, 0xa8, 0x50, 0xaf, 0xf6, 0x73,
+    0xef, 0x75, 0x44, 0x1d, 0x14, 0x68, 0x11, 0x1e, 0xd6, 0xb7, 0x91, 0x3c,
+    0xcf, 0x73, 0xc0, 0xa6, 0x1a, 0x08, 0xea, 0x2d, 0x14, 0x98, 0x8f, 0xa3,
+    0x9b, 0x6b, 0xcf, 0xc2, 0xc8, 0xed, 0xab, 0x00, 0x9e, 0x43, 0x31, 0xfa,
+    0xb1, 0xf7, 0x36, 0x0f, 0x77, 0x5d, 0xdd, 0x06, 0xb7, 0x29, 0x31, 0x28,
+    0xe0, 0x1a, 0x93, 0x09, 0x0b, 0xc8, 0xbf, 0xfe, 0xfe, 0x07, 0x88, 0xb6,
+    0x60, 0xa0, 0xc3, 0x13, 0x2e, 0xb9, 0x04, 0xcf, 0x66, 0xdb, 0xb0, 0x55,
+    0xfe, 0x53, 0x9a, 0xd5, 0x99, 0x37, 0x28, 0xfc, 0x09, 0x95, 0xe4, 0x25,
+    0xec, 0x09, 0xca, 0x99, 0x62, 0x75, 0xd6, 0xc4, 0x39, 0x24, 0xe9, 0x69,
+    0x86, 0x06, 0xb9, 0x4e, 0xf1, 0xc1, 0x85, 0x49, 0xe4, 0x5e, 0x09, 0x28,
+    0xa2, 0xf5, 0xd2, 0xc1, 0x74, 0x10, 0x79, 0x26, 0x94, 0x7e, 0x64, 0x4d,
+    0x3d, 0xf8, 0xe9, 0xd7, 0x5f, 0xad, 0x6f, 0xad, 0x4a, 0xe0, 0x78, 0xab,
+    0xe0, 0x01, 0x9a, 0x7c, 0x32, 0x5f, 0x27, 0xd3, 0x35, 0xde, 0x00, 0x69,
+    0x86, 0x4f, 0x4c, 0x9c, 0x43, 0x63, 0x84, 0x9c, 0x04, 0x53, 0x33, 0xe8,
+    0xaf, 0x7f, 0xce, 0x75, 0x32, 0x78, 0xb3, 0x40, 0xe1, 0x96, 0xe6, 0xc2,
+    0xf8, 0xa7, 0x33, 0x80, 0xd1, 0x8f, 0xa5, 0x71, 0xc8, 0x9b, 0x85, 0xfe,
+    0x2e, 0x2d, 0x20, 0xd6, 0x98, 0xcb, 0x32, 0x1f, 0xe4, 0x87, 0xde, 0x2c,
+    0x40, 0x8e, 0x65, 0x65, 0xca, 0x9a, 0x53, 0x93, 0xf8, 0xca, 0xc5, 0x3c,
+    0x5b, 0x59, 0x95, 0xfe, 0x6d, 0xbd, 0x75, 0xb2, 0xf4, 0x31, 0xdf, 0xe4,
+    0x47, 0xb8, 0x8d, 0x6d, 0x2d, 0x57, 0x56, 0xf8, 0x19, 0xac, 0xd0, 0x68,
+    0x0a, 0x60, 0x2e, 0xf0, 0x1a, 0xcd, 0x5f, 0xa0, 0x59, 0xae, 0x5b, 0xe8,
+    0x08, 0xcb, 0x97, 0x7d, 0x70, 0x95, 0xc2, 0x36, 0x7c, 0xb0, 0xb4, 0xcc,
+    0x4b, 0xe6, 0x58, 0x6e, 0x26, 0x8d, 0xb5, 0x82, 0xb5, 0x40, 0xef, 0xfb,
+    0x0a, 0x24, 0x0d, 0xb9, 0x98, 0xd6, 0x2d, 0x53, 0xa6, 0x68, 0x1c, 0x1b,
+    0x37, 0x42, 0x2f, 0x92, 0xdf, 0x5a, 0x8d, 0x86, 0xd1, 0x34, 0xe4, 0x9f,
+    0x17, 0x12, 0x4b, 0x4b, 0x83, 0x5a, 0x47, 0x0b, 0x78, 0xba, 0x47, 0x69,
+    0xe0, 0x5a, 0x9f, 0xee, 0xee, 0x47, 0xd6, 0x12, 0xd8, 0x57, 0x53, 0x14,
+    0x0a, 0x53, 0x8a, 0x51, 0x56, 0xda, 0xc5, 0x1a, 0xc9, 0x2b, 0x3a, 0xa8,
+    0xa4, 0x45, 0x50, 0x02, 0x74, 0x6d, 0x17, 0x8f, 0xb0, 0x77, 0xcd, 0x25,
+    0x28, 0x82, 0x89, 0xba, 0xe5, 0x47, 0x58, 0x74, 0xad, 0x23, 0xed, 0xbc,
+    0x70, 0x2d, 0xf0, 0x55, 0x28, 0x1e, 0x4c, 0x35, 0x75, 0x49, 0x65, 0x01,
+    0x5c, 0x76, 0x57, 0x66, 0x95, 0x4c, 0x15, 0xe3, 0xfa, 0x4a, 0x94, 0xa3,
+    0xb7, 0xd0, 0x95, 0x36, 0xca, 0x80, 0xd1, 0xf7, 0x2b, 0xc9, 0x76, 0xc0,
+    0x00, 0xe9, 0xcb, 0x69, 0x7b, 0x79, 0xb0, 0xad, 0x0a, 0xf0, 0xbb, 0xbc,
+    0xea, 0x54, 0x8b, 0x76, 0x92, 0xda, 0x19, 0x58, 0x4e, 0xd5, 0x8a, 0x8a,
+    0x58, 0xa9, 0x7f, 0x44, 0x77, 0xa8, 0xa4, 0xd2, 0xff, 0x93, 0x8d, 0x07,
+    0x00, 0xc9, 0x7b, 0x59, 0xb3, 0xa9, 0xeb, 0xa5, 0x6e, 0x4b, 0x8f, 0x5f,
+    0xae, 0xaf, 0xa4, 0xd2, 0x24, 0x93, 0x95, 0x17, 0x13, 0xfd, 0x3c, 0x26,
+    0xeb, 0x0f, 0x4d, 0xa2, 0x1f, 0xf4, 0x64, 0xe3, 0xad, 0x42, 0x56, 0x8f,
+    0x15, 0x88, 0x7a, 0x05, 0xa0, 0xb6, 0xc4, 0x77, 0x1d, 0xb4, 0xd4, 0x28,
+    0x1f, 0x48, 0x70, 0x4b, 0x1f, 0xf9, 0x84, 0xa2, 0xd5, 0x75, 0x0f, 0x67,
+    0x2e, 0x9c, 0x4b, 0x54, 0x3c, 0x55, 0x88, 0xfe, 0xb9, 0x81, 0xec, 0xfe,
+    0xbd, 0x81, 0xe4, 0x3f, 0x38, 0xbc, 0x3b, 0x22, 0xf8, 0xeb, 0x02, 0x90,
+    0x51, 0xbc, 0x7c, 0x71, 0xbf, 0xcd, 0x96, 0x0c, 0x9e, 0x3b, 0x9a, 0x5b,
+    0x33, 0x02, 0x27, 0xf3, 0xac, 0x96, 0x55, 0x6a, 0xb3, 0x7a, 0xc1, 0x63,
+    0xbc, 0x4b, 0xd1, 0xfc, 0x17, 0x60, 0x5f, 0x1f, 0xb6, 0x3b, 0xef, 0xbe,
+    0x39, 0xed, 0xf6, 0xaa, 0xdd, 0xfb, 0x8b, 0xbd, 0xdf, 0x26, 0x23, 0xe9,
+    0xd3, 0x64, 0x4f, 0x66, 0xdd, 0xce, 0xc9, 0xbb, 0x1e, 0xb9, 0x87, 0x83,
+    0xe0, 0xc3, 0x7b, 0xb0, 0x1a, 0x8b, 0xf4, 0x49, 0xb2, 0xfd, 0x99, 0xb5,
+    0x7b, 0xe4, 0xbd, 0x3e, 0xba, 0x07, 0x2f, 0x78, 0x44, 0x3e, 0xec, 0xcb,
+    0xe9, 0xe4, 0xe4, 0xa4, 0x07, 0x7d, 0x3b, 0x26, 0xb9, 0x7d, 0x6e, 0x05,
+    0x8f, 0xb8, 0x59, 0xb6, 0x2f, 0xaf, 0xf6, 0x37, 0x0e, 0xdc, 0x4a, 0x1f,
+    0xdd, 0x83, 0xd7, 0x94, 0x26, 0x33, 0x1a, 0xef, 0xad, 0xc1, 0x36, 0xdc,
+    0xeb, 0x46, 0x1f, 0xdd, 0xe7, 0x62, 0x79, 0xff, 0xb5, 0x27, 0xb3, 0xd3,
+    0x2e, 0x98, 0x6b, 0xeb, 0xd1, 0xb0, 0xfe, 0xb0, 0x69, 0xe5, 0x6f, 0xd2,
+    0x96, 0xf9, 0x69, 0xf5, 0xbf, 0xd1, 0xc3, 0xbb, 0x2f, 0x72, 0x15, 0x00,
+    0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+    {"/static/common.css", "text/css", web_common_css,
+     sizeof(web_common_css), "\"048d30b43c658f01\"", true},
+    {"/static/app.js", "application/javascript", web_app_js,
+     sizeof(web_app_js), "\"8885d9565253f2ba\"", true},
+    {"/", "text/html; charset=utf-8", web_index_html,
+     sizeof(web_index_html), "\"40306a53e3c2de6d\"", false},
+    {"/browse", "text/html; charset=utf-8", web_browse_html,
+     sizeof(web_browse_html), "\"a2282ff499865686\"", false},
+    {"/scan", "text/html; charset=utf-8", web_scan_html,
+     sizeof(web_scan_html), "\"fd0150f6dfa1c2d9\"", false},
+    {"/link", "text/html; charset=utf-8", web_link_html,
+     sizeof(web_link_html), "\"b6ea29ac1fe83eca\"", false},
+    {"/led-select", "text/html; charset=utf-8", web_led_select_html,
+     sizeof(web_led_select_html), "\"2df41e0d8bf54a29\"", false},
+    {"/backup", "text/html; charset=utf-8", web_backup_html,
+     sizeof(web_backup_html), "\"81705dd075279027\"", false},
+    {"/manual", "text/html; charset=utf-8", web_manual_html,
+     sizeof(web_manual_html), "\"b4ad42a2bccd3bee\"", false},
+    {"/errors", "text/html; charset=utf-8", web_errors_html,
+     sizeof(web_errors_html), "\"8b6257fd11299603\"", false},
+};
+#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))
+
+#endif // WEB_ASSETS_H
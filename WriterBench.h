@@ -0,0 +1,150 @@
+#ifndef WRITER_BENCH_H
+#define WRITER_BENCH_H
+
+#include "AppGlobals.h"
+#include "ChunkWriter.h"
+#include "LockProfiler.h"
+#include "mode_abstraction.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+// Builds the current library as JSON three ways and reports time per pass,
+// output size and the internal heap the result holds:
+//   string  - String concatenation with an escaper that returns a String
+//             (how the handlers built JSON before ChunkWriter)
+//   spool   - ChunkWriter into a PSRAM spool (/api/items, /api/changes)
+//   stream  - ChunkWriter straight to a sink (/api/export_backup)
+// Holds libraryMutex while it runs.
+class WriterBench {
+public:
+  static String run(int passes) {
+    passes = constrain(passes, 1, 20);
+    String log = "=== Library JSON: String vs ChunkWriter ===\n";
+
+    if (libraryMutex)
+      LOCK_TAKE(libraryMutex, portMAX_DELAY);
+    int items = getItemCount();
+    Result r[3];
+    switch (currentMode) {
+    case MODE_BOOK:
+      measure(bookLibrary, passes, r);
+      break;
+    case MODE_CD:
+      measure(cdLibrary, passes, r);
+      break;
+    default:
+      break;
+    }
+    if (libraryMutex)
+      LOCK_GIVE(libraryMutex);
+
+    static const char *names[3] = {"string", "spool ", "stream"};
+    log += String(items) + " items, " + String(passes) + " passes\n";
+    for (int i = 0; i < 3; i++) {
+      char line[128];
+      snprintf(line, sizeof(line),
+               "%s  %7lu us/pass  %6u bytes  holds %6d internal  "
+               "largest block after %u\n",
+               names[i], (unsigned long)r[i].usPerPass, (unsigned)r[i].bytes,
+               r[i].internalHeld, (unsigned)r[i].largestBlock);
+      log += line;
+      Serial.print("[BENCH] ");
+      Serial.print(line);
+    }
+    return log;
+  }
+
+private:
+  struct Result {
+    uint32_t usPerPass = 0;
+    size_t bytes = 0;
+    int internalHeld = 0; // Internal heap in use by the finished output
+    size_t largestBlock = 0;
+  };
+
+  // escapeJSON() as the handlers used it: a new String per value
+  static String escapeToString(const String &s) {
+    String out = "";
+    out.reserve(s.length() + 10);
+    for (unsigned int i = 0; i < s.length(); i++) {
+      char c = s[i];
+      if (c == '"')
+        out += "\\\"";
+      else if (c == '\\')
+        out += "\\\\";
+      else if (c == '\n')
+        out += "\\n";
+      else if ((unsigned char)c >= 0x20)
+        out += c;
+    }
+    return out;
+  }
+
+  template <typename T>
+  static void appendItemString(String &out, int id, const T &it) {
+    String item = "{\"id\":" + String(id);
+    item += ",\"title\":\"" + escapeToString(it.title.c_str()) + "\"";
+    item += ",\"artist\":\"" +
+            escapeToString(itemArtistField(it).c_str()) + "\"";
+    item += ",\"year\":" + String(it.year);
+    item += ",\"genre\":\"" + escapeToString(it.genre.c_str()) + "\"";
+    item += ",\"uniqueID\":\"" + escapeToString(it.uniqueID.c_str()) + "\"";
+    item += ",\"ledIndices\":[";
+    for (size_t k = 0; k < it.ledIndices.size(); k++)
+      item += (k ? "," : "") + String(it.ledIndices[k]);
+    item += "],\"barcode\":\"" +
+            escapeToString(itemCodeField(it).c_str()) + "\"";
+    item += ",\"notes\":\"" + escapeToString(it.notes.c_str()) + "\"";
+    item += String(",\"favorite\":") + (it.favorite ? "true" : "false");
+    item += "}";
+    if (out.length())
+      out += ",";
+    out += item;
+  }
+
+  template <typename V>
+  static void measure(const V &lib, int passes, Result r[3]) {
+    for (int variant = 0; variant < 3; variant++) {
+      int64_t elapsed = 0;
+      for (int p = 0; p < passes; p++) {
+        size_t freeBefore = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        int64_t start = esp_timer_get_time();
+        int held = 0;
+        if (variant == 0) {
+          String out;
+          for (int i = 0; i < (int)lib.size(); i++)
+            appendItemString(out, i, lib[i]);
+          elapsed += esp_timer_get_time() - start;
+          held = freeBefore - heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+          r[variant].bytes = out.length();
+        } else if (variant == 1) {
+          ChunkSpool spool;
+          {
+            ChunkWriter w(ChunkWriter::into(spool));
+            for (int i = 0; i < (int)lib.size(); i++)
+              writeItemJSON(w, i, lib[i], ITEM_FIELDS_ALL);
+          }
+          elapsed += esp_timer_get_time() - start;
+          held = freeBefore - heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+          r[variant].bytes = spool.size();
+        } else {
+          ChunkWriter w(ChunkWriter::discard());
+          for (int i = 0; i < (int)lib.size(); i++)
+            writeItemJSON(w, i, lib[i], ITEM_FIELDS_ALL);
+          w.flush();
+          elapsed += esp_timer_get_time() - start;
+          held = freeBefore - heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+          r[variant].bytes = w.bytesWritten();
+        }
+        if (held > r[variant].internalHeld)
+          r[variant].internalHeld = held;
+      }
+      r[variant].usPerPass = elapsed / passes;
+      r[variant].largestBlock = heap_caps_get_largest_free_block(
+          MALLOC_CAP_INTERNAL);
+    }
+  }
+};
+
+#endif // WRITER_BENCH_H
@@ -0,0 +1,139 @@
+"""Compiles the web UI in web/ into WebAssets.h.
+
+Each page and static file is gzip-compressed and embedded as a byte array
+in flash, with a strong ETag derived from its content. The firmware serves
+the bytes as they are (Content-Encoding: gzip), so nothing is built or
+compressed on the device.
+
+Pages may contain:
+  %INCLUDE:name%  replaced by web/name (shared markup such as the footer)
+  %ASSET:name%    replaced by /static/name?v=<hash>; the version changes
+                  with the content, so static files can be cached forever
+
+Run after editing anything in web/:  python embed_web_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+WEB_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "web")
+OUT_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                        "WebAssets.h")
+
+# Served under /static/, cached for a year (URLs carry the content hash)
+STATIC = ["common.css", "app.js"]
+
+# Route -> page. Revalidated on every load (ETag), so a new firmware's
+# pages show up at once.
+PAGES = [
+    ("/", "index.html"),
+    ("/browse", "browse.html"),
+    ("/scan", "scan.html"),
+    ("/link", "link.html"),
+    ("/led-select", "led-select.html"),
+    ("/backup", "backup.html"),
+    ("/manual", "manual.html"),
+    ("/errors", "errors.html"),
+]
+
+MIME = {
+    ".html": "text/html; charset=utf-8",
+    ".css": "text/css",
+    ".js": "application/javascript",
+}
+
+
+def read(name):
+    with open(os.path.join(WEB_DIR, name), encoding="utf-8") as f:
+        return f.read()
+
+
+def squeeze(text):
+    # Indentation and blank lines only; gzip handles the rest
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line) + "\n"
+
+
+def digest(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def c_name(name):
+    return "web_" + re.sub(r"[^A-Za-z0-9]", "_", name)
+
+
+def main():
+    assets = []  # (route, file, mime, immutable, raw bytes)
+    versions = {}
+
+    for name in STATIC:
+        raw = squeeze(read(name)).encode("utf-8")
+        versions[name] = digest(raw)[:8]
+        ext = os.path.splitext(name)[1]
+        assets.append(("/static/" + name, name, MIME[ext], True, raw))
+
+    def expand(match):
+        kind, name = match.group(1), match.group(2)
+        if kind == "INCLUDE":
+            return read(name)
+        if name not in versions:
+            raise SystemExit("unknown asset %s" % name)
+        return "/static/%s?v=%s" % (name, versions[name])
+
+    for route, name in PAGES:
+        text = read(name)
+        # Includes first: they may reference assets themselves
+        text = re.sub(r"%(INCLUDE):([\w.-]+)%", expand, text)
+        text = re.sub(r"%(ASSET):([\w.-]+)%", expand, text)
+        raw = squeeze(text).encode("utf-8")
+        assets.append((route, name, MIME[".html"], False, raw))
+
+    out = []
+    out.append("// Generated by embed_web_assets.py from web/. Edit those "
+               "files and re-run\n// the script instead of changing this "
+               "one.\n")
+    out.append("#ifndef WEB_ASSETS_H\n#define WEB_ASSETS_H\n\n")
+    out.append("#include <Arduino.h>\n\n")
+    out.append("struct WebAsset {\n")
+    out.append("  const char *path; // Route it is served at\n")
+    out.append("  const char *contentType;\n")
+    out.append("  const uint8_t *gzip;\n")
+    out.append("  size_t gzipLen;\n")
+    out.append("  const char *etag;\n")
+    out.append("  bool immutable; // URL is versioned: cache for good\n")
+    out.append("};\n\n")
+
+    total_raw = total_gz = 0
+    for route, name, mime, immutable, raw in assets:
+        gz = gzip.compress(raw, 9, mtime=0)
+        total_raw += len(raw)
+        total_gz += len(gz)
+        out.append("// %s: %d bytes, %d gzipped\n" % (name, len(raw),
+                                                        len(gz)))
+        out.append("static const uint8_t %s[] PROGMEM = {\n" % c_name(name))
+        for i in range(0, len(gz), 12):
+            row = ", ".join("0x%02x" % b for b in gz[i:i + 12])
+            out.append("    %s,\n" % row)
+        out.append("};\n\n")
+
+    out.append("static const WebAsset WEB_ASSETS[] = {\n")
+    for route, name, mime, immutable, raw in assets:
+        out.append("    {\"%s\", \"%s\", %s,\n"
+                   "     sizeof(%s), \"\\\"%s\\\"\", %s},\n"
+                   % (route, mime, c_name(name), c_name(name), digest(raw),
+                      "true" if immutable else "false"))
+    out.append("};\n")
+    out.append("#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / "
+               "sizeof(WEB_ASSETS[0]))\n\n")
+    out.append("#endif // WEB_ASSETS_H\n")
+
+    with open(OUT_FILE, "w", encoding="utf-8", newline="\n") as f:
+        f.write("".join(out))
+    print("%d assets, %d bytes -> %d gzipped" % (len(assets), total_raw,
+                                                   total_gz))
+
+
+if __name__ == "__main__":
+    main()
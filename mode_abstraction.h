@@ -11,7 +11,11 @@
 //
 // NOTE: Include this file AFTER all global declarations in DigitalLibrarian.ino
 //       It depends on: currentMode, bookLibrary, cdLibrary, Book, CD structs
+#include "ChunkWriter.h"
 #include "Core_Data.h"
+#include "CoverStore.h"
+#include "LibraryRevision.h"
+#include "LockProfiler.h"
 #include "Storage.h"
 
 //
@@ -21,7 +25,9 @@
 //
 
 #include "MediaManager.h"
+#include "Utils.h"
 #include <lvgl.h>
+#include <set>
 
 extern int currentCDIndex;
 extern int currentBookIndex;
@@ -216,7 +222,7 @@ inline int findItemIndex(String query) {
     return -1;
 
   if (libraryMutex)
-    xSemaphoreTakeRecursive(libraryMutex, portMAX_DELAY);
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
 
   int found = -1;
   switch (currentMode) {
@@ -243,7 +249,7 @@ inline int findItemIndex(String query) {
   }
 
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
 
   return found;
 }
@@ -251,7 +257,7 @@ inline int findItemIndex(String query) {
 // Get total item count for current mode
 inline int getItemCount() {
   if (libraryMutex)
-    xSemaphoreTakeRecursive(libraryMutex, portMAX_DELAY);
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
   int count = 0;
   switch (currentMode) {
   case MODE_BOOK:
@@ -268,7 +274,7 @@ inline int getItemCount() {
     break;
   }
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
   return count;
 }
 
@@ -293,7 +299,7 @@ inline void ensureItemDetailsLoaded(int index) {
 
       // 2. Lock
       if (libraryMutex)
-        xSemaphoreTakeRecursive(libraryMutex, portMAX_DELAY);
+        LOCK_TAKE(libraryMutex, portMAX_DELAY);
 
       // 3. Re-check state inside lock
       if (!cdLibrary[index].detailsLoaded) {
@@ -311,7 +317,7 @@ inline void ensureItemDetailsLoaded(int index) {
       }
 
       if (libraryMutex)
-        xSemaphoreGiveRecursive(libraryMutex);
+        LOCK_GIVE(libraryMutex);
     }
     break;
   default:
@@ -434,7 +440,7 @@ inline ItemView getItemAtRAM(int index) {
 inline ItemView getItemAtSD(int index) {
   ensureItemDetailsLoaded(index); // Ensure details are loaded on SD access
   if (libraryMutex)
-    xSemaphoreTakeRecursive(libraryMutex, portMAX_DELAY);
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
   ItemView view;
   view.isValid = false;
 
@@ -502,7 +508,7 @@ inline ItemView getItemAtSD(int index) {
   }
 
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
   return view;
 }
 
@@ -551,6 +557,7 @@ inline void setItem(int index, const ItemView &view) {
   default:
     break;
   }
+  LibraryRevision::recordUpsert(currentMode, view.uniqueID.c_str());
 }
 
 // --- Persistence Functions ---
@@ -561,6 +568,14 @@ inline void setItem(int index, const ItemView &view) {
 // Save current library (index) to SD
 inline bool saveLibrary() {
   auto &index = Storage.getIndex();
+  // Cover references follow the index entries. Edits made with setItem()
+  // reach the index only here, so the new entries take their references
+  // before the old ones are dropped (a cover both use never hits zero).
+  std::vector<String> oldCovers;
+  for (const auto &item : index) {
+    if (CoverStore::isStoreFile(item.coverFile.c_str()))
+      oldCovers.push_back(item.coverFile.c_str());
+  }
   index.clear();
 
   switch (currentMode) {
@@ -600,6 +615,10 @@ inline bool saveLibrary() {
     break;
   }
 
+  for (const auto &item : index)
+    CoverStore::retain(item.coverFile.c_str());
+  for (const String &file : oldCovers)
+    CoverStore::release(file);
   return Storage.rewriteIndex(currentMode);
 }
 
@@ -622,6 +641,9 @@ inline bool loadCurrentLibrary() {
 // Delete item at index
 inline bool deleteItemAt(int index) {
   bool success = false;
+  // Held across the RAM erase and its change-log entry
+  if (libraryMutex)
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
 
   switch (currentMode) {
   case MODE_BOOK:
@@ -637,6 +659,7 @@ inline bool deleteItemAt(int index) {
         // DigitalLibrarian.ino populates bookLibrary FROM Storage.index. We
         // should just reload/resync or manually erase.
         bookLibrary.erase(bookLibrary.begin() + index);
+        LibraryRevision::recordDelete(MODE_BOOK, uid.c_str(), index);
         success = true;
       }
     }
@@ -648,6 +671,7 @@ inline bool deleteItemAt(int index) {
       String uid = cdLibrary[index].uniqueID.c_str();
       if (Storage.deleteItem(uid, MODE_CD)) {
         cdLibrary.erase(cdLibrary.begin() + index);
+        LibraryRevision::recordDelete(MODE_CD, uid.c_str(), index);
         success = true;
       }
     }
@@ -657,6 +681,8 @@ inline bool deleteItemAt(int index) {
     break;
   }
 
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
   return success;
 }
 
@@ -669,6 +695,8 @@ inline bool toggleFavoriteAt(int index) {
     if (index >= 0 && index < bookLibrary.size()) {
       // Toggle RAM
       bookLibrary[index].favorite = !bookLibrary[index].favorite;
+      LibraryRevision::recordUpsert(MODE_BOOK,
+                                    bookLibrary[index].uniqueID.c_str());
       // Save deep storage
       // Note: We need full detail to save? Storage.saveBook requires a full
       // Book object. bookLibrary[index] only has Index data (plus maybe notes
@@ -685,6 +713,8 @@ inline bool toggleFavoriteAt(int index) {
   case MODE_CD:
     if (index >= 0 && index < cdLibrary.size()) {
       cdLibrary[index].favorite = !cdLibrary[index].favorite;
+      LibraryRevision::recordUpsert(MODE_CD,
+                                    cdLibrary[index].uniqueID.c_str());
       CD fullCD;
       if (Storage.loadCDDetail(cdLibrary[index].uniqueID.c_str(), fullCD)) {
         fullCD.favorite = cdLibrary[index].favorite;
@@ -729,7 +759,7 @@ inline std::vector<int> getItemLedIndices(int index) {
 
 inline void setItemID(int index, String newID) {
   if (libraryMutex)
-    xSemaphoreTakeRecursive(libraryMutex, portMAX_DELAY);
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
   switch (currentMode) {
   case MODE_BOOK:
     if (index >= 0 && index < (int)bookLibrary.size()) {
@@ -762,13 +792,14 @@ inline void setItemID(int index, String newID) {
   case MODE_ALL:
     break;
   }
+  LibraryRevision::recordUpsert(currentMode, newID.c_str());
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
 }
 
 inline void setItemCoverFile(int index, String filename) {
   if (libraryMutex)
-    xSemaphoreTakeRecursive(libraryMutex, portMAX_DELAY);
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
   switch (currentMode) {
   case MODE_BOOK:
     if (index >= 0 && index < (int)bookLibrary.size()) {
@@ -778,6 +809,7 @@ inline void setItemCoverFile(int index, String filename) {
       auto &vec = Storage.getVectorForMode(MODE_BOOK);
       for (auto &item : vec) {
         if (item.uniqueID == uid.c_str()) {
+          CoverStore::retarget(item.coverFile.c_str(), filename);
           item.coverFile = filename.c_str();
           break;
         }
@@ -792,6 +824,7 @@ inline void setItemCoverFile(int index, String filename) {
       auto &vec = Storage.getVectorForMode(MODE_CD);
       for (auto &item : vec) {
         if (item.uniqueID == uid.c_str()) {
+          CoverStore::retarget(item.coverFile.c_str(), filename);
           item.coverFile = filename.c_str();
           break;
         }
@@ -802,12 +835,12 @@ inline void setItemCoverFile(int index, String filename) {
     break;
   }
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
 }
 
 inline void setItemCoverUrl(int index, String url) {
   if (libraryMutex)
-    xSemaphoreTakeRecursive(libraryMutex, portMAX_DELAY);
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
   switch (currentMode) {
   case MODE_BOOK:
     if (index >= 0 && index < (int)bookLibrary.size()) {
@@ -823,14 +856,14 @@ inline void setItemCoverUrl(int index, String url) {
     break;
   }
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
 }
 
 // Get the next available LED index for the current mode
 inline int getNextLedIndex() {
   int nextLed = 0;
   if (libraryMutex) {
-    if (xSemaphoreTakeRecursive(libraryMutex, pdMS_TO_TICKS(1000)) != pdPASS) {
+    if (LOCK_TAKE(libraryMutex, pdMS_TO_TICKS(1000)) != pdPASS) {
       Serial.println("!!! LOCK FAIL: getNextLedIndex");
       return 0;
     }
@@ -862,14 +895,14 @@ inline int getNextLedIndex() {
       nextLed, (int)currentMode, maxExisting);
 
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
   return nextLed;
 }
 
 // Add a new item to the correct library
 inline void addItemToLibrary(const ItemView &item) {
   if (libraryMutex) {
-    if (xSemaphoreTakeRecursive(libraryMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
+    if (LOCK_TAKE(libraryMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
       Serial.println("!!! DEADLOCK: addItemToLibrary failed to get mutex");
       return;
     }
@@ -923,9 +956,10 @@ inline void addItemToLibrary(const ItemView &item) {
   default:
     break;
   }
+  LibraryRevision::recordUpsert(currentMode, item.uniqueID.c_str());
   Serial.println("addItem: Giving mutex");
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
 }
 
 // --- Metadata Fetching (Unified) ---
@@ -944,6 +978,81 @@ inline bool fetchModeMetadata(String code, ItemView &out) {
   }
 }
 
+// Index of the item whose barcode/ISBN is `code` in the current library, or -1
+inline int findItemByCode(const String &code) {
+  if (code.length() <= 3)
+    return -1;
+
+  if (libraryMutex)
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
+  int found = -1;
+  for (int i = 0; i < getItemCount(); i++) {
+    ItemView item = getItemAtRAM(i);
+    if (item.codecOrIsbn == code) {
+      found = i;
+      break;
+    }
+  }
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
+  return found;
+}
+
+// findItemByCode() that also reads the item under the same lock, so the
+// index can't go stale in between
+inline int findItemByCode(const String &code, ItemView &item) {
+  if (libraryMutex)
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
+  int found = findItemByCode(code);
+  if (found >= 0)
+    item = getItemAtRAM(found);
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
+  return found;
+}
+
+enum LookupAddResult { LOOKUP_NOT_FOUND, LOOKUP_ADDED, LOOKUP_DUPLICATE };
+
+// Looks `code` up and appends it to the current library as the selected item.
+// The lookup runs unlocked; the duplicate check, LED assignment, add and save
+// happen under one library lock so concurrent lookups can't add the same
+// code twice or claim the same LED. Unless `force`, an item already holding
+// `code` is returned in `out` as LOOKUP_DUPLICATE.
+inline LookupAddResult lookupAndAddItem(const String &code, ItemView &out,
+                                        bool force) {
+  // Skip the network when the code is already in; rechecked below
+  if (!force && findItemByCode(code, out) >= 0)
+    return LOOKUP_DUPLICATE;
+  if (!fetchModeMetadata(code, out))
+    return LOOKUP_NOT_FOUND;
+
+  // Assign Unique ID if not already set by fetcher
+  if (out.uniqueID.length() == 0) {
+    out.uniqueID = String(millis()) + "_" + String(random(9999));
+  }
+
+  if (libraryMutex && LOCK_TAKE(libraryMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
+    Serial.println("!!! LOCK FAIL: lookupAndAddItem");
+    return LOOKUP_NOT_FOUND;
+  }
+  // Added by another lookup while this one was fetching
+  if (!force && findItemByCode(code, out) >= 0) {
+    if (libraryMutex)
+      LOCK_GIVE(libraryMutex);
+    return LOOKUP_DUPLICATE;
+  }
+  // Assign LED (If not already set by metadata fetcher)
+  if (out.ledIndices.empty()) {
+    out.ledIndices.push_back(getNextLedIndex());
+  }
+  addItemToLibrary(out);
+  saveLibrary();
+  setCurrentItemIndex(getItemCount() - 1);
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
+  return LOOKUP_ADDED;
+}
+
 // Fetch cover URL for an item at index
 inline String fetchCoverUrlForIndex(int index) {
   ItemView item = getItemAtSD(index);
@@ -978,7 +1087,7 @@ inline String fetchCoverUrlForIndex(int index) {
 
 inline void clearCurrentLibrary() {
   if (libraryMutex)
-    xSemaphoreTakeRecursive(libraryMutex, portMAX_DELAY);
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
   switch (currentMode) {
   case MODE_BOOK:
     bookLibrary.clear();
@@ -989,20 +1098,22 @@ inline void clearCurrentLibrary() {
   default:
     break;
   }
+  LibraryRevision::recordReset(currentMode);
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
 }
 
 inline void syncLibraryFromStorage() {
   Serial.println("syncLibrary: Attempting lock...");
   if (libraryMutex) {
-    if (xSemaphoreTakeRecursive(libraryMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
+    if (LOCK_TAKE(libraryMutex, pdMS_TO_TICKS(5000)) != pdPASS) {
       Serial.println("!!! DEADLOCK: syncLibrary failed to get mutex");
       return;
     }
   }
   Serial.println("syncLibrary: Lock acquired.");
 
+  LibraryRevision::beginBulk(); // One reset instead of an upsert per item
   clearCurrentLibrary();
   for (auto &item : Storage.getIndex()) {
     ItemView view;
@@ -1032,9 +1143,10 @@ inline void syncLibraryFromStorage() {
 
     addItemToLibrary(view);
   }
+  LibraryRevision::endBulk(currentMode);
   Serial.println("syncLibrary: Giving mutex");
   if (libraryMutex)
-    xSemaphoreGiveRecursive(libraryMutex);
+    LOCK_GIVE(libraryMutex);
 }
 
 // --- Sorting Functions ---
@@ -1070,6 +1182,7 @@ inline void sortByArtistOrAuthor() {
     // Future: handle mixed mode sorting
     break;
   }
+  LibraryRevision::recordReset(currentMode); // Item positions moved
 }
 
 inline void sortByLedIndex() {
@@ -1095,6 +1208,492 @@ inline void sortByLedIndex() {
     // Future: handle mixed mode sorting
     break;
   }
+  LibraryRevision::recordReset(currentMode); // Item positions moved
+}
+
+// --- Web Item Pages (/api/items) ---
+
+#define ITEMS_PAGE_DEFAULT 50
+#define ITEMS_PAGE_MAX 100
+
+// Fields a client can pick with fields=title,artist,...; the library position
+// ("id") is always sent.
+enum ItemField : uint16_t {
+  ITEM_FIELD_TITLE = 1 << 0,
+  ITEM_FIELD_ARTIST = 1 << 1,
+  ITEM_FIELD_YEAR = 1 << 2,
+  ITEM_FIELD_GENRE = 1 << 3,
+  ITEM_FIELD_UNIQUE_ID = 1 << 4,
+  ITEM_FIELD_LEDS = 1 << 5,
+  ITEM_FIELD_CODE = 1 << 6,
+  ITEM_FIELD_NOTES = 1 << 7,
+  ITEM_FIELD_FAVORITE = 1 << 8,
+  ITEM_FIELD_COUNT = 9,
+  ITEM_FIELDS_ALL = (1 << 9) - 1
+};
+
+// JSON key of each ItemField bit
+inline const char *itemFieldName(int bit) {
+  static const char *names[ITEM_FIELD_COUNT] = {
+      "title",      "artist",  "year",  "genre",   "uniqueID",
+      "ledIndices", "barcode", "notes", "favorite"};
+  return (bit >= 0 && bit < ITEM_FIELD_COUNT) ? names[bit] : "";
+}
+
+// Unknown names are ignored; an empty (or all-unknown) list means all fields
+inline uint16_t parseItemFields(const String &list) {
+  uint16_t mask = 0;
+  int start = 0;
+  while (start < (int)list.length()) {
+    int comma = list.indexOf(',', start);
+    if (comma < 0)
+      comma = list.length();
+    String name = list.substring(start, comma);
+    name.trim();
+    for (int i = 0; i < ITEM_FIELD_COUNT; i++) {
+      if (name == itemFieldName(i))
+        mask |= 1 << i;
+    }
+    start = comma + 1;
+  }
+  return mask ? mask : ITEM_FIELDS_ALL;
+}
+
+struct ItemFilter {
+  String text;  // Lowercase; substring of title or artist/author
+  String genre; // Case-insensitive exact match
+  int decade = 0; // First year (1990 = the 90s), 0 = any
+  bool favoritesOnly = false;
+};
+
+struct ItemPage {
+  uint32_t rev = 0; // LibraryRevision the page was read at
+  int total = 0;    // Matches in the whole library
+  String next;      // Cursor of the following page, empty on the last one
+};
+
+inline const PsramString &itemArtistField(const CD &c) { return c.artist; }
+inline const PsramString &itemArtistField(const Book &b) { return b.author; }
+inline const PsramString &itemCodeField(const CD &c) { return c.barcode; }
+inline const PsramString &itemCodeField(const Book &b) { return b.isbn; }
+inline PsramString &itemArtistField(CD &c) { return c.artist; }
+inline PsramString &itemArtistField(Book &b) { return b.author; }
+inline PsramString &itemCodeField(CD &c) { return c.barcode; }
+inline PsramString &itemCodeField(Book &b) { return b.isbn; }
+
+template <typename T>
+inline bool itemMatchesFilter(const T &it, const ItemFilter &f) {
+  if (f.favoritesOnly && !it.favorite)
+    return false;
+  if (f.decade && (it.year < f.decade || it.year >= f.decade + 10))
+    return false;
+  if (f.genre.length() && strcasecmp(f.genre.c_str(), it.genre.c_str()) != 0)
+    return false;
+  if (f.text.length() &&
+      !containsIgnoreCase(it.title.c_str(), f.text.c_str()) &&
+      !containsIgnoreCase(itemArtistField(it).c_str(), f.text.c_str()))
+    return false;
+  return true;
+}
+
+// Writes one item as a JSON object, straight from the library entry
+template <typename T>
+inline void writeItemJSON(ChunkWriter &out, int id, const T &it,
+                          uint16_t fields) {
+  out.beginObject().key("id").number(id);
+  for (int bit = 0; bit < ITEM_FIELD_COUNT; bit++) {
+    if (!(fields & (1 << bit)))
+      continue;
+    out.key(itemFieldName(bit));
+    switch (1 << bit) {
+    case ITEM_FIELD_TITLE:
+      out.string(it.title.c_str());
+      break;
+    case ITEM_FIELD_ARTIST:
+      out.string(itemArtistField(it).c_str());
+      break;
+    case ITEM_FIELD_YEAR:
+      out.number(it.year);
+      break;
+    case ITEM_FIELD_GENRE:
+      out.string(it.genre.c_str());
+      break;
+    case ITEM_FIELD_UNIQUE_ID:
+      out.string(it.uniqueID.c_str());
+      break;
+    case ITEM_FIELD_LEDS:
+      out.beginArray();
+      for (size_t k = 0; k < it.ledIndices.size(); k++)
+        out.number(it.ledIndices[k]);
+      out.endArray();
+      break;
+    case ITEM_FIELD_CODE:
+      out.string(itemCodeField(it).c_str());
+      break;
+    case ITEM_FIELD_NOTES:
+      out.string(it.notes.c_str());
+      break;
+    case ITEM_FIELD_FAVORITE:
+      out.boolean(it.favorite);
+      break;
+    }
+  }
+  out.endObject();
+}
+
+// A cursor is "<position>:<uniqueID>" of the first item of the next page.
+// Anchoring on the id keeps paging in place while other items are edited,
+// added or removed. -1 if that item is gone (the client starts over).
+template <typename V>
+inline int resolveItemCursor(const V &lib, const String &cursor) {
+  if (cursor.length() == 0)
+    return 0;
+  int colon = cursor.indexOf(':');
+  if (colon < 0)
+    return -1;
+  int pos = cursor.substring(0, colon).toInt();
+  const char *uid = cursor.c_str() + colon + 1;
+  if (pos >= 0 && pos < (int)lib.size() &&
+      strcmp(lib[pos].uniqueID.c_str(), uid) == 0)
+    return pos;
+  for (int i = 0; i < (int)lib.size(); i++) {
+    if (strcmp(lib[i].uniqueID.c_str(), uid) == 0)
+      return i;
+  }
+  return -1;
+}
+
+template <typename V>
+inline bool buildItemPageFrom(const V &lib, const ItemFilter &f,
+                              const String &cursor, int limit,
+                              uint16_t fields, ChunkWriter &out,
+                              ItemPage &page) {
+  int start = resolveItemCursor(lib, cursor);
+  if (start < 0)
+    return false;
+  int emitted = 0;
+  for (int i = 0; i < (int)lib.size(); i++) {
+    if (!itemMatchesFilter(lib[i], f))
+      continue;
+    page.total++;
+    if (i < start)
+      continue;
+    if (emitted == limit) {
+      if (page.next.length() == 0)
+        page.next = String(i) + ":" + lib[i].uniqueID.c_str();
+      continue;
+    }
+    emitted++;
+    writeItemJSON(out, i, lib[i], fields);
+  }
+  return true;
+}
+
+// Writes the items of one page of the current library to `out` as
+// comma-separated JSON objects (no brackets). False if `cursor` is stale.
+// Runs under libraryMutex: `out` should spool rather than go to a client.
+inline bool buildItemPage(const ItemFilter &f, const String &cursor, int limit,
+                          uint16_t fields, ChunkWriter &out, ItemPage &page) {
+  if (libraryMutex)
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
+  page.rev = LibraryRevision::current();
+  bool ok = false;
+  switch (currentMode) {
+  case MODE_BOOK:
+    ok = buildItemPageFrom(bookLibrary, f, cursor, limit, fields, out, page);
+    break;
+  case MODE_CD:
+    ok = buildItemPageFrom(cdLibrary, f, cursor, limit, fields, out, page);
+    break;
+  default:
+    break;
+  }
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
+  return ok;
+}
+
+// Same, for the single item at position `id` (page.total is 0 if there is
+// none). Used by pages that edit one item.
+inline void buildItemByPosition(int id, uint16_t fields, ChunkWriter &out,
+                                ItemPage &page) {
+  if (libraryMutex)
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
+  page.rev = LibraryRevision::current();
+  if (id >= 0 && id < getItemCount()) {
+    page.total = 1;
+    if (currentMode == MODE_BOOK)
+      writeItemJSON(out, id, bookLibrary[id], fields);
+    else
+      writeItemJSON(out, id, cdLibrary[id], fields);
+  }
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
+}
+
+// --- Change Feed (/api/changes) ---
+
+template <typename V>
+inline int findItemByUniqueID(const V &lib, const char *uid) {
+  for (int i = 0; i < (int)lib.size(); i++) {
+    if (strcmp(lib[i].uniqueID.c_str(), uid) == 0)
+      return i;
+  }
+  return -1;
+}
+
+template <typename V>
+inline void writeChangesFrom(const V &lib,
+                             const std::vector<LibraryChange> &changes,
+                             ChunkWriter &out) {
+  // Deletes first, oldest first, with the position the item had then: a
+  // client applying them in order to its copy lines its ids up with ours
+  // (adds only ever append).
+  for (const LibraryChange &c : changes) {
+    if (c.op != CHANGE_DELETE)
+      continue;
+    out.beginObject().key("op").string("delete");
+    out.key("id").number(c.position);
+    out.key("uniqueID").string(c.uniqueID.c_str()).endObject();
+  }
+  // Then the current state of every item touched since, once each
+  std::set<PsramString> sent;
+  for (auto it = changes.rbegin(); it != changes.rend(); ++it) {
+    if (it->op != CHANGE_UPSERT || it->uniqueID.length() == 0 ||
+        !sent.insert(it->uniqueID).second)
+      continue;
+    int pos = findItemByUniqueID(lib, it->uniqueID.c_str());
+    if (pos < 0)
+      continue; // Deleted (or renamed) later
+    out.beginObject().key("op").string("upsert").key("item");
+    writeItemJSON(out, pos, lib[pos], ITEM_FIELDS_ALL);
+    out.endObject();
+  }
+}
+
+// Writes the changes to the current library after revision `since` to `out`
+// as comma-separated JSON objects. False if the client has to reload instead.
+// Runs under libraryMutex, like buildItemPage().
+inline bool buildChangesSince(uint32_t since, ChunkWriter &out,
+                              uint32_t &rev) {
+  std::vector<LibraryChange> changes;
+  if (libraryMutex)
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
+  bool ok = LibraryRevision::changesSince(since, currentMode, changes, rev);
+  if (ok) {
+    switch (currentMode) {
+    case MODE_BOOK:
+      writeChangesFrom(bookLibrary, changes, out);
+      break;
+    case MODE_CD:
+      writeChangesFrom(cdLibrary, changes, out);
+      break;
+    default:
+      break;
+    }
+  }
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
+  return ok;
+}
+
+// Distinct genres of the current library, sorted. Case-insensitive; the first
+// spelling seen wins.
+inline std::vector<String> getLibraryGenres() {
+  struct CaselessLess {
+    bool operator()(const char *a, const char *b) const {
+      return strcasecmp(a, b) < 0;
+    }
+  };
+  std::set<const char *, CaselessLess> seen;
+  std::vector<String> genres;
+
+  if (libraryMutex)
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
+  switch (currentMode) {
+  case MODE_BOOK:
+    for (const auto &b : bookLibrary)
+      if (b.genre.length() > 0)
+        seen.insert(b.genre.c_str());
+    break;
+  case MODE_CD:
+    for (const auto &c : cdLibrary)
+      if (c.genre.length() > 0)
+        seen.insert(c.genre.c_str());
+    break;
+  default:
+    break;
+  }
+  genres.reserve(seen.size());
+  for (const char *g : seen)
+    genres.push_back(g);
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
+  return genres;
+}
+
+// --- Batch Edits (/api/batch) ---
+
+#define BATCH_MAX_OPS 500
+
+enum BatchStatus {
+  BATCH_COMMITTED,
+  BATCH_INVALID,       // An op failed validation; nothing changed
+  BATCH_STORAGE_FAILED // Journal not written; nothing changed
+};
+
+struct BatchOpResult {
+  int id = -1;
+  String error; // Empty = valid
+};
+
+inline bool batchString(JsonVariantConst v, PsramString &out) {
+  if (!v.is<const char *>())
+    return false;
+  out = v.as<const char *>();
+  return true;
+}
+
+// Sets the fields of one "edit" op on a staged item. Keys as in /api/items.
+// Returns the error, empty if every field was valid.
+template <typename T>
+inline String applyBatchFields(T &it, JsonObjectConst op) {
+  for (JsonPairConst kv : op) {
+    const char *k = kv.key().c_str();
+    JsonVariantConst v = kv.value();
+    if (!strcmp(k, "op") || !strcmp(k, "id"))
+      continue;
+
+    bool ok = true;
+    if (!strcmp(k, "title")) {
+      ok = batchString(v, it.title);
+    } else if (!strcmp(k, "artist")) {
+      ok = batchString(v, itemArtistField(it));
+    } else if (!strcmp(k, "genre")) {
+      ok = batchString(v, it.genre);
+    } else if (!strcmp(k, "notes")) {
+      ok = batchString(v, it.notes);
+    } else if (!strcmp(k, "barcode")) {
+      ok = batchString(v, itemCodeField(it));
+    } else if (!strcmp(k, "uniqueID")) {
+      ok = batchString(v, it.uniqueID) && it.uniqueID.length() > 0;
+    } else if (!strcmp(k, "year")) {
+      ok = v.is<int>();
+      if (ok)
+        it.year = v.as<int>();
+    } else if (!strcmp(k, "favorite")) {
+      ok = v.is<bool>();
+      if (ok)
+        it.favorite = v.as<bool>();
+    } else if (!strcmp(k, "ledIndices")) {
+      JsonArrayConst leds = v.as<JsonArrayConst>();
+      ok = !leds.isNull();
+      for (JsonVariantConst led : leds)
+        ok = ok && led.is<int>() && led.as<int>() >= 0 &&
+             led.as<int>() < led_count;
+      if (ok) {
+        it.ledIndices.clear();
+        for (JsonVariantConst led : leds)
+          it.ledIndices.push_back(led.as<int>());
+        if (it.ledIndices.empty())
+          it.ledIndices.push_back(0); // As action=edit does
+      }
+    } else {
+      return String("unknown field ") + k;
+    }
+    if (!ok)
+      return String("invalid ") + k;
+  }
+  return "";
+}
+
+// Stages every op on a copy of the items it touches, then commits them all
+// through Storage::commitBatch() and updates the library. Several ops on one
+// item apply in order. `touched` gets the edited positions.
+template <typename V>
+inline BatchStatus applyBatchTo(V &lib, JsonArrayConst ops,
+                                std::vector<BatchOpResult> &results,
+                                String &error, std::vector<int> &touched) {
+  typedef typename V::value_type T;
+  std::vector<BatchEntry<T>> entries; // Parallel to `touched`
+  bool valid = true;
+
+  for (JsonVariantConst v : ops) {
+    BatchOpResult r;
+    JsonObjectConst op = v.as<JsonObjectConst>();
+    r.id = op["id"] | -1;
+    if (op.isNull()) {
+      r.error = "not an object";
+    } else if (strcmp(op["op"] | "edit", "edit") != 0) {
+      r.error = "unknown op";
+    } else if (!op["id"].is<int>() || r.id < 0 || r.id >= (int)lib.size()) {
+      r.error = "invalid id";
+    } else {
+      size_t e = 0;
+      while (e < touched.size() && touched[e] != r.id)
+        e++;
+      if (e == touched.size()) {
+        ensureItemDetailsLoaded(r.id); // The detail file is rewritten whole
+        BatchEntry<T> entry;
+        entry.item = lib[r.id];
+        entry.oldUniqueID = lib[r.id].uniqueID.c_str();
+        entries.push_back(entry);
+        touched.push_back(r.id);
+      }
+      r.error = applyBatchFields(entries[e].item, op);
+    }
+    valid = valid && r.error.length() == 0;
+    results.push_back(r);
+  }
+  if (!valid)
+    return BATCH_INVALID;
+
+  // A new uniqueID may not be in use, even by an item this batch renames:
+  // the detail files are written one by one
+  for (size_t e = 0; e < entries.size(); e++) {
+    const PsramString &uid = entries[e].item.uniqueID;
+    if (uid == entries[e].oldUniqueID.c_str())
+      continue;
+    bool taken = findItemByUniqueID(lib, uid.c_str()) >= 0;
+    for (size_t o = 0; o < entries.size() && !taken; o++)
+      taken = o != e && entries[o].item.uniqueID == uid;
+    if (taken) {
+      error = String("uniqueID in use: ") + uid.c_str();
+      return BATCH_INVALID;
+    }
+  }
+
+  if (!Storage.commitBatch(entries)) {
+    error = "could not write the batch journal";
+    return BATCH_STORAGE_FAILED;
+  }
+  for (size_t e = 0; e < entries.size(); e++)
+    lib[touched[e]] = entries[e].item;
+  return BATCH_COMMITTED;
+}
+
+// Applies a batch of edits to the current library as one transaction, under
+// libraryMutex: either every op is applied or none is.
+inline BatchStatus applyBatch(JsonArrayConst ops,
+                              std::vector<BatchOpResult> &results,
+                              String &error, std::vector<int> &touched) {
+  if (libraryMutex)
+    LOCK_TAKE(libraryMutex, portMAX_DELAY);
+  BatchStatus status = BATCH_INVALID;
+  switch (currentMode) {
+  case MODE_BOOK:
+    status = applyBatchTo(bookLibrary, ops, results, error, touched);
+    break;
+  case MODE_CD:
+    status = applyBatchTo(cdLibrary, ops, results, error, touched);
+    break;
+  default:
+    error = "no library in this mode";
+    break;
+  }
+  if (libraryMutex)
+    LOCK_GIVE(libraryMutex);
+  return status;
 }
 
 // --- Future Extension Template ---
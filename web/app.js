@@ -0,0 +1,28 @@
+// Shared by every page. The PIN comes from ?pin= (remembered) or from an
+// earlier visit; the APIs check it, the pages only decide what to show.
+const PIN = (function () {
+    const p = new URLSearchParams(location.search).get('pin');
+    if (p) localStorage.setItem('web_pin', p);
+    return localStorage.getItem('web_pin') || '';
+})();
+
+function sP() {
+    localStorage.setItem('web_pin', document.getElementById('pin').value);
+    location.reload();
+}
+
+// Shows the #login overlay until a PIN is known
+function requirePin() {
+    const el = document.getElementById('login');
+    if (el) el.style.display = PIN ? 'none' : 'flex';
+    return !!PIN;
+}
+
+// Labels of the current mode (CD/Book), see /api/config
+function loadConfig() {
+    return fetch('/api/config').then(r => r.json());
+}
+
+function esc(s) {
+    return String(s).replace(/[&<>"']/g, c => '&#' + c.charCodeAt(0) + ';');
+}